@@ -0,0 +1,152 @@
+/**
+ * Assembler Benchmarks.
+ *
+ * Each stage of the Lexer -> Parser -> Resolver -> Encoder pipeline on a
+ * generated 2000-line program, the pipeline end to end, and the
+ * single-pass StreamingAssembler on the same program. Items are source
+ * lines, so M/s reads as millions of lines per second.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bench.hpp"
+#include "Tools/Assembler/Encoder.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include "Tools/Assembler/StreamingAssembler.hpp"
+#include <algorithm>
+#include <sstream>
+#include <string>
+
+using namespace Aurelia;
+using namespace Aurelia::Tools::Assembler;
+
+namespace {
+
+constexpr std::size_t SourceLines = 2000;
+
+/**
+ * @brief A deterministic program mixing every operand form and branches.
+ *
+ * Branch targets stay within reach, so every stage runs to completion
+ * instead of stopping at the first out-of-range branch.
+ */
+std::string GenerateSource() {
+  static const char *const Templates[] = {
+      "ADD R{a}, R{b}, R{c}", "SUB R{a}, R{b}, R{c}",
+      "AND R{a}, R{b}, R{c}", "MOV R{a}, #{imm}",
+      "LDR R{a}, [R{b}, #{off}]", "STR R{a}, [R{b}, #{off}]",
+      "CMP R{a}, R{b}",       "BNE label{label}",
+  };
+
+  Bench::Rng rng(16);
+  std::string source = "; Generated benchmark program\n";
+  for (std::size_t line = 0; line < SourceLines; ++line) {
+    if (line % 16 == 0) {
+      source += "label" + std::to_string(line / 16) + ":\n";
+    }
+    std::string text = Templates[rng.Next() % std::size(Templates)];
+    auto replace = [&text](const std::string &key, std::uint64_t value) {
+      std::size_t at = text.find(key);
+      if (at != std::string::npos) {
+        text.replace(at, key.size(), std::to_string(value));
+      }
+    };
+    replace("{a}", rng.Next() % 16);
+    replace("{b}", rng.Next() % 16);
+    replace("{c}", rng.Next() % 16);
+    replace("{imm}", rng.Next() % 2048);
+    replace("{off}", (rng.Next() % 64) * 8);
+    // A label within three either side keeps every branch in range
+    std::uint64_t here = line / 16;
+    std::uint64_t target = here + rng.Next() % 7;
+    replace("{label}",
+            std::clamp<std::uint64_t>(target, 3, SourceLines / 16 + 2) - 3);
+    source += "  " + text + "  ; comment\n";
+  }
+  source += "HALT\n";
+  return source;
+}
+
+} // namespace
+
+AURELIA_BENCHMARK("Asm/Lexer") {
+  std::string source = GenerateSource();
+  state.SetItemsPerOp(SourceLines);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      Lexer lexer(source);
+      Bench::DoNotOptimize(lexer.Tokenize());
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Asm/Parser") {
+  std::string source = GenerateSource();
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+
+  state.SetItemsPerOp(SourceLines);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      Parser parser(tokens);
+      Bench::DoNotOptimize(parser.Parse());
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Asm/ResolveEncode") {
+  std::string source = GenerateSource();
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+  Parser parser(tokens);
+  if (!parser.Parse()) {
+    state.SkipWithError(parser.GetErrorMessage());
+    return;
+  }
+
+  // Resolve rewrites operands in place, so each pass needs a fresh copy
+  state.SetItemsPerOp(SourceLines);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      auto instructions = parser.GetInstructions();
+      Resolver resolver(instructions, parser.GetLabels());
+      Encoder encoder(instructions);
+      Bench::DoNotOptimize(resolver.Resolve() && encoder.Encode());
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Asm/Pipeline") {
+  std::string source = GenerateSource();
+  state.SetItemsPerOp(SourceLines);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      Lexer lexer(source);
+      auto tokens = lexer.Tokenize();
+      Parser parser(tokens);
+      bool ok = parser.Parse();
+      auto instructions = parser.GetInstructions();
+      Resolver resolver(instructions, parser.GetLabels());
+      Encoder encoder(instructions);
+      ok = ok && resolver.Resolve() && encoder.Encode();
+      Bench::DoNotOptimize(ok);
+      Bench::DoNotOptimize(encoder.GetBinary().size());
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Asm/Stream") {
+  std::string source = GenerateSource();
+  state.SetItemsPerOp(SourceLines);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      std::istringstream in(source);
+      StreamingAssembler assembler;
+      Bench::DoNotOptimize(assembler.Assemble(in));
+      Bench::DoNotOptimize(assembler.GetText().size());
+    }
+  });
+}
@@ -0,0 +1,322 @@
+/**
+ * Aurelia Micro-Benchmark Harness Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bench.hpp"
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <iomanip>
+#include <ostream>
+
+namespace Aurelia::Bench {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Entry {
+  std::string Name;
+  Function Body;
+};
+
+// Function-local so registration order across translation units is safe
+std::vector<Entry> &Registry() {
+  static std::vector<Entry> registry;
+  return registry;
+}
+
+double TimeBatch(const State::Body &body, std::uint64_t iterations) {
+  auto start = Clock::now();
+  body(iterations);
+  ClobberMemory();
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+std::string Escape(std::string_view text) {
+  std::string out;
+  for (char c : text) {
+    if (c == '"' || c == '\\') {
+      out += '\\';
+    }
+    out += c;
+  }
+  return out;
+}
+
+/**
+ * @brief Find `"key":` after `from` and return the text after the colon.
+ */
+std::size_t FindKey(std::string_view text, std::string_view key,
+                    std::size_t from) {
+  std::string quoted(1, '"');
+  quoted.append(key).push_back('"');
+  std::size_t at = text.find(quoted, from);
+  if (at == std::string_view::npos) {
+    return at;
+  }
+  at = text.find(':', at + quoted.size());
+  if (at == std::string_view::npos) {
+    return at;
+  }
+  return text.find_first_not_of(" \t\r\n", at + 1);
+}
+
+} // namespace
+
+// ============================================================================
+// Measurement
+// ============================================================================
+
+void State::Measure(const Body &body) {
+  // Calibrate: grow the batch until it is long enough to time reliably
+  std::uint64_t iterations = 1;
+  for (;;) {
+    double seconds = TimeBatch(body, iterations);
+    if (seconds >= m_Options.MinSampleSeconds || iterations >= (1ull << 40)) {
+      break;
+    }
+    double scale = seconds > 0.0 ? m_Options.MinSampleSeconds / seconds : 10.0;
+    scale = std::clamp(scale * 1.2, 2.0, 10.0);
+    iterations = static_cast<std::uint64_t>(
+        static_cast<double>(iterations) * scale);
+  }
+
+  std::vector<double> samples;
+  samples.reserve(m_Options.Samples);
+  for (std::uint32_t i = 0; i < m_Options.Samples; ++i) {
+    samples.push_back(TimeBatch(body, iterations) * 1e9 /
+                      static_cast<double>(iterations));
+  }
+  std::sort(samples.begin(), samples.end());
+
+  double mean = 0.0;
+  for (double sample : samples) {
+    mean += sample;
+  }
+  mean /= static_cast<double>(samples.size());
+  double variance = 0.0;
+  for (double sample : samples) {
+    variance += (sample - mean) * (sample - mean);
+  }
+  variance /= static_cast<double>(samples.size());
+
+  std::size_t mid = samples.size() / 2;
+  m_Result.NsPerOp = samples.size() % 2 != 0
+                         ? samples[mid]
+                         : (samples[mid - 1] + samples[mid]) / 2.0;
+  m_Result.MinNs = samples.front();
+  m_Result.MaxNs = samples.back();
+  m_Result.StdDevNs = std::sqrt(variance);
+  m_Result.Iterations = iterations;
+  m_Result.Samples = static_cast<std::uint32_t>(samples.size());
+}
+
+// ============================================================================
+// Registry and Runner
+// ============================================================================
+
+Registration::Registration(const char *name, Function function) {
+  Registry().push_back({name, function});
+}
+
+std::vector<std::string> ListBenchmarks() {
+  std::vector<std::string> names;
+  for (const Entry &entry : Registry()) {
+    names.push_back(entry.Name);
+  }
+  std::sort(names.begin(), names.end());
+  return names;
+}
+
+std::vector<Result> RunBenchmarks(const Options &options,
+                                  std::ostream &progress) {
+  std::vector<Entry> entries = Registry();
+  std::sort(entries.begin(), entries.end(),
+            [](const Entry &a, const Entry &b) { return a.Name < b.Name; });
+
+  std::vector<Result> results;
+  for (const Entry &entry : entries) {
+    if (!options.Filter.empty() &&
+        entry.Name.find(options.Filter) == std::string::npos) {
+      continue;
+    }
+
+    Options sampled = options;
+    sampled.Samples = std::max<std::uint32_t>(options.Samples, 1);
+    State state(sampled);
+    entry.Body(state);
+    Result result = state.GetResult();
+    result.Name = entry.Name;
+    if (result.Error.empty() && result.Samples == 0) {
+      result.Error = "Benchmark never called Measure()";
+    }
+
+    progress << std::left << std::setw(28) << result.Name;
+    if (!result.Error.empty()) {
+      progress << "ERROR: " << result.Error << "\n";
+    } else {
+      progress << std::right << std::fixed << std::setprecision(2)
+               << std::setw(12) << result.NsPerOp << " ns/op  ±"
+               << std::setw(5) << std::setprecision(1)
+               << (result.NsPerOp > 0.0
+                       ? result.StdDevNs / result.NsPerOp * 100.0
+                       : 0.0)
+               << "%";
+      if (result.BytesPerOp != 0) {
+        progress << std::setw(10) << std::setprecision(1)
+                 << static_cast<double>(result.BytesPerOp) /
+                        result.NsPerOp * 1e9 / (1024.0 * 1024.0)
+                 << " MiB/s";
+      } else if (result.ItemsPerOp != 0) {
+        progress << std::setw(10) << std::setprecision(1)
+                 << static_cast<double>(result.ItemsPerOp) /
+                        result.NsPerOp * 1e3
+                 << " M/s";
+      }
+      progress << "\n";
+    }
+    progress.flush();
+    results.push_back(std::move(result));
+  }
+  return results;
+}
+
+// ============================================================================
+// JSON
+// ============================================================================
+
+void WriteJson(const std::vector<Result> &results, const Options &options,
+               std::string_view tag, std::ostream &out) {
+  out << "{\n"
+      << "  \"schema\": 1,\n"
+      << "  \"tag\": \"" << Escape(tag) << "\",\n"
+      << "  \"timestamp\": " << std::time(nullptr) << ",\n"
+#if defined(__VERSION__)
+      << "  \"compiler\": \"" << Escape(__VERSION__) << "\",\n"
+#endif
+#if defined(__OPTIMIZE__)
+      << "  \"optimized\": true,\n"
+#else
+      << "  \"optimized\": false,\n"
+#endif
+      << "  \"samples\": " << options.Samples << ",\n"
+      << "  \"min_sample_seconds\": " << options.MinSampleSeconds << ",\n"
+      << "  \"benchmarks\": [";
+
+  out << std::setprecision(4) << std::fixed;
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const Result &r = results[i];
+    out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << Escape(r.Name)
+        << "\"";
+    if (!r.Error.empty()) {
+      out << ", \"error\": \"" << Escape(r.Error) << "\"}";
+      continue;
+    }
+    out << ", \"ns_per_op\": " << r.NsPerOp << ", \"min_ns\": " << r.MinNs
+        << ", \"max_ns\": " << r.MaxNs << ", \"stddev_ns\": " << r.StdDevNs
+        << ", \"iterations\": " << r.Iterations
+        << ", \"samples\": " << r.Samples;
+    if (r.BytesPerOp != 0) {
+      out << ", \"bytes_per_op\": " << r.BytesPerOp;
+    }
+    if (r.ItemsPerOp != 0) {
+      out << ", \"items_per_op\": " << r.ItemsPerOp;
+    }
+    out << "}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+bool ReadJson(std::string_view text, std::vector<Result> &results,
+              std::string &error) {
+  // Reads back exactly what WriteJson() writes: one object per benchmark
+  std::size_t list = FindKey(text, "benchmarks", 0);
+  if (FindKey(text, "schema", 0) == std::string_view::npos ||
+      list == std::string_view::npos || text[list] != '[') {
+    error = "Not a benchmark results file";
+    return false;
+  }
+
+  std::size_t at = list;
+  while ((at = FindKey(text, "name", at)) != std::string_view::npos) {
+    if (text[at] != '"') {
+      error = "Malformed benchmark name";
+      return false;
+    }
+    std::size_t end = text.find('"', at + 1);
+    std::size_t close = text.find('}', at);
+    if (end == std::string_view::npos || close == std::string_view::npos) {
+      error = "Truncated benchmark entry";
+      return false;
+    }
+
+    Result result;
+    result.Name = std::string(text.substr(at + 1, end - at - 1));
+    std::size_t value = FindKey(text, "ns_per_op", end);
+    if (value != std::string_view::npos && value < close) {
+      auto [ptr, ec] = std::from_chars(text.data() + value,
+                                       text.data() + close, result.NsPerOp);
+      if (ec != std::errc{}) {
+        error = "Bad ns_per_op for " + result.Name;
+        return false;
+      }
+    } else {
+      result.Error = "No result";
+    }
+    results.push_back(std::move(result));
+    at = close;
+  }
+  return true;
+}
+
+std::size_t Compare(const std::vector<Result> &current,
+                    const std::vector<Result> &baseline, double threshold,
+                    std::ostream &out) {
+  std::size_t regressions = 0;
+  out << std::left << std::setw(28) << "Benchmark" << std::right
+      << std::setw(14) << "Baseline" << std::setw(14) << "Current"
+      << std::setw(10) << "Change"
+      << "\n";
+
+  for (const Result &now : current) {
+    auto base = std::find_if(
+        baseline.begin(), baseline.end(),
+        [&now](const Result &r) { return r.Name == now.Name; });
+
+    out << std::left << std::setw(28) << now.Name << std::right
+        << std::fixed << std::setprecision(2);
+    if (!now.Error.empty()) {
+      out << std::setw(28) << "ERROR\n";
+      ++regressions; // A benchmark that stopped working is a regression
+      continue;
+    }
+    if (base == baseline.end() || !base->Error.empty() ||
+        base->NsPerOp <= 0.0) {
+      out << std::setw(14) << "-" << std::setw(14) << now.NsPerOp
+          << std::setw(10) << "new\n";
+      continue;
+    }
+
+    double change = now.NsPerOp / base->NsPerOp - 1.0;
+    out << std::fixed << std::setprecision(2) << std::setw(14)
+        << base->NsPerOp << std::setw(14) << now.NsPerOp << std::setw(9)
+        << std::showpos << std::setprecision(1) << change * 100.0
+        << std::noshowpos << "%";
+    if (change > threshold) {
+      out << "  REGRESSION";
+      ++regressions;
+    } else if (change < -threshold) {
+      out << "  faster";
+    }
+    out << "\n";
+  }
+  return regressions;
+}
+
+} // namespace Aurelia::Bench
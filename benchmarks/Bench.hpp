@@ -0,0 +1,218 @@
+/**
+ * Aurelia Micro-Benchmark Harness.
+ *
+ * A small, dependency-free harness for timing the simulator's hot paths
+ * (decoder, ALU, bus, RAM, NAND, FTL, assembler) reproducibly enough to
+ * catch per-commit regressions.
+ *
+ * WRITING A BENCHMARK:
+ *   AURELIA_BENCHMARK("Cpu/Decode") {
+ *     auto words = MakeInput();              // Setup: not timed
+ *     state.SetItemsPerOp(words.size());
+ *     state.Measure([&](std::uint64_t n) {   // Timed
+ *       for (std::uint64_t i = 0; i < n; ++i) {
+ *         Bench::DoNotOptimize(Decode(words[i % words.size()]));
+ *       }
+ *     });
+ *   }
+ *
+ * The body passed to Measure() runs `n` operations; the harness picks n.
+ *
+ * MEASUREMENT:
+ * ┌─────────────┬──────────────────────────────────────────────────────┐
+ * │ Phase       │ What happens                                         │
+ * ├─────────────┼──────────────────────────────────────────────────────┤
+ * │ Calibrate   │ Grow n until one batch takes at least MinSampleTime; │
+ * │             │ doubles as warm-up (caches, page faults, branch      │
+ * │             │ predictors)                                          │
+ * │ Sample      │ Time `Samples` batches of n operations               │
+ * │ Report      │ Median ns/op (robust to a noisy sample), plus min,   │
+ * │             │ max and standard deviation                           │
+ * └─────────────┴──────────────────────────────────────────────────────┘
+ * Inputs come from Bench::Rng with fixed seeds, so every run times the
+ * same work.
+ *
+ * BASELINES:
+ * WriteJson() records every result; Compare() reads a stored file back
+ * and flags any benchmark whose median got slower than the threshold.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Aurelia::Bench {
+
+// ============================================================================
+// Optimisation Barriers
+// ============================================================================
+
+/**
+ * @brief Force `value` to be computed, without storing it anywhere.
+ */
+template <typename T> inline void DoNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  const volatile T *sink = &value;
+  (void)sink;
+#endif
+}
+
+/**
+ * @brief Force pending memory writes to be treated as observed.
+ */
+inline void ClobberMemory() {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : : "memory");
+#endif
+}
+
+/**
+ * Deterministic xorshift64 generator for benchmark inputs.
+ */
+class Rng {
+public:
+  explicit Rng(std::uint64_t seed) : m_State(seed | 1) {}
+
+  std::uint64_t Next() {
+    m_State ^= m_State << 13;
+    m_State ^= m_State >> 7;
+    m_State ^= m_State << 17;
+    return m_State;
+  }
+
+private:
+  std::uint64_t m_State;
+};
+
+// ============================================================================
+// Results and Options
+// ============================================================================
+
+struct Result {
+  std::string Name;
+  double NsPerOp = 0.0; // Median over samples
+  double MinNs = 0.0;
+  double MaxNs = 0.0;
+  double StdDevNs = 0.0;
+  std::uint64_t Iterations = 0; // Operations per sample
+  std::uint32_t Samples = 0;
+  std::uint64_t BytesPerOp = 0; // 0 if not a throughput benchmark
+  std::uint64_t ItemsPerOp = 0;
+  std::string Error; // Set if the benchmark could not run
+};
+
+struct Options {
+  std::string Filter; // Substring of names to run (empty: all)
+  std::uint32_t Samples = 10;
+  double MinSampleSeconds = 0.01;
+};
+
+// ============================================================================
+// Benchmark State
+// ============================================================================
+
+class State {
+public:
+  using Body = std::function<void(std::uint64_t iterations)>;
+
+  explicit State(const Options &options) : m_Options(options) {}
+
+  /**
+   * @brief Time `body`, which must perform exactly `n` operations.
+   */
+  void Measure(const Body &body);
+
+  /**
+   * @brief Bytes moved per operation, for throughput reporting.
+   */
+  void SetBytesPerOp(std::uint64_t bytes) { m_Result.BytesPerOp = bytes; }
+
+  /**
+   * @brief Logical items (instructions, pages) per operation.
+   */
+  void SetItemsPerOp(std::uint64_t items) { m_Result.ItemsPerOp = items; }
+
+  /**
+   * @brief Mark the benchmark as failed (setup went wrong).
+   */
+  void SkipWithError(std::string message) {
+    m_Result.Error = std::move(message);
+  }
+
+  [[nodiscard]] Result &GetResult() { return m_Result; }
+
+private:
+  const Options &m_Options;
+  Result m_Result;
+};
+
+// ============================================================================
+// Registry and Runner
+// ============================================================================
+
+using Function = void (*)(State &);
+
+/**
+ * Adds a benchmark to the global registry at static-initialisation time.
+ */
+struct Registration {
+  Registration(const char *name, Function function);
+};
+
+[[nodiscard]] std::vector<std::string> ListBenchmarks();
+
+/**
+ * @brief Run every registered benchmark matching the filter, in name order.
+ * @param progress Receives one line per benchmark as it completes
+ */
+std::vector<Result> RunBenchmarks(const Options &options,
+                                  std::ostream &progress);
+
+/**
+ * @brief Write results and run context as JSON.
+ */
+void WriteJson(const std::vector<Result> &results, const Options &options,
+               std::string_view tag, std::ostream &out);
+
+/**
+ * @brief Read the name and median of every benchmark in a results file.
+ * @return false with `error` set if the file is not a results file
+ */
+bool ReadJson(std::string_view text, std::vector<Result> &results,
+              std::string &error);
+
+/**
+ * @brief Print a comparison table against a baseline.
+ * @param threshold Relative slowdown that counts as a regression (0.1 = 10%)
+ * @return Number of regressions
+ */
+std::size_t Compare(const std::vector<Result> &current,
+                    const std::vector<Result> &baseline, double threshold,
+                    std::ostream &out);
+
+} // namespace Aurelia::Bench
+
+#define AURELIA_BENCH_CONCAT2(a, b) a##b
+#define AURELIA_BENCH_CONCAT(a, b) AURELIA_BENCH_CONCAT2(a, b)
+
+/**
+ * Define and register a benchmark; the body sees `state` (Bench::State &).
+ */
+#define AURELIA_BENCHMARK(name)                                                \
+  static void AURELIA_BENCH_CONCAT(BenchBody_, __LINE__)(                      \
+      ::Aurelia::Bench::State & state);                                        \
+  static const ::Aurelia::Bench::Registration AURELIA_BENCH_CONCAT(            \
+      BenchRegistration_,                                                      \
+      __LINE__)(name, &AURELIA_BENCH_CONCAT(BenchBody_, __LINE__));            \
+  static void AURELIA_BENCH_CONCAT(BenchBody_, __LINE__)(                      \
+      ::Aurelia::Bench::State & state)
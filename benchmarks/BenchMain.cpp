@@ -0,0 +1,162 @@
+/**
+ * Aurelia Micro-Benchmark Runner.
+ *
+ * USAGE:
+ *   aurelia_bench [options]
+ *
+ * OPTIONS:
+ * ┌──────────────────┬──────────────────────────────────────────────────┐
+ * │ Option           │ Effect                                           │
+ * ├──────────────────┼──────────────────────────────────────────────────┤
+ * │ --list           │ Print benchmark names and exit                   │
+ * │ --filter <text>  │ Run only benchmarks whose name contains <text>   │
+ * │ --samples <n>    │ Timed batches per benchmark (default 10)         │
+ * │ --min-time <s>   │ Minimum seconds per batch (default 0.01)         │
+ * │ --json <file>    │ Write results as JSON                            │
+ * │ --tag <text>     │ Label stored in the JSON (e.g. a commit hash)    │
+ * │ --baseline <file>│ Compare against a stored JSON results file       │
+ * │ --threshold <pct>│ Slowdown counted as a regression (default 10)    │
+ * └──────────────────┴──────────────────────────────────────────────────┘
+ *
+ * REGRESSION WORKFLOW:
+ *   aurelia_bench --json base.json --tag $(git rev-parse --short HEAD)
+ *   ... change code, rebuild ...
+ *   aurelia_bench --baseline base.json
+ *
+ * NOTE (KleaSCM) Compare like with like: same machine, same build type,
+ * nothing else heavy running. Timings from an unoptimised build are
+ * flagged in the output and in the JSON.
+ *
+ * EXIT CODES:
+ *   0  Success (no regressions against the baseline)
+ *   1  At least one regression or failed benchmark
+ *   2  I/O error (baseline unreadable, JSON not writable)
+ *   3  Invalid arguments
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bench.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+using namespace Aurelia;
+
+constexpr int ExitSuccess = 0;
+constexpr int ExitRegression = 1;
+constexpr int ExitIoError = 2;
+constexpr int ExitInvalidArgs = 3;
+
+void PrintUsage(const char *programName) {
+  std::cout << "Aurelia Micro-Benchmarks\n"
+            << "Usage: " << programName << " [options]\n\n"
+            << "Options:\n"
+            << "  --list              List benchmarks\n"
+            << "  --filter <text>     Run names containing <text>\n"
+            << "  --samples <n>       Timed batches per benchmark\n"
+            << "  --min-time <s>      Minimum seconds per batch\n"
+            << "  --json <file>       Write results as JSON\n"
+            << "  --tag <text>        Label stored in the JSON\n"
+            << "  --baseline <file>   Compare against stored results\n"
+            << "  --threshold <pct>   Regression threshold (default 10)\n";
+}
+
+int main(int argc, char *argv[]) {
+  Bench::Options options;
+  std::string jsonPath;
+  std::string baselinePath;
+  std::string tag;
+  double threshold = 10.0;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+
+    if (arg == "--list") {
+      for (const std::string &name : Bench::ListBenchmarks()) {
+        std::cout << name << "\n";
+      }
+      return ExitSuccess;
+    } else if (arg == "-h" || arg == "--help") {
+      PrintUsage(argv[0]);
+      return ExitSuccess;
+    } else if (arg == "--filter" && hasValue) {
+      options.Filter = argv[++i];
+    } else if (arg == "--json" && hasValue) {
+      jsonPath = argv[++i];
+    } else if (arg == "--tag" && hasValue) {
+      tag = argv[++i];
+    } else if (arg == "--baseline" && hasValue) {
+      baselinePath = argv[++i];
+    } else if (arg == "--samples" && hasValue) {
+      char *end = nullptr;
+      unsigned long value = std::strtoul(argv[++i], &end, 10);
+      if (*end != '\0' || value == 0 || value > 10000) {
+        std::cerr << "Error: Invalid sample count '" << argv[i] << "'\n";
+        return ExitInvalidArgs;
+      }
+      options.Samples = static_cast<std::uint32_t>(value);
+    } else if ((arg == "--min-time" || arg == "--threshold") && hasValue) {
+      char *end = nullptr;
+      double value = std::strtod(argv[++i], &end);
+      if (*end != '\0' || !(value > 0.0)) {
+        std::cerr << "Error: Invalid " << arg << " '" << argv[i] << "'\n";
+        return ExitInvalidArgs;
+      }
+      (arg == "--min-time" ? options.MinSampleSeconds : threshold) = value;
+    } else {
+      PrintUsage(argv[0]);
+      return ExitInvalidArgs;
+    }
+  }
+
+  // Read the baseline first: a typo should not cost a full run
+  std::vector<Bench::Result> baseline;
+  if (!baselinePath.empty()) {
+    std::ifstream file(baselinePath, std::ios::in | std::ios::binary);
+    if (!file) {
+      std::cerr << "Error: Cannot read '" << baselinePath << "'\n";
+      return ExitIoError;
+    }
+    std::string text((std::istreambuf_iterator<char>(file)),
+                     std::istreambuf_iterator<char>());
+    std::string error;
+    if (!Bench::ReadJson(text, baseline, error)) {
+      std::cerr << "Error: " << baselinePath << ": " << error << "\n";
+      return ExitIoError;
+    }
+  }
+
+#if !defined(__OPTIMIZE__)
+  std::cout << "WARNING: unoptimised build; configure with "
+               "-DCMAKE_BUILD_TYPE=Release for meaningful numbers\n\n";
+#endif
+
+  std::vector<Bench::Result> results = Bench::RunBenchmarks(options, std::cout);
+
+  if (!jsonPath.empty()) {
+    std::ofstream file(jsonPath, std::ios::out | std::ios::trunc);
+    Bench::WriteJson(results, options, tag, file);
+    if (!file.good()) {
+      std::cerr << "Error: Cannot write '" << jsonPath << "'\n";
+      return ExitIoError;
+    }
+    std::cout << "\nResults written to " << jsonPath << "\n";
+  }
+
+  std::size_t failures = 0;
+  for (const Bench::Result &result : results) {
+    failures += result.Error.empty() ? 0 : 1;
+  }
+  if (!baseline.empty()) {
+    std::cout << "\n";
+    failures = Bench::Compare(results, baseline, threshold / 100.0, std::cout);
+    std::cout << "\n"
+              << failures << " regression(s) beyond " << threshold << "%\n";
+  }
+  return failures == 0 ? ExitSuccess : ExitRegression;
+}
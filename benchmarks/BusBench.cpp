@@ -0,0 +1,177 @@
+/**
+ * Bus and Memory Benchmarks.
+ *
+ * Address decode, word and block transfers through the bus, and the
+ * RamDevice access paths the bus forwards to.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bench.hpp"
+#include "Bus/Bus.hpp"
+#include "Memory/RamDevice.hpp"
+#include "Peripherals/PicDevice.hpp"
+#include "Peripherals/RtcDevice.hpp"
+#include "Peripherals/TimerDevice.hpp"
+#include "Peripherals/UartDevice.hpp"
+#include "Peripherals/UartSink.hpp"
+#include "System/MemoryMap.hpp"
+#include <vector>
+
+using namespace Aurelia;
+
+namespace {
+
+constexpr std::size_t RamBytes = 16 * 1024 * 1024;
+constexpr std::size_t AddressCount = 4096;
+
+/**
+ * Bus populated like the real machine's low MMIO window, so decode has to
+ * search past several devices.
+ */
+struct BusFixture {
+  Bus::Bus Bus;
+  Memory::RamDevice Ram{RamBytes, 0};
+  Peripherals::UartDevice Uart;
+  Peripherals::PicDevice Pic;
+  Peripherals::TimerDevice Timer;
+  Peripherals::RtcDevice Rtc;
+  Peripherals::BufferSink Sink;
+
+  BusFixture() {
+    Bus.ConnectDevice(&Uart);
+    Bus.ConnectDevice(&Pic);
+    Bus.ConnectDevice(&Timer);
+    Bus.ConnectDevice(&Rtc);
+    Bus.ConnectDevice(&Ram);
+    Uart.SetSink(&Sink);
+
+    // Touch every page so no benchmark pays first-fault costs
+    std::vector<Core::Byte> fill(RamBytes, 0x5A);
+    Bus.WriteBlock(System::RamBase, fill);
+  }
+};
+
+std::vector<Core::Address> RandomWordAddresses(std::uint64_t seed) {
+  Bench::Rng rng(seed);
+  std::vector<Core::Address> addresses(AddressCount);
+  for (auto &address : addresses) {
+    address = System::RamBase + (rng.Next() % (RamBytes / 8)) * 8;
+  }
+  return addresses;
+}
+
+} // namespace
+
+AURELIA_BENCHMARK("Bus/Decode") {
+  BusFixture f;
+  Bench::Rng rng(3);
+  std::vector<Core::Address> addresses(AddressCount);
+  for (auto &address : addresses) {
+    // Mix of RAM and each MMIO window
+    switch (rng.Next() % 4) {
+    case 0:
+      address = System::UartBase + rng.Next() % 0x20;
+      break;
+    case 1:
+      address = System::RtcBase + rng.Next() % 0x20;
+      break;
+    default:
+      address = System::RamBase + rng.Next() % RamBytes;
+      break;
+    }
+  }
+
+  state.SetItemsPerOp(1);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      Bench::DoNotOptimize(f.Bus.IsMapped(addresses[i & (AddressCount - 1)]));
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Bus/ReadWord") {
+  BusFixture f;
+  auto addresses = RandomWordAddresses(4);
+
+  state.SetBytesPerOp(8);
+  state.Measure([&](std::uint64_t n) {
+    Core::Data data = 0;
+    for (std::uint64_t i = 0; i < n; ++i) {
+      f.Bus.Read(addresses[i & (AddressCount - 1)], data);
+      Bench::DoNotOptimize(data);
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Bus/WriteWord") {
+  BusFixture f;
+  auto addresses = RandomWordAddresses(5);
+
+  state.SetBytesPerOp(8);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      f.Bus.Write(addresses[i & (AddressCount - 1)], i);
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Bus/ReadBlock4K") {
+  BusFixture f;
+  std::vector<Core::Byte> buffer(4096);
+  Bench::Rng rng(6);
+  std::vector<Core::Address> addresses(AddressCount);
+  for (auto &address : addresses) {
+    address = System::RamBase + (rng.Next() % (RamBytes / 4096)) * 4096;
+  }
+
+  state.SetBytesPerOp(buffer.size());
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      f.Bus.ReadBlock(addresses[i & (AddressCount - 1)], buffer);
+    }
+    Bench::DoNotOptimize(buffer[0]);
+  });
+}
+
+AURELIA_BENCHMARK("Ram/ReadWord") {
+  BusFixture f;
+  auto addresses = RandomWordAddresses(7);
+
+  state.SetBytesPerOp(8);
+  state.Measure([&](std::uint64_t n) {
+    Core::Data data = 0;
+    for (std::uint64_t i = 0; i < n; ++i) {
+      f.Ram.OnRead(addresses[i & (AddressCount - 1)], data);
+      Bench::DoNotOptimize(data);
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Ram/WriteWord") {
+  BusFixture f;
+  auto addresses = RandomWordAddresses(8);
+
+  state.SetBytesPerOp(8);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      f.Ram.OnWrite(addresses[i & (AddressCount - 1)], i);
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Ram/SequentialRead") {
+  // Word-at-a-time scan of a 1 MiB window: the prefetch-friendly case
+  BusFixture f;
+  constexpr std::size_t Window = 1024 * 1024;
+
+  state.SetBytesPerOp(8);
+  state.Measure([&](std::uint64_t n) {
+    Core::Data data = 0;
+    for (std::uint64_t i = 0; i < n; ++i) {
+      f.Ram.OnRead(System::RamBase + (i * 8) % Window, data);
+      Bench::DoNotOptimize(data);
+    }
+  });
+}
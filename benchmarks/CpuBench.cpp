@@ -0,0 +1,110 @@
+/**
+ * CPU Benchmarks.
+ *
+ * Instruction decode, ALU execution, and whole-machine cycles per second
+ * (CPU, bus, RAM and peripherals clocked together through Core::System).
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bench.hpp"
+#include "Cpu/Alu.hpp"
+#include "Cpu/Decoder.hpp"
+#include "System/VirtualMachine.hpp"
+#include "Tools/Assembler/Encoder.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include <array>
+#include <vector>
+
+using namespace Aurelia;
+
+namespace {
+
+constexpr std::size_t InputCount = 4096; // Power of two: cheap wrap
+
+} // namespace
+
+AURELIA_BENCHMARK("Cpu/Decode") {
+  // Opcode field limited to the defined range so every class is decoded
+  Bench::Rng rng(1);
+  std::vector<std::uint32_t> words(InputCount);
+  for (auto &word : words) {
+    auto raw = static_cast<std::uint32_t>(rng.Next());
+    word = (raw & 0x03FFFFFFu) | ((raw >> 26) % 20u) << 26;
+  }
+
+  state.SetItemsPerOp(1);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      Bench::DoNotOptimize(Cpu::Decoder::Decode(words[i & (InputCount - 1)]));
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Cpu/AluExecute") {
+  constexpr std::array Ops{Cpu::AluOp::ADD, Cpu::AluOp::SUB, Cpu::AluOp::AND,
+                           Cpu::AluOp::OR,  Cpu::AluOp::XOR, Cpu::AluOp::LSL,
+                           Cpu::AluOp::LSR, Cpu::AluOp::ASR};
+  struct Operation {
+    Cpu::AluOp Op;
+    Core::Word A;
+    Core::Word B;
+  };
+  Bench::Rng rng(2);
+  std::vector<Operation> operations(InputCount);
+  for (auto &operation : operations) {
+    operation.Op = Ops[rng.Next() % Ops.size()];
+    operation.A = static_cast<Core::Word>(rng.Next());
+    operation.B = static_cast<Core::Word>(rng.Next() % 64);
+  }
+
+  state.SetItemsPerOp(1);
+  state.Measure([&](std::uint64_t n) {
+    Cpu::Flags flags;
+    for (std::uint64_t i = 0; i < n; ++i) {
+      const Operation &op = operations[i & (InputCount - 1)];
+      auto result = Cpu::Alu::Execute(op.Op, op.A, op.B, flags);
+      flags = result.NewFlags;
+      Bench::DoNotOptimize(result.Result);
+    }
+  });
+}
+
+AURELIA_BENCHMARK("System/Cycle") {
+  // An endless ALU + load/store loop: every cycle does representative work
+  std::string source = "MOV R1, #1024\n"
+                       "MOV R2, #1\n"
+                       "loop:\n"
+                       "ADD R3, R3, R2\n"
+                       "STR R3, [R1, #0]\n"
+                       "LDR R4, [R1, #0]\n"
+                       "B loop\n";
+  using namespace Tools::Assembler;
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+  Parser parser(tokens);
+  if (!parser.Parse()) {
+    state.SkipWithError(parser.GetErrorMessage());
+    return;
+  }
+  auto instructions = parser.GetInstructions();
+  Resolver resolver(instructions, parser.GetLabels());
+  Encoder encoder(instructions);
+  if (!resolver.Resolve() || !encoder.Encode()) {
+    state.SkipWithError("Kernel failed to assemble");
+    return;
+  }
+
+  System::VirtualMachine vm;
+  if (!vm.LoadProgram(encoder.GetBinary())) {
+    state.SkipWithError(vm.GetErrorMessage());
+    return;
+  }
+
+  // One operation is one system cycle, so M/s reads as emulated MHz
+  state.SetItemsPerOp(1);
+  state.Measure([&](std::uint64_t n) { vm.Run(n); });
+}
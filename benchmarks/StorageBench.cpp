@@ -0,0 +1,163 @@
+/**
+ * Storage Benchmarks.
+ *
+ * Raw NAND page program, read and block erase, and the FTL's write and
+ * read paths in steady state, where every write eventually pays for
+ * garbage collection.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bench.hpp"
+#include "Storage/FTL/Ftl.hpp"
+#include "Storage/Nand/NandChip.hpp"
+#include <memory>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::Storage;
+
+namespace {
+
+constexpr std::size_t NandBlocks = 64; // 16 MiB of page data
+constexpr std::size_t TotalPages = NandBlocks * Nand::PagesPerBlock;
+
+std::vector<Core::Byte> PatternPage(std::uint64_t seed) {
+  Bench::Rng rng(seed);
+  std::vector<Core::Byte> page(Nand::PageDataSize);
+  for (auto &b : page) {
+    b = static_cast<Core::Byte>(rng.Next());
+  }
+  return page;
+}
+
+/**
+ * @brief Time FTL writes over a working set of `liveFraction` of capacity.
+ *
+ * Random overwrites invalidate pages all over the device, so once the free
+ * list runs dry each write carries its share of GC copy-back; the fuller
+ * the device, the larger that share.
+ */
+void FtlWriteSteadyState(Bench::State &state, double liveFraction) {
+  auto nand = std::make_unique<Nand::NandChip>(NandBlocks);
+  FTL::Ftl ftl(nand.get(), NandBlocks);
+  auto page = PatternPage(9);
+  auto working = static_cast<FTL::Lba>(static_cast<double>(TotalPages) *
+                                       liveFraction);
+
+  // Fill the working set once, then churn it until GC is in steady state
+  for (FTL::Lba lba = 0; lba < working; ++lba) {
+    if (ftl.Write(lba, page) != Nand::NandStatus::Success) {
+      state.SkipWithError("FTL rejected the initial fill");
+      return;
+    }
+  }
+  Bench::Rng rng(10);
+  for (std::size_t i = 0; i < 2 * TotalPages; ++i) {
+    if (ftl.Write(static_cast<FTL::Lba>(rng.Next() % working), page) !=
+        Nand::NandStatus::Success) {
+      state.SkipWithError("FTL write failed during warm-up (GC)");
+      return;
+    }
+  }
+
+  bool failed = false;
+  state.SetBytesPerOp(Nand::PageDataSize);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      failed |= ftl.Write(static_cast<FTL::Lba>(rng.Next() % working),
+                          page) != Nand::NandStatus::Success;
+    }
+  });
+  if (failed) {
+    state.SkipWithError("FTL write failed while measuring");
+  }
+}
+
+} // namespace
+
+AURELIA_BENCHMARK("Nand/ProgramPage") {
+  // Programs pages in order, erasing each block as it comes round again:
+  // one erase per 64 programs, as a log-structured writer would
+  Nand::NandChip nand(NandBlocks);
+  auto page = PatternPage(11);
+
+  state.SetBytesPerOp(Nand::PageDataSize);
+  std::uint64_t next = 0;
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i, ++next) {
+      std::size_t block = (next / Nand::PagesPerBlock) % NandBlocks;
+      std::size_t pageIdx = next % Nand::PagesPerBlock;
+      if (pageIdx == 0) {
+        Bench::DoNotOptimize(nand.EraseBlock(block));
+      }
+      Bench::DoNotOptimize(nand.ProgramPage(block, pageIdx, page));
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Nand/ReadPage") {
+  Nand::NandChip nand(NandBlocks);
+  auto page = PatternPage(12);
+  for (std::size_t block = 0; block < NandBlocks; ++block) {
+    for (std::size_t p = 0; p < Nand::PagesPerBlock; ++p) {
+      (void)nand.ProgramPage(block, p, page);
+    }
+  }
+
+  Bench::Rng rng(13);
+  std::vector<Core::Byte> buffer(Nand::PageDataSize);
+  state.SetBytesPerOp(Nand::PageDataSize);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      std::uint64_t at = rng.Next() % TotalPages;
+      Bench::DoNotOptimize(nand.ReadPage(at / Nand::PagesPerBlock,
+                                         at % Nand::PagesPerBlock, buffer));
+    }
+    Bench::DoNotOptimize(buffer[0]);
+  });
+}
+
+AURELIA_BENCHMARK("Nand/EraseBlock") {
+  Nand::NandChip nand(NandBlocks);
+
+  state.SetBytesPerOp(Nand::PageDataSize * Nand::PagesPerBlock);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      Bench::DoNotOptimize(nand.EraseBlock(i % NandBlocks));
+    }
+  });
+}
+
+AURELIA_BENCHMARK("Ftl/Write") {
+  FtlWriteSteadyState(state, 0.25); // Light GC pressure
+}
+
+AURELIA_BENCHMARK("Ftl/WriteGc") {
+  FtlWriteSteadyState(state, 0.75); // Most writes drag GC copy-back along
+}
+
+AURELIA_BENCHMARK("Ftl/Read") {
+  auto nand = std::make_unique<Nand::NandChip>(NandBlocks);
+  FTL::Ftl ftl(nand.get(), NandBlocks);
+  auto page = PatternPage(14);
+  constexpr FTL::Lba Working = TotalPages / 2;
+  for (FTL::Lba lba = 0; lba < Working; ++lba) {
+    if (ftl.Write(lba, page) != Nand::NandStatus::Success) {
+      state.SkipWithError("FTL rejected the initial fill");
+      return;
+    }
+  }
+
+  Bench::Rng rng(15);
+  std::vector<Core::Byte> buffer(Nand::PageDataSize);
+  state.SetBytesPerOp(Nand::PageDataSize);
+  state.Measure([&](std::uint64_t n) {
+    for (std::uint64_t i = 0; i < n; ++i) {
+      Bench::DoNotOptimize(
+          ftl.Read(static_cast<FTL::Lba>(rng.Next() % Working), buffer));
+    }
+    Bench::DoNotOptimize(buffer[0]);
+  });
+}
@@ -0,0 +1,407 @@
+/**
+ * Aurelia Guest Workload Runner.
+ *
+ * Micro-benchmarks time one host function; this times whole guest
+ * programs. Each workload in examples/workloads/ is assembled, run to
+ * HALT in a fresh headless VirtualMachine, checked against its expected
+ * console output, and reported as:
+ * ┌──────────┬─────────────────────────────────────────────────────────┐
+ * │ Column   │ Meaning                                                 │
+ * ├──────────┼─────────────────────────────────────────────────────────┤
+ * │ Instr    │ Guest instructions retired                              │
+ * │ CPI      │ Guest cycles per instruction (pipeline + wait states)   │
+ * │ MIPS     │ Guest instructions per host second, in millions         │
+ * │ MHz      │ Guest cycles per host second, in millions               │
+ * │ Bus      │ Share of cycles with a bus transaction in flight        │
+ * │ Wall     │ Host time for the run (median over --runs)              │
+ * └──────────┴─────────────────────────────────────────────────────────┘
+ * Cycles, instructions and bus figures depend only on the guest program
+ * and the device models, so they double as a check that a change did not
+ * alter guest-visible timing; MIPS and wall time measure the host.
+ *
+ * THE CORPUS:
+ * <name>.s is the program; <name>.expect, if present, is the console
+ * output it must produce byte for byte. Every machine has the NVMe
+ * controller attached, so the storage workload runs on the same machine
+ * as the others and their figures stay comparable.
+ *
+ * USAGE:
+ *   aurelia_workloads [--dir <path>] [--filter <text>] [--runs <n>]
+ *                     [--budget <cycles>] [--json <file>] [--list]
+ *
+ * EXIT CODES:
+ *   0  Every workload halted with the expected output
+ *   1  A workload failed to assemble, halt, or match its output
+ *   2  I/O error (corpus or JSON file)
+ *   3  Invalid arguments
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "System/MemoryMap.hpp"
+#include "System/VirtualMachine.hpp"
+#include "Tools/Assembler/Encoder.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#ifndef AURELIA_WORKLOAD_DIR
+#define AURELIA_WORKLOAD_DIR "examples/workloads"
+#endif
+
+using namespace Aurelia;
+
+constexpr int ExitSuccess = 0;
+constexpr int ExitWorkloadFailed = 1;
+constexpr int ExitIoError = 2;
+constexpr int ExitInvalidArgs = 3;
+
+// 4 MiB of NAND: room for the storage workload with no GC
+constexpr std::size_t WorkloadNandBlocks = 16;
+constexpr Core::TickCount DefaultBudget = 200'000'000;
+
+struct Workload {
+  std::string Name;
+  std::string SourcePath;
+  std::string ExpectPath; // Empty: halting is enough
+};
+
+struct Report {
+  std::string Name;
+  bool Passed = false;
+  std::string Error;
+  Core::TickCount Cycles = 0;
+  std::uint64_t Instructions = 0;
+  std::uint64_t BusCycles = 0;
+  double WallSeconds = 0.0; // Median over runs
+};
+
+bool ReadFile(const std::string &path, std::string &out) {
+  std::ifstream file(path, std::ios::in | std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  out.assign(std::istreambuf_iterator<char>(file),
+             std::istreambuf_iterator<char>());
+  return true;
+}
+
+/**
+ * @brief Assemble `source` into a flat RAM image at ResetVector.
+ *
+ * Same layout as `asm -f flat`: [text][rodata][data], each section at
+ * its resolved address.
+ */
+bool AssembleFlat(const std::string &source, std::vector<std::uint8_t> &out,
+                  std::string &error) {
+  using namespace Aurelia::Tools::Assembler;
+  Lexer lexer(source);
+  std::vector<Token> tokens = lexer.Tokenize();
+
+  Parser parser(tokens);
+  if (!parser.Parse()) {
+    error = "Parser: " + parser.GetErrorMessage();
+    return false;
+  }
+
+  auto instructions = parser.GetInstructions();
+  auto labels = parser.GetLabels();
+  const auto &roData = parser.GetRoDataSegment();
+  const auto &data = parser.GetDataSegment();
+  auto layout = SectionLayout::Sequential(
+      System::ResetVector, instructions.size() * 4, roData.size(),
+      data.size());
+  Resolver resolver(instructions, labels, layout);
+  if (!resolver.Resolve()) {
+    error = "Resolver: " + resolver.GetErrorMessage();
+    return false;
+  }
+
+  Encoder encoder(instructions);
+  if (!encoder.Encode()) {
+    error = "Encoder: " + encoder.GetErrorMessage();
+    return false;
+  }
+
+  const auto &text = encoder.GetBinary();
+  out.assign(text.begin(), text.end());
+  if (!roData.empty()) {
+    out.resize(layout.RoDataBase - layout.TextBase, 0);
+    out.insert(out.end(), roData.begin(), roData.end());
+  }
+  if (!data.empty()) {
+    out.resize(layout.DataBase - layout.TextBase, 0);
+    out.insert(out.end(), data.begin(), data.end());
+  }
+  return true;
+}
+
+/**
+ * @brief Every <name>.s in `dir`, in name order.
+ */
+bool FindWorkloads(const std::string &dir, const std::string &filter,
+                   std::vector<Workload> &workloads) {
+  std::error_code ec;
+  std::filesystem::directory_iterator it(dir, ec);
+  if (ec) {
+    return false;
+  }
+  for (const auto &entry : it) {
+    const std::filesystem::path &path = entry.path();
+    if (path.extension() != ".s") {
+      continue;
+    }
+    Workload workload;
+    workload.Name = path.stem().string();
+    if (!filter.empty() && workload.Name.find(filter) == std::string::npos) {
+      continue;
+    }
+    workload.SourcePath = path.string();
+    std::filesystem::path expect = path;
+    expect.replace_extension(".expect");
+    if (std::filesystem::exists(expect)) {
+      workload.ExpectPath = expect.string();
+    }
+    workloads.push_back(std::move(workload));
+  }
+  std::sort(workloads.begin(), workloads.end(),
+            [](const Workload &a, const Workload &b) {
+              return a.Name < b.Name;
+            });
+  return true;
+}
+
+Report RunWorkload(const Workload &workload, std::uint32_t runs,
+                   Core::TickCount budget) {
+  Report report;
+  report.Name = workload.Name;
+
+  std::string source;
+  std::string expected;
+  if (!ReadFile(workload.SourcePath, source)) {
+    report.Error = "Cannot read " + workload.SourcePath;
+    return report;
+  }
+  if (!workload.ExpectPath.empty() &&
+      !ReadFile(workload.ExpectPath, expected)) {
+    report.Error = "Cannot read " + workload.ExpectPath;
+    return report;
+  }
+  std::vector<std::uint8_t> image;
+  if (!AssembleFlat(source, image, report.Error)) {
+    return report;
+  }
+
+  std::vector<double> walls;
+  for (std::uint32_t run = 0; run < runs; ++run) {
+    System::VmConfig config;
+    config.NandBlocks = WorkloadNandBlocks;
+    System::VirtualMachine vm(config);
+    if (!vm.LoadProgram(image)) {
+      report.Error = vm.GetErrorMessage();
+      return report;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    System::VmExit exit = vm.Run(budget);
+    walls.push_back(std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - start)
+                        .count());
+
+    if (exit != System::VmExit::Halted) {
+      report.Error = "Did not halt within " + std::to_string(budget) +
+                     " cycles";
+      return report;
+    }
+    const std::string &output = vm.GetOutput();
+    if (!workload.ExpectPath.empty() && output != expected) {
+      auto diff = std::mismatch(output.begin(), output.end(),
+                                expected.begin(), expected.end());
+      report.Error = "Output differs at byte " +
+                     std::to_string(diff.first - output.begin());
+      return report;
+    }
+    // Identical every run: the machine is deterministic
+    report.Cycles = vm.GetCycles();
+    report.Instructions = vm.GetCpu().GetRetiredCount();
+    report.BusCycles = vm.GetBus().GetBusyCycles();
+  }
+
+  std::sort(walls.begin(), walls.end());
+  report.WallSeconds = walls[walls.size() / 2];
+  report.Passed = true;
+  return report;
+}
+
+double Ratio(double num, double den) { return den > 0.0 ? num / den : 0.0; }
+
+void PrintReport(const Report &r) {
+  std::cout << std::left << std::setw(14) << r.Name << std::right;
+  if (!r.Passed) {
+    std::cout << "FAIL  " << r.Error << "\n";
+    return;
+  }
+  auto cycles = static_cast<double>(r.Cycles);
+  auto instr = static_cast<double>(r.Instructions);
+  std::cout << std::setw(11) << r.Cycles << std::setw(11) << r.Instructions
+            << std::fixed << std::setprecision(2) << std::setw(7)
+            << Ratio(cycles, instr) << std::setw(9)
+            << Ratio(instr, r.WallSeconds) / 1e6 << std::setw(9)
+            << Ratio(cycles, r.WallSeconds) / 1e6 << std::setprecision(1)
+            << std::setw(7)
+            << Ratio(static_cast<double>(r.BusCycles), cycles) * 100.0 << "%"
+            << std::setprecision(2) << std::setw(10) << r.WallSeconds * 1e3
+            << "\n";
+}
+
+void WriteJson(const std::vector<Report> &reports, std::ostream &out) {
+  out << "{\n"
+      << "  \"schema\": 1,\n"
+      << "  \"timestamp\": " << std::time(nullptr) << ",\n"
+#if defined(__OPTIMIZE__)
+      << "  \"optimized\": true,\n"
+#else
+      << "  \"optimized\": false,\n"
+#endif
+      << "  \"workloads\": [";
+  out << std::setprecision(6);
+  for (std::size_t i = 0; i < reports.size(); ++i) {
+    const Report &r = reports[i];
+    out << (i == 0 ? "\n" : ",\n") << "    {\"name\": \"" << r.Name
+        << "\", \"passed\": " << (r.Passed ? "true" : "false");
+    if (r.Passed) {
+      auto cycles = static_cast<double>(r.Cycles);
+      auto instr = static_cast<double>(r.Instructions);
+      out << ", \"cycles\": " << r.Cycles
+          << ", \"instructions\": " << r.Instructions
+          << ", \"cpi\": " << Ratio(cycles, instr)
+          << ", \"mips\": " << Ratio(instr, r.WallSeconds) / 1e6
+          << ", \"bus_utilization\": "
+          << Ratio(static_cast<double>(r.BusCycles), cycles)
+          << ", \"wall_seconds\": " << r.WallSeconds;
+    }
+    out << "}";
+  }
+  out << "\n  ]\n}\n";
+}
+
+void PrintUsage(const char *programName) {
+  std::cout << "Aurelia Guest Workload Runner\n"
+            << "Usage: " << programName
+            << " [--dir <path>] [--filter <text>] [--runs <n>]\n"
+            << "       [--budget <cycles>] [--json <file>] [--list]\n\n"
+            << "Default corpus: " << AURELIA_WORKLOAD_DIR << "\n";
+}
+
+int main(int argc, char *argv[]) {
+  std::string dir = AURELIA_WORKLOAD_DIR;
+  std::string filter;
+  std::string jsonPath;
+  std::uint32_t runs = 3;
+  Core::TickCount budget = DefaultBudget;
+  bool list = false;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    bool hasValue = i + 1 < argc;
+    if (arg == "--dir" && hasValue) {
+      dir = argv[++i];
+    } else if (arg == "--filter" && hasValue) {
+      filter = argv[++i];
+    } else if (arg == "--json" && hasValue) {
+      jsonPath = argv[++i];
+    } else if ((arg == "--runs" || arg == "--budget") && hasValue) {
+      char *end = nullptr;
+      unsigned long long value = std::strtoull(argv[++i], &end, 10);
+      if (*end != '\0' || value == 0 || (arg == "--runs" && value > 1000)) {
+        std::cerr << "Error: Invalid " << arg << " value '" << argv[i]
+                  << "'\n";
+        return ExitInvalidArgs;
+      }
+      if (arg == "--runs") {
+        runs = static_cast<std::uint32_t>(value);
+      } else {
+        budget = value;
+      }
+    } else if (arg == "--list") {
+      list = true;
+    } else if (arg == "-h" || arg == "--help") {
+      PrintUsage(argv[0]);
+      return ExitSuccess;
+    } else {
+      PrintUsage(argv[0]);
+      return ExitInvalidArgs;
+    }
+  }
+
+  std::vector<Workload> workloads;
+  if (!FindWorkloads(dir, filter, workloads)) {
+    std::cerr << "Error: Cannot read workload directory '" << dir << "'\n";
+    return ExitIoError;
+  }
+  if (list) {
+    for (const Workload &workload : workloads) {
+      std::cout << workload.Name << "\n";
+    }
+    return ExitSuccess;
+  }
+  if (workloads.empty()) {
+    std::cerr << "Error: No workloads in '" << dir << "'\n";
+    return ExitIoError;
+  }
+
+#if !defined(__OPTIMIZE__)
+  std::cerr << "Warning: unoptimised build; host figures are not "
+               "representative\n";
+#endif
+
+  std::cout << std::left << std::setw(14) << "Workload" << std::right
+            << std::setw(11) << "Cycles" << std::setw(11) << "Instr"
+            << std::setw(7) << "CPI" << std::setw(9) << "MIPS"
+            << std::setw(9) << "MHz" << std::setw(8) << "Bus"
+            << std::setw(10) << "Wall ms"
+            << "\n";
+
+  std::vector<Report> reports;
+  bool allPassed = true;
+  double totalInstr = 0.0;
+  double totalWall = 0.0;
+  for (const Workload &workload : workloads) {
+    Report report = RunWorkload(workload, runs, budget);
+    PrintReport(report);
+    if (report.Passed) {
+      totalInstr += static_cast<double>(report.Instructions);
+      totalWall += report.WallSeconds;
+    }
+    allPassed &= report.Passed;
+    reports.push_back(std::move(report));
+  }
+  std::cout << "\nCorpus:   " << std::fixed << std::setprecision(2)
+            << Ratio(totalInstr, totalWall) / 1e6 << " MIPS over "
+            << totalWall * 1e3 << " ms\n";
+
+  if (!jsonPath.empty()) {
+    std::ofstream out(jsonPath, std::ios::out | std::ios::trunc);
+    if (out) {
+      WriteJson(reports, out);
+    }
+    if (!out) {
+      std::cerr << "Error: Cannot write '" << jsonPath << "'\n";
+      return ExitIoError;
+    }
+    std::cout << "Results written to " << jsonPath << "\n";
+  }
+  return allPassed ? ExitSuccess : ExitWorkloadFailed;
+}
@@ -18,9 +18,15 @@
  */
 
 #include "Bus/Bus.hpp"
+#include "Core/System.hpp"
 #include "Cpu/Cpu.hpp"
 #include "Memory/RamDevice.hpp"
+#include "Peripherals/KeyboardDevice.hpp"
+#include "Peripherals/MouseDevice.hpp"
+#include "Peripherals/PicDevice.hpp"
+#include "Peripherals/TimerDevice.hpp"
 #include "Peripherals/UartDevice.hpp"
+#include "System/ClockDomains.hpp"
 #include "System/Loader.hpp"
 #include "System/MemoryMap.hpp"
 #include "Tools/Assembler/Encoder.hpp"
@@ -78,12 +84,33 @@ int main() {
   Memory::RamDevice ram(RamSize, 0); // 16MB RAM
   Cpu::Cpu cpu;
   Peripherals::UartDevice uart;
+  Peripherals::PicDevice pic;
+  Peripherals::TimerDevice timer;
+  Peripherals::KeyboardDevice kbc;
+  Peripherals::MouseDevice mouse;
 
   bus.ConnectDevice(&ram);
   bus.ConnectDevice(&uart);
+  bus.ConnectDevice(&pic);
+  bus.ConnectDevice(&timer);
+  bus.ConnectDevice(&kbc);
+  bus.ConnectDevice(&mouse);
+  kbc.ConnectPic(&pic);
+  mouse.ConnectPic(&pic);
   cpu.ConnectBus(&bus);
 
-  std::cout << "  [OK] CPU, RAM, UART Connected.\n";
+  // Full-system clocking so the numbers include peripheral cost
+  Core::System machine;
+  machine.AddDevice(&cpu, CoreClockDivider);
+  machine.AddDevice(&bus, CoreClockDivider);
+  machine.AddDevice(&ram, CoreClockDivider);
+  machine.AddDevice(&uart, CoreClockDivider);
+  machine.AddDevice(&timer, TimerClockDivider);
+  machine.AddDevice(&pic, ControlClockDivider);
+  machine.AddDevice(&kbc, ControlClockDivider);
+  machine.AddDevice(&mouse, ControlClockDivider);
+
+  std::cout << "  [OK] CPU, RAM, UART, PIC, Timer, KBC, Mouse Connected.\n";
 
   // 2. Generate Benchmark Program (ASCII Art Loop)
   // Logic:
@@ -176,18 +203,17 @@ int main() {
   auto start = std::chrono::high_resolution_clock::now();
 
   // Max cycles safety net
-  const int MaxCycles = 1000000;
-  int cycles = 0;
+  const Core::TickCount MaxCycles = 1000000;
 
-  while (!cpu.IsHalted() && cycles < MaxCycles) {
-    cpu.OnTick();
-    bus.OnTick();
-    cycles++;
-  }
+  Core::TickCount cycles =
+      machine.RunUntil([&cpu] { return cpu.IsHalted(); }, MaxCycles);
 
   auto end = std::chrono::high_resolution_clock::now();
   std::chrono::duration<double> elapsed = end - start;
 
+  // Drain any unterminated guest output before the host report
+  uart.FlushTx();
+
   std::cout << "\n--------------------------------------------------\n";
   std::cout << "Execution Finished.\n";
 
@@ -197,7 +223,7 @@ int main() {
 
   // 5. Report Stats
   double secs = elapsed.count();
-  double mhz = (cycles / secs) / 1000000.0;
+  double mhz = (static_cast<double>(cycles) / secs) / 1000000.0;
 
   std::cout << "\nPERFORMANCE REPORT:\n";
   std::cout << "  Total Cycles: " << cycles << "\n";
@@ -0,0 +1,60 @@
+; Integer loop: 65536 rounds of xorshift64, summed into a checksum.
+; Register-only ALU work and one backward branch per round; no memory
+; traffic beyond instruction fetch. Prints the checksum in hex.
+
+	; R1 = UART (0xE0001000)
+	MOV R1, #224
+	MOV R3, #24
+	LSL R1, R1, R3
+	MOV R2, #16
+	MOV R3, #8
+	LSL R2, R2, R3
+	ADD R1, R1, R2
+
+	MOV R2, #1
+	MOV R3, #16
+	LSL R2, R2, R3       ; R2 = rounds left (65536)
+	MOV R4, #1
+	MOV R5, #0
+	MOV R6, #13
+	MOV R7, #7
+	MOV R8, #17
+	MOV R10, #1234       ; xorshift state
+	MOV R11, #0          ; checksum
+
+round:
+	LSL R12, R10, R6
+	XOR R10, R10, R12
+	LSR R12, R10, R7
+	XOR R10, R10, R12
+	LSL R12, R10, R8
+	XOR R10, R10, R12
+	ADD R11, R11, R10
+	SUB R2, R2, R4
+	CMP R2, R5
+	BNE round
+
+	; Print R11 as 16 hex digits and a newline
+	MOV R20, hexdigits
+	MOV R21, #60
+	MOV R22, #15
+	MOV R23, #4
+	MOV R24, #255
+digit:
+	LSR R26, R11, R21
+	AND R26, R26, R22
+	ADD R26, R26, R20
+	LDR R27, [R26, #0]
+	AND R27, R27, R24
+	STR R27, [R1, #0]
+	CMP R21, R5
+	BEQ done
+	SUB R21, R21, R23
+	B digit
+done:
+	MOV R27, #10
+	STR R27, [R1, #0]
+	HALT
+
+.rodata
+hexdigits: .string "0123456789abcdef"
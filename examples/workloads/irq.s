@@ -0,0 +1,81 @@
+; Interrupts: service 1024 RTC alarm interrupts through the PIC. Each
+; round arms the alarm 1 us ahead, polls CLAIM until the RTC line wins,
+; completes it and clears the alarm. The CPU has no exception entry, so
+; the handler is polled; the device side (alarm, PIC pending, claim and
+; complete) is the same as for a vectored handler. Prints the count.
+
+	; R1 = UART (0xE0001000)
+	MOV R1, #224
+	MOV R3, #24
+	LSL R1, R1, R3
+	MOV R2, #16
+	MOV R3, #8
+	LSL R2, R2, R3
+	ADD R1, R1, R2
+
+
+	MOV R4, #1
+	MOV R5, #0
+	MOV R6, #12
+	MOV R7, #24
+
+	; R2 = PIC (0xE0002000), R3 = RTC (0xE0008000)
+	MOV R2, #224
+	LSL R2, R2, R7
+	ADD R3, R2, R5
+	MOV R8, #2
+	LSL R8, R8, R6
+	ADD R2, R2, R8
+	MOV R8, #8
+	LSL R8, R8, R6
+	ADD R3, R3, R8
+
+	MOV R12, #12         ; PIC line of the RTC alarm
+	LSL R8, R4, R12
+	STR R8, [R2, #4]     ; IRQ_ENABLE: RTC only
+	STR R4, [R3, #56]    ; RTC CONTROL: alarm interrupt on
+
+	MOV R9, #1
+	MOV R8, #10
+	LSL R9, R9, R8       ; interrupts left (1024)
+	MOV R13, #1000       ; alarm lead, ns
+	MOV R11, #0          ; serviced
+arm:
+	LDR R10, [R3, #8]    ; MONOTONIC
+	ADD R10, R10, R13
+	STR R10, [R3, #48]   ; ALARM
+claim:
+	LDR R10, [R2, #20]   ; CLAIM (0xFF while nothing is pending)
+	CMP R10, R12
+	BNE claim
+	STR R12, [R2, #20]   ; complete
+	STR R4, [R3, #64]    ; clear STATUS.ALARM
+	ADD R11, R11, R4
+	SUB R9, R9, R4
+	CMP R9, R5
+	BNE arm
+
+	; Print R11 as 16 hex digits and a newline
+	MOV R20, hexdigits
+	MOV R21, #60
+	MOV R22, #15
+	MOV R23, #4
+	MOV R24, #255
+digit:
+	LSR R26, R11, R21
+	AND R26, R26, R22
+	ADD R26, R26, R20
+	LDR R27, [R26, #0]
+	AND R27, R27, R24
+	STR R27, [R1, #0]
+	CMP R21, R5
+	BEQ done
+	SUB R21, R21, R23
+	B digit
+done:
+	MOV R27, #10
+	STR R27, [R1, #0]
+	HALT
+
+.rodata
+hexdigits: .string "0123456789abcdef"
@@ -0,0 +1,116 @@
+; Mandelbrot: a 40x16 ASCII rendering of the Mandelbrot set in Q10
+; fixed point (1.0 = 1024), at most 16 iterations per point.
+; The ISA has no multiply, so squares come from a shift-and-add routine
+; reached through a return selector in R30 (there is no call
+; instruction); 2*zr*zi is (zr+zi)^2 - zr^2 - zi^2.
+
+	; R1 = UART (0xE0001000)
+	MOV R1, #224
+	MOV R3, #24
+	LSL R1, R1, R3
+	MOV R2, #16
+	MOV R3, #8
+	LSL R2, R2, R3
+	ADD R1, R1, R2
+
+
+	MOV R4, #1
+	MOV R5, #0
+	MOV R15, #63         ; sign bit shift
+	MOV R16, #1
+	MOV R17, #12
+	LSL R16, R16, R17    ; escape radius^2: 4.0 = 4096
+	MOV R17, #16         ; iteration limit
+	MOV R18, #64         ; x step: 2.5 / 40
+	MOV R19, #128        ; y step: 2.0 / 16
+	MOV R21, #10         ; Q10 shift
+	MOV R22, shades
+	MOV R23, #255
+	MOV R24, #2
+
+	MOV R2, #16          ; rows left
+	MOV R3, #960
+	SUB R3, R5, R3       ; cy = -1.0 + half a step
+row:
+	MOV R7, #40          ; columns left
+	MOV R8, #2016
+	SUB R8, R5, R8       ; cx = -2.0 + half a step
+column:
+	MOV R9, #0           ; zr
+	MOV R10, #0          ; zi
+	MOV R11, #0          ; iterations
+iterate:
+	ADD R28, R9, R5
+	MOV R30, #1
+	B square
+return1:
+	ADD R12, R29, R5     ; zr^2
+	ADD R28, R10, R5
+	MOV R30, #2
+	B square
+return2:
+	ADD R13, R29, R5     ; zi^2
+	ADD R14, R12, R13
+	SUB R14, R16, R14
+	LSR R14, R14, R15
+	CMP R14, R5
+	BNE plot             ; |z|^2 > 4: escaped
+	ADD R28, R9, R10
+	MOV R30, #3
+	B square
+return3:
+	SUB R29, R29, R12
+	SUB R29, R29, R13
+	ADD R10, R29, R3     ; zi = 2*zr*zi + cy
+	SUB R9, R12, R13
+	ADD R9, R9, R8       ; zr = zr^2 - zi^2 + cx
+	ADD R11, R11, R4
+	CMP R11, R17
+	BNE iterate
+plot:
+	ADD R14, R22, R11
+	LDR R14, [R14, #0]
+	AND R14, R14, R23
+	STR R14, [R1, #0]
+	ADD R8, R8, R18
+	SUB R7, R7, R4
+	CMP R7, R5
+	BNE column
+	MOV R14, #10
+	STR R14, [R1, #0]
+	ADD R3, R3, R19
+	SUB R2, R2, R4
+	CMP R2, R5
+	BNE row
+	HALT
+
+	; R29 = R28^2 >> 10, then return to returnN for N = R30
+square:
+	LSR R26, R28, R15
+	CMP R26, R5
+	BEQ square_positive
+	SUB R28, R5, R28
+square_positive:
+	MOV R29, #0
+	ADD R26, R28, R5
+square_bit:
+	CMP R28, R5
+	BEQ square_done
+	AND R27, R28, R4
+	CMP R27, R5
+	BEQ square_skip
+	ADD R29, R29, R26
+square_skip:
+	ADD R26, R26, R26
+	LSR R28, R28, R4
+	B square_bit
+square_done:
+	LSR R29, R29, R21
+	CMP R30, R4
+	BEQ return1
+	CMP R30, R24
+	BEQ return2
+	B return3
+
+.rodata
+shades: .string "   ..,,::;;==+*#@"
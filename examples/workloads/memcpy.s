@@ -0,0 +1,108 @@
+; memcpy: fill a 32 KiB buffer with xorshift64 words, copy it eight
+; times with a four-word unrolled loop, then checksum the copy.
+; Load/store bound: every copy iteration is eight RAM transactions.
+
+	; R1 = UART (0xE0001000)
+	MOV R1, #224
+	MOV R3, #24
+	LSL R1, R1, R3
+	MOV R2, #16
+	MOV R3, #8
+	LSL R2, R2, R3
+	ADD R1, R1, R2
+
+	MOV R4, #1
+	MOV R5, #0
+	MOV R6, #16
+	MOV R13, #8          ; one word
+	MOV R14, #32         ; one unrolled block
+	MOV R2, #1
+	LSL R2, R2, R6       ; R2 = source (0x10000)
+	MOV R3, #2
+	LSL R3, R3, R6       ; R3 = destination (0x20000)
+	MOV R15, #13
+	MOV R16, #7
+	MOV R17, #17
+
+	; Fill the source with 4096 words
+	MOV R7, #1
+	MOV R8, #12
+	LSL R7, R7, R8
+	MOV R10, #1234
+	ADD R9, R2, R5
+fill:
+	LSL R12, R10, R15
+	XOR R10, R10, R12
+	LSR R12, R10, R16
+	XOR R10, R10, R12
+	LSL R12, R10, R17
+	XOR R10, R10, R12
+	STR R10, [R9, #0]
+	ADD R9, R9, R13
+	SUB R7, R7, R4
+	CMP R7, R5
+	BNE fill
+
+	MOV R18, #8          ; passes
+pass:
+	ADD R9, R2, R5
+	ADD R19, R3, R5
+	MOV R7, #1
+	MOV R8, #10
+	LSL R7, R7, R8       ; 1024 blocks of four words
+copy:
+	LDR R20, [R9, #0]
+	LDR R21, [R9, #8]
+	LDR R22, [R9, #16]
+	LDR R23, [R9, #24]
+	STR R20, [R19, #0]
+	STR R21, [R19, #8]
+	STR R22, [R19, #16]
+	STR R23, [R19, #24]
+	ADD R9, R9, R14
+	ADD R19, R19, R14
+	SUB R7, R7, R4
+	CMP R7, R5
+	BNE copy
+	SUB R18, R18, R4
+	CMP R18, R5
+	BNE pass
+
+	; Checksum the destination
+	MOV R7, #1
+	MOV R8, #12
+	LSL R7, R7, R8
+	ADD R19, R3, R5
+	MOV R11, #0
+sum:
+	LDR R20, [R19, #0]
+	ADD R11, R11, R20
+	ADD R19, R19, R13
+	SUB R7, R7, R4
+	CMP R7, R5
+	BNE sum
+
+	; Print R11 as 16 hex digits and a newline
+	MOV R20, hexdigits
+	MOV R21, #60
+	MOV R22, #15
+	MOV R23, #4
+	MOV R24, #255
+digit:
+	LSR R26, R11, R21
+	AND R26, R26, R22
+	ADD R26, R26, R20
+	LDR R27, [R26, #0]
+	AND R27, R27, R24
+	STR R27, [R1, #0]
+	CMP R21, R5
+	BEQ done
+	SUB R21, R21, R23
+	B digit
+done:
+	MOV R27, #10
+	STR R27, [R1, #0]
+	HALT
+
+.rodata
+hexdigits: .string "0123456789abcdef"
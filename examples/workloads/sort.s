@@ -0,0 +1,115 @@
+; Sort: insertion-sort 512 pseudo-random 31-bit words in place, then
+; fold the sorted array into an order-sensitive checksum.
+; Data-dependent branches and a load/store shuffle in the inner loop.
+
+	; R1 = UART (0xE0001000)
+	MOV R1, #224
+	MOV R3, #24
+	LSL R1, R1, R3
+	MOV R2, #16
+	MOV R3, #8
+	LSL R2, R2, R3
+	ADD R1, R1, R2
+
+
+	MOV R4, #1
+	MOV R5, #0
+	MOV R6, #16
+	MOV R2, #1
+	LSL R2, R2, R6       ; R2 = array (0x10000)
+	MOV R13, #8          ; one element
+	MOV R15, #13
+	MOV R16, #7
+	MOV R17, #17
+	MOV R18, #63
+	MOV R19, #33
+
+	; Fill with xorshift64 >> 33: positive, so differences keep their sign
+	MOV R7, #1
+	MOV R8, #9
+	LSL R7, R7, R8       ; 512 elements
+	MOV R10, #1234
+	ADD R9, R2, R5
+fill:
+	LSL R12, R10, R15
+	XOR R10, R10, R12
+	LSR R12, R10, R16
+	XOR R10, R10, R12
+	LSL R12, R10, R17
+	XOR R10, R10, R12
+	LSR R12, R10, R19
+	STR R12, [R9, #0]
+	ADD R9, R9, R13
+	SUB R7, R7, R4
+	CMP R7, R5
+	BNE fill
+
+	; Insertion sort: R9 walks a[1..n-1], R21 is the hole
+	MOV R7, #1
+	LSL R7, R7, R8
+	SUB R7, R7, R4       ; 511 insertions
+	ADD R9, R2, R13
+outer:
+	LDR R20, [R9, #0]    ; key
+	ADD R21, R9, R5
+inner:
+	CMP R21, R2
+	BEQ place
+	SUB R23, R21, R13
+	LDR R22, [R23, #0]
+	SUB R24, R20, R22    ; negative iff a[j] > key
+	LSR R24, R24, R18
+	CMP R24, R5
+	BEQ place
+	STR R22, [R21, #0]
+	ADD R21, R23, R5
+	B inner
+place:
+	STR R20, [R21, #0]
+	ADD R9, R9, R13
+	SUB R7, R7, R4
+	CMP R7, R5
+	BNE outer
+
+	; Checksum: rotate left 7, then XOR in the next element
+	MOV R7, #1
+	LSL R7, R7, R8
+	MOV R15, #7
+	MOV R16, #57
+	MOV R11, #0
+	ADD R9, R2, R5
+fold:
+	LSL R12, R11, R15
+	LSR R11, R11, R16
+	OR R11, R11, R12
+	LDR R20, [R9, #0]
+	XOR R11, R11, R20
+	ADD R9, R9, R13
+	SUB R7, R7, R4
+	CMP R7, R5
+	BNE fold
+
+	; Print R11 as 16 hex digits and a newline
+	MOV R20, hexdigits
+	MOV R21, #60
+	MOV R22, #15
+	MOV R23, #4
+	MOV R24, #255
+digit:
+	LSR R26, R11, R21
+	AND R26, R26, R22
+	ADD R26, R26, R20
+	LDR R27, [R26, #0]
+	AND R27, R27, R24
+	STR R27, [R1, #0]
+	CMP R21, R5
+	BEQ done
+	SUB R21, R21, R23
+	B digit
+done:
+	MOV R27, #10
+	STR R27, [R1, #0]
+	HALT
+
+.rodata
+hexdigits: .string "0123456789abcdef"
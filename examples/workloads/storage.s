@@ -0,0 +1,144 @@
+; Storage: drive the NVMe controller through its admin queue. Four
+; rounds of 4 KiB writes over LBAs 0-63, then read every LBA back and
+; count pages whose first word is not the last value written, plus
+; commands that completed with an error. Prints that count (zero).
+; Guest work is light; the run is dominated by command DMA, FTL and
+; NAND page programs.
+
+	; R1 = UART (0xE0001000)
+	MOV R1, #224
+	MOV R3, #24
+	LSL R1, R1, R3
+	MOV R2, #16
+	MOV R3, #8
+	LSL R2, R2, R3
+	ADD R1, R1, R2
+
+
+	MOV R4, #1
+	MOV R5, #0
+	MOV R6, #16
+	MOV R13, #64         ; submission entry size
+	MOV R14, #16         ; completion entry size
+
+	; R2 = controller (0xE0010000), R3 = SQ0 tail doorbell (+0x1000)
+	MOV R2, #224
+	MOV R7, #24
+	LSL R2, R2, R7
+	MOV R7, #1
+	LSL R7, R7, R6
+	ADD R2, R2, R7
+	MOV R3, #1
+	MOV R7, #12
+	LSL R3, R3, R7
+	ADD R3, R2, R3
+
+	; Queues and buffers in RAM
+	MOV R15, #4
+	LSL R15, R15, R6     ; R15 = admin SQ (0x40000)
+	MOV R16, #5
+	LSL R16, R16, R6     ; R16 = admin CQ (0x50000)
+	MOV R17, #6
+	LSL R17, R17, R6     ; R17 = write buffer (0x60000)
+	MOV R18, #7
+	LSL R18, R18, R6     ; R18 = read buffer (0x70000)
+
+	STR R15, [R2, #40]   ; ASQ
+	STR R16, [R2, #48]   ; ACQ
+	STR R4, [R2, #20]    ; CC.EN
+
+	MOV R11, #0          ; failures
+	MOV R19, #0          ; commands issued (SQ tail)
+	ADD R20, R15, R5     ; next submission entry
+	ADD R21, R16, R5     ; next completion entry
+	MOV R22, #256        ; round stride in the data word
+	MOV R23, #64         ; LBAs
+
+	; Write phase: data word = round * 256 + LBA
+	MOV R8, #4           ; rounds left
+	MOV R12, #0          ; round * 256
+write_round:
+	MOV R9, #0           ; LBA
+write_lba:
+	ADD R10, R12, R9
+	STR R10, [R17, #0]
+	MOV R10, #1          ; opcode: write
+	STR R10, [R20, #0]
+	STR R17, [R20, #24]  ; PRP1
+	STR R9, [R20, #40]   ; LBA
+	STR R5, [R20, #48]   ; one block
+	ADD R19, R19, R4
+	STR R19, [R3, #0]    ; ring the doorbell
+write_wait:
+	LDR R10, [R21, #12]
+	CMP R10, R5
+	BEQ write_wait
+	CMP R10, R4          ; phase 1, status 0
+	BEQ write_ok
+	ADD R11, R11, R4
+write_ok:
+	ADD R20, R20, R13
+	ADD R21, R21, R14
+	ADD R9, R9, R4
+	CMP R9, R23
+	BNE write_lba
+	ADD R12, R12, R22
+	SUB R8, R8, R4
+	CMP R8, R5
+	BNE write_round
+
+	; Read phase: every LBA must hold the last round's word
+	SUB R12, R12, R22
+	MOV R9, #0
+read_lba:
+	MOV R10, #2          ; opcode: read
+	STR R10, [R20, #0]
+	STR R18, [R20, #24]
+	STR R9, [R20, #40]
+	STR R5, [R20, #48]
+	ADD R19, R19, R4
+	STR R19, [R3, #0]
+read_wait:
+	LDR R10, [R21, #12]
+	CMP R10, R5
+	BEQ read_wait
+	CMP R10, R4
+	BEQ read_ok
+	ADD R11, R11, R4
+read_ok:
+	LDR R10, [R18, #0]
+	ADD R7, R12, R9
+	CMP R10, R7
+	BEQ read_match
+	ADD R11, R11, R4
+read_match:
+	ADD R20, R20, R13
+	ADD R21, R21, R14
+	ADD R9, R9, R4
+	CMP R9, R23
+	BNE read_lba
+
+	; Print R11 as 16 hex digits and a newline
+	MOV R20, hexdigits
+	MOV R21, #60
+	MOV R22, #15
+	MOV R23, #4
+	MOV R24, #255
+digit:
+	LSR R26, R11, R21
+	AND R26, R26, R22
+	ADD R26, R26, R20
+	LDR R27, [R26, #0]
+	AND R27, R27, R24
+	STR R27, [R1, #0]
+	CMP R21, R5
+	BEQ done
+	SUB R21, R21, R23
+	B digit
+done:
+	MOV R27, #10
+	STR R27, [R1, #0]
+	HALT
+
+.rodata
+hexdigits: .string "0123456789abcdef"
@@ -0,0 +1,106 @@
+; String search: generate 8 KiB of text over the alphabet "abcd", then
+; count every occurrence of "abca" with a naive byte-by-byte compare.
+; Byte loads and data-dependent early exits, like strstr() on real text.
+
+	; R1 = UART (0xE0001000)
+	MOV R1, #224
+	MOV R3, #24
+	LSL R1, R1, R3
+	MOV R2, #16
+	MOV R3, #8
+	LSL R2, R2, R3
+	ADD R1, R1, R2
+
+
+	MOV R4, #1
+	MOV R5, #0
+	MOV R6, #16
+	MOV R2, #1
+	LSL R2, R2, R6       ; R2 = text (0x10000)
+	MOV R15, #13
+	MOV R16, #7
+	MOV R17, #17
+	MOV R18, #32
+	MOV R19, #3
+	MOV R24, #255
+	MOV R25, #97         ; 'a'
+
+	; Text: one byte per store; each store's upper bytes are overwritten
+	; by the next one
+	MOV R7, #1
+	MOV R8, #13
+	LSL R7, R7, R8       ; 8192 bytes
+	MOV R10, #1234
+	ADD R9, R2, R5
+gen:
+	LSL R12, R10, R15
+	XOR R10, R10, R12
+	LSR R12, R10, R16
+	XOR R10, R10, R12
+	LSL R12, R10, R17
+	XOR R10, R10, R12
+	LSR R12, R10, R18
+	AND R12, R12, R19
+	ADD R12, R12, R25
+	STR R12, [R9, #0]
+	ADD R9, R9, R4
+	SUB R7, R7, R4
+	CMP R7, R5
+	BNE gen
+
+	; Search every start position that leaves room for the pattern
+	MOV R7, #1
+	LSL R7, R7, R8
+	SUB R7, R7, R19      ; 8189 positions
+	MOV R6, pattern
+	MOV R13, #4          ; pattern length
+	MOV R11, #0          ; matches
+	ADD R9, R2, R5
+position:
+	ADD R20, R9, R5
+	ADD R21, R6, R5
+	ADD R22, R13, R5
+compare:
+	LDR R26, [R20, #0]
+	AND R26, R26, R24
+	LDR R27, [R21, #0]
+	AND R27, R27, R24
+	CMP R26, R27
+	BNE next
+	ADD R20, R20, R4
+	ADD R21, R21, R4
+	SUB R22, R22, R4
+	CMP R22, R5
+	BNE compare
+	ADD R11, R11, R4
+next:
+	ADD R9, R9, R4
+	SUB R7, R7, R4
+	CMP R7, R5
+	BNE position
+
+	; Print R11 as 16 hex digits and a newline
+	MOV R20, hexdigits
+	MOV R21, #60
+	MOV R22, #15
+	MOV R23, #4
+	MOV R24, #255
+digit:
+	LSR R26, R11, R21
+	AND R26, R26, R22
+	ADD R26, R26, R20
+	LDR R27, [R26, #0]
+	AND R27, R27, R24
+	STR R27, [R1, #0]
+	CMP R21, R5
+	BEQ done
+	SUB R21, R21, R23
+	B digit
+done:
+	MOV R27, #10
+	STR R27, [R1, #0]
+	HALT
+
+.rodata
+hexdigits: .string "0123456789abcdef"
+pattern: .string "abca"
@@ -13,6 +13,7 @@
 
 #include "Bus/Bus.hpp"
 #include "Core/BitManip.hpp"
+#include "Core/Instrument.hpp"
 
 namespace Aurelia::Bus {
 
@@ -79,6 +80,49 @@ bool Bus::Write(Core::Address Address, Core::Data InData) {
   return false;
 }
 
+IBusDevice *Bus::DecodeBlock(Core::Address Address,
+                             std::size_t Length) const {
+  if (Length == 0 || Address + (Length - 1) < Address) {
+    return nullptr; // Empty, or wraps the address space
+  }
+
+  for (auto *device : Devices) {
+    if (device->IsAddressInRange(Address)) {
+      return device->IsAddressInRange(Address + (Length - 1)) ? device
+                                                             : nullptr;
+    }
+  }
+  return nullptr;
+}
+
+bool Bus::IsMapped(Core::Address Address) const {
+  return DecodeBlock(Address, 1) != nullptr;
+}
+
+bool Bus::ReadBlock(Core::Address Address, std::span<Core::Byte> Out) {
+  if (Out.empty()) {
+    return true;
+  }
+  IBusDevice *device = DecodeBlock(Address, Out.size());
+  return device && device->OnReadBlock(Address, Out);
+}
+
+bool Bus::WriteBlock(Core::Address Address, std::span<const Core::Byte> In) {
+  if (In.empty()) {
+    return true;
+  }
+  IBusDevice *device = DecodeBlock(Address, In.size());
+  return device && device->OnWriteBlock(Address, In);
+}
+
+bool Bus::ZeroBlock(Core::Address Address, std::size_t Length) {
+  if (Length == 0) {
+    return true;
+  }
+  IBusDevice *device = DecodeBlock(Address, Length);
+  return device && device->OnZeroBlock(Address, Length);
+}
+
 void Bus::OnTick() {
   auto readBit = static_cast<std::size_t>(
       std::countr_zero(static_cast<Core::Byte>(ControlSignal::Read)));
@@ -97,6 +141,8 @@ void Bus::OnTick() {
   if (!isRead && !isWrite) {
     return;
   }
+  BusyCycles++;
+  AURELIA_INSTRUMENT_SCOPE(BusDecode);
 
   IBusDevice *target = nullptr;
   for (auto *dev : Devices) {
@@ -9,6 +9,8 @@
 
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <vector>
 
 #include "Bus/BusDefs.hpp"
@@ -32,6 +34,9 @@ public:
   [[nodiscard]] std::size_t GetReadCount() const { return ReadCount; }
   [[nodiscard]] std::size_t GetWriteCount() const { return WriteCount; }
 
+  // Ticks with a Read or Write in progress (including wait states)
+  [[nodiscard]] std::uint64_t GetBusyCycles() const { return BusyCycles; }
+
   // Debug / DMA Access (Bypasses timing)
 
   // NOTE (KleaSCM) These methods bypass the cycle-accurate simulation
@@ -39,6 +44,18 @@ public:
   bool Read(Core::Address Address, Core::Data &OutData);
   bool Write(Core::Address Address, Core::Data InData);
 
+  // Bulk Access (Bypasses timing)
+
+  // NOTE (KleaSCM) One device call per block instead of one per word.
+  // The whole block must be decoded by a single device; a block that
+  // straddles two devices is a bus fault and returns false.
+  bool ReadBlock(Core::Address Address, std::span<Core::Byte> Out);
+  bool WriteBlock(Core::Address Address, std::span<const Core::Byte> In);
+  bool ZeroBlock(Core::Address Address, std::size_t Length);
+
+  // True if some connected device decodes Address
+  [[nodiscard]] bool IsMapped(Core::Address Address) const;
+
   // System Interface
   void OnTick() override;
 
@@ -46,11 +63,15 @@ private:
   std::vector<IBusDevice *> Devices;
   BusState State;
 
+  [[nodiscard]] IBusDevice *DecodeBlock(Core::Address Address,
+                                        std::size_t Length) const;
+
   // Internal latch to hold data during transfer
   Core::Data LatchedData = 0;
 
   std::size_t ReadCount = 0;
   std::size_t WriteCount = 0;
+  std::uint64_t BusyCycles = 0;
 };
 
 } // namespace Aurelia::Bus
@@ -0,0 +1,51 @@
+/**
+ * IBusDevice Default Bulk Transfers.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bus/IBusDevice.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace Aurelia::Bus {
+
+bool IBusDevice::OnReadBlock(Core::Address addr, std::span<Core::Byte> out) {
+  for (std::size_t done = 0; done < out.size(); done += sizeof(Core::Data)) {
+    Core::Data word = 0;
+    if (!OnRead(addr + done, word)) {
+      return false;
+    }
+    std::size_t n = std::min(sizeof(Core::Data), out.size() - done);
+    std::memcpy(out.data() + done, &word, n);
+  }
+  return true;
+}
+
+bool IBusDevice::OnWriteBlock(Core::Address addr,
+                              std::span<const Core::Byte> in) {
+  for (std::size_t done = 0; done < in.size(); done += sizeof(Core::Data)) {
+    Core::Data word = 0;
+    std::size_t n = std::min(sizeof(Core::Data), in.size() - done);
+    std::memcpy(&word, in.data() + done, n);
+    if (!OnWrite(addr + done, word)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool IBusDevice::OnZeroBlock(Core::Address addr, std::size_t length) {
+  static constexpr std::array<Core::Byte, 256> Zeros{};
+  for (std::size_t done = 0; done < length; done += Zeros.size()) {
+    std::size_t n = std::min(Zeros.size(), length - done);
+    if (!OnWriteBlock(addr + done, std::span(Zeros.data(), n))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace Aurelia::Bus
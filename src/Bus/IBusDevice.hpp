@@ -11,6 +11,7 @@
 
 #include "Core/ITickable.hpp"
 #include "Core/Types.hpp"
+#include <span>
 
 namespace Aurelia::Bus {
 
@@ -35,6 +36,33 @@ public:
    * @return true if Write was completed, false if device needs to WAIT.
    */
   virtual bool OnWrite(Core::Address addr, Core::Data inData) = 0;
+
+  /**
+   * BULK TRANSFER PATH
+   *
+   * Used by Bus::ReadBlock/WriteBlock for DMA and loaders. The range lies
+   * entirely inside this device and bypasses access timing, like the
+   * Bus::Read/Write debug path.
+   *
+   * The default splits the block into word accesses through OnRead and
+   * OnWrite. A trailing partial word is read as a full word and
+   * truncated, or written zero-extended. Memory-like devices override
+   * these with a single copy.
+   *
+   * @return true if the whole block was transferred
+   */
+  virtual bool OnReadBlock(Core::Address addr, std::span<Core::Byte> out);
+  virtual bool OnWriteBlock(Core::Address addr,
+                            std::span<const Core::Byte> in);
+
+  /**
+   * @brief Bulk zero fill (BSS, freshly allocated buffers).
+   *
+   * The default writes zeros through OnWriteBlock in chunks. RAM can do
+   * better by handing whole pages back to the host, which then reads as
+   * zero without ever having been written.
+   */
+  virtual bool OnZeroBlock(Core::Address addr, std::size_t length);
 };
 
 } // namespace Aurelia::Bus
@@ -0,0 +1,55 @@
+/**
+ * Event Queue Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Core/EventQueue.hpp"
+#include <algorithm>
+
+namespace Aurelia::Core {
+
+namespace {
+
+/**
+ * Heap comparator. std::push_heap builds a max-heap, so "less" here means
+ * "fires later", which puts the earliest deadline at the front.
+ */
+bool FiresLater(const EventQueue::Event &a, const EventQueue::Event &b) {
+  if (a.Deadline != b.Deadline) {
+    return a.Deadline > b.Deadline;
+  }
+  return a.Sequence > b.Sequence;
+}
+
+} // namespace
+
+void EventQueue::Schedule(TickCount deadline, std::uint32_t id,
+                          std::uint64_t payload) {
+  m_Heap.push_back({deadline, id, payload, m_NextSequence++});
+  std::push_heap(m_Heap.begin(), m_Heap.end(), FiresLater);
+}
+
+void EventQueue::Cancel(std::uint32_t id) {
+  auto it = std::remove_if(m_Heap.begin(), m_Heap.end(),
+                           [id](const Event &ev) { return ev.Id == id; });
+  if (it == m_Heap.end()) {
+    return;
+  }
+  m_Heap.erase(it, m_Heap.end());
+  std::make_heap(m_Heap.begin(), m_Heap.end(), FiresLater);
+}
+
+bool EventQueue::PopDue(TickCount now, Event &out) {
+  if (m_Heap.empty() || m_Heap.front().Deadline > now) {
+    return false;
+  }
+
+  std::pop_heap(m_Heap.begin(), m_Heap.end(), FiresLater);
+  out = m_Heap.back();
+  m_Heap.pop_back();
+  return true;
+}
+
+} // namespace Aurelia::Core
@@ -0,0 +1,90 @@
+/**
+ * Event Queue.
+ *
+ * Deadline-ordered queue of device-internal timed events.
+ *
+ * Most devices only have work to do at a handful of known future instants
+ * (a UART frame finishing, a flash program completing). Counting down a
+ * per-operation timer on every tick costs a branch per operation per cycle;
+ * scheduling the completion as an event reduces the per-tick cost to a
+ * single compare against the earliest deadline.
+ *
+ * USAGE PATTERN:
+ *   void Device::OnTick() {
+ *     ++m_Now;
+ *     Core::EventQueue::Event ev;
+ *     while (m_Events.PopDue(m_Now, ev)) {
+ *       HandleEvent(ev);
+ *     }
+ *   }
+ *
+ * Events carry a small integer Id (device-defined enum) and a 64-bit
+ * Payload rather than a callback, so scheduling never allocates once the
+ * heap has grown to its working size.
+ *
+ * ORDERING:
+ * Events fire in deadline order. Events sharing a deadline fire in the
+ * order they were scheduled.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Core/Types.hpp"
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Aurelia::Core {
+
+class EventQueue {
+public:
+  struct Event {
+    TickCount Deadline = 0;
+    std::uint32_t Id = 0;
+    std::uint64_t Payload = 0;
+    std::uint64_t Sequence = 0; // Tie-break for equal deadlines (FIFO)
+  };
+
+  static constexpr TickCount NoDeadline = std::numeric_limits<TickCount>::max();
+
+  /**
+   * @brief Schedule an event to fire once the clock reaches `deadline`.
+   */
+  void Schedule(TickCount deadline, std::uint32_t id,
+                std::uint64_t payload = 0);
+
+  /**
+   * @brief Remove every pending event with the given Id.
+   */
+  void Cancel(std::uint32_t id);
+
+  /**
+   * @brief Pop the earliest event if its deadline has been reached.
+   *
+   * @param now Current device time
+   * @param out Receives the event when one is due
+   * @return true if an event was popped
+   */
+  [[nodiscard]] bool PopDue(TickCount now, Event &out);
+
+  /**
+   * @brief Deadline of the earliest pending event, or NoDeadline.
+   */
+  [[nodiscard]] TickCount NextDeadline() const {
+    return m_Heap.empty() ? NoDeadline : m_Heap.front().Deadline;
+  }
+
+  [[nodiscard]] bool IsEmpty() const { return m_Heap.empty(); }
+  [[nodiscard]] std::size_t GetPendingCount() const { return m_Heap.size(); }
+
+  void Clear() { m_Heap.clear(); }
+
+private:
+  std::vector<Event> m_Heap; // Binary min-heap on (Deadline, Sequence)
+  std::uint64_t m_NextSequence = 0;
+};
+
+} // namespace Aurelia::Core
@@ -0,0 +1,305 @@
+/**
+ * Hot-Path Instrumentation Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Core/Instrument.hpp"
+#include <ostream>
+
+#if AURELIA_INSTRUMENT_ENABLED
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#define AURELIA_HAS_SIGUSR1 1
+#endif
+#endif
+
+namespace Aurelia::Core::Instrument {
+
+const char *ToString(Probe probe) {
+  switch (probe) {
+  case Probe::CpuFetch:
+    return "Cpu/Fetch";
+  case Probe::CpuDecode:
+    return "Cpu/Decode";
+  case Probe::CpuExecute:
+    return "Cpu/Execute";
+  case Probe::CpuMemory:
+    return "Cpu/Memory";
+  case Probe::CpuWriteBack:
+    return "Cpu/WriteBack";
+  case Probe::BusDecode:
+    return "Bus/Decode";
+  case Probe::RamRead:
+    return "Ram/Read";
+  case Probe::RamWrite:
+    return "Ram/Write";
+  case Probe::RamBlock:
+    return "Ram/Block";
+  case Probe::RamFaultIn:
+    return "Ram/FaultIn";
+  case Probe::FtlWrite:
+    return "Ftl/Write";
+  case Probe::FtlRead:
+    return "Ftl/Read";
+  case Probe::FtlGc:
+    return "Ftl/GC";
+  case Probe::FtlGcCopy:
+    return "Ftl/GcCopy";
+  case Probe::NvmeCommand:
+    return "Nvme/Command";
+  case Probe::Count:
+    break;
+  }
+  return "?";
+}
+
+#if AURELIA_INSTRUMENT_ENABLED
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/**
+ * Slots of every live thread, plus what exited threads left behind.
+ */
+struct Registry {
+  std::mutex Mutex;
+  std::vector<ThreadSlots *> Live;
+  std::array<ProbeTotals, ProbeCount> Retired{};
+  std::size_t Threads = 0; // Every thread that ever recorded
+  Clock::time_point EpochTime = Clock::now();
+  std::uint64_t EpochTicks = ReadTicks();
+};
+
+// Never destroyed: threads may still record while statics are torn down
+Registry &GetRegistry() {
+  static auto *registry = new Registry;
+  return *registry;
+}
+
+void Accumulate(std::array<ProbeTotals, ProbeCount> &totals,
+                const ThreadSlots &slots) {
+  for (std::size_t i = 0; i < ProbeCount; ++i) {
+    const Slot &slot = slots.Slots[i];
+    totals[i].Calls += slot.Calls.load(std::memory_order_relaxed);
+    totals[i].Timed += slot.Timed.load(std::memory_order_relaxed);
+    totals[i].Ticks += slot.Ticks.load(std::memory_order_relaxed);
+  }
+}
+
+/**
+ * Folds the calling thread's counts into Retired before its slots go away.
+ */
+struct ThreadExit {
+  ~ThreadExit() {
+    Registry &registry = GetRegistry();
+    std::lock_guard lock(registry.Mutex);
+    Accumulate(registry.Retired, t_Slots);
+    std::erase(registry.Live, &t_Slots);
+    t_Slots.Attached = false;
+  }
+};
+
+} // namespace
+
+void AttachThread() {
+  static thread_local ThreadExit exitHook; // Constructed on first call
+  (void)exitHook;
+
+  Registry &registry = GetRegistry();
+  std::lock_guard lock(registry.Mutex);
+  registry.Live.push_back(&t_Slots);
+  registry.Threads++;
+  t_Slots.Attached = true;
+}
+
+std::array<ProbeTotals, ProbeCount> Snapshot() {
+  Registry &registry = GetRegistry();
+  std::lock_guard lock(registry.Mutex);
+  std::array<ProbeTotals, ProbeCount> totals = registry.Retired;
+  for (const ThreadSlots *slots : registry.Live) {
+    Accumulate(totals, *slots);
+  }
+  return totals;
+}
+
+void Reset() {
+  Registry &registry = GetRegistry();
+  std::lock_guard lock(registry.Mutex);
+  // Racing increments from running threads may survive; Reset() is meant
+  // for quiet points between runs
+  registry.Retired = {};
+  for (ThreadSlots *slots : registry.Live) {
+    for (Slot &slot : slots->Slots) {
+      slot.Calls.store(0, std::memory_order_relaxed);
+      slot.Timed.store(0, std::memory_order_relaxed);
+      slot.Ticks.store(0, std::memory_order_relaxed);
+    }
+  }
+  registry.EpochTime = Clock::now();
+  registry.EpochTicks = ReadTicks();
+}
+
+double TicksPerSecond() {
+#if defined(__x86_64__) || defined(__i386__)
+  Registry &registry = GetRegistry();
+  Clock::time_point epochTime;
+  std::uint64_t epochTicks = 0;
+  {
+    std::lock_guard lock(registry.Mutex);
+    epochTime = registry.EpochTime;
+    epochTicks = registry.EpochTicks;
+  }
+  // Calibrate over the whole run; spin a little if it was too short
+  Clock::time_point now = Clock::now();
+  while (now - epochTime < std::chrono::milliseconds(10)) {
+    now = Clock::now();
+  }
+  std::uint64_t ticks = ReadTicks() - epochTicks;
+  return static_cast<double>(ticks) /
+         std::chrono::duration<double>(now - epochTime).count();
+#else
+  return static_cast<double>(Clock::period::den) /
+         static_cast<double>(Clock::period::num);
+#endif
+}
+
+namespace {
+
+/**
+ * @brief Ticks a timed scope reports when it contains no work.
+ *
+ * Back-to-back reads, best of many: the cost of the timer itself, which
+ * Report() takes off every timed call.
+ */
+std::uint64_t TimerOverheadTicks() {
+  static const std::uint64_t overhead = [] {
+    std::uint64_t best = ~std::uint64_t{0};
+    for (int i = 0; i < 1000; ++i) {
+      std::uint64_t start = ReadTicks();
+      best = std::min(best, ReadTicks() - start);
+    }
+    return best;
+  }();
+  return overhead;
+}
+
+} // namespace
+
+void Report(std::ostream &out) {
+  std::array<ProbeTotals, ProbeCount> totals = Snapshot();
+  double ticksPerNs = TicksPerSecond() / 1e9;
+  auto overhead = static_cast<double>(TimerOverheadTicks());
+  double wallNs = 0.0;
+  std::size_t threads = 0;
+  {
+    Registry &registry = GetRegistry();
+    std::lock_guard lock(registry.Mutex);
+    wallNs = std::chrono::duration<double, std::nano>(Clock::now() -
+                                                      registry.EpochTime)
+                 .count();
+    threads = registry.Threads;
+  }
+
+  /**
+   * Formatted into a private stream and written to `out` in one call: the
+   * SIGUSR1 watcher reports from its own thread, and must not touch the
+   * format state of a stream the program is printing to meanwhile.
+   */
+  std::ostringstream text;
+  text << "\n  Instrumentation (" << threads << " thread"
+       << (threads == 1 ? "" : "s") << ", " << std::fixed
+       << std::setprecision(3) << wallNs / 1e9 << " s wall, timer "
+       << std::setprecision(2) << ticksPerNs << " GHz):\n"
+       << "    " << std::left << std::setw(16) << "Probe" << std::right
+       << std::setw(14) << "Calls" << std::setw(11) << "ns/call"
+       << std::setw(12) << "Total ms" << std::setw(9) << "% wall"
+       << "\n";
+
+  for (std::size_t i = 0; i < ProbeCount; ++i) {
+    const ProbeTotals &probe = totals[i];
+    if (probe.Calls == 0) {
+      continue;
+    }
+    text << "    " << std::left << std::setw(16)
+         << ToString(static_cast<Probe>(i)) << std::right << std::setw(14)
+         << probe.Calls;
+    if (probe.Timed == 0) {
+      // Count-only probe, or no call of this one sampled yet
+      text << std::setw(11) << "-" << "\n";
+      continue;
+    }
+    // Sampled probes: scale the mean timed call up to every call
+    double ticksPerCall = static_cast<double>(probe.Ticks) /
+                          static_cast<double>(probe.Timed);
+    double nsPerCall = std::max(ticksPerCall - overhead, 0.0) / ticksPerNs;
+    double totalNs = nsPerCall * static_cast<double>(probe.Calls);
+    text << std::setprecision(1) << std::setw(11) << nsPerCall
+         << std::setw(12) << totalNs / 1e6 << std::setw(8)
+         << (wallNs > 0.0 ? totalNs / wallNs * 100.0 : 0.0) << "%\n";
+  }
+
+  out << text.str();
+}
+
+#if defined(AURELIA_HAS_SIGUSR1)
+
+namespace {
+
+// Lock-free, so setting it is async-signal-safe
+std::atomic<bool> g_ReportRequested{false};
+
+extern "C" void OnReportSignal(int) {
+  g_ReportRequested.store(true, std::memory_order_relaxed);
+}
+
+} // namespace
+
+void InstallSignalReporter(std::ostream &out) {
+  static std::once_flag once;
+  std::call_once(once, [&out] {
+    // Joined at exit; the poll interval bounds how long that takes
+    static std::jthread watcher([&out](std::stop_token stop) {
+      while (!stop.stop_requested()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        if (g_ReportRequested.exchange(false, std::memory_order_relaxed)) {
+          Report(out);
+          out.flush();
+        }
+      }
+    });
+    std::signal(SIGUSR1, OnReportSignal);
+  });
+}
+
+#else
+
+void InstallSignalReporter(std::ostream & /*out*/) {}
+
+#endif
+
+#else
+
+std::array<ProbeTotals, ProbeCount> Snapshot() { return {}; }
+
+void Reset() {}
+
+double TicksPerSecond() { return 0.0; }
+
+void Report(std::ostream & /*out*/) {}
+
+void InstallSignalReporter(std::ostream & /*out*/) {}
+
+#endif
+
+} // namespace Aurelia::Core::Instrument
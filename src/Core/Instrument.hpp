@@ -0,0 +1,282 @@
+/**
+ * Hot-Path Instrumentation.
+ *
+ * Built-in counters and scoped timers for the simulator's own hot paths,
+ * so "where does simulation time go?" can be answered without attaching
+ * an external profiler.
+ *
+ * BUILD SWITCH:
+ * Configure with -DAURELIA_INSTRUMENT=ON to compile the probes in. Without
+ * it the AURELIA_INSTRUMENT_* macros expand to nothing and Enabled is
+ * false, so a normal build carries no trace of them.
+ *
+ * PROBES:
+ * ┌───────────────────┬──────────┬──────────────────────────────────────┐
+ * │ Probe             │ Timed    │ Placed in                            │
+ * ├───────────────────┼──────────┼──────────────────────────────────────┤
+ * │ Cpu/Fetch ..      │ 1/1024   │ Cpu::OnTick, one per pipeline stage  │
+ * │   Cpu/WriteBack   │          │                                      │
+ * │ Bus/Decode        │ 1/1024   │ Bus::OnTick, address decode and      │
+ * │                   │          │ device dispatch (non-idle ticks)     │
+ * │ Ram/Read, Write   │ 1/1024   │ RamDevice single-word accesses       │
+ * │ Ram/Block         │ every    │ RamDevice bulk (DMA) transfers       │
+ * │ Ram/FaultIn       │ count    │ Image pages decoded on demand        │
+ * │ Ftl/Write, Read   │ every    │ Ftl::Write, Ftl::Read                │
+ * │ Ftl/GC            │ every    │ Ftl::GarbageCollect                  │
+ * │ Ftl/GcCopy        │ count    │ Valid pages migrated by GC           │
+ * │ Nvme/Command      │ every    │ StorageController::ExecuteCommand    │
+ * └───────────────────┴──────────┴──────────────────────────────────────┘
+ *
+ * COST:
+ * Each thread owns its own slots, so recording is a plain increment with
+ * no lock and no shared cache line. Timers read the TSC (steady_clock off
+ * x86) around the scope. Probes that fire every few nanoseconds time only
+ * every 1024th call and scale the result up; the call count stays exact.
+ *
+ * NOTE (KleaSCM) Times are inclusive: Bus/Decode contains the Ram/Read it
+ * dispatched to. Report() subtracts the measured cost of the timer itself
+ * (one TSC read, tens of ns under some hypervisors), but what remains for
+ * the few-ns pipeline stages is still only good as a relative weight.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+#if defined(AURELIA_INSTRUMENT) && AURELIA_INSTRUMENT
+#define AURELIA_INSTRUMENT_ENABLED 1
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+#else
+#define AURELIA_INSTRUMENT_ENABLED 0
+#endif
+
+namespace Aurelia::Core::Instrument {
+
+#if AURELIA_INSTRUMENT_ENABLED
+inline constexpr bool Enabled = true;
+#else
+inline constexpr bool Enabled = false;
+#endif
+
+enum class Probe : std::uint8_t {
+  CpuFetch,
+  CpuDecode,
+  CpuExecute,
+  CpuMemory,
+  CpuWriteBack,
+  BusDecode,
+  RamRead,
+  RamWrite,
+  RamBlock,
+  RamFaultIn,
+  FtlWrite,
+  FtlRead,
+  FtlGc,
+  FtlGcCopy,
+  NvmeCommand,
+  Count
+};
+
+inline constexpr std::size_t ProbeCount =
+    static_cast<std::size_t>(Probe::Count);
+
+[[nodiscard]] const char *ToString(Probe probe);
+
+/**
+ * @brief Calls mask of a probe: a call is timed when its low bits match
+ * SamplePhase().
+ */
+[[nodiscard]] constexpr std::uint64_t SampleMask(Probe probe) {
+  switch (probe) {
+  case Probe::CpuFetch:
+  case Probe::CpuDecode:
+  case Probe::CpuExecute:
+  case Probe::CpuMemory:
+  case Probe::CpuWriteBack:
+  case Probe::BusDecode:
+  case Probe::RamRead:
+  case Probe::RamWrite:
+    return 1023;
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief Which call in each mask period is timed.
+ *
+ * Staggered per probe: nested probes that fire in lockstep (Bus/Decode
+ * around Ram/Read) would otherwise sample the same call, and the outer
+ * one would time the inner one's timer as well.
+ */
+[[nodiscard]] constexpr std::uint64_t SamplePhase(Probe probe) {
+  return (static_cast<std::uint64_t>(probe) * 131) & SampleMask(probe);
+}
+
+/**
+ * Totals for one probe, summed over every thread that recorded it.
+ */
+struct ProbeTotals {
+  std::uint64_t Calls = 0;
+  std::uint64_t Timed = 0; // Calls whose scope was timed
+  std::uint64_t Ticks = 0; // Timer ticks over the timed calls
+};
+
+/**
+ * @brief Sum every thread's slots.
+ */
+[[nodiscard]] std::array<ProbeTotals, ProbeCount> Snapshot();
+
+/**
+ * @brief Zero every thread's slots and restart the wall-clock reference.
+ */
+void Reset();
+
+/**
+ * @brief Timer ticks per second, measured against steady_clock.
+ */
+[[nodiscard]] double TicksPerSecond();
+
+/**
+ * @brief Print one row per probe that fired (nothing if disabled).
+ *
+ * The report is written to `out` in a single call and leaves its format
+ * flags alone, so it is safe next to other output on the same stream.
+ */
+void Report(std::ostream &out);
+
+/**
+ * @brief Print a report to `out` whenever the process receives SIGUSR1.
+ *
+ * A watcher thread does the printing, so the signal handler only sets a
+ * flag; the program may keep printing to `out` from its own threads.
+ * No-op when disabled or on hosts without POSIX signals.
+ */
+void InstallSignalReporter(std::ostream &out);
+
+#if AURELIA_INSTRUMENT_ENABLED
+
+// ============================================================================
+// Recording (only compiled with AURELIA_INSTRUMENT)
+// ============================================================================
+
+/**
+ * One thread's counters. Only the owning thread writes them; Snapshot()
+ * reads them from another thread, hence relaxed atomics (a plain
+ * load/add/store on x86, not a locked add).
+ */
+struct Slot {
+  std::atomic<std::uint64_t> Calls{0};
+  std::atomic<std::uint64_t> Timed{0};
+  std::atomic<std::uint64_t> Ticks{0};
+};
+
+struct ThreadSlots {
+  std::array<Slot, ProbeCount> Slots;
+  bool Attached = false; // Listed with the registry Snapshot() reads
+};
+
+/**
+ * @brief List the calling thread's slots with the registry.
+ *
+ * Called once per thread, from the first probe it records.
+ */
+void AttachThread();
+
+// Constant-initialised, so access is a direct TLS offset with no guard
+inline thread_local ThreadSlots t_Slots;
+
+inline Slot &LocalSlot(Probe probe) {
+  return t_Slots.Slots[static_cast<std::size_t>(probe)];
+}
+
+inline void Bump(std::atomic<std::uint64_t> &counter, std::uint64_t by) {
+  counter.store(counter.load(std::memory_order_relaxed) + by,
+                std::memory_order_relaxed);
+}
+
+inline std::uint64_t ReadTicks() {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return static_cast<std::uint64_t>(
+      std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+inline void Count(Probe probe, std::uint64_t by = 1) {
+  if (!t_Slots.Attached) [[unlikely]] {
+    AttachThread();
+  }
+  Bump(LocalSlot(probe).Calls, by);
+}
+
+/**
+ * Counts a call and, if this call is sampled, times the enclosing scope.
+ */
+class ScopedTimer {
+public:
+  explicit ScopedTimer(Probe probe) : m_Slot(LocalSlot(probe)) {
+    if (!t_Slots.Attached) [[unlikely]] {
+      AttachThread();
+    }
+    std::uint64_t calls = m_Slot.Calls.load(std::memory_order_relaxed);
+    m_Slot.Calls.store(calls + 1, std::memory_order_relaxed);
+    if ((calls & SampleMask(probe)) == SamplePhase(probe)) {
+      m_Start = ReadTicks();
+      m_Sampled = true;
+    }
+  }
+
+  ~ScopedTimer() {
+    if (m_Sampled) {
+      Bump(m_Slot.Ticks, ReadTicks() - m_Start);
+      Bump(m_Slot.Timed, 1);
+    }
+  }
+
+  ScopedTimer(const ScopedTimer &) = delete;
+  ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+private:
+  Slot &m_Slot;
+  std::uint64_t m_Start = 0;
+  bool m_Sampled = false;
+};
+
+#endif
+
+} // namespace Aurelia::Core::Instrument
+
+#if AURELIA_INSTRUMENT_ENABLED
+#define AURELIA_INSTRUMENT_CONCAT2(a, b) a##b
+#define AURELIA_INSTRUMENT_CONCAT(a, b) AURELIA_INSTRUMENT_CONCAT2(a, b)
+
+/**
+ * Time the rest of the enclosing scope under `probe` (a Probe enumerator).
+ */
+#define AURELIA_INSTRUMENT_SCOPE(probe)                                        \
+  ::Aurelia::Core::Instrument::ScopedTimer AURELIA_INSTRUMENT_CONCAT(          \
+      InstrumentScope_, __LINE__)(::Aurelia::Core::Instrument::Probe::probe)
+
+/**
+ * Add `n` to the call count of `probe` without timing anything.
+ */
+#define AURELIA_INSTRUMENT_COUNT(probe, n)                                     \
+  ::Aurelia::Core::Instrument::Count(                                          \
+      ::Aurelia::Core::Instrument::Probe::probe, (n))
+#else
+#define AURELIA_INSTRUMENT_SCOPE(probe)
+#define AURELIA_INSTRUMENT_COUNT(probe, n)
+#endif
@@ -0,0 +1,71 @@
+/**
+ * Fixed-Capacity Ring Buffer.
+ *
+ * Allocation-free FIFO used to model hardware queues (UART FIFOs, host
+ * input staging). Capacity is a compile-time power of two so index wrap
+ * is a mask rather than a modulo.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+
+namespace Aurelia::Core {
+
+template <typename T, std::size_t N>
+  requires(std::has_single_bit(N))
+class RingBuffer {
+public:
+  static constexpr std::size_t Capacity = N;
+
+  /**
+   * @brief Append an element.
+   * @return false (and drops the element) if the buffer is full
+   */
+  bool Push(const T &value) {
+    if (m_Count == N) {
+      return false;
+    }
+    m_Storage[(m_Head + m_Count) & Mask] = value;
+    m_Count++;
+    return true;
+  }
+
+  /**
+   * @brief Remove the oldest element.
+   * @return false if the buffer is empty
+   */
+  bool Pop(T &out) {
+    if (m_Count == 0) {
+      return false;
+    }
+    out = m_Storage[m_Head];
+    m_Head = (m_Head + 1) & Mask;
+    m_Count--;
+    return true;
+  }
+
+  [[nodiscard]] const T &Front() const { return m_Storage[m_Head]; }
+  [[nodiscard]] std::size_t Size() const { return m_Count; }
+  [[nodiscard]] bool IsEmpty() const { return m_Count == 0; }
+  [[nodiscard]] bool IsFull() const { return m_Count == N; }
+
+  void Clear() {
+    m_Head = 0;
+    m_Count = 0;
+  }
+
+private:
+  static constexpr std::size_t Mask = N - 1;
+
+  std::array<T, N> m_Storage{};
+  std::size_t m_Head = 0; // Oldest element
+  std::size_t m_Count = 0;
+};
+
+} // namespace Aurelia::Core
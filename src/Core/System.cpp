@@ -9,20 +9,43 @@
 
 namespace Aurelia::Core {
 
-void System::AddDevice(ITickable *device) { m_Devices.push_back(device); }
+void System::AddDevice(ITickable *device, TickCount divider) {
+  if (divider <= 1) {
+    m_Devices.push_back(device);
+    return;
+  }
 
-void System::Run(TickCount cycles) {
-  for (TickCount i = 0; i < cycles; ++i) {
-    // Update global time
-    m_Clock.Tick();
+  DividedDevice slot;
+  slot.Device = device;
+  slot.Divider = divider;
+  slot.Countdown = divider;
+  m_DividedDevices.push_back(slot);
+}
+
+void System::Step() {
+  // Update global time
+  m_Clock.Tick();
+
+  // Notify full-rate devices
+  for (auto *device : m_Devices) {
+    device->OnTick();
+  }
 
-    // Notify all devices
-    for (auto *device : m_Devices) {
-      device->OnTick();
+  // Notify divided devices whose clock edge falls on this cycle
+  for (auto &slot : m_DividedDevices) {
+    if (--slot.Countdown == 0) {
+      slot.Countdown = slot.Divider;
+      slot.Device->OnTick();
     }
   }
 }
 
+void System::Run(TickCount cycles) {
+  for (TickCount i = 0; i < cycles; ++i) {
+    Step();
+  }
+}
+
 const Clock &System::GetClock() const { return m_Clock; }
 
 } // namespace Aurelia::Core
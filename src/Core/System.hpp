@@ -3,6 +3,47 @@
  *
  * Orchestrates the simulation lifecycle and component updates.
  *
+ * Every registered device is ticked from one place, so bus latency
+ * counters, timers and storage busy periods all advance in lockstep with
+ * the CPU.
+ *
+ * TICK DIVIDERS:
+ * Not every device needs the full CPU clock. A device registered with
+ * divider N is ticked once every N system cycles, i.e. it runs on a
+ * derived clock of CPU/N, like a peripheral clock domain on a real SoC.
+ *
+ * ┌──────────────┬─────────┬─────────────────────────────────────┐
+ * │ Device       │ Divider │ Ticked on cycles                    │
+ * ├──────────────┼─────────┼─────────────────────────────────────┤
+ * │ CPU, Bus     │ 1       │ 1, 2, 3, 4, ...                     │
+ * │ Timer        │ 4       │ 4, 8, 12, ...                       │
+ * │ Input pump   │ 1024    │ 1024, 2048, ...                     │
+ * └──────────────┴─────────┴─────────────────────────────────────┘
+ *
+ * ORDERING:
+ * Within a cycle, full-rate devices tick first in registration order,
+ * then due divided devices in registration order. Register the CPU
+ * before the Bus, as the bus completes the transfer the CPU requested
+ * in the same cycle.
+ *
+ * TIME SLICING:
+ * RunSlice() runs for at most one quantum and then returns, leaving every
+ * device exactly as it was at that cycle boundary. Calling it again
+ * resumes the machine as if it had never stopped, so a host thread can
+ * interleave many machines the way an OS scheduler interleaves processes.
+ *
+ * ┌──────────────┬────────────────────────────────────────────────────┐
+ * │ RunExit      │ Meaning                                            │
+ * ├──────────────┼────────────────────────────────────────────────────┤
+ * │ Done         │ The stop condition held                            │
+ * │ Yielded      │ Quantum used up; call RunSlice() again to continue │
+ * │ LimitReached │ Total cycle count hit SetCycleLimit(); terminal    │
+ * └──────────────┴────────────────────────────────────────────────────┘
+ *
+ * NOTE (KleaSCM) The cycle limit is absolute (total ticks since power-on),
+ * not per call, so it bounds a machine identically however its run was
+ * cut into slices.
+ *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
  */
@@ -11,19 +52,110 @@
 
 #include "Core/Clock.hpp"
 #include "Core/ITickable.hpp"
+#include <cstdint>
 #include <vector>
 
 namespace Aurelia::Core {
 
+enum class RunExit : std::uint8_t { Done, Yielded, LimitReached };
+
 class System {
 public:
-  void AddDevice(ITickable *device);
+  /**
+   * @brief Register a device on the system clock.
+   *
+   * @param device  Device to tick (not owned)
+   * @param divider Tick once every `divider` cycles (0 is treated as 1)
+   */
+  void AddDevice(ITickable *device, TickCount divider = 1);
+
+  /**
+   * @brief Advance the system by exactly `cycles` clock cycles.
+   */
   void Run(TickCount cycles);
+
+  /**
+   * @brief Advance one cycle at a time until `done()` holds.
+   *
+   * The predicate is evaluated after every cycle.
+   *
+   * @param done      Stop condition (e.g. CPU halted)
+   * @param maxCycles Safety limit
+   * @return Number of cycles executed
+   */
+  template <typename Predicate>
+  TickCount RunUntil(Predicate &&done, TickCount maxCycles) {
+    TickCount executed = 0;
+    while (executed < maxCycles) {
+      Step();
+      executed++;
+      if (done()) {
+        break;
+      }
+    }
+    return executed;
+  }
+
+  /**
+   * @brief Run until `done()` holds, for at most `quantum` cycles.
+   *
+   * Also stops once the total cycle count reaches the cycle limit. The
+   * predicate is evaluated after every cycle.
+   *
+   * @param done    Stop condition (e.g. CPU halted)
+   * @param quantum Cycles to run before yielding back to the caller
+   */
+  template <typename Predicate>
+  RunExit RunSlice(Predicate &&done, TickCount quantum) {
+    TickCount slice = quantum;
+    bool limited = false;
+    if (m_CycleLimit != 0) {
+      TickCount now = m_Clock.GetTotalTicks();
+      if (now >= m_CycleLimit) {
+        return RunExit::LimitReached;
+      }
+      if (m_CycleLimit - now <= quantum) {
+        slice = m_CycleLimit - now;
+        limited = true;
+      }
+    }
+
+    // A slice cut short, or ending on the cycle where `done` became true
+    if (RunUntil(done, slice) < slice || done()) {
+      return RunExit::Done;
+    }
+    return limited ? RunExit::LimitReached : RunExit::Yielded;
+  }
+
+  /**
+   * @brief Cap the total cycle count for RunSlice() (0 = unlimited).
+   */
+  void SetCycleLimit(TickCount limit) { m_CycleLimit = limit; }
+  [[nodiscard]] TickCount GetCycleLimit() const { return m_CycleLimit; }
+
+  /**
+   * @brief Advance a single clock cycle.
+   */
+  void Step();
+
   [[nodiscard]] const Clock &GetClock() const;
 
 private:
+  struct DividedDevice {
+    ITickable *Device = nullptr;
+    TickCount Divider = 1;
+    TickCount Countdown = 1; // Cycles until next tick
+  };
+
   Clock m_Clock;
+  TickCount m_CycleLimit = 0; // Absolute; 0 = unlimited
+
+  /**
+   * Full-rate devices live in their own flat array so the common path
+   * is a plain loop of virtual calls with no per-device countdown.
+   */
   std::vector<ITickable *> m_Devices;
+  std::vector<DividedDevice> m_DividedDevices;
 };
 
 } // namespace Aurelia::Core
@@ -8,6 +8,7 @@
 #include <cstring>
 
 #include "Core/BitManip.hpp"
+#include "Core/Instrument.hpp"
 #include "Cpu/Alu.hpp"
 #include "Cpu/Cpu.hpp"
 #include "Cpu/Decoder.hpp"
@@ -25,6 +26,7 @@ void Cpu::Reset(Core::Address StartAddress) {
   GPR.fill(0);
   MicroOp = 0;
   Halted = false;
+  Retired = 0;
 }
 
 Core::Word Cpu::GetRegister(Register Reg) const {
@@ -48,6 +50,7 @@ void Cpu::OnTick() {
 
   switch (State) {
   case CpuState::Fetch: {
+    AURELIA_INSTRUMENT_SCOPE(CpuFetch);
     if (MicroOp == 0) {
       /**
        * FETCH PHASE 1: REQUEST
@@ -80,6 +83,7 @@ void Cpu::OnTick() {
   }
 
   case CpuState::Decode: {
+    AURELIA_INSTRUMENT_SCOPE(CpuDecode);
     /**
      * DECODE STAGE
      *
@@ -107,6 +111,7 @@ void Cpu::OnTick() {
   }
 
   case CpuState::Execute: {
+    AURELIA_INSTRUMENT_SCOPE(CpuExecute);
     /**
      * EXECUTE STAGE
      *
@@ -148,6 +153,7 @@ void Cpu::OnTick() {
     case Opcode::Halt:
       // HALT instruction - stop execution
       Halted = true;
+      Retired++;
       return;
     default:
       break;
@@ -169,6 +175,7 @@ void Cpu::OnTick() {
         State = CpuState::Fetch; // Flush pipeline (simplification: just go to
                                  // fetch)
         MicroOp = 0;
+        Retired++; // Taken branches skip WriteBack
         return;
       }
     } else if (CurrentInstr.Op == Opcode::LDR ||
@@ -190,6 +197,7 @@ void Cpu::OnTick() {
   }
 
   case CpuState::Memory: {
+    AURELIA_INSTRUMENT_SCOPE(CpuMemory);
     /**
      * MEMORY STAGE
      *
@@ -225,6 +233,7 @@ void Cpu::OnTick() {
   }
 
   case CpuState::WriteBack: {
+    AURELIA_INSTRUMENT_SCOPE(CpuWriteBack);
     /**
      * WRITEBACK STAGE
      *
@@ -244,6 +253,7 @@ void Cpu::OnTick() {
     PC += 4;
     State = CpuState::Fetch;
     MicroOp = 0;
+    Retired++;
     break;
   }
   }
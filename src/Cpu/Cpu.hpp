@@ -12,6 +12,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 
 #include "Bus/Bus.hpp"
 #include "Core/ITickable.hpp"
@@ -43,6 +44,9 @@ public:
   [[nodiscard]] CpuState GetState() const { return State; }
   [[nodiscard]] bool IsHalted() const { return Halted; }
 
+  // Instructions completed since Reset(); cycles / this is the CPI
+  [[nodiscard]] std::uint64_t GetRetiredCount() const { return Retired; }
+
 private:
   Bus::Bus *SystemBus = nullptr;
 
@@ -61,8 +65,9 @@ private:
   Core::Word AluResult = 0; // Execute -> Memory/WB
   Core::Data MemData = 0;   // Memory -> WB
 
-  bool Halted = false; // HALT instruction executed
-  int MicroOp = 0;     // For multi-cycle stages (Fetch/Memory)
+  bool Halted = false;       // HALT instruction executed
+  int MicroOp = 0;           // For multi-cycle stages (Fetch/Memory)
+  std::uint64_t Retired = 0; // Completed instructions
 };
 
 } // namespace Aurelia::Cpu
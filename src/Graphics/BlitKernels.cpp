@@ -0,0 +1,158 @@
+/**
+ * Blit Kernels Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Graphics/BlitKernels.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define AURELIA_HAS_SSE2 1
+#endif
+
+namespace Aurelia::Graphics::BlitKernels {
+
+namespace {
+
+constexpr std::uint32_t Div255(std::uint32_t x) {
+  x += 128;
+  return (x + (x >> 8)) >> 8;
+}
+
+#if defined(AURELIA_HAS_SSE2)
+/**
+ * @brief Blend two pixels held as eight u16 lanes.
+ *
+ * @param s   Source channels, alpha lane already forced to 255
+ * @param d   Destination channels
+ * @param a   Source alpha broadcast to each pixel's four lanes
+ */
+inline __m128i Blend16(__m128i s, __m128i d, __m128i a) {
+  const __m128i max = _mm_set1_epi16(255);
+  const __m128i bias = _mm_set1_epi16(128);
+
+  __m128i inv = _mm_sub_epi16(max, a);
+  __m128i x = _mm_add_epi16(_mm_mullo_epi16(s, a), _mm_mullo_epi16(d, inv));
+  x = _mm_add_epi16(x, bias);
+  x = _mm_add_epi16(x, _mm_srli_epi16(x, 8));
+  return _mm_srli_epi16(x, 8);
+}
+#endif
+
+} // namespace
+
+bool HasSimd() {
+#if defined(AURELIA_HAS_SSE2)
+  return true;
+#else
+  return false;
+#endif
+}
+
+// -------------------------------------------------------------------------
+// Scalar Reference
+// -------------------------------------------------------------------------
+
+void Scalar::FillRow(std::uint32_t *dst, std::size_t count,
+                     std::uint32_t color) {
+  for (std::size_t i = 0; i < count; ++i) {
+    dst[i] = color;
+  }
+}
+
+void Scalar::BlendRow(std::uint32_t *dst, const std::uint32_t *src,
+                      std::size_t count) {
+  for (std::size_t i = 0; i < count; ++i) {
+    std::uint32_t s = src[i] | 0xFF000000u; // Alpha lane blends 255 * a
+    std::uint32_t d = dst[i];
+    std::uint32_t a = src[i] >> 24;
+    std::uint32_t inv = 255 - a;
+
+    std::uint32_t out = 0;
+    for (std::uint32_t shift = 0; shift < 32; shift += 8) {
+      std::uint32_t sc = (s >> shift) & 0xFF;
+      std::uint32_t dc = (d >> shift) & 0xFF;
+      out |= Div255(sc * a + dc * inv) << shift;
+    }
+    dst[i] = out;
+  }
+}
+
+void Scalar::KeyedRow(std::uint32_t *dst, const std::uint32_t *src,
+                      std::size_t count, std::uint32_t key) {
+  for (std::size_t i = 0; i < count; ++i) {
+    if (src[i] != key) {
+      dst[i] = src[i];
+    }
+  }
+}
+
+// -------------------------------------------------------------------------
+// Dispatch
+// -------------------------------------------------------------------------
+
+void FillRow(std::uint32_t *dst, std::size_t count, std::uint32_t color) {
+#if defined(AURELIA_HAS_SSE2)
+  const __m128i c = _mm_set1_epi32(static_cast<int>(color));
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), c);
+  }
+  Scalar::FillRow(dst + i, count - i, color);
+#else
+  Scalar::FillRow(dst, count, color);
+#endif
+}
+
+void BlendRow(std::uint32_t *dst, const std::uint32_t *src,
+              std::size_t count) {
+#if defined(AURELIA_HAS_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i alphaLane = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+
+    // Alpha of each pixel copied into both u16 halves of its u32 lane
+    __m128i a = _mm_srli_epi32(s, 24);
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+
+    __m128i sf = _mm_or_si128(s, alphaLane);
+    __m128i lo = Blend16(_mm_unpacklo_epi8(sf, zero),
+                         _mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi32(a, a));
+    __m128i hi = Blend16(_mm_unpackhi_epi8(sf, zero),
+                         _mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi32(a, a));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i),
+                     _mm_packus_epi16(lo, hi));
+  }
+  Scalar::BlendRow(dst + i, src + i, count - i);
+#else
+  Scalar::BlendRow(dst, src, count);
+#endif
+}
+
+void KeyedRow(std::uint32_t *dst, const std::uint32_t *src, std::size_t count,
+              std::uint32_t key) {
+#if defined(AURELIA_HAS_SSE2)
+  const __m128i k = _mm_set1_epi32(static_cast<int>(key));
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+    __m128i keep = _mm_cmpeq_epi32(s, k); // All-ones where dst survives
+    __m128i out = _mm_or_si128(_mm_and_si128(keep, d),
+                               _mm_andnot_si128(keep, s));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), out);
+  }
+  Scalar::KeyedRow(dst + i, src + i, count - i, key);
+#else
+  Scalar::KeyedRow(dst, src, count, key);
+#endif
+}
+
+} // namespace Aurelia::Graphics::BlitKernels
@@ -0,0 +1,69 @@
+/**
+ * Blit Kernels.
+ *
+ * Row-level pixel kernels used by the BlitterDevice. Every kernel works
+ * on one run of RGBA8888 pixels (as packed little-endian u32: R in the low
+ * byte, A in the high byte).
+ *
+ * KERNELS:
+ * ┌────────────┬─────────────────────────────────────────────────────┐
+ * │ Kernel     │ Operation (per pixel)                               │
+ * ├────────────┼─────────────────────────────────────────────────────┤
+ * │ FillRow    │ dst = color                                         │
+ * │ BlendRow   │ dst = src OVER dst (straight alpha from src)        │
+ * │ KeyedRow   │ dst = (src == key) ? dst : src                      │
+ * └────────────┴─────────────────────────────────────────────────────┘
+ *
+ * Plain copies need no kernel: rows are moved with memmove, which the
+ * host C library already vectorises.
+ *
+ * SIMD:
+ * On x86-64 the kernels use SSE2 (part of the base ISA, so no runtime
+ * dispatch is needed) and process four pixels per step. Other hosts use
+ * the scalar versions. The scalar versions are always compiled and are
+ * bit-exact with the SIMD ones; the tests compare the two.
+ *
+ * BLEND ARITHMETIC:
+ *   out.c = div255(src.c * a + dst.c * (255 - a))       c ∈ {R, G, B}
+ *   out.a = div255(255   * a + dst.a * (255 - a))
+ *   div255(x) = (x + 128 + ((x + 128) >> 8)) >> 8       exact rounding
+ *
+ * Every intermediate fits in 16 bits, which is what lets SSE2 blend eight
+ * channels per multiply.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace Aurelia::Graphics::BlitKernels {
+
+/**
+ * @brief True if the SIMD kernels are compiled in on this host.
+ */
+[[nodiscard]] bool HasSimd();
+
+void FillRow(std::uint32_t *dst, std::size_t count, std::uint32_t color);
+void BlendRow(std::uint32_t *dst, const std::uint32_t *src,
+              std::size_t count);
+void KeyedRow(std::uint32_t *dst, const std::uint32_t *src, std::size_t count,
+              std::uint32_t key);
+
+/**
+ * REFERENCE IMPLEMENTATIONS
+ *
+ * Used for the tail of each SIMD row and on hosts without SIMD.
+ */
+namespace Scalar {
+void FillRow(std::uint32_t *dst, std::size_t count, std::uint32_t color);
+void BlendRow(std::uint32_t *dst, const std::uint32_t *src,
+              std::size_t count);
+void KeyedRow(std::uint32_t *dst, const std::uint32_t *src, std::size_t count,
+              std::uint32_t key);
+} // namespace Scalar
+
+} // namespace Aurelia::Graphics::BlitKernels
@@ -0,0 +1,253 @@
+/**
+ * 2D Blitter Device Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Graphics/BlitterDevice.hpp"
+#include "Graphics/BlitKernels.hpp"
+#include "System/MemoryMap.hpp"
+#include <cstring>
+
+namespace Aurelia::Graphics {
+
+namespace {
+
+constexpr std::uint32_t PackXy(std::uint32_t x, std::uint32_t y) {
+  return (y << 16) | x;
+}
+
+} // namespace
+
+BlitterDevice::BlitterDevice()
+    : m_BaseAddr(System::BlitterBase), m_RowScratch(GpuDevice::Width, 0) {}
+
+bool BlitterDevice::IsAddressInRange(Core::Address addr) const {
+  return addr >= m_BaseAddr && addr < m_BaseAddr + RegisterBlockSize;
+}
+
+bool BlitterDevice::OnRead(Core::Address addr, Core::Data &outData) {
+  switch (addr - m_BaseAddr) {
+  case DstXyOffset:
+    outData = PackXy(m_Staging.DstX, m_Staging.DstY);
+    return true;
+
+  case SrcXyOffset:
+    outData = PackXy(m_Staging.SrcX, m_Staging.SrcY);
+    return true;
+
+  case SizeOffset:
+    outData = PackXy(m_Staging.Width, m_Staging.Height);
+    return true;
+
+  case ColorOffset:
+    outData = m_Staging.Color;
+    return true;
+
+  case ColorKeyOffset:
+    outData = m_Staging.Key;
+    return true;
+
+  case StatusOffset: {
+    std::uint32_t status = static_cast<std::uint32_t>(m_Queue.Size()) << 8;
+    if (IsBusy()) {
+      status |= StatusBusy;
+    }
+    if (m_Queue.IsFull()) {
+      status |= StatusFull;
+    }
+    if (m_Error) {
+      status |= StatusError;
+      m_Error = false; // Sticky until observed
+    }
+    outData = status;
+    return true;
+  }
+
+  case ControlOffset:
+    outData = m_Control;
+    return true;
+
+  case CompletedOffset:
+    outData = static_cast<std::uint32_t>(m_Completed);
+    return true;
+
+  default:
+    outData = 0; // RAZ, including write-only COMMAND
+    return true;
+  }
+}
+
+bool BlitterDevice::OnWrite(Core::Address addr, Core::Data inData) {
+  auto value = static_cast<std::uint32_t>(inData);
+
+  switch (addr - m_BaseAddr) {
+  case DstXyOffset:
+    m_Staging.DstX = value & 0xFFFF;
+    m_Staging.DstY = value >> 16;
+    return true;
+
+  case SrcXyOffset:
+    m_Staging.SrcX = value & 0xFFFF;
+    m_Staging.SrcY = value >> 16;
+    return true;
+
+  case SizeOffset:
+    m_Staging.Width = value & 0xFFFF;
+    m_Staging.Height = value >> 16;
+    return true;
+
+  case ColorOffset:
+    m_Staging.Color = value;
+    return true;
+
+  case ColorKeyOffset:
+    m_Staging.Key = value;
+    return true;
+
+  case CommandOffset: {
+    /**
+     * ENQUEUE
+     *
+     * A full queue stalls the store; an invalid command is dropped and
+     * flagged so a bad parameter cannot wedge the CPU.
+     */
+    BlitCommand cmd = m_Staging;
+    cmd.Op = static_cast<BlitOp>(value & 0xFF);
+    if (!IsValid(cmd)) {
+      m_Error = true;
+      m_Rejected++;
+      return true;
+    }
+    return Submit(cmd);
+  }
+
+  case ControlOffset:
+    m_Control = value & ControlIrqEnable;
+    return true;
+
+  default:
+    return true; // Read-only and undefined registers ignore writes
+  }
+}
+
+bool BlitterDevice::Submit(const BlitCommand &cmd) {
+  if (!IsValid(cmd)) {
+    return false;
+  }
+  return m_Queue.Push(cmd);
+}
+
+bool BlitterDevice::IsValid(const BlitCommand &cmd) {
+  if (cmd.Width == 0 || cmd.Height == 0 || cmd.Width > GpuDevice::Width ||
+      cmd.Height > GpuDevice::Height ||
+      cmd.DstX > GpuDevice::Width - cmd.Width ||
+      cmd.DstY > GpuDevice::Height - cmd.Height) {
+    return false;
+  }
+
+  switch (cmd.Op) {
+  case BlitOp::Fill:
+    return true;
+
+  case BlitOp::Copy:
+  case BlitOp::Blend:
+  case BlitOp::KeyedCopy:
+    return cmd.SrcX <= GpuDevice::Width - cmd.Width &&
+           cmd.SrcY <= GpuDevice::Height - cmd.Height;
+
+  default:
+    return false;
+  }
+}
+
+void BlitterDevice::OnTick() {
+  if (!m_Active) {
+    if (m_Queue.IsEmpty()) {
+      return; // Idle: no budget accumulates
+    }
+    StartNext();
+  }
+
+  m_Budget += PixelsPerTick;
+  while (m_Active && m_Budget >= m_Current.Width) {
+    m_Budget -= m_Current.Width;
+    ExecuteRow();
+
+    if (++m_Row == m_Current.Height) {
+      Complete();
+      if (!m_Queue.IsEmpty()) {
+        StartNext(); // Leftover budget carries into the next command
+      }
+    }
+  }
+
+  if (!m_Active) {
+    m_Budget = 0;
+  }
+}
+
+void BlitterDevice::StartNext() {
+  m_Queue.Pop(m_Current);
+  m_Active = true;
+  m_Row = 0;
+
+  // Destination below an overlapping source: walk rows bottom-up
+  m_BottomUp = m_Current.Op != BlitOp::Fill && m_Current.DstY > m_Current.SrcY;
+}
+
+void BlitterDevice::ExecuteRow() {
+  if (!m_Gpu) {
+    return;
+  }
+
+  const BlitCommand &cmd = m_Current;
+  std::uint32_t row = m_BottomUp ? cmd.Height - 1 - m_Row : m_Row;
+  std::uint32_t *pixels = m_Gpu->GetPixels().data();
+  std::uint32_t *dst = pixels +
+                       static_cast<std::size_t>(cmd.DstY + row) *
+                           GpuDevice::Width +
+                       cmd.DstX;
+
+  if (cmd.Op == BlitOp::Fill) {
+    BlitKernels::FillRow(dst, cmd.Width, cmd.Color);
+    return;
+  }
+
+  const std::uint32_t *src = pixels +
+                             static_cast<std::size_t>(cmd.SrcY + row) *
+                                 GpuDevice::Width +
+                             cmd.SrcX;
+  std::size_t bytes = static_cast<std::size_t>(cmd.Width) * sizeof(*dst);
+
+  if (cmd.Op == BlitOp::Copy) {
+    std::memmove(dst, src, bytes);
+    return;
+  }
+
+  // Read-modify-write kernels read the source row before any of it is
+  // overwritten, in case it overlaps the destination row.
+  std::memcpy(m_RowScratch.data(), src, bytes);
+  if (cmd.Op == BlitOp::Blend) {
+    BlitKernels::BlendRow(dst, m_RowScratch.data(), cmd.Width);
+  } else {
+    BlitKernels::KeyedRow(dst, m_RowScratch.data(), cmd.Width, cmd.Key);
+  }
+}
+
+void BlitterDevice::Complete() {
+  m_Active = false;
+  m_Completed++;
+
+  if (m_Gpu) {
+    m_Gpu->MarkDirty(
+        {m_Current.DstX, m_Current.DstY, m_Current.Width, m_Current.Height});
+  }
+
+  if (m_Queue.IsEmpty() && (m_Control & ControlIrqEnable) && m_Pic) {
+    m_Pic->RaiseIrq(Peripherals::PicDevice::IrqBlitter);
+  }
+}
+
+} // namespace Aurelia::Graphics
@@ -0,0 +1,209 @@
+/**
+ * 2D Blitter Device.
+ *
+ * Command-queue rectangle engine operating on GPU VRAM.
+ *
+ * PROBLEM:
+ * A guest filling the 640×480 screen pixel by pixel issues 153,600 bus
+ * stores (two pixels each), every one of them a full fetch/decode/execute
+ * round trip. Any compositor built on that is a slideshow.
+ *
+ * DESIGN:
+ * The guest programs a handful of parameter registers and writes an
+ * opcode to COMMAND. The parameters are snapshotted into a command queue
+ * and the guest continues immediately. The engine drains the queue in the
+ * background, a few rows per tick, using SIMD row kernels on the host
+ * (see BlitKernels.hpp). When the queue runs dry it raises IrqBlitter.
+ *
+ * REGISTER MAP (32-bit registers, 4-byte stride):
+ * ┌────────────┬─────────────────────────────────────────────────┐
+ * │ Offset     │ Register                                        │
+ * ├────────────┼─────────────────────────────────────────────────┤
+ * │ 0x0000     │ DST_XY    - Destination (Y << 16 | X) (RW)      │
+ * │ 0x0004     │ SRC_XY    - Source (Y << 16 | X) (RW)           │
+ * │ 0x0008     │ SIZE      - (Height << 16 | Width) (RW)         │
+ * │ 0x000C     │ COLOR     - Fill colour, RGBA8888 (RW)          │
+ * │ 0x0010     │ COLOR_KEY - Transparent source colour (RW)      │
+ * │ 0x0014     │ COMMAND   - Write opcode to enqueue (WO)        │
+ * │ 0x0018     │ STATUS    - Busy / queue state (RO)             │
+ * │ 0x001C     │ CONTROL   - Bit 0: IRQ_EN on queue drain (RW)   │
+ * │ 0x0020     │ COMPLETED - Commands finished since reset (RO)  │
+ * └────────────┴─────────────────────────────────────────────────┘
+ *
+ * OPCODES:
+ * ┌────┬────────────┬────────────────────────────────────────────────┐
+ * │ Op │ Name       │ Effect on the destination rectangle            │
+ * ├────┼────────────┼────────────────────────────────────────────────┤
+ * │ 1  │ FILL       │ Solid COLOR                                    │
+ * │ 2  │ COPY       │ Source rectangle; overlap-safe                 │
+ * │ 3  │ BLEND      │ Source OVER destination, source alpha          │
+ * │ 4  │ KEYED_COPY │ Copy, skipping source pixels equal to COLOR_KEY│
+ * └────┴────────────┴────────────────────────────────────────────────┘
+ *
+ * STATUS (Offset 0x18):
+ * - Bit 0 BUSY: A command is executing or queued
+ * - Bit 1 FULL: The queue has no free slot
+ * - Bit 2 ERROR: A command was rejected (sticky, cleared on read)
+ * - Bits 15:8: Queued commands (excluding the one executing)
+ *
+ * BACKPRESSURE:
+ * Writing COMMAND while the queue is full stalls the bus write (WAIT)
+ * until a slot frees, exactly like a slow memory. Software that wants to
+ * stay busy elsewhere polls FULL first.
+ *
+ * Commands with an unknown opcode, an empty size, or a rectangle that
+ * leaves the screen are rejected and set ERROR; nothing is clipped.
+ *
+ * TIMING:
+ * The engine moves PixelsPerTick pixels per tick and always finishes a
+ * whole row at a time, so a row wider than the budget takes several ticks.
+ * Overlapping copies run bottom-up when the destination is below the
+ * source; horizontal overlap within a row is handled by moving the source
+ * row first.
+ *
+ * NOTE (KleaSCM) The finished rectangle is reported to the GPU as dirty
+ * when the command completes, so a vsync in the middle of a long blit
+ * presents the previous contents of that region rather than half a blit.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Bus/IBusDevice.hpp"
+#include "Core/RingBuffer.hpp"
+#include "Core/Types.hpp"
+#include "Graphics/GpuDevice.hpp"
+#include "Peripherals/PicDevice.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Aurelia::Graphics {
+
+enum class BlitOp : std::uint8_t {
+  None = 0,
+  Fill = 1,
+  Copy = 2,
+  Blend = 3,
+  KeyedCopy = 4,
+};
+
+/**
+ * @brief Snapshot of the parameter registers taken at COMMAND write.
+ */
+struct BlitCommand {
+  BlitOp Op = BlitOp::None;
+  std::uint32_t DstX = 0;
+  std::uint32_t DstY = 0;
+  std::uint32_t SrcX = 0;
+  std::uint32_t SrcY = 0;
+  std::uint32_t Width = 0;
+  std::uint32_t Height = 0;
+  std::uint32_t Color = 0;
+  std::uint32_t Key = 0;
+};
+
+class BlitterDevice final : public Bus::IBusDevice {
+public:
+  static constexpr std::size_t QueueDepth = 16;
+  static constexpr std::uint32_t PixelsPerTick = 256;
+
+  /**
+   * REGISTER OFFSETS
+   */
+  static constexpr Core::Address DstXyOffset = 0x00;
+  static constexpr Core::Address SrcXyOffset = 0x04;
+  static constexpr Core::Address SizeOffset = 0x08;
+  static constexpr Core::Address ColorOffset = 0x0C;
+  static constexpr Core::Address ColorKeyOffset = 0x10;
+  static constexpr Core::Address CommandOffset = 0x14;
+  static constexpr Core::Address StatusOffset = 0x18;
+  static constexpr Core::Address ControlOffset = 0x1C;
+  static constexpr Core::Address CompletedOffset = 0x20;
+
+  /**
+   * STATUS / CONTROL BITS
+   */
+  static constexpr std::uint32_t StatusBusy = 1u << 0;
+  static constexpr std::uint32_t StatusFull = 1u << 1;
+  static constexpr std::uint32_t StatusError = 1u << 2;
+  static constexpr std::uint32_t ControlIrqEnable = 1u << 0;
+
+  /**
+   * @brief Construct idle blitter at MemoryMap::BlitterBase.
+   */
+  BlitterDevice();
+
+  void SetBaseAddress(Core::Address base) { m_BaseAddr = base; }
+
+  /**
+   * @brief Attach the GPU whose VRAM is drawn into.
+   *
+   * Commands submitted with no GPU connected complete without effect.
+   */
+  void ConnectGpu(GpuDevice *gpu) { m_Gpu = gpu; }
+
+  /**
+   * @brief Connect PIC for completion interrupts.
+   */
+  void ConnectPic(Peripherals::PicDevice *pic) { m_Pic = pic; }
+
+  [[nodiscard]] bool IsAddressInRange(Core::Address addr) const override;
+  bool OnRead(Core::Address addr, Core::Data &outData) override;
+  bool OnWrite(Core::Address addr, Core::Data inData) override;
+
+  /**
+   * @brief Spend this tick's pixel budget on queued work.
+   */
+  void OnTick() override;
+
+  /**
+   * @brief Queue a command directly (host side, bypassing registers).
+   * @return false if the command is invalid or the queue is full
+   */
+  bool Submit(const BlitCommand &cmd);
+
+  [[nodiscard]] bool IsBusy() const {
+    return m_Active || !m_Queue.IsEmpty();
+  }
+  [[nodiscard]] std::uint64_t GetCompletedCount() const {
+    return m_Completed;
+  }
+  [[nodiscard]] std::uint64_t GetRejectedCount() const { return m_Rejected; }
+
+private:
+  static constexpr Core::Address RegisterBlockSize = 0x1000;
+
+  [[nodiscard]] static bool IsValid(const BlitCommand &cmd);
+  void StartNext();
+  void ExecuteRow();
+  void Complete();
+
+  Core::Address m_BaseAddr;
+  GpuDevice *m_Gpu = nullptr;
+  Peripherals::PicDevice *m_Pic = nullptr;
+
+  /**
+   * PARAMETER REGISTERS
+   */
+  BlitCommand m_Staging;
+  std::uint32_t m_Control = 0;
+  bool m_Error = false;
+
+  /**
+   * ENGINE STATE
+   */
+  Core::RingBuffer<BlitCommand, QueueDepth> m_Queue;
+  BlitCommand m_Current;
+  bool m_Active = false;
+  bool m_BottomUp = false;  // Row order for vertically overlapping copies
+  std::uint32_t m_Row = 0;  // Rows of m_Current already processed
+  std::uint32_t m_Budget = 0;
+  std::vector<std::uint32_t> m_RowScratch;
+
+  std::uint64_t m_Completed = 0;
+  std::uint64_t m_Rejected = 0;
+};
+
+} // namespace Aurelia::Graphics
@@ -0,0 +1,209 @@
+/**
+ * Frame Sinks Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Graphics/FrameSink.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define AURELIA_HAS_SHM 1
+#endif
+
+namespace Aurelia::Graphics {
+
+namespace {
+
+/**
+ * @brief Bounding box of a set of rectangles.
+ */
+Rect BoundingBox(std::span<const Rect> rects) {
+  if (rects.empty()) {
+    return {};
+  }
+
+  std::uint32_t x0 = rects[0].X;
+  std::uint32_t y0 = rects[0].Y;
+  std::uint32_t x1 = rects[0].X + rects[0].Width;
+  std::uint32_t y1 = rects[0].Y + rects[0].Height;
+  for (const Rect &r : rects.subspan(1)) {
+    x0 = std::min(x0, r.X);
+    y0 = std::min(y0, r.Y);
+    x1 = std::max(x1, r.X + r.Width);
+    y1 = std::max(y1, r.Y + r.Height);
+  }
+  return {x0, y0, x1 - x0, y1 - y0};
+}
+
+} // namespace
+
+// -------------------------------------------------------------------------
+// PpmSequenceSink
+// -------------------------------------------------------------------------
+
+PpmSequenceSink::PpmSequenceSink(std::string prefix, bool cropToDirty)
+    : m_Prefix(std::move(prefix)), m_CropToDirty(cropToDirty) {}
+
+void PpmSequenceSink::Present(const FrameView &frame,
+                              std::span<const Rect> dirty) {
+  char number[32];
+  std::snprintf(number, sizeof(number), "%06llu",
+                static_cast<unsigned long long>(frame.FrameNumber));
+
+  Rect region{0, 0, frame.Width, frame.Height};
+  std::string path = m_Prefix + number;
+
+  if (m_CropToDirty && !dirty.empty()) {
+    region = BoundingBox(dirty);
+    path += "_x" + std::to_string(region.X) + "_y" + std::to_string(region.Y);
+  }
+  path += ".ppm";
+
+  if (WritePpm(path, frame, region)) {
+    m_FilesWritten++;
+    m_LastPath = path;
+  }
+}
+
+bool PpmSequenceSink::WritePpm(const std::string &path, const FrameView &frame,
+                               const Rect &region) {
+  std::FILE *file = std::fopen(path.c_str(), "wb");
+  if (!file) {
+    return false;
+  }
+
+  std::fprintf(file, "P6\n%u %u\n255\n", region.Width, region.Height);
+
+  /**
+   * RGBA → RGB, one row at a time, so the whole image never needs a
+   * second full-size buffer.
+   */
+  std::vector<std::uint8_t> row(static_cast<std::size_t>(region.Width) * 3);
+  for (std::uint32_t y = region.Y; y < region.Y + region.Height; ++y) {
+    const std::uint8_t *src = frame.Pixels.data() +
+                              static_cast<std::size_t>(y) * frame.Pitch +
+                              static_cast<std::size_t>(region.X) * 4;
+    for (std::uint32_t x = 0; x < region.Width; ++x) {
+      row[x * 3 + 0] = src[x * 4 + 0];
+      row[x * 3 + 1] = src[x * 4 + 1];
+      row[x * 3 + 2] = src[x * 4 + 2];
+    }
+    std::fwrite(row.data(), 1, row.size(), file);
+  }
+
+  bool ok = std::ferror(file) == 0;
+  ok = (std::fclose(file) == 0) && ok;
+  return ok;
+}
+
+// -------------------------------------------------------------------------
+// SharedMemorySink
+// -------------------------------------------------------------------------
+
+namespace {
+
+struct ShmHeader {
+  std::uint32_t Magic;
+  std::uint32_t Width;
+  std::uint32_t Height;
+  std::uint32_t Pitch;
+  std::atomic<std::uint64_t> Sequence;
+  std::uint64_t FrameNumber;
+  std::uint32_t DirtyX;
+  std::uint32_t DirtyY;
+  std::uint32_t DirtyWidth;
+  std::uint32_t DirtyHeight;
+};
+
+static_assert(sizeof(ShmHeader) <= SharedMemorySink::HeaderSize);
+
+} // namespace
+
+SharedMemorySink::SharedMemorySink(std::string name, std::uint32_t width,
+                                   std::uint32_t height)
+    : m_Name(std::move(name)), m_Pitch(width * 4), m_Height(height) {
+#if defined(AURELIA_HAS_SHM)
+  int fd = ::shm_open(m_Name.c_str(), O_CREAT | O_RDWR, 0600);
+  if (fd < 0) {
+    return;
+  }
+
+  std::size_t size = HeaderSize + static_cast<std::size_t>(m_Pitch) * height;
+  if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+    ::close(fd);
+    return;
+  }
+
+  void *mapping =
+      ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd); // The mapping keeps the segment alive
+  if (mapping == MAP_FAILED) {
+    return;
+  }
+
+  m_Mapping = static_cast<std::uint8_t *>(mapping);
+  m_MappingSize = size;
+
+  auto *header = new (m_Mapping) ShmHeader{};
+  header->Magic = Magic;
+  header->Width = width;
+  header->Height = height;
+  header->Pitch = m_Pitch;
+#else
+  (void)width;
+#endif
+}
+
+SharedMemorySink::~SharedMemorySink() {
+#if defined(AURELIA_HAS_SHM)
+  if (m_Mapping) {
+    ::munmap(m_Mapping, m_MappingSize);
+    ::shm_unlink(m_Name.c_str());
+  }
+#endif
+}
+
+void SharedMemorySink::Present(const FrameView &frame,
+                               std::span<const Rect> dirty) {
+  if (!m_Mapping || frame.Pitch != m_Pitch || frame.Height != m_Height) {
+    return;
+  }
+
+  auto *header = reinterpret_cast<ShmHeader *>(m_Mapping);
+  std::uint8_t *pixels = m_Mapping + HeaderSize;
+
+  // Odd sequence: update in progress
+  header->Sequence.fetch_add(1, std::memory_order_acq_rel);
+
+  for (const Rect &r : dirty) {
+    std::size_t offset = static_cast<std::size_t>(r.X) * 4;
+    std::size_t bytes = static_cast<std::size_t>(r.Width) * 4;
+    for (std::uint32_t y = r.Y; y < r.Y + r.Height; ++y) {
+      std::size_t rowStart = static_cast<std::size_t>(y) * m_Pitch + offset;
+      std::memcpy(pixels + rowStart, frame.Pixels.data() + rowStart, bytes);
+    }
+  }
+
+  Rect box = BoundingBox(dirty);
+  header->FrameNumber = frame.FrameNumber;
+  header->DirtyX = box.X;
+  header->DirtyY = box.Y;
+  header->DirtyWidth = box.Width;
+  header->DirtyHeight = box.Height;
+
+  // Even again: frame consistent
+  header->Sequence.fetch_add(1, std::memory_order_release);
+}
+
+} // namespace Aurelia::Graphics
@@ -0,0 +1,152 @@
+/**
+ * Frame Sinks.
+ *
+ * Host-side destinations for frames presented by the GPU scan-out stage.
+ *
+ * The GpuDevice only calls a sink on a vsync where the guest actually
+ * changed VRAM, and passes the list of dirty rectangles alongside the
+ * frame. Sinks are free to use the rectangles to avoid touching unchanged
+ * pixels (the shared-memory sink copies only dirty rows) or to ignore them
+ * and encode the whole frame (the PPM sink's default).
+ *
+ * AVAILABLE SINKS:
+ * ┌──────────────────┬──────────────────────────────────────────────────┐
+ * │ Sink             │ Destination                                      │
+ * ├──────────────────┼──────────────────────────────────────────────────┤
+ * │ PpmSequenceSink  │ Numbered .ppm files (headless CI golden images)  │
+ * │ SharedMemorySink │ POSIX shm segment (external viewer, zero encode) │
+ * └──────────────────┴──────────────────────────────────────────────────┘
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace Aurelia::Graphics {
+
+/**
+ * @brief Axis-aligned pixel rectangle, half-open: [X, X+Width) x [Y, Y+H).
+ */
+struct Rect {
+  std::uint32_t X = 0;
+  std::uint32_t Y = 0;
+  std::uint32_t Width = 0;
+  std::uint32_t Height = 0;
+};
+
+/**
+ * @brief Read-only view of a presented frame.
+ *
+ * Pixels are RGBA8888 (byte 0 = R ... byte 3 = A), rows Pitch bytes apart.
+ * Only valid for the duration of IFrameSink::Present().
+ */
+struct FrameView {
+  std::span<const std::uint8_t> Pixels;
+  std::uint32_t Width = 0;
+  std::uint32_t Height = 0;
+  std::uint32_t Pitch = 0;
+  std::uint64_t FrameNumber = 0; // Frames presented before this one
+};
+
+class IFrameSink {
+public:
+  virtual ~IFrameSink() = default;
+
+  /**
+   * @brief Receive a changed frame.
+   *
+   * @param frame Full frame contents
+   * @param dirty Regions that changed since the previous present
+   */
+  virtual void Present(const FrameView &frame,
+                       std::span<const Rect> dirty) = 0;
+};
+
+/**
+ * @brief Writes each presented frame as a binary PPM (P6) file.
+ *
+ * Files are named `<prefix>NNNNNN.ppm` using the GPU frame number: the
+ * count of frames presented before this one (FRAME_COUNT), so the
+ * sequence has no gaps and manual PRESENT writes never reuse a name.
+ *
+ * With CropToDirty enabled only the bounding box of the dirty rectangles
+ * is written, as `<prefix>NNNNNN_x<X>_y<Y>.ppm`.
+ *
+ * PPM drops the alpha channel.
+ */
+class PpmSequenceSink final : public IFrameSink {
+public:
+  explicit PpmSequenceSink(std::string prefix, bool cropToDirty = false);
+
+  void Present(const FrameView &frame, std::span<const Rect> dirty) override;
+
+  [[nodiscard]] std::size_t GetFilesWritten() const { return m_FilesWritten; }
+  [[nodiscard]] const std::string &GetLastPath() const { return m_LastPath; }
+
+  /**
+   * @brief Write a region of a frame to a PPM file.
+   * @return false if the file could not be written
+   */
+  static bool WritePpm(const std::string &path, const FrameView &frame,
+                       const Rect &region);
+
+private:
+  std::string m_Prefix;
+  bool m_CropToDirty;
+  std::size_t m_FilesWritten = 0;
+  std::string m_LastPath;
+};
+
+/**
+ * @brief Mirrors the framebuffer into a POSIX shared-memory segment.
+ *
+ * SEGMENT LAYOUT:
+ * ┌─────────┬──────────────────────────────────────────────────────┐
+ * │ Offset  │ Field                                                │
+ * ├─────────┼──────────────────────────────────────────────────────┤
+ * │ 0x00    │ Magic 'AFB1' (u32)                                   │
+ * │ 0x04    │ Width, Height, Pitch (u32 each)                      │
+ * │ 0x10    │ Sequence (u64): odd while an update is in progress   │
+ * │ 0x18    │ FrameNumber (u64)                                    │
+ * │ 0x20    │ Dirty bounding box X, Y, Width, Height (u32 each)    │
+ * │ 0x40    │ Pixels (RGBA8888, Height * Pitch bytes)              │
+ * └─────────┴──────────────────────────────────────────────────────┘
+ *
+ * Readers use the sequence counter as a seqlock: read Sequence, copy,
+ * re-read Sequence, retry if it changed or was odd. Only dirty rows are
+ * copied on each present.
+ */
+class SharedMemorySink final : public IFrameSink {
+public:
+  static constexpr std::uint32_t Magic = 0x31424641; // "AFB1"
+  static constexpr std::size_t HeaderSize = 0x40;
+
+  /**
+   * @param name shm_open name, e.g. "/aurelia-fb"
+   */
+  SharedMemorySink(std::string name, std::uint32_t width,
+                   std::uint32_t height);
+  ~SharedMemorySink() override;
+
+  SharedMemorySink(const SharedMemorySink &) = delete;
+  SharedMemorySink &operator=(const SharedMemorySink &) = delete;
+
+  [[nodiscard]] bool IsOpen() const { return m_Mapping != nullptr; }
+
+  void Present(const FrameView &frame, std::span<const Rect> dirty) override;
+
+private:
+  std::string m_Name;
+  std::uint8_t *m_Mapping = nullptr;
+  std::size_t m_MappingSize = 0;
+  std::uint32_t m_Pitch = 0;
+  std::uint32_t m_Height = 0;
+};
+
+} // namespace Aurelia::Graphics
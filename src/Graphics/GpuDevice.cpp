@@ -0,0 +1,299 @@
+/**
+ * Framebuffer GPU Device Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Graphics/GpuDevice.hpp"
+#include "System/MemoryMap.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace Aurelia::Graphics {
+
+static_assert(GpuDevice::VramSize == System::GpuVramSize,
+              "MemoryMap VRAM window must match the display geometry");
+
+GpuDevice::GpuDevice()
+    : m_RegisterBase(System::GpuBase), m_VramBase(System::GpuVramBase),
+      m_Vram(static_cast<std::size_t>(Width) * Height, 0) {
+  m_DirtyRects.reserve(static_cast<std::size_t>(TilesX) * TilesY);
+}
+
+void GpuDevice::SetBaseAddresses(Core::Address registerBase,
+                                 Core::Address vramBase) {
+  m_RegisterBase = registerBase;
+  m_VramBase = vramBase;
+}
+
+bool GpuDevice::IsAddressInRange(Core::Address addr) const {
+  return (addr >= m_RegisterBase &&
+          addr < m_RegisterBase + RegisterBlockSize) ||
+         IsVramAddress(addr);
+}
+
+bool GpuDevice::OnRead(Core::Address addr, Core::Data &outData) {
+  if (IsVramAddress(addr)) {
+    /**
+     * VRAM READ
+     *
+     * Zero wait states, same width and bounds rule as RamDevice.
+     */
+    Core::Address offset = addr - m_VramBase;
+    if (offset + sizeof(Core::Data) > VramSize) {
+      return false;
+    }
+    std::memcpy(&outData, GetVram().data() + offset, sizeof(Core::Data));
+    return true;
+  }
+
+  switch (addr - m_RegisterBase) {
+  case IdOffset:
+    outData = DeviceId;
+    return true;
+
+  case WidthOffset:
+    outData = Width;
+    return true;
+
+  case HeightOffset:
+    outData = Height;
+    return true;
+
+  case PitchOffset:
+    outData = Pitch;
+    return true;
+
+  case ControlOffset:
+    outData = m_Control;
+    return true;
+
+  case StatusOffset:
+    /**
+     * STATUS READ
+     * VSYNC is sticky until observed, so a polling loop cannot miss one.
+     */
+    outData = (m_AnyDirty ? StatusDirty : 0u) |
+              (m_VsyncFlag ? StatusVsync : 0u);
+    m_VsyncFlag = false;
+    return true;
+
+  case FrameCountOffset:
+    outData = static_cast<std::uint32_t>(m_FrameCount);
+    return true;
+
+  case VsyncCountOffset:
+    outData = static_cast<std::uint32_t>(m_VsyncCount);
+    return true;
+
+  case VsyncPeriodOffset:
+    outData = m_VsyncPeriod;
+    return true;
+
+  default:
+    outData = 0; // RAZ, including write-only PRESENT
+    return true;
+  }
+}
+
+bool GpuDevice::OnWrite(Core::Address addr, Core::Data inData) {
+  if (IsVramAddress(addr)) {
+    /**
+     * VRAM WRITE
+     *
+     * An 8-byte store covers two pixels when aligned and up to three when
+     * not; every pixel it touches is marked.
+     */
+    Core::Address offset = addr - m_VramBase;
+    if (offset + sizeof(Core::Data) > VramSize) {
+      return false;
+    }
+    std::memcpy(GetVram().data() + offset, &inData, sizeof(Core::Data));
+    MarkPixelSpan(offset / BytesPerPixel,
+                  (offset + sizeof(Core::Data) - 1) / BytesPerPixel);
+    return true;
+  }
+
+  auto value = static_cast<std::uint32_t>(inData);
+  switch (addr - m_RegisterBase) {
+  case ControlOffset:
+    m_Control = value & (ControlScanoutEnable | ControlVsyncIrqEnable);
+    return true;
+
+  case VsyncPeriodOffset:
+    m_VsyncPeriod = value;
+    m_TicksSinceVsync = 0;
+    return true;
+
+  case PresentOffset:
+    Present();
+    return true;
+
+  default:
+    return true; // Read-only and undefined registers ignore writes
+  }
+}
+
+bool GpuDevice::OnReadBlock(Core::Address addr, std::span<Core::Byte> out) {
+  if (!IsVramAddress(addr)) {
+    return IBusDevice::OnReadBlock(addr, out);
+  }
+
+  Core::Address offset = addr - m_VramBase;
+  if (offset + out.size() > VramSize) {
+    return false;
+  }
+  std::memcpy(out.data(), GetVram().data() + offset, out.size());
+  return true;
+}
+
+bool GpuDevice::OnWriteBlock(Core::Address addr,
+                             std::span<const Core::Byte> in) {
+  if (!IsVramAddress(addr)) {
+    return IBusDevice::OnWriteBlock(addr, in);
+  }
+
+  Core::Address offset = addr - m_VramBase;
+  if (offset + in.size() > VramSize) {
+    return false;
+  }
+  std::memcpy(GetVram().data() + offset, in.data(), in.size());
+
+  /**
+   * A block spanning several lines marks whole lines; within one line
+   * only the touched columns.
+   */
+  std::size_t first = offset / BytesPerPixel;
+  std::size_t last = (offset + in.size() - 1) / BytesPerPixel;
+  auto y0 = static_cast<std::uint32_t>(first / Width);
+  auto y1 = static_cast<std::uint32_t>(last / Width);
+  if (y0 == y1) {
+    auto x0 = static_cast<std::uint32_t>(first % Width);
+    auto x1 = static_cast<std::uint32_t>(last % Width);
+    MarkDirty({x0, y0, x1 - x0 + 1, 1});
+  } else {
+    MarkDirty({0, y0, Width, y1 - y0 + 1});
+  }
+  return true;
+}
+
+void GpuDevice::OnTick() {
+  if (m_VsyncPeriod == 0) {
+    return; // Manual presentation only
+  }
+
+  if (++m_TicksSinceVsync >= m_VsyncPeriod) {
+    m_TicksSinceVsync = 0;
+    Vsync();
+  }
+}
+
+void GpuDevice::Vsync() {
+  m_VsyncCount++;
+  m_VsyncFlag = true;
+
+  if (m_Control & ControlScanoutEnable) {
+    if (!Present()) {
+      m_SkippedFrames++;
+    }
+  }
+
+  if ((m_Control & ControlVsyncIrqEnable) && m_Pic) {
+    m_Pic->RaiseIrq(Peripherals::PicDevice::IrqGpuVsync);
+  }
+}
+
+bool GpuDevice::Present() {
+  if (!m_AnyDirty) {
+    return false;
+  }
+
+  BuildDirtyRects();
+
+  if (m_Sink) {
+    FrameView frame;
+    frame.Pixels = GetVram();
+    frame.Width = Width;
+    frame.Height = Height;
+    frame.Pitch = Pitch;
+    frame.FrameNumber = m_FrameCount;
+    m_Sink->Present(frame, m_DirtyRects);
+  }
+
+  m_DirtyTiles.fill(0);
+  m_AnyDirty = false;
+  m_FrameCount++;
+  return true;
+}
+
+void GpuDevice::MarkDirty(const Rect &region) {
+  if (region.Width == 0 || region.Height == 0 || region.X >= Width ||
+      region.Y >= Height) {
+    return;
+  }
+
+  std::uint32_t x1 = std::min(region.X + region.Width, Width) - 1;
+  std::uint32_t y1 = std::min(region.Y + region.Height, Height) - 1;
+  std::uint32_t tx0 = region.X / TileSize;
+  std::uint32_t tx1 = x1 / TileSize;
+
+  // Columns tx0..tx1 inclusive; tx1 < 32 so the shift cannot overflow
+  std::uint32_t mask = ((2u << tx1) - 1u) & ~((1u << tx0) - 1u);
+  for (std::uint32_t ty = region.Y / TileSize; ty <= y1 / TileSize; ++ty) {
+    m_DirtyTiles[ty] |= mask;
+  }
+  m_AnyDirty = true;
+}
+
+void GpuDevice::MarkPixelSpan(std::size_t firstPixel, std::size_t lastPixel) {
+  for (std::size_t p = firstPixel; p <= lastPixel; ++p) {
+    auto x = static_cast<std::uint32_t>(p % Width);
+    auto y = static_cast<std::uint32_t>(p / Width);
+    m_DirtyTiles[y / TileSize] |= 1u << (x / TileSize);
+  }
+  m_AnyDirty = true;
+}
+
+void GpuDevice::BuildDirtyRects() {
+  /**
+   * TILE MASKS → RECTANGLES
+   *
+   * Each run of set bits in a row mask becomes one rectangle. When a row
+   * has exactly the same mask as the row above, the previous row's
+   * rectangles are extended downwards instead of emitting new ones.
+   */
+  m_DirtyRects.clear();
+
+  std::uint32_t previousMask = 0;
+  std::size_t previousFirst = 0; // Index of the previous row's first rect
+
+  for (std::uint32_t ty = 0; ty < TilesY; ++ty) {
+    std::uint32_t mask = m_DirtyTiles[ty];
+    std::uint32_t y = ty * TileSize;
+    std::uint32_t h = std::min(TileSize, Height - y);
+
+    if (mask != 0 && mask == previousMask) {
+      for (std::size_t i = previousFirst; i < m_DirtyRects.size(); ++i) {
+        m_DirtyRects[i].Height += h;
+      }
+      continue;
+    }
+
+    previousMask = mask;
+    previousFirst = m_DirtyRects.size();
+
+    while (mask != 0) {
+      auto start = static_cast<std::uint32_t>(std::countr_zero(mask));
+      auto run = static_cast<std::uint32_t>(std::countr_one(mask >> start));
+      mask &= ~(((run == 32 ? 0u : (1u << run)) - 1u) << start);
+
+      std::uint32_t x = start * TileSize;
+      std::uint32_t w = std::min(run * TileSize, Width - x);
+      m_DirtyRects.push_back({x, y, w, h});
+    }
+  }
+}
+
+} // namespace Aurelia::Graphics
@@ -0,0 +1,244 @@
+/**
+ * Framebuffer GPU Device.
+ *
+ * Linear RGBA framebuffer with dirty-tile tracking and vsync-driven
+ * scan-out to a pluggable host frame sink.
+ *
+ * The guest draws by storing pixels straight into VRAM. Once per vsync
+ * period the device "scans out" the frame, but only if something was
+ * written since the previous scan-out, and it hands the sink a list of
+ * the regions that changed. An idle desktop therefore costs one counter
+ * compare per tick and no host I/O at all.
+ *
+ * ADDRESS LAYOUT:
+ * ┌──────────────────┬──────────────────────────────────────────────┐
+ * │ Address          │ Region                                       │
+ * ├──────────────────┼──────────────────────────────────────────────┤
+ * │ 0xF000_0000      │ Control registers (4 KB)                     │
+ * │ 0xF010_0000      │ VRAM: 640 × 480 × RGBA8888 (1200 KB)         │
+ * └──────────────────┴──────────────────────────────────────────────┘
+ *
+ * REGISTER MAP (32-bit registers, 4-byte stride):
+ * ┌────────────┬─────────────────────────────────────────────────┐
+ * │ Offset     │ Register                                        │
+ * ├────────────┼─────────────────────────────────────────────────┤
+ * │ 0x0000     │ ID           - 'AGPU' (RO)                      │
+ * │ 0x0004     │ WIDTH        - Pixels per line (RO)             │
+ * │ 0x0008     │ HEIGHT       - Lines per frame (RO)             │
+ * │ 0x000C     │ PITCH        - Bytes per line (RO)              │
+ * │ 0x0010     │ CONTROL      - Scan-out / IRQ enables (RW)      │
+ * │ 0x0014     │ STATUS       - Dirty / vsync flags (RO)         │
+ * │ 0x0018     │ FRAME_COUNT  - Frames presented to the host (RO)│
+ * │ 0x001C     │ VSYNC_COUNT  - Vsyncs elapsed (RO)              │
+ * │ 0x0020     │ VSYNC_PERIOD - Ticks per vsync, 0 = manual (RW) │
+ * │ 0x0024     │ PRESENT      - Write: scan out now (WO)         │
+ * └────────────┴─────────────────────────────────────────────────┘
+ *
+ * CONTROL (Offset 0x10):
+ * ┌───┬───┬───┐
+ * │...│ 1 │ 0 │
+ * └───┴───┴───┘
+ *       │   └── SCANOUT_EN: Present dirty frames to the host sink
+ *       └────── VSYNC_IRQ_EN: Raise PIC IrqGpuVsync on every vsync
+ *
+ * STATUS (Offset 0x14):
+ * - Bit 0 DIRTY: VRAM changed since the last scan-out
+ * - Bit 1 VSYNC: A vsync occurred since STATUS was last read (sticky,
+ *   cleared on read). Lets a guest without interrupts wait for vblank.
+ *
+ * DIRTY TRACKING:
+ * VRAM is divided into 32×32 pixel tiles. A store marks the tile(s) it
+ * touches with one OR into a per-tile-row bitmask. At scan-out each tile
+ * row is turned into rectangles by walking runs of set bits, and rows
+ * with identical masks are merged vertically, so a sprite moving across
+ * the screen yields one or two rectangles instead of a full frame.
+ *
+ * NOTE (KleaSCM) The sink sees full frames plus dirty rectangles rather
+ * than pixel deltas. Encoding cost is the sink's business: the PPM sink
+ * writes a file per changed frame, the shared-memory sink copies only the
+ * dirty rows. Frames where nothing changed never reach the sink at all.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Bus/IBusDevice.hpp"
+#include "Core/Types.hpp"
+#include "Graphics/FrameSink.hpp"
+#include "Peripherals/PicDevice.hpp"
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Aurelia::Graphics {
+
+class GpuDevice final : public Bus::IBusDevice {
+public:
+  /**
+   * DISPLAY GEOMETRY
+   */
+  static constexpr std::uint32_t Width = 640;
+  static constexpr std::uint32_t Height = 480;
+  static constexpr std::uint32_t BytesPerPixel = 4;
+  static constexpr std::uint32_t Pitch = Width * BytesPerPixel;
+  static constexpr std::size_t VramSize =
+      static_cast<std::size_t>(Pitch) * Height;
+
+  /**
+   * DIRTY TILE GRID
+   */
+  static constexpr std::uint32_t TileSize = 32;
+  static constexpr std::uint32_t TilesX = (Width + TileSize - 1) / TileSize;
+  static constexpr std::uint32_t TilesY = (Height + TileSize - 1) / TileSize;
+  static_assert(TilesX <= 32, "Tile row mask is 32 bits");
+
+  /**
+   * REGISTER OFFSETS
+   */
+  static constexpr Core::Address IdOffset = 0x00;
+  static constexpr Core::Address WidthOffset = 0x04;
+  static constexpr Core::Address HeightOffset = 0x08;
+  static constexpr Core::Address PitchOffset = 0x0C;
+  static constexpr Core::Address ControlOffset = 0x10;
+  static constexpr Core::Address StatusOffset = 0x14;
+  static constexpr Core::Address FrameCountOffset = 0x18;
+  static constexpr Core::Address VsyncCountOffset = 0x1C;
+  static constexpr Core::Address VsyncPeriodOffset = 0x20;
+  static constexpr Core::Address PresentOffset = 0x24;
+
+  static constexpr std::uint32_t DeviceId = 0x55504741; // "AGPU"
+
+  /**
+   * CONTROL / STATUS BITS
+   */
+  static constexpr std::uint32_t ControlScanoutEnable = 1u << 0;
+  static constexpr std::uint32_t ControlVsyncIrqEnable = 1u << 1;
+  static constexpr std::uint32_t StatusDirty = 1u << 0;
+  static constexpr std::uint32_t StatusVsync = 1u << 1;
+
+  /**
+   * Reset vsync period in device ticks. At the CPU clock this is roughly
+   * 60 Hz for a 6 MHz guest; software can reprogram it.
+   */
+  static constexpr std::uint32_t DefaultVsyncPeriod = 100000;
+
+  /**
+   * @brief Construct GPU with cleared (black, transparent) VRAM.
+   *
+   * Registers live at MemoryMap::GpuBase, VRAM at MemoryMap::GpuVramBase.
+   * Scan-out is enabled at reset so a guest only has to draw.
+   */
+  GpuDevice();
+
+  /**
+   * @brief Relocate the device (registers and VRAM independently).
+   */
+  void SetBaseAddresses(Core::Address registerBase, Core::Address vramBase);
+
+  /**
+   * @brief Attach the host frame sink (not owned). nullptr discards frames.
+   */
+  void SetFrameSink(IFrameSink *sink) { m_Sink = sink; }
+
+  /**
+   * @brief Connect PIC for vsync interrupts.
+   */
+  void ConnectPic(Peripherals::PicDevice *pic) { m_Pic = pic; }
+
+  [[nodiscard]] bool IsAddressInRange(Core::Address addr) const override;
+  bool OnRead(Core::Address addr, Core::Data &outData) override;
+  bool OnWrite(Core::Address addr, Core::Data inData) override;
+
+  /**
+   * @brief Bulk VRAM access (DMA). Register blocks use the word default.
+   */
+  bool OnReadBlock(Core::Address addr, std::span<Core::Byte> out) override;
+  bool OnWriteBlock(Core::Address addr,
+                    std::span<const Core::Byte> in) override;
+
+  /**
+   * @brief Advance the vsync counter; scan out on vsync.
+   */
+  void OnTick() override;
+
+  /**
+   * HOST-SIDE ACCESS
+   *
+   * Host code (or another device model) drawing directly into VRAM must
+   * report what it touched through MarkDirty(), otherwise the change is
+   * not presented until something else dirties the same tiles.
+   */
+  [[nodiscard]] std::span<std::uint8_t> GetVram() {
+    return {reinterpret_cast<std::uint8_t *>(m_Vram.data()), VramSize};
+  }
+  [[nodiscard]] std::span<const std::uint8_t> GetVram() const {
+    return {reinterpret_cast<const std::uint8_t *>(m_Vram.data()), VramSize};
+  }
+  [[nodiscard]] std::span<std::uint32_t> GetPixels() { return m_Vram; }
+  void MarkDirty(const Rect &region);
+
+  /**
+   * @brief Scan out immediately if anything is dirty.
+   * @return true if a frame was handed to the sink
+   */
+  bool Present();
+
+  [[nodiscard]] bool IsDirty() const { return m_AnyDirty; }
+
+  /**
+   * STATISTICS
+   */
+  [[nodiscard]] std::uint64_t GetPresentedFrames() const {
+    return m_FrameCount;
+  }
+  [[nodiscard]] std::uint64_t GetSkippedFrames() const {
+    return m_SkippedFrames;
+  }
+  [[nodiscard]] std::uint64_t GetVsyncCount() const { return m_VsyncCount; }
+
+private:
+  [[nodiscard]] bool IsVramAddress(Core::Address addr) const {
+    return addr >= m_VramBase && addr < m_VramBase + VramSize;
+  }
+  void Vsync();
+  void MarkPixelSpan(std::size_t firstPixel, std::size_t lastPixel);
+  void BuildDirtyRects();
+
+  /**
+   * ADDRESSING
+   */
+  Core::Address m_RegisterBase;
+  Core::Address m_VramBase;
+  static constexpr Core::Address RegisterBlockSize = 0x1000;
+
+  /**
+   * REGISTERS
+   */
+  std::uint32_t m_Control = ControlScanoutEnable;
+  std::uint32_t m_VsyncPeriod = DefaultVsyncPeriod;
+  bool m_VsyncFlag = false;
+
+  /**
+   * FRAMEBUFFER STATE
+   */
+  std::vector<std::uint32_t> m_Vram; // One packed RGBA pixel per element
+  std::array<std::uint32_t, TilesY> m_DirtyTiles{}; // Bit N = tile column N
+  bool m_AnyDirty = false;
+  std::vector<Rect> m_DirtyRects; // Scratch, reused across scan-outs
+
+  /**
+   * TIMING
+   */
+  std::uint32_t m_TicksSinceVsync = 0;
+  std::uint64_t m_VsyncCount = 0;
+  std::uint64_t m_FrameCount = 0;
+  std::uint64_t m_SkippedFrames = 0;
+
+  IFrameSink *m_Sink = nullptr;
+  Peripherals::PicDevice *m_Pic = nullptr;
+};
+
+} // namespace Aurelia::Graphics
@@ -0,0 +1,415 @@
+/**
+ * Asynchronous Host I/O Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Host/AsyncIo.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#define AURELIA_HAS_PREAD 1
+#endif
+
+#if defined(__linux__)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define AURELIA_HAS_IO_URING 1
+#endif
+#endif
+
+namespace Aurelia::Host {
+
+namespace {
+
+#if defined(AURELIA_HAS_IO_URING)
+int IoUringSetup(unsigned entries, io_uring_params *params) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int fd, unsigned toSubmit, unsigned minComplete,
+                 unsigned flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, fd, toSubmit,
+                                    minComplete, flags, nullptr, 0));
+}
+
+/**
+ * Ring indices are shared with the kernel. The side that owns an index
+ * publishes it with release; the other side reads it with acquire.
+ */
+std::uint32_t LoadAcquire(std::uint32_t *p) {
+  return std::atomic_ref<std::uint32_t>(*p).load(std::memory_order_acquire);
+}
+
+void StoreRelease(std::uint32_t *p, std::uint32_t value) {
+  std::atomic_ref<std::uint32_t>(*p).store(value, std::memory_order_release);
+}
+#endif
+
+} // namespace
+
+AsyncIo::AsyncIo(std::size_t depth, std::size_t workers)
+    : m_Depth(std::max<std::size_t>(depth, 1)),
+      m_WorkerCount(std::max<std::size_t>(workers, 1)) {}
+
+AsyncIo::~AsyncIo() {
+  std::array<AsyncIoCompletion, 32> discard{};
+  while (m_InFlight > 0) {
+    Wait();
+    Reap(discard);
+  }
+
+  if (m_Backend == AsyncIoBackend::IoUring) {
+    TeardownRing();
+  } else {
+    StopWorkers();
+  }
+}
+
+bool AsyncIo::Start(AsyncIoBackend preferred) {
+  if (m_Started) {
+    return false;
+  }
+
+  if (preferred == AsyncIoBackend::IoUring && SetupRing()) {
+    m_Backend = AsyncIoBackend::IoUring;
+  } else {
+    m_Backend = AsyncIoBackend::ThreadPool;
+    StartWorkers();
+  }
+  m_Started = true;
+  return true;
+}
+
+bool AsyncIo::Submit(const AsyncIoRequest &request) {
+  if (!m_Started || !HasCapacity()) {
+    return false;
+  }
+
+  if (m_Backend == AsyncIoBackend::IoUring) {
+    if (!PushSqe(request)) {
+      return false;
+    }
+  } else {
+    m_Staged.push_back(request);
+  }
+  m_InFlight++;
+  return true;
+}
+
+void AsyncIo::Kick() {
+  if (m_Backend == AsyncIoBackend::IoUring) {
+#if defined(AURELIA_HAS_IO_URING)
+    if (m_Unsubmitted != 0) {
+      int ret = IoUringEnter(m_Ring.Fd, m_Unsubmitted, 0, 0);
+      if (ret > 0) {
+        m_Unsubmitted -= static_cast<std::uint32_t>(ret);
+      }
+      // EAGAIN/EBUSY: entries stay in the SQ ring for the next Kick()
+    }
+#endif
+    return;
+  }
+
+  if (m_Staged.empty()) {
+    return;
+  }
+  {
+    std::lock_guard lock(m_PoolMutex);
+    m_Pending.insert(m_Pending.end(), m_Staged.begin(), m_Staged.end());
+  }
+  m_Staged.clear();
+  m_PoolCv.notify_all();
+}
+
+std::size_t AsyncIo::Reap(std::span<AsyncIoCompletion> out) {
+  if (m_InFlight == 0 || out.empty()) {
+    return 0;
+  }
+
+  std::size_t n = m_Backend == AsyncIoBackend::IoUring ? ReapRing(out)
+                                                       : ReapPool(out);
+  m_InFlight -= n;
+  return n;
+}
+
+void AsyncIo::Wait() {
+  if (m_InFlight == 0) {
+    return;
+  }
+  Kick(); // A staged request would otherwise never finish
+
+  if (m_Backend == AsyncIoBackend::IoUring) {
+#if defined(AURELIA_HAS_IO_URING)
+    while (LoadAcquire(m_Ring.CqHead) == LoadAcquire(m_Ring.CqTail)) {
+      int ret = IoUringEnter(m_Ring.Fd, m_Unsubmitted, 1,
+                             IORING_ENTER_GETEVENTS);
+      if (ret > 0) {
+        m_Unsubmitted -= static_cast<std::uint32_t>(ret);
+      }
+    }
+#endif
+    return;
+  }
+
+  std::unique_lock lock(m_DoneMutex);
+  m_DoneCv.wait(lock, [this] { return !m_Done.empty(); });
+}
+
+// ---------------------------------------------------------------------------
+// io_uring backend
+// ---------------------------------------------------------------------------
+
+bool AsyncIo::SetupRing() {
+#if defined(AURELIA_HAS_IO_URING)
+  io_uring_params params{};
+  int fd = IoUringSetup(static_cast<unsigned>(m_Depth), &params);
+  if (fd < 0) {
+    return false; // ENOSYS, EPERM (seccomp, io_uring_disabled), ...
+  }
+  m_Ring.Fd = fd;
+
+  m_Ring.SqMapSize = params.sq_off.array + params.sq_entries * 4u;
+  m_Ring.CqMapSize =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+  bool single = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+  if (single) {
+    m_Ring.SqMapSize = m_Ring.CqMapSize =
+        std::max(m_Ring.SqMapSize, m_Ring.CqMapSize);
+  }
+
+  m_Ring.SqMap = ::mmap(nullptr, m_Ring.SqMapSize, PROT_READ | PROT_WRITE,
+                        MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQ_RING);
+  if (m_Ring.SqMap == MAP_FAILED) {
+    m_Ring.SqMap = nullptr;
+    TeardownRing();
+    return false;
+  }
+
+  if (single) {
+    m_Ring.CqMap = m_Ring.SqMap;
+  } else {
+    m_Ring.CqMap = ::mmap(nullptr, m_Ring.CqMapSize, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_CQ_RING);
+    if (m_Ring.CqMap == MAP_FAILED) {
+      m_Ring.CqMap = nullptr;
+      TeardownRing();
+      return false;
+    }
+  }
+
+  m_Ring.SqeMapSize = params.sq_entries * sizeof(io_uring_sqe);
+  m_Ring.SqeMap = ::mmap(nullptr, m_Ring.SqeMapSize, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+  if (m_Ring.SqeMap == MAP_FAILED) {
+    m_Ring.SqeMap = nullptr;
+    TeardownRing();
+    return false;
+  }
+
+  auto *sq = static_cast<std::uint8_t *>(m_Ring.SqMap);
+  auto *cq = static_cast<std::uint8_t *>(m_Ring.CqMap);
+  auto field = [](std::uint8_t *base, std::uint32_t offset) {
+    return reinterpret_cast<std::uint32_t *>(base + offset);
+  };
+
+  m_Ring.SqHead = field(sq, params.sq_off.head);
+  m_Ring.SqTail = field(sq, params.sq_off.tail);
+  m_Ring.SqMask = *field(sq, params.sq_off.ring_mask);
+  m_Ring.SqEntries = params.sq_entries;
+  m_Ring.SqArray = field(sq, params.sq_off.array);
+  m_Ring.CqHead = field(cq, params.cq_off.head);
+  m_Ring.CqTail = field(cq, params.cq_off.tail);
+  m_Ring.CqMask = *field(cq, params.cq_off.ring_mask);
+  m_Ring.Sqes = m_Ring.SqeMap;
+  m_Ring.Cqes = cq + params.cq_off.cqes;
+
+  // Never more in flight than SQ entries, so the CQ ring cannot overflow
+  m_Depth = std::min<std::size_t>(m_Depth, params.sq_entries);
+  m_Iovecs.assign(params.sq_entries, IoVec{});
+  static_assert(sizeof(IoVec) == sizeof(iovec));
+  return true;
+#else
+  return false;
+#endif
+}
+
+void AsyncIo::TeardownRing() {
+#if defined(AURELIA_HAS_IO_URING)
+  if (m_Ring.SqeMap) {
+    ::munmap(m_Ring.SqeMap, m_Ring.SqeMapSize);
+  }
+  if (m_Ring.CqMap && m_Ring.CqMap != m_Ring.SqMap) {
+    ::munmap(m_Ring.CqMap, m_Ring.CqMapSize);
+  }
+  if (m_Ring.SqMap) {
+    ::munmap(m_Ring.SqMap, m_Ring.SqMapSize);
+  }
+  if (m_Ring.Fd >= 0) {
+    ::close(m_Ring.Fd);
+  }
+#endif
+  m_Ring = Ring{};
+}
+
+bool AsyncIo::PushSqe(const AsyncIoRequest &request) {
+#if defined(AURELIA_HAS_IO_URING)
+  std::uint32_t tail = *m_Ring.SqTail; // Only this thread writes the tail
+  if (tail - LoadAcquire(m_Ring.SqHead) == m_Ring.SqEntries) {
+    return false;
+  }
+
+  std::uint32_t index = tail & m_Ring.SqMask;
+  auto &sqe = static_cast<io_uring_sqe *>(m_Ring.Sqes)[index];
+  sqe = io_uring_sqe{};
+  sqe.fd = request.Fd;
+  sqe.user_data = request.Tag;
+
+  /**
+   * READV/WRITEV rather than READ/WRITE: same cost for one segment, and
+   * available from the first io_uring kernel (5.1) instead of 5.6.
+   */
+  switch (request.Op) {
+  case AsyncIoOp::Read:
+  case AsyncIoOp::Write:
+    m_Iovecs[index] = IoVec{request.Buffer, request.Length};
+    sqe.opcode = request.Op == AsyncIoOp::Read ? IORING_OP_READV
+                                               : IORING_OP_WRITEV;
+    sqe.off = request.Offset;
+    sqe.addr = reinterpret_cast<std::uint64_t>(&m_Iovecs[index]);
+    sqe.len = 1;
+    break;
+  case AsyncIoOp::Fsync:
+    sqe.opcode = IORING_OP_FSYNC;
+    break;
+  }
+
+  m_Ring.SqArray[index] = index;
+  StoreRelease(m_Ring.SqTail, tail + 1);
+  m_Unsubmitted++;
+  return true;
+#else
+  (void)request;
+  return false;
+#endif
+}
+
+std::size_t AsyncIo::ReapRing(std::span<AsyncIoCompletion> out) {
+#if defined(AURELIA_HAS_IO_URING)
+  std::uint32_t head = *m_Ring.CqHead; // Only this thread writes the head
+  std::uint32_t tail = LoadAcquire(m_Ring.CqTail);
+
+  std::size_t n = 0;
+  auto *cqes = static_cast<io_uring_cqe *>(m_Ring.Cqes);
+  while (head != tail && n < out.size()) {
+    const io_uring_cqe &cqe = cqes[head & m_Ring.CqMask];
+    out[n++] = AsyncIoCompletion{cqe.user_data, cqe.res};
+    head++;
+  }
+  StoreRelease(m_Ring.CqHead, head);
+  return n;
+#else
+  (void)out;
+  return 0;
+#endif
+}
+
+// ---------------------------------------------------------------------------
+// Worker pool backend
+// ---------------------------------------------------------------------------
+
+void AsyncIo::StartWorkers() {
+  m_Stopping = false;
+  for (std::size_t i = 0; i < m_WorkerCount; ++i) {
+    m_Workers.emplace_back([this] { WorkerMain(); });
+  }
+}
+
+void AsyncIo::StopWorkers() {
+  {
+    std::lock_guard lock(m_PoolMutex);
+    m_Stopping = true;
+  }
+  m_PoolCv.notify_all();
+  for (auto &worker : m_Workers) {
+    worker.join();
+  }
+  m_Workers.clear();
+}
+
+void AsyncIo::WorkerMain() {
+  for (;;) {
+    AsyncIoRequest request;
+    {
+      std::unique_lock lock(m_PoolMutex);
+      m_PoolCv.wait(lock, [this] { return m_Stopping || !m_Pending.empty(); });
+      if (m_Pending.empty()) {
+        return; // Stopping with nothing left to do
+      }
+      request = m_Pending.front();
+      m_Pending.pop_front();
+    }
+
+    AsyncIoCompletion done{request.Tag, ExecuteBlocking(request)};
+    {
+      std::lock_guard lock(m_DoneMutex);
+      m_Done.push_back(done);
+      m_DoneCount.store(m_Done.size(), std::memory_order_release);
+    }
+    m_DoneCv.notify_one();
+  }
+}
+
+std::size_t AsyncIo::ReapPool(std::span<AsyncIoCompletion> out) {
+  if (m_DoneCount.load(std::memory_order_acquire) == 0) {
+    return 0;
+  }
+
+  std::lock_guard lock(m_DoneMutex);
+  std::size_t n = std::min(out.size(), m_Done.size());
+  std::copy_n(m_Done.begin(), n, out.begin());
+  m_Done.erase(m_Done.begin(), m_Done.begin() + static_cast<long>(n));
+  m_DoneCount.store(m_Done.size(), std::memory_order_release);
+  return n;
+}
+
+std::int64_t AsyncIo::ExecuteBlocking(const AsyncIoRequest &request) {
+#if defined(AURELIA_HAS_PREAD)
+  if (request.Op == AsyncIoOp::Fsync) {
+    return ::fsync(request.Fd) == 0 ? 0 : -errno;
+  }
+
+  std::uint32_t done = 0;
+  while (done < request.Length) {
+    auto offset = static_cast<off_t>(request.Offset + done);
+    ssize_t n = request.Op == AsyncIoOp::Read
+                    ? ::pread(request.Fd, request.Buffer + done,
+                              request.Length - done, offset)
+                    : ::pwrite(request.Fd, request.Buffer + done,
+                               request.Length - done, offset);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return -errno;
+    }
+    if (n == 0) {
+      break; // End of file
+    }
+    done += static_cast<std::uint32_t>(n);
+  }
+  return done;
+#else
+  (void)request;
+  return -ENOSYS;
+#endif
+}
+
+} // namespace Aurelia::Host
@@ -0,0 +1,234 @@
+/**
+ * Asynchronous Host I/O.
+ *
+ * Submission/completion queue for positional file I/O that runs off the
+ * simulation thread.
+ *
+ * PROBLEM:
+ * A storage device that calls pread() from OnTick stops the whole
+ * machine for as long as the host disk takes. On a cold multi-gigabyte
+ * image that is milliseconds per request, during which no guest
+ * instruction retires.
+ *
+ * DESIGN:
+ * ┌──────────────┐ Submit  ┌───────────────────┐ Reap  ┌──────────────┐
+ * │ Device       │────────►│ io_uring (kernel) │──────►│ Device       │
+ * │ (sim thread) │  Kick   │  or worker pool   │       │ (sim thread) │
+ * └──────────────┘         └───────────────────┘       └──────────────┘
+ *
+ * - Submit() only queues a request. Kick() hands every queued request to
+ *   the backend at once, so a device that drains a ring of N requests
+ *   pays one syscall (io_uring) or one wakeup (worker pool), not N.
+ * - Reap() collects finished requests without blocking. With nothing in
+ *   flight, or nothing finished, it is one atomic load.
+ * - Wait() blocks until at least one request finishes, for callers that
+ *   must not continue without a result (deterministic replay, shutdown).
+ *
+ * BACKENDS:
+ * ┌────────────┬──────────────────────────────────────────────────────┐
+ * │ Backend    │ Mechanism                                            │
+ * ├────────────┼──────────────────────────────────────────────────────┤
+ * │ IoUring    │ Raw io_uring_setup/io_uring_enter, shared rings.     │
+ * │            │ Linux 5.1+; liburing is not required.                │
+ * │ ThreadPool │ Worker threads calling pread/pwrite/fsync. Used when │
+ * │            │ io_uring is unavailable (old kernel, seccomp, other  │
+ * │            │ platforms) or explicitly requested.                  │
+ * └────────────┴──────────────────────────────────────────────────────┘
+ *
+ * OWNERSHIP:
+ * Request buffers belong to the caller and must stay valid until the
+ * request is reaped. Results follow the syscall convention: bytes
+ * transferred, or a negative errno.
+ *
+ * NOTE (KleaSCM) Submit, Kick, Reap and Wait must all be called from one
+ * thread, and one AsyncIo serves one device: completions are matched to
+ * requests by the caller's Tag only.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Core/Types.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace Aurelia::Host {
+
+enum class AsyncIoBackend : std::uint8_t {
+  IoUring,
+  ThreadPool,
+};
+
+enum class AsyncIoOp : std::uint8_t {
+  Read,
+  Write,
+  Fsync,
+};
+
+struct AsyncIoRequest {
+  AsyncIoOp Op = AsyncIoOp::Read;
+  int Fd = -1;
+  std::uint64_t Offset = 0;
+  Core::Byte *Buffer = nullptr; // Written by Read, read by Write
+  std::uint32_t Length = 0;
+  std::uint64_t Tag = 0; // Returned unchanged in the completion
+};
+
+struct AsyncIoCompletion {
+  std::uint64_t Tag = 0;
+  std::int64_t Result = 0; // Bytes transferred, or -errno
+};
+
+class AsyncIo {
+public:
+  static constexpr std::size_t DefaultDepth = 256;
+  static constexpr std::size_t DefaultWorkers = 2;
+
+  explicit AsyncIo(std::size_t depth = DefaultDepth,
+                   std::size_t workers = DefaultWorkers);
+
+  /**
+   * @brief Waits for in-flight requests, then releases the backend.
+   */
+  ~AsyncIo();
+
+  AsyncIo(const AsyncIo &) = delete;
+  AsyncIo &operator=(const AsyncIo &) = delete;
+
+  /**
+   * @brief Bring up the backend.
+   *
+   * Asking for IoUring falls back to ThreadPool if the kernel refuses.
+   *
+   * @return false if already started
+   */
+  bool Start(AsyncIoBackend preferred = AsyncIoBackend::IoUring);
+
+  [[nodiscard]] bool IsStarted() const { return m_Started; }
+  [[nodiscard]] AsyncIoBackend GetBackend() const { return m_Backend; }
+
+  /**
+   * @brief True if another request fits within the queue depth.
+   */
+  [[nodiscard]] bool HasCapacity() const { return m_InFlight < m_Depth; }
+  [[nodiscard]] std::size_t GetInFlight() const { return m_InFlight; }
+
+  /**
+   * @brief Queue a request; nothing reaches the backend until Kick().
+   * @return false if not started or the queue depth is reached
+   */
+  bool Submit(const AsyncIoRequest &request);
+
+  /**
+   * @brief Hand every queued request to the backend.
+   */
+  void Kick();
+
+  /**
+   * @brief Collect finished requests without blocking.
+   * @return Number of entries written to `out`
+   */
+  std::size_t Reap(std::span<AsyncIoCompletion> out);
+
+  /**
+   * @brief Block until at least one request can be reaped.
+   *
+   * Returns immediately if nothing is in flight.
+   */
+  void Wait();
+
+  /**
+   * @brief Perform a request on the calling thread (what a worker does).
+   *
+   * Short transfers are retried until the full length moves or the file
+   * ends, so the result is directly comparable with Length.
+   */
+  static std::int64_t ExecuteBlocking(const AsyncIoRequest &request);
+
+private:
+  /**
+   * IO_URING BACKEND
+   */
+  bool SetupRing();
+  void TeardownRing();
+  bool PushSqe(const AsyncIoRequest &request);
+  std::size_t ReapRing(std::span<AsyncIoCompletion> out);
+
+  /**
+   * WORKER POOL BACKEND
+   */
+  void StartWorkers();
+  void StopWorkers();
+  void WorkerMain();
+  std::size_t ReapPool(std::span<AsyncIoCompletion> out);
+
+  std::size_t m_Depth;
+  std::size_t m_WorkerCount;
+  bool m_Started = false;
+  AsyncIoBackend m_Backend = AsyncIoBackend::ThreadPool;
+  std::size_t m_InFlight = 0; // Submitted and not yet reaped
+
+  /**
+   * Requests accepted by Submit() but not yet Kick()ed. For io_uring
+   * they already sit in the SQ ring; the count is what Kick() submits.
+   */
+  std::vector<AsyncIoRequest> m_Staged; // Worker pool only
+  std::uint32_t m_Unsubmitted = 0;       // io_uring only
+
+  struct Ring {
+    int Fd = -1;
+    void *SqMap = nullptr;
+    std::size_t SqMapSize = 0;
+    void *CqMap = nullptr;
+    std::size_t CqMapSize = 0;
+    void *SqeMap = nullptr;
+    std::size_t SqeMapSize = 0;
+
+    std::uint32_t *SqHead = nullptr;
+    std::uint32_t *SqTail = nullptr;
+    std::uint32_t SqMask = 0;
+    std::uint32_t SqEntries = 0;
+    std::uint32_t *SqArray = nullptr;
+    std::uint32_t *CqHead = nullptr;
+    std::uint32_t *CqTail = nullptr;
+    std::uint32_t CqMask = 0;
+    void *Sqes = nullptr;
+    void *Cqes = nullptr;
+  };
+  Ring m_Ring;
+
+  /**
+   * Layout of struct iovec; one per SQE slot so vectored ops can point
+   * at it until the kernel has consumed the entry.
+   */
+  struct IoVec {
+    void *Base = nullptr;
+    std::size_t Length = 0;
+  };
+  std::vector<IoVec> m_Iovecs;
+
+  /**
+   * Worker queues. Submission is guarded by m_PoolMutex; completions by
+   * m_DoneMutex, with m_DoneCount letting an idle Reap() skip the lock.
+   */
+  std::vector<std::thread> m_Workers;
+  std::mutex m_PoolMutex;
+  std::condition_variable m_PoolCv;
+  std::deque<AsyncIoRequest> m_Pending;
+  bool m_Stopping = false;
+
+  std::mutex m_DoneMutex;
+  std::condition_variable m_DoneCv;
+  std::vector<AsyncIoCompletion> m_Done;
+  std::atomic<std::size_t> m_DoneCount{0};
+};
+
+} // namespace Aurelia::Host
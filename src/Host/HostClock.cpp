@@ -0,0 +1,30 @@
+/**
+ * Host Clock Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Host/HostClock.hpp"
+#include <chrono>
+
+namespace Aurelia::Host {
+
+std::uint64_t SystemHostClock::MonotonicNs() const {
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+std::int64_t SystemHostClock::WallNs() const {
+  auto now = std::chrono::system_clock::now().time_since_epoch();
+  return static_cast<std::int64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+const SystemHostClock &SystemHostClock::Instance() {
+  static const SystemHostClock clock;
+  return clock;
+}
+
+} // namespace Aurelia::Host
@@ -0,0 +1,50 @@
+/**
+ * Host Clock.
+ *
+ * Source of host time for devices that expose it to the guest.
+ *
+ * Two readings, both in nanoseconds:
+ * ┌──────────────┬────────────────────────────────────────────────────┐
+ * │ Reading      │ Meaning                                            │
+ * ├──────────────┼────────────────────────────────────────────────────┤
+ * │ MonotonicNs  │ Arbitrary origin, never goes backwards, unaffected │
+ * │              │ by wall clock adjustments (steady_clock)           │
+ * │ WallNs       │ Nanoseconds since the Unix epoch (system_clock)    │
+ * └──────────────┴────────────────────────────────────────────────────┘
+ *
+ * Devices hold an IHostClock pointer rather than calling std::chrono
+ * directly, so tests can substitute a clock they control.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace Aurelia::Host {
+
+class IHostClock {
+public:
+  virtual ~IHostClock() = default;
+
+  [[nodiscard]] virtual std::uint64_t MonotonicNs() const = 0;
+  [[nodiscard]] virtual std::int64_t WallNs() const = 0;
+};
+
+/**
+ * The real host clocks.
+ */
+class SystemHostClock final : public IHostClock {
+public:
+  [[nodiscard]] std::uint64_t MonotonicNs() const override;
+  [[nodiscard]] std::int64_t WallNs() const override;
+
+  /**
+   * @brief Process-wide instance; stateless, so sharing is free.
+   */
+  static const SystemHostClock &Instance();
+};
+
+} // namespace Aurelia::Host
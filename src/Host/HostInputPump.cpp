@@ -0,0 +1,359 @@
+/**
+ * Host Input Pump Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Host/HostInputPump.hpp"
+#include <cstring>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define AURELIA_HAS_EPOLL 1
+#endif
+
+namespace Aurelia::Host {
+
+namespace {
+
+/**
+ * epoll user data for the shutdown eventfd. Sources use their index into
+ * m_Sources, which can never reach this value.
+ */
+constexpr std::uint64_t WakeToken = ~std::uint64_t{0};
+
+constexpr int MaxEventsPerWait = 16;
+constexpr std::size_t ReadChunk = 512;
+
+} // namespace
+
+HostInputPump::~HostInputPump() { Stop(); }
+
+bool HostInputPump::AddSource(int fd, InputTarget target) {
+  if (IsRunning() || fd < 0) {
+    return false;
+  }
+  Source src;
+  src.Fd = fd;
+  src.Target = target;
+  m_Sources.push_back(src);
+  return true;
+}
+
+bool HostInputPump::AddStdin(InputTarget target) {
+#if defined(AURELIA_HAS_EPOLL)
+  return AddSource(STDIN_FILENO, target);
+#else
+  (void)target;
+  return false;
+#endif
+}
+
+bool HostInputPump::ListenUnix(const std::string &path, InputTarget target) {
+#if defined(AURELIA_HAS_EPOLL)
+  if (IsRunning()) {
+    return false;
+  }
+
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+    return false;
+  }
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+
+  int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+  if (fd < 0) {
+    return false;
+  }
+
+  ::unlink(path.c_str()); // Stale socket from a previous run
+  if (::bind(fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) !=
+          0 ||
+      ::listen(fd, 4) != 0) {
+    ::close(fd);
+    return false;
+  }
+
+  Source src;
+  src.Fd = fd;
+  src.Target = target;
+  src.Owned = true;
+  src.Listener = true;
+  m_Sources.push_back(src);
+  m_SocketPaths.push_back(path);
+  return true;
+#else
+  (void)path;
+  (void)target;
+  return false;
+#endif
+}
+
+bool HostInputPump::Start() {
+#if defined(AURELIA_HAS_EPOLL)
+  if (IsRunning()) {
+    return false;
+  }
+
+  m_EpollFd = ::epoll_create1(EPOLL_CLOEXEC);
+  m_WakeFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (m_EpollFd < 0 || m_WakeFd < 0) {
+    Stop();
+    return false;
+  }
+
+  epoll_event wake{};
+  wake.events = EPOLLIN;
+  wake.data.u64 = WakeToken;
+  if (::epoll_ctl(m_EpollFd, EPOLL_CTL_ADD, m_WakeFd, &wake) != 0) {
+    Stop();
+    return false;
+  }
+
+  for (std::size_t i = 0; i < m_Sources.size(); ++i) {
+    if (!WatchSource(i)) {
+      Stop();
+      return false;
+    }
+  }
+
+  m_Thread = std::thread(&HostInputPump::ThreadMain, this);
+  return true;
+#else
+  return false;
+#endif
+}
+
+void HostInputPump::Stop() {
+#if defined(AURELIA_HAS_EPOLL)
+  if (m_Thread.joinable()) {
+    std::uint64_t one = 1;
+    [[maybe_unused]] auto n = ::write(m_WakeFd, &one, sizeof(one));
+    m_Thread.join();
+  }
+
+  if (m_EpollFd >= 0) {
+    ::close(m_EpollFd);
+    m_EpollFd = -1;
+  }
+  if (m_WakeFd >= 0) {
+    ::close(m_WakeFd);
+    m_WakeFd = -1;
+  }
+
+  for (Source &src : m_Sources) {
+    if (src.Owned && src.Fd >= 0) {
+      ::close(src.Fd);
+    }
+  }
+  m_Sources.clear();
+
+  for (const std::string &path : m_SocketPaths) {
+    ::unlink(path.c_str());
+  }
+  m_SocketPaths.clear();
+#endif
+}
+
+void HostInputPump::OnTick() {
+  /**
+   * TICK BOUNDARY DELIVERY
+   *
+   * Everything that arrived since the last tick is delivered now, in
+   * arrival order per device. The empty case is three acquire loads.
+   *
+   * The UART is the exception: its RX FIFO holds 16 bytes, so a byte is
+   * only popped once CanReceive() says it will be kept. The rest wait in
+   * the queue for a later tick, as with VirtualMachine's input feeder.
+   */
+  std::uint8_t byte = 0;
+  while ((!m_Uart || m_Uart->CanReceive()) && m_UartQueue.TryPop(byte)) {
+    if (m_Uart) {
+      m_Uart->SimulateReceive(byte);
+    }
+    m_Delivered++;
+  }
+
+  while (m_KeyboardQueue.TryPop(byte)) {
+    if (m_Keyboard) {
+      m_Keyboard->EnqueueKey(byte);
+    }
+    m_Delivered++;
+  }
+
+  MouseEvent ev;
+  while (m_MouseQueue.TryPop(ev)) {
+    if (m_Mouse) {
+      m_Mouse->UpdateState(ev.Dx, ev.Dy, ev.Buttons);
+    }
+    m_Delivered++;
+  }
+}
+
+// -------------------------------------------------------------------------
+// I/O Thread
+// -------------------------------------------------------------------------
+
+void HostInputPump::ThreadMain() {
+#if defined(AURELIA_HAS_EPOLL)
+  std::array<epoll_event, MaxEventsPerWait> events{};
+
+  for (;;) {
+    int n = ::epoll_wait(m_EpollFd, events.data(), MaxEventsPerWait, -1);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return;
+    }
+
+    for (int i = 0; i < n; ++i) {
+      std::uint64_t token = events[static_cast<std::size_t>(i)].data.u64;
+      if (token == WakeToken) {
+        return;
+      }
+      ServiceSource(static_cast<std::size_t>(token));
+    }
+  }
+#endif
+}
+
+bool HostInputPump::WatchSource(std::size_t index) {
+#if defined(AURELIA_HAS_EPOLL)
+  epoll_event ev{};
+  ev.events = EPOLLIN;
+  ev.data.u64 = index;
+  return ::epoll_ctl(m_EpollFd, EPOLL_CTL_ADD, m_Sources[index].Fd, &ev) == 0;
+#else
+  (void)index;
+  return false;
+#endif
+}
+
+void HostInputPump::ServiceSource(std::size_t index) {
+#if defined(AURELIA_HAS_EPOLL)
+  if (index >= m_Sources.size() || m_Sources[index].Fd < 0) {
+    return; // Closed earlier in the same epoll batch
+  }
+
+  if (m_Sources[index].Listener) {
+    AcceptConnections(index);
+    return;
+  }
+
+  /**
+   * One read per readiness notification: level-triggered epoll reports
+   * the source again if more is pending, and a single read on a readable
+   * descriptor cannot block even if the caller left it in blocking mode.
+   */
+  std::array<std::uint8_t, ReadChunk> buffer{};
+  ssize_t n = ::read(m_Sources[index].Fd, buffer.data(), buffer.size());
+  if (n > 0) {
+    Route(m_Sources[index], std::span<const std::uint8_t>(
+                                buffer.data(), static_cast<std::size_t>(n)));
+  } else if (n == 0 || (errno != EINTR && errno != EAGAIN)) {
+    CloseSource(index); // EOF or hard error
+  }
+#else
+  (void)index;
+#endif
+}
+
+void HostInputPump::AcceptConnections(std::size_t index) {
+#if defined(AURELIA_HAS_EPOLL)
+  for (;;) {
+    int fd = ::accept4(m_Sources[index].Fd, nullptr, nullptr,
+                       SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0) {
+      return; // EAGAIN: backlog drained
+    }
+
+    Source conn;
+    conn.Fd = fd;
+    conn.Target = m_Sources[index].Target;
+    conn.Owned = true;
+    m_Sources.push_back(conn);
+
+    if (!WatchSource(m_Sources.size() - 1)) {
+      CloseSource(m_Sources.size() - 1);
+    }
+  }
+#else
+  (void)index;
+#endif
+}
+
+void HostInputPump::CloseSource(std::size_t index) {
+#if defined(AURELIA_HAS_EPOLL)
+  Source &src = m_Sources[index];
+  ::epoll_ctl(m_EpollFd, EPOLL_CTL_DEL, src.Fd, nullptr);
+  if (src.Owned) {
+    ::close(src.Fd);
+  }
+  src.Fd = -1; // Slot retired; indices of other sources stay stable
+#else
+  (void)index;
+#endif
+}
+
+void HostInputPump::Route(Source &src, std::span<const std::uint8_t> bytes) {
+  switch (src.Target) {
+  case InputTarget::Uart:
+    for (std::uint8_t byte : bytes) {
+      PushByte(m_UartQueue, byte);
+    }
+    break;
+
+  case InputTarget::Keyboard:
+    for (std::uint8_t byte : bytes) {
+      PushByte(m_KeyboardQueue, byte);
+    }
+    break;
+
+  case InputTarget::Mouse:
+    /**
+     * Stream sockets do not preserve message boundaries, so packets are
+     * reassembled per source before being decoded.
+     */
+    for (std::uint8_t byte : bytes) {
+      src.Partial[src.PartialCount++] = byte;
+      if (src.PartialCount < MousePacketSize) {
+        continue;
+      }
+      src.PartialCount = 0;
+
+      std::uint32_t dx = 0;
+      std::uint32_t dy = 0;
+      for (std::size_t i = 0; i < 4; ++i) {
+        dx |= static_cast<std::uint32_t>(src.Partial[1 + i]) << (8 * i);
+        dy |= static_cast<std::uint32_t>(src.Partial[5 + i]) << (8 * i);
+      }
+
+      MouseEvent ev;
+      ev.Buttons = src.Partial[0];
+      ev.Dx = static_cast<std::int32_t>(dx);
+      ev.Dy = static_cast<std::int32_t>(dy);
+      if (!m_MouseQueue.TryPush(ev)) {
+        m_Dropped.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+    break;
+  }
+}
+
+void HostInputPump::PushByte(
+    Core::SpscQueue<std::uint8_t, ByteQueueCapacity> &queue,
+    std::uint8_t byte) {
+  if (!queue.TryPush(byte)) {
+    m_Dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+} // namespace Aurelia::Host
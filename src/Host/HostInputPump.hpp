@@ -0,0 +1,223 @@
+/**
+ * Host Input Pump.
+ *
+ * Dedicated host I/O thread feeding real input into the guest's input
+ * devices (UART RX, keyboard controller, mouse).
+ *
+ * PROBLEM:
+ * The simulation thread runs a tight tick loop. Polling host file
+ * descriptors from it would cost a syscall per poll, and a blocking read
+ * would freeze guest time entirely while the user is not typing.
+ *
+ * DESIGN:
+ * ┌──────────────┐  epoll   ┌──────────────┐  SPSC   ┌──────────────────┐
+ * │ stdin / pty  │─────────►│  I/O thread  │────────►│ OnTick (sim      │
+ * │ unix sockets │  read()  │  (blocking)  │ queues  │ thread) → device │
+ * └──────────────┘          └──────────────┘         └──────────────────┘
+ *
+ * - The I/O thread sleeps in epoll_wait until a source is readable, reads
+ *   what is there and pushes it onto a lock-free single-producer
+ *   single-consumer queue per target device.
+ * - The pump is an ITickable. Its OnTick runs on the simulation thread,
+ *   pops whatever arrived and hands it to the devices at a tick boundary.
+ *   An idle OnTick is one atomic load per queue; no syscalls, no locks.
+ * - Shutdown is signalled through an eventfd registered with the same
+ *   epoll set, so Stop() never has to interrupt a blocked syscall.
+ *
+ * SOURCE FORMATS:
+ * ┌──────────┬───────────────────────────────────────────────────────┐
+ * │ Target   │ Byte Stream Interpretation                            │
+ * ├──────────┼───────────────────────────────────────────────────────┤
+ * │ Uart     │ Raw bytes → UartDevice::SimulateReceive               │
+ * │ Keyboard │ Raw bytes → KeyboardDevice::EnqueueKey                │
+ * │ Mouse    │ 9-byte packets: buttons(u8), dx(i32 LE), dy(i32 LE)   │
+ * │          │ → MouseDevice::UpdateState                            │
+ * └──────────┴───────────────────────────────────────────────────────┘
+ *
+ * BACKPRESSURE:
+ * UART input is held in its queue while the RX FIFO is full
+ * (UartDevice::CanReceive()), like CTS flow control, so a paste longer
+ * than the FIFO is not overrun. Beyond that there is none: if a queue is
+ * full the excess input is dropped and counted (GetDroppedCount()).
+ *
+ * PLATFORM:
+ * Linux only (epoll, eventfd). Elsewhere Start() returns false and the
+ * pump is inert.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Core/ITickable.hpp"
+#include "Core/SpscQueue.hpp"
+#include "Peripherals/KeyboardDevice.hpp"
+#include "Peripherals/MouseDevice.hpp"
+#include "Peripherals/UartDevice.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Aurelia::Host {
+
+enum class InputTarget : std::uint8_t {
+  Uart,
+  Keyboard,
+  Mouse,
+};
+
+/**
+ * @brief Decoded mouse packet, as queued between threads.
+ */
+struct MouseEvent {
+  std::int32_t Dx = 0;
+  std::int32_t Dy = 0;
+  std::uint8_t Buttons = 0;
+};
+
+class HostInputPump final : public Core::ITickable {
+public:
+  static constexpr std::size_t ByteQueueCapacity = 4096;
+  static constexpr std::size_t MouseQueueCapacity = 256;
+  static constexpr std::size_t MousePacketSize = 9;
+
+  HostInputPump() = default;
+
+  /**
+   * @brief Stops the I/O thread and closes every owned descriptor.
+   */
+  ~HostInputPump() override;
+
+  HostInputPump(const HostInputPump &) = delete;
+  HostInputPump &operator=(const HostInputPump &) = delete;
+
+  /**
+   * DEVICE WIRING
+   *
+   * Input for a target with no connected device is discarded on delivery.
+   */
+  void ConnectUart(Peripherals::UartDevice *uart) { m_Uart = uart; }
+  void ConnectKeyboard(Peripherals::KeyboardDevice *kbc) { m_Keyboard = kbc; }
+  void ConnectMouse(Peripherals::MouseDevice *mouse) { m_Mouse = mouse; }
+
+  /**
+   * @brief Register an existing readable descriptor (not owned).
+   *
+   * Suitable for stdin, a pipe, or a PtySink master. The descriptor's
+   * flags are left untouched; the I/O thread performs exactly one read
+   * per readiness notification, which cannot block.
+   *
+   * Sources must be registered before Start().
+   *
+   * @return false if already running or fd is invalid
+   */
+  bool AddSource(int fd, InputTarget target);
+
+  /**
+   * @brief Register standard input.
+   */
+  bool AddStdin(InputTarget target = InputTarget::Uart);
+
+  /**
+   * @brief Listen on a Unix stream socket.
+   *
+   * Every accepted connection becomes a source routed to `target`. Any
+   * stale socket file at `path` is replaced; the file is removed again on
+   * Stop().
+   *
+   * @return false if the socket could not be created, bound or listened
+   */
+  bool ListenUnix(const std::string &path, InputTarget target);
+
+  /**
+   * @brief Launch the I/O thread.
+   * @return false if already running, or epoll/eventfd setup failed
+   */
+  bool Start();
+
+  /**
+   * @brief Wake and join the I/O thread; close owned descriptors.
+   *
+   * Input already queued stays queued and is still delivered by OnTick.
+   */
+  void Stop();
+
+  [[nodiscard]] bool IsRunning() const { return m_Thread.joinable(); }
+
+  /**
+   * @brief Deliver queued host input to the connected devices.
+   *
+   * Simulation thread only. Never blocks and never enters the kernel.
+   */
+  void OnTick() override;
+
+  /**
+   * @brief Input discarded because a queue was full.
+   */
+  [[nodiscard]] std::uint64_t GetDroppedCount() const {
+    return m_Dropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Bytes and mouse packets handed to devices (simulation thread).
+   */
+  [[nodiscard]] std::uint64_t GetDeliveredCount() const {
+    return m_Delivered;
+  }
+
+private:
+  struct Source {
+    int Fd = -1;
+    InputTarget Target = InputTarget::Uart;
+    bool Owned = false;    // Close on removal/shutdown
+    bool Listener = false; // Accept connections instead of reading
+    std::array<std::uint8_t, MousePacketSize> Partial{};
+    std::size_t PartialCount = 0; // Mouse packet reassembly
+  };
+
+  /**
+   * I/O THREAD
+   */
+  void ThreadMain();
+  void ServiceSource(std::size_t index);
+  void AcceptConnections(std::size_t index);
+  void CloseSource(std::size_t index);
+  bool WatchSource(std::size_t index);
+  void Route(Source &src, std::span<const std::uint8_t> bytes);
+  void PushByte(Core::SpscQueue<std::uint8_t, ByteQueueCapacity> &queue,
+                std::uint8_t byte);
+
+  /**
+   * Registered before Start(); afterwards only the I/O thread touches
+   * this (to append accepted connections), until Stop() joins it.
+   */
+  std::vector<Source> m_Sources;
+  std::vector<std::string> m_SocketPaths;
+
+  int m_EpollFd = -1;
+  int m_WakeFd = -1;
+  std::thread m_Thread;
+
+  /**
+   * CROSS-THREAD QUEUES (producer: I/O thread, consumer: OnTick)
+   */
+  Core::SpscQueue<std::uint8_t, ByteQueueCapacity> m_UartQueue;
+  Core::SpscQueue<std::uint8_t, ByteQueueCapacity> m_KeyboardQueue;
+  Core::SpscQueue<MouseEvent, MouseQueueCapacity> m_MouseQueue;
+  std::atomic<std::uint64_t> m_Dropped{0};
+
+  /**
+   * SIMULATION-THREAD STATE
+   */
+  Peripherals::UartDevice *m_Uart = nullptr;
+  Peripherals::KeyboardDevice *m_Keyboard = nullptr;
+  Peripherals::MouseDevice *m_Mouse = nullptr;
+  std::uint64_t m_Delivered = 0;
+};
+
+} // namespace Aurelia::Host
@@ -0,0 +1,86 @@
+/**
+ * Mapped File Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Host/MappedFile.hpp"
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AURELIA_HAS_MMAP 1
+#endif
+
+namespace Aurelia::Host {
+
+MappedFile::~MappedFile() { Close(); }
+
+bool MappedFile::Open(const std::string &filename, MappedFileHint hint) {
+  Close();
+#if defined(AURELIA_HAS_MMAP)
+  int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st {};
+  if (::fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+    ::close(fd);
+    return false;
+  }
+  std::size_t size = static_cast<std::size_t>(st.st_size);
+  if (size != 0) {
+    void *map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+      ::close(fd);
+      return false;
+    }
+    ::madvise(map, size, hint == MappedFileHint::Sequential ? MADV_SEQUENTIAL
+                                                            : MADV_RANDOM);
+    m_Map = map;
+  }
+  m_Size = size;
+  ::close(fd); // The mapping keeps the file alive
+  return true;
+#else
+  (void)hint;
+  std::ifstream file(filename,
+                     std::ios::in | std::ios::binary | std::ios::ate);
+  if (!file.is_open()) {
+    return false;
+  }
+  m_Buffer.resize(static_cast<std::size_t>(file.tellg()));
+  file.seekg(0);
+  if (!file.read(reinterpret_cast<char *>(m_Buffer.data()),
+                 static_cast<std::streamsize>(m_Buffer.size()))) {
+    m_Buffer.clear();
+    return false;
+  }
+  m_Size = m_Buffer.size();
+  return true;
+#endif
+}
+
+void MappedFile::Close() {
+#if defined(AURELIA_HAS_MMAP)
+  if (m_Map) {
+    ::munmap(m_Map, m_Size);
+  }
+#endif
+  m_Map = nullptr;
+  m_Buffer.clear();
+  m_Size = 0;
+}
+
+std::span<const std::uint8_t> MappedFile::Bytes() const {
+  if (m_Map) {
+    return {static_cast<const std::uint8_t *>(m_Map), m_Size};
+  }
+  return {m_Buffer.data(), m_Size};
+}
+
+} // namespace Aurelia::Host
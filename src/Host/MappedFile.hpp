@@ -0,0 +1,59 @@
+/**
+ * Mapped File.
+ *
+ * Read-only view of a whole host file. mmap'd where available, so bytes
+ * are only read from disk when something touches them; otherwise the
+ * file is read into an owned buffer in one call.
+ *
+ * ACCESS HINTS:
+ * ┌────────────┬──────────────────────────────────────────────────────┐
+ * │ Hint       │ Use                                                  │
+ * ├────────────┼──────────────────────────────────────────────────────┤
+ * │ Sequential │ One forward pass (program load): aggressive readahead│
+ * │ Random     │ Scattered page faults (compressed images): no        │
+ * │            │ readahead, so a cold start reads only what is used   │
+ * └────────────┴──────────────────────────────────────────────────────┘
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Aurelia::Host {
+
+enum class MappedFileHint { Sequential, Random };
+
+class MappedFile {
+public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+
+  /**
+   * @brief Map `filename`, replacing any file already open.
+   * @return false if the file cannot be opened, is not a regular file,
+   *         or cannot be read
+   */
+  bool Open(const std::string &filename,
+            MappedFileHint hint = MappedFileHint::Sequential);
+
+  void Close();
+
+  [[nodiscard]] std::span<const std::uint8_t> Bytes() const;
+
+private:
+  std::size_t m_Size = 0;
+  void *m_Map = nullptr;             // mmap'd view (POSIX)
+  std::vector<std::uint8_t> m_Buffer; // Owned copy (elsewhere)
+};
+
+} // namespace Aurelia::Host
@@ -0,0 +1,136 @@
+/**
+ * Work-Stealing Thread Pool Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Host/ThreadPool.hpp"
+
+namespace Aurelia::Host {
+
+namespace {
+
+// Identifies the pool and deque of the current thread, if it is a worker
+thread_local const ThreadPool *t_Pool = nullptr;
+thread_local std::size_t t_WorkerIndex = 0;
+
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t threads) {
+  if (threads == 0) {
+    threads = std::thread::hardware_concurrency();
+  }
+  if (threads == 0) {
+    threads = 1; // Concurrency unknown
+  }
+
+  for (std::size_t i = 0; i < threads; ++i) {
+    m_Queues.push_back(std::make_unique<WorkQueue>());
+  }
+  m_Workers.reserve(threads);
+  for (std::size_t i = 0; i < threads; ++i) {
+    m_Workers.emplace_back([this, i] { WorkerLoop(i); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  Wait();
+  {
+    std::lock_guard<std::mutex> lock(m_SleepMutex);
+    m_Stopping = true;
+  }
+  m_WorkCv.notify_all();
+  for (std::thread &worker : m_Workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::Submit(Task task) { Push(std::move(task), false); }
+
+void ThreadPool::Defer(Task task) { Push(std::move(task), t_Pool == this); }
+
+void ThreadPool::Push(Task task, bool front) {
+  std::size_t index = t_WorkerIndex;
+  if (t_Pool != this) {
+    index = m_NextQueue.fetch_add(1, std::memory_order_relaxed) %
+            m_Queues.size();
+  }
+
+  // Counted before the push, so a worker's decrement never goes below 0
+  m_Unfinished.fetch_add(1, std::memory_order_relaxed);
+  m_Queued.fetch_add(1, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(m_Queues[index]->Mutex);
+    if (front) {
+      m_Queues[index]->Tasks.push_front(std::move(task));
+    } else {
+      m_Queues[index]->Tasks.push_back(std::move(task));
+    }
+  }
+
+  // Taking the sleep lock orders this wakeup after any worker's check of
+  // m_Queued, so a worker about to sleep cannot miss the task
+  { std::lock_guard<std::mutex> lock(m_SleepMutex); }
+  m_WorkCv.notify_one();
+}
+
+void ThreadPool::Wait() {
+  std::unique_lock<std::mutex> lock(m_SleepMutex);
+  m_IdleCv.wait(lock, [this] {
+    return m_Unfinished.load(std::memory_order_acquire) == 0;
+  });
+}
+
+bool ThreadPool::TryPopOwn(std::size_t index, Task &task) {
+  WorkQueue &queue = *m_Queues[index];
+  std::lock_guard<std::mutex> lock(queue.Mutex);
+  if (queue.Tasks.empty()) {
+    return false;
+  }
+  task = std::move(queue.Tasks.back());
+  queue.Tasks.pop_back();
+  return true;
+}
+
+bool ThreadPool::TrySteal(std::size_t thief, Task &task) {
+  for (std::size_t i = 1; i < m_Queues.size(); ++i) {
+    WorkQueue &victim = *m_Queues[(thief + i) % m_Queues.size()];
+    std::lock_guard<std::mutex> lock(victim.Mutex);
+    if (!victim.Tasks.empty()) {
+      task = std::move(victim.Tasks.front());
+      victim.Tasks.pop_front();
+      m_Steals.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+  }
+  return false;
+}
+
+void ThreadPool::WorkerLoop(std::size_t index) {
+  t_Pool = this;
+  t_WorkerIndex = index;
+
+  for (;;) {
+    Task task;
+    if (TryPopOwn(index, task) || TrySteal(index, task)) {
+      m_Queued.fetch_sub(1, std::memory_order_relaxed);
+      task();
+      if (m_Unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_IdleCv.notify_all();
+      }
+      continue;
+    }
+
+    std::unique_lock<std::mutex> lock(m_SleepMutex);
+    m_WorkCv.wait(lock, [this] {
+      return m_Stopping || m_Queued.load(std::memory_order_acquire) != 0;
+    });
+    if (m_Stopping && m_Queued.load(std::memory_order_acquire) == 0) {
+      return;
+    }
+  }
+}
+
+} // namespace Aurelia::Host
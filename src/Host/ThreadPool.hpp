@@ -0,0 +1,124 @@
+/**
+ * Work-Stealing Thread Pool.
+ *
+ * Runs independent host tasks (whole guest machines in the batch runner)
+ * across a fixed set of worker threads.
+ *
+ * DESIGN:
+ * Every worker owns a deque. Tasks submitted from outside the pool are
+ * dealt round-robin across the deques; tasks submitted by a task go on
+ * the submitting worker's own deque. A worker takes from the back of its
+ * own deque (newest first, still warm in cache) and, when that is empty,
+ * steals from the front of another worker's (oldest first, the largest
+ * remaining piece of work). A worker with nothing to run or steal sleeps
+ * until the next Submit().
+ *
+ * ┌──────────┐  pop back   ┌───────────────────┐  steal front  ┌──────────┐
+ * │ Worker 0 │◄────────────│ Deque 0 [a b c d] │──────────────►│ Worker 1 │
+ * └──────────┘             └───────────────────┘               └──────────┘
+ *
+ * Imbalanced work (one guest runs for seconds, the rest for microseconds)
+ * therefore never leaves a worker idle while another has a backlog.
+ *
+ * YIELDING:
+ * A long task can run in slices by queueing its own continuation with
+ * Defer(), which puts it at the front of the deque instead of the back:
+ * the owner runs everything else queued there first, and it is the
+ * first thing an idle worker steals. Many time-sliced tasks on one
+ * worker therefore take turns round-robin.
+ *
+ * NOTE (KleaSCM) Each deque has its own lock, held only to push or pop a
+ * single task. Contention is between one owner and the occasional thief,
+ * which costs far less than the jobs being scheduled.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Aurelia::Host {
+
+class ThreadPool {
+public:
+  using Task = std::function<void()>;
+
+  /**
+   * @param threads Worker count; 0 uses the host's hardware concurrency
+   */
+  explicit ThreadPool(std::size_t threads = 0);
+
+  /**
+   * @brief Finishes every queued task, then joins the workers.
+   */
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /**
+   * @brief Queue a task. Safe from any thread, including pool tasks.
+   */
+  void Submit(Task task);
+
+  /**
+   * @brief Queue a task behind everything already queued on this worker.
+   *
+   * For continuations of time-sliced work; from outside the pool it
+   * behaves like Submit().
+   */
+  void Defer(Task task);
+
+  /**
+   * @brief Block until every task submitted so far has finished.
+   *
+   * Must not be called from a pool task.
+   */
+  void Wait();
+
+  [[nodiscard]] std::size_t GetThreadCount() const { return m_Queues.size(); }
+
+  /**
+   * @brief Tasks run by a worker other than the one they were queued on.
+   */
+  [[nodiscard]] std::uint64_t GetStealCount() const {
+    return m_Steals.load(std::memory_order_relaxed);
+  }
+
+private:
+  struct WorkQueue {
+    std::mutex Mutex;
+    std::deque<Task> Tasks;
+  };
+
+  std::vector<std::unique_ptr<WorkQueue>> m_Queues;
+  std::vector<std::thread> m_Workers;
+
+  std::atomic<std::size_t> m_Queued{0};     // In a deque, not yet taken
+  std::atomic<std::size_t> m_Unfinished{0}; // Submitted, not yet finished
+  std::atomic<std::size_t> m_NextQueue{0};  // Round-robin for outsiders
+  std::atomic<std::uint64_t> m_Steals{0};
+  bool m_Stopping = false; // Guarded by m_SleepMutex
+
+  std::mutex m_SleepMutex;
+  std::condition_variable m_WorkCv; // Workers: a task was queued
+  std::condition_variable m_IdleCv; // Wait(): m_Unfinished reached zero
+
+  void Push(Task task, bool front);
+  void WorkerLoop(std::size_t index);
+  bool TryPopOwn(std::size_t index, Task &task);
+  bool TrySteal(std::size_t thief, Task &task);
+};
+
+} // namespace Aurelia::Host
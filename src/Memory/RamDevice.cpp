@@ -6,20 +6,113 @@
  */
 
 #include "Memory/RamDevice.hpp"
+#include "Core/Instrument.hpp"
+#include <algorithm>
+#include <cstdint>
 #include <cstring> // for memcpy
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define AURELIA_HAS_MMAP 1
+#endif
+
 namespace Aurelia::Memory {
 
+namespace {
+
+#if defined(AURELIA_HAS_MMAP)
+std::size_t HostPageSize() {
+  static const auto size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+  return size;
+}
+#endif
+
+} // namespace
+
 RamDevice::RamDevice(std::size_t sizeBytes, Core::TickCount latency)
     : m_BaseAddr(0), m_Size(sizeBytes), m_Latency(latency),
       m_CurrentWaitTicks(0) {
-  m_Storage.resize(sizeBytes, 0);
+#if defined(AURELIA_HAS_MMAP)
+  // Anonymous pages read as zero and are only committed when touched
+  void *map = ::mmap(nullptr, sizeBytes, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (sizeBytes != 0 && map != MAP_FAILED) {
+    m_Storage = static_cast<Core::Byte *>(map);
+    m_IsMapped = true;
+    return;
+  }
+#endif
+  m_Storage = new Core::Byte[sizeBytes](); // Value-initialised: zeroed
+}
+
+RamDevice::~RamDevice() {
+#if defined(AURELIA_HAS_MMAP)
+  if (m_IsMapped) {
+    ::munmap(m_Storage, m_Size);
+    return;
+  }
+#endif
+  delete[] m_Storage;
 }
 
 void RamDevice::SetBaseAddress(Core::Address baseAddr) {
   m_BaseAddr = baseAddr;
 }
 
+bool RamDevice::AttachImage(const Storage::Image::PageImage *image) {
+  if (!image || image->GetLayout() != Storage::Image::PageLayout::Flat ||
+      image->GetLogicalSize() > m_Size) {
+    return false;
+  }
+
+  std::size_t pages = image->GetPageCount();
+  m_PendingPages.assign((pages + 63) / 64, ~std::uint64_t{0});
+  if (pages % 64 != 0) {
+    m_PendingPages.back() = (std::uint64_t{1} << (pages % 64)) - 1;
+  }
+  m_PendingCount = pages;
+  m_ImageErrors = 0;
+  m_Image = pages != 0 ? image : nullptr;
+  return true;
+}
+
+void RamDevice::FaultIn(std::size_t offset, std::size_t length,
+                        bool overwrite) {
+  if (length == 0) {
+    return;
+  }
+  std::size_t pageSize = m_Image->GetPageSize();
+  std::size_t first = offset / pageSize;
+  std::size_t last = std::min((offset + length - 1) / pageSize,
+                              m_Image->GetPageCount() - 1);
+
+  for (std::size_t page = first; page <= last; ++page) {
+    std::uint64_t bit = std::uint64_t{1} << (page % 64);
+    if (!(m_PendingPages[page / 64] & bit)) {
+      continue;
+    }
+    m_PendingPages[page / 64] &= ~bit;
+    --m_PendingCount;
+    AURELIA_INSTRUMENT_COUNT(RamFaultIn, 1);
+
+    std::size_t begin = page * pageSize;
+    std::size_t bytes = m_Image->GetPageBytes(page);
+    bool covered =
+        overwrite && offset <= begin && begin + bytes <= offset + length;
+    if (!covered &&
+        !m_Image->ReadPage(page, {m_Storage + begin, bytes})) {
+      std::memset(m_Storage + begin, 0, bytes);
+      ++m_ImageErrors;
+    }
+  }
+
+  if (m_PendingCount == 0) {
+    m_Image = nullptr; // Fully resident: back to the fast path
+    m_PendingPages.clear();
+  }
+}
+
 bool RamDevice::IsAddressInRange(Core::Address addr) const {
   return addr >= m_BaseAddr && addr < (m_BaseAddr + m_Size);
 }
@@ -43,17 +136,21 @@ bool RamDevice::OnRead(Core::Address addr, Core::Data &outData) {
   }
   // Pass through if m_IsBusy is true AND ticks == 0 (Wait finished)
   m_IsBusy = false;
+  AURELIA_INSTRUMENT_SCOPE(RamRead);
 
   // Perform Read
   // Calculate offset
   Core::Address offset = addr - m_BaseAddr;
 
   // Access overrun check
-  if (offset + sizeof(Core::Data) > m_Storage.size()) {
+  if (offset + sizeof(Core::Data) > m_Size) {
     return false;
   }
+  if (m_Image) [[unlikely]] {
+    FaultIn(offset, sizeof(Core::Data), false);
+  }
 
-  std::memcpy(&outData, &m_Storage[offset], sizeof(Core::Data));
+  std::memcpy(&outData, m_Storage + offset, sizeof(Core::Data));
   return true;
 }
 
@@ -70,15 +167,83 @@ bool RamDevice::OnWrite(Core::Address addr, Core::Data inData) {
   }
   // Pass through if m_IsBusy is true AND ticks == 0 (Wait finished)
   m_IsBusy = false;
+  AURELIA_INSTRUMENT_SCOPE(RamWrite);
 
   // Perform Write
   Core::Address offset = addr - m_BaseAddr;
 
-  if (offset + sizeof(Core::Data) > m_Storage.size()) {
+  if (offset + sizeof(Core::Data) > m_Size) {
     return false;
   }
+  if (m_Image) [[unlikely]] {
+    FaultIn(offset, sizeof(Core::Data), false);
+  }
+
+  std::memcpy(m_Storage + offset, &inData, sizeof(Core::Data));
+  return true;
+}
+
+bool RamDevice::OnReadBlock(Core::Address addr, std::span<Core::Byte> out) {
+  // Bulk path: one copy, no wait states (see IBusDevice)
+  AURELIA_INSTRUMENT_SCOPE(RamBlock);
+  Core::Address offset = addr - m_BaseAddr;
+  if (offset + out.size() > m_Size) {
+    return false;
+  }
+  if (m_Image) [[unlikely]] {
+    FaultIn(offset, out.size(), false);
+  }
+
+  std::memcpy(out.data(), m_Storage + offset, out.size());
+  return true;
+}
+
+bool RamDevice::OnWriteBlock(Core::Address addr,
+                             std::span<const Core::Byte> in) {
+  AURELIA_INSTRUMENT_SCOPE(RamBlock);
+  Core::Address offset = addr - m_BaseAddr;
+  if (offset + in.size() > m_Size) {
+    return false;
+  }
+  if (m_Image) [[unlikely]] {
+    FaultIn(offset, in.size(), true);
+  }
+
+  std::memcpy(m_Storage + offset, in.data(), in.size());
+  return true;
+}
+
+bool RamDevice::OnZeroBlock(Core::Address addr, std::size_t length) {
+  AURELIA_INSTRUMENT_SCOPE(RamBlock);
+  Core::Address offset = addr - m_BaseAddr;
+  if (offset + length > m_Size) {
+    return false;
+  }
+  if (m_Image) [[unlikely]] {
+    FaultIn(offset, length, true);
+  }
+
+  Core::Byte *begin = m_Storage + offset;
+  Core::Byte *end = begin + length;
+
+#if defined(AURELIA_HAS_MMAP)
+  // Whole pages go back to the host; only the ragged edges are written
+  if (m_IsMapped) {
+    auto mask = ~static_cast<std::uintptr_t>(HostPageSize() - 1);
+    auto first = (reinterpret_cast<std::uintptr_t>(begin) + ~mask) & mask;
+    auto last = reinterpret_cast<std::uintptr_t>(end) & mask;
+    if (first < last &&
+        ::madvise(reinterpret_cast<void *>(first), last - first,
+                  MADV_DONTNEED) == 0) {
+      std::memset(begin, 0, first - reinterpret_cast<std::uintptr_t>(begin));
+      std::memset(reinterpret_cast<Core::Byte *>(last), 0,
+                  reinterpret_cast<std::uintptr_t>(end) - last);
+      return true;
+    }
+  }
+#endif
 
-  std::memcpy(&m_Storage[offset], &inData, sizeof(Core::Data));
+  std::memset(begin, 0, length);
   return true;
 }
 
@@ -3,6 +3,23 @@
  *
  * Simulates a contiguous block of volatile memory with access latency.
  *
+ * SPARSE BACKING:
+ * On POSIX hosts the storage is an anonymous private mapping, so the
+ * host only commits pages the guest actually touches: a 256 MB machine
+ * running a 4 KB program costs a few pages, not 256 MB of memset at
+ * boot. Zero fills of whole pages (OnZeroBlock, used for BSS) release
+ * the pages instead of writing them; the next access sees fresh zero
+ * pages. Elsewhere the storage is an ordinary zeroed heap array.
+ *
+ * COMPRESSED IMAGES:
+ * AttachImage() overlays a flat page image (Storage/Image/PageImage.hpp)
+ * from the start of RAM without decoding anything. Each image page is
+ * decoded on the first access that touches it, tracked by a bitmap of
+ * pending pages. Block writes and zero fills that cover a whole pending
+ * page skip decoding it, since the old contents would be overwritten
+ * anyway. Once every page is resident the image is dropped and accesses
+ * are back to a single pointer test.
+ *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
  */
@@ -10,6 +27,9 @@
 #pragma once
 
 #include "Bus/IBusDevice.hpp"
+#include "Storage/Image/PageImage.hpp"
+#include <cstddef>
+#include <cstdint>
 #include <vector>
 
 namespace Aurelia::Memory {
@@ -17,17 +37,47 @@ namespace Aurelia::Memory {
 class RamDevice : public Bus::IBusDevice {
 public:
   RamDevice(std::size_t sizeBytes, Core::TickCount latency = 1);
+  ~RamDevice() override;
+
+  RamDevice(const RamDevice &) = delete;
+  RamDevice &operator=(const RamDevice &) = delete;
 
   [[nodiscard]] bool IsAddressInRange(Core::Address addr) const override;
   bool OnRead(Core::Address addr, Core::Data &outData) override;
   bool OnWrite(Core::Address addr, Core::Data inData) override;
+  bool OnReadBlock(Core::Address addr, std::span<Core::Byte> out) override;
+  bool OnWriteBlock(Core::Address addr,
+                    std::span<const Core::Byte> in) override;
+  bool OnZeroBlock(Core::Address addr, std::size_t length) override;
   void OnTick() override;
 
   void SetBaseAddress(Core::Address baseAddr);
 
+  /**
+   * @brief Back RAM with a compressed image, decoded on first touch.
+   *
+   * The image must stay alive until every page is resident or another
+   * image is attached.
+   *
+   * @return false unless the image is Flat and fits in RAM
+   */
+  bool AttachImage(const Storage::Image::PageImage *image);
+
+  [[nodiscard]] std::size_t GetPendingImagePages() const {
+    return m_PendingCount;
+  }
+
+  /**
+   * @brief Image pages that failed to decode (and were zero-filled).
+   */
+  [[nodiscard]] std::size_t GetImageErrorCount() const {
+    return m_ImageErrors;
+  }
+
 private:
-  // Emulating physical storage
-  std::vector<Core::Byte> m_Storage;
+  // Emulating physical storage (sparse where the host allows)
+  Core::Byte *m_Storage = nullptr;
+  bool m_IsMapped = false; // Anonymous mapping rather than heap array
   Core::Address m_BaseAddr;
   std::size_t m_Size;
 
@@ -35,6 +85,19 @@ private:
   Core::TickCount m_Latency;
   Core::TickCount m_CurrentWaitTicks;
   bool m_IsBusy = false;
+
+  // Demand-decoded image
+  const Storage::Image::PageImage *m_Image = nullptr;
+  std::vector<std::uint64_t> m_PendingPages; // Bit set: not yet decoded
+  std::size_t m_PendingCount = 0;
+  std::size_t m_ImageErrors = 0;
+
+  /**
+   * @brief Decode pending pages overlapping [offset, offset + length).
+   * @param overwrite Caller replaces the whole range, so fully covered
+   *                  pages need no decoding
+   */
+  void FaultIn(std::size_t offset, std::size_t length, bool overwrite);
 };
 
 } // namespace Aurelia::Memory
@@ -0,0 +1,210 @@
+/**
+ * Network Backends Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Network/NetBackend.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define AURELIA_HAS_UNIX_SOCKETS 1
+#endif
+
+namespace Aurelia::Network {
+
+// ---------------------------------------------------------------------------
+// NetSwitch
+// ---------------------------------------------------------------------------
+
+NetSwitch::Port *NetSwitch::AddPort() {
+  std::lock_guard lock(m_Mutex);
+  m_Ports.push_back(std::unique_ptr<Port>(new Port(this, m_Ports.size())));
+  return m_Ports.back().get();
+}
+
+std::size_t NetSwitch::GetPortCount() const {
+  std::lock_guard lock(m_Mutex);
+  return m_Ports.size();
+}
+
+void NetSwitch::Forward(std::size_t from, Frame &&frame) {
+  MacAddress dst{};
+  MacAddress src{};
+  std::copy_n(frame.begin(), 6, dst.begin());
+  std::copy_n(frame.begin() + 6, 6, src.begin());
+
+  std::lock_guard lock(m_Mutex);
+  if (!(src[0] & 1)) {
+    m_MacTable[src] = from; // Learn; group addresses are never sources
+  }
+
+  if (!(dst[0] & 1)) {
+    auto it = m_MacTable.find(dst);
+    if (it != m_MacTable.end()) {
+      if (it->second != from) {
+        m_Ports[it->second]->Deliver(std::move(frame));
+      }
+      return; // Known unicast, possibly to the sender's own segment
+    }
+  }
+
+  // Flood: copy for every extra port, move into the last one
+  std::size_t last = m_Ports.size();
+  for (std::size_t i = m_Ports.size(); i-- > 0;) {
+    if (i != from) {
+      last = i;
+      break;
+    }
+  }
+  for (std::size_t i = 0; i < m_Ports.size(); ++i) {
+    if (i == from) {
+      continue;
+    }
+    if (i == last) {
+      m_Ports[i]->Deliver(std::move(frame));
+    } else {
+      m_Ports[i]->Deliver(Frame(frame));
+    }
+  }
+}
+
+bool NetSwitch::Port::Transmit(Frame &&frame) {
+  if (frame.size() < EthernetHeaderSize || frame.size() > MaxFrameSize) {
+    return false;
+  }
+  m_Switch->Forward(m_Index, std::move(frame));
+  return true;
+}
+
+void NetSwitch::Port::Deliver(Frame &&frame) {
+  std::lock_guard lock(m_Mutex);
+  if (m_Inbox.size() >= PortQueueDepth) {
+    m_Dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  m_Inbox.push_back(std::move(frame));
+  m_Pending.store(m_Inbox.size(), std::memory_order_release);
+}
+
+std::size_t NetSwitch::Port::Receive(std::vector<Frame> &out,
+                                     std::size_t max) {
+  if (max == 0 || m_Pending.load(std::memory_order_acquire) == 0) {
+    return 0;
+  }
+
+  std::lock_guard lock(m_Mutex);
+  std::size_t n = std::min(max, m_Inbox.size());
+  std::move(m_Inbox.begin(), m_Inbox.begin() + static_cast<long>(n),
+            std::back_inserter(out));
+  m_Inbox.erase(m_Inbox.begin(), m_Inbox.begin() + static_cast<long>(n));
+  m_Pending.store(m_Inbox.size(), std::memory_order_release);
+  return n;
+}
+
+// ---------------------------------------------------------------------------
+// UnixDatagramBackend
+// ---------------------------------------------------------------------------
+
+UnixDatagramBackend::~UnixDatagramBackend() {
+#if defined(AURELIA_HAS_UNIX_SOCKETS)
+  if (m_Fd >= 0) {
+    ::close(m_Fd);
+    ::unlink(m_LocalPath.c_str());
+  }
+#endif
+}
+
+bool UnixDatagramBackend::Open(const std::string &localPath,
+                               const std::string &peerPath) {
+#if defined(AURELIA_HAS_UNIX_SOCKETS)
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  if (m_Fd >= 0 || localPath.empty() ||
+      localPath.size() >= sizeof(addr.sun_path) ||
+      peerPath.size() >= sizeof(addr.sun_path)) {
+    return false;
+  }
+  std::memcpy(addr.sun_path, localPath.c_str(), localPath.size() + 1);
+
+  int fd = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+  if (fd < 0) {
+    return false;
+  }
+
+  ::unlink(localPath.c_str()); // Stale socket from a previous run
+  if (::bind(fd, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) !=
+      0) {
+    ::close(fd);
+    return false;
+  }
+
+  m_Fd = fd;
+  m_LocalPath = localPath;
+  m_PeerPath = peerPath;
+  return true;
+#else
+  (void)localPath;
+  (void)peerPath;
+  return false;
+#endif
+}
+
+bool UnixDatagramBackend::Transmit(Frame &&frame) {
+#if defined(AURELIA_HAS_UNIX_SOCKETS)
+  if (m_Fd < 0 || frame.size() < EthernetHeaderSize ||
+      frame.size() > MaxFrameSize) {
+    return false;
+  }
+
+  sockaddr_un peer{};
+  peer.sun_family = AF_UNIX;
+  std::memcpy(peer.sun_path, m_PeerPath.c_str(), m_PeerPath.size() + 1);
+
+  // No peer listening is a dropped frame, as on a cable with nobody home
+  ssize_t sent = ::sendto(m_Fd, frame.data(), frame.size(), MSG_DONTWAIT,
+                          reinterpret_cast<const sockaddr *>(&peer),
+                          sizeof(peer));
+  return sent == static_cast<ssize_t>(frame.size());
+#else
+  (void)frame;
+  return false;
+#endif
+}
+
+std::size_t UnixDatagramBackend::Receive(std::vector<Frame> &out,
+                                         std::size_t max) {
+#if defined(AURELIA_HAS_UNIX_SOCKETS)
+  std::size_t n = 0;
+  while (m_Fd >= 0 && n < max) {
+    Frame frame(MaxFrameSize);
+    ssize_t got = ::recv(m_Fd, frame.data(), frame.size(), MSG_DONTWAIT);
+    if (got < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      break; // EAGAIN: nothing (more) waiting
+    }
+    if (static_cast<std::size_t>(got) < EthernetHeaderSize) {
+      continue; // Runt
+    }
+    frame.resize(static_cast<std::size_t>(got));
+    out.push_back(std::move(frame));
+    n++;
+  }
+  return n;
+#else
+  (void)out;
+  (void)max;
+  return 0;
+#endif
+}
+
+} // namespace Aurelia::Network
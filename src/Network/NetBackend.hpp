@@ -0,0 +1,170 @@
+/**
+ * Network Backends.
+ *
+ * Host side of the paravirtual NIC: where transmitted frames go and
+ * where received frames come from. There is no real network; frames only
+ * travel between Aurelia machines.
+ *
+ * BACKENDS:
+ * ┌─────────────────────┬─────────────────────────────────────────────┐
+ * │ Backend             │ Reach                                       │
+ * ├─────────────────────┼─────────────────────────────────────────────┤
+ * │ NetSwitch::Port     │ Machines in the same host process           │
+ * │ UnixDatagramBackend │ Machines in other processes on this host    │
+ * └─────────────────────┴─────────────────────────────────────────────┘
+ *
+ * FRAMES:
+ * A Frame is a plain byte vector that is moved, never copied, from the
+ * sending NIC through the backend to the receiving NIC. Inside one
+ * process the payload bytes are written exactly twice: guest RAM → frame
+ * on transmit, frame → guest RAM on receive. Emptied frames are recycled
+ * by the receiving NIC, so steady-state traffic does not allocate.
+ *
+ * THREADING:
+ * Transmit() and Receive() on one backend object are called by the
+ * thread running its NIC. NetSwitch ports may belong to machines on
+ * different threads; the switch serialises access internally.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Core/Types.hpp"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Aurelia::Network {
+
+using Frame = std::vector<Core::Byte>;
+using MacAddress = std::array<Core::Byte, 6>;
+
+constexpr std::size_t EthernetHeaderSize = 14;
+constexpr std::size_t MaxFrameSize = 2048;
+
+class INetBackend {
+public:
+  virtual ~INetBackend() = default;
+
+  /**
+   * @brief Send a frame; the backend takes ownership.
+   * @return false if the frame was dropped
+   */
+  virtual bool Transmit(Frame &&frame) = 0;
+
+  /**
+   * @brief Move up to `max` received frames onto the end of `out`.
+   * @return Number of frames appended
+   */
+  virtual std::size_t Receive(std::vector<Frame> &out, std::size_t max) = 0;
+};
+
+/**
+ * In-process learning switch.
+ *
+ * Each port remembers the source MAC of frames sent through it. Frames to
+ * a known unicast MAC go to that port only; broadcast, multicast and
+ * unknown destinations are flooded to every other port (copying the
+ * payload once per extra port).
+ */
+class NetSwitch {
+public:
+  static constexpr std::size_t PortQueueDepth = 256;
+
+  class Port final : public INetBackend {
+  public:
+    bool Transmit(Frame &&frame) override;
+    std::size_t Receive(std::vector<Frame> &out, std::size_t max) override;
+
+    /**
+     * @brief Frames dropped because this port's inbox was full.
+     */
+    [[nodiscard]] std::uint64_t GetDroppedCount() const {
+      return m_Dropped.load(std::memory_order_relaxed);
+    }
+
+  private:
+    friend class NetSwitch;
+
+    Port(NetSwitch *owner, std::size_t index)
+        : m_Switch(owner), m_Index(index) {}
+    void Deliver(Frame &&frame);
+
+    NetSwitch *m_Switch;
+    std::size_t m_Index;
+
+    /**
+     * Inbox. m_Pending lets an idle Receive() skip the lock.
+     */
+    std::mutex m_Mutex;
+    std::vector<Frame> m_Inbox;
+    std::atomic<std::size_t> m_Pending{0};
+    std::atomic<std::uint64_t> m_Dropped{0};
+  };
+
+  NetSwitch() = default;
+  NetSwitch(const NetSwitch &) = delete;
+  NetSwitch &operator=(const NetSwitch &) = delete;
+
+  /**
+   * @brief Create a port. Ports live as long as the switch.
+   */
+  Port *AddPort();
+
+  [[nodiscard]] std::size_t GetPortCount() const;
+
+private:
+  void Forward(std::size_t from, Frame &&frame);
+
+  mutable std::mutex m_Mutex; // Guards m_Ports and m_MacTable
+  std::vector<std::unique_ptr<Port>> m_Ports;
+  std::map<MacAddress, std::size_t> m_MacTable;
+};
+
+/**
+ * Unix datagram socket backend.
+ *
+ * Binds a SOCK_DGRAM socket at `localPath` and sends every frame to
+ * `peerPath`, one datagram per frame. Two Aurelia processes pointing at
+ * each other's paths form a point-to-point link. Receive() never blocks.
+ *
+ * PLATFORM:
+ * POSIX only. Elsewhere Open() returns false.
+ */
+class UnixDatagramBackend final : public INetBackend {
+public:
+  UnixDatagramBackend() = default;
+
+  /**
+   * @brief Closes the socket and removes the local socket file.
+   */
+  ~UnixDatagramBackend() override;
+
+  UnixDatagramBackend(const UnixDatagramBackend &) = delete;
+  UnixDatagramBackend &operator=(const UnixDatagramBackend &) = delete;
+
+  /**
+   * @brief Bind the local socket; any stale file at localPath is replaced.
+   * @return false if the socket could not be created or bound
+   */
+  bool Open(const std::string &localPath, const std::string &peerPath);
+
+  [[nodiscard]] bool IsOpen() const { return m_Fd >= 0; }
+
+  bool Transmit(Frame &&frame) override;
+  std::size_t Receive(std::vector<Frame> &out, std::size_t max) override;
+
+private:
+  int m_Fd = -1;
+  std::string m_LocalPath;
+  std::string m_PeerPath;
+};
+
+} // namespace Aurelia::Network
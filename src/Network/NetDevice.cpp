@@ -0,0 +1,382 @@
+/**
+ * Paravirtual Network Device Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Network/NetDevice.hpp"
+#include "System/MemoryMap.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+namespace Aurelia::Network {
+
+namespace {
+
+/**
+ * @brief Replace the low or high 32 bits of a 64-bit ring address.
+ */
+void SetHalf(Core::Address &reg, Core::Data value, bool high) {
+  auto half = static_cast<std::uint32_t>(value);
+  if (high) {
+    reg = (reg & 0xFFFFFFFFull) | (static_cast<Core::Address>(half) << 32);
+  } else {
+    reg = (reg & ~0xFFFFFFFFull) | half;
+  }
+}
+
+} // namespace
+
+NetDevice::NetDevice() : m_BaseAddr(System::NetBase) {}
+
+bool NetDevice::IsAddressInRange(Core::Address addr) const {
+  return addr >= m_BaseAddr && addr < m_BaseAddr + RegisterBlockSize;
+}
+
+bool NetDevice::OnRead(Core::Address addr, Core::Data &outData) {
+  switch (addr - m_BaseAddr) {
+  case IdOffset:
+    outData = DeviceId;
+    return true;
+  case ControlOffset:
+    outData = m_Control;
+    return true;
+  case StatusOffset:
+    outData = m_Backend ? 1u : 0u;
+    return true;
+  case MacLoOffset:
+    outData = static_cast<Core::Data>(m_Mac[0]) | (Core::Data{m_Mac[1]} << 8) |
+              (Core::Data{m_Mac[2]} << 16) | (Core::Data{m_Mac[3]} << 24);
+    return true;
+  case MacHiOffset:
+    outData = static_cast<Core::Data>(m_Mac[4]) | (Core::Data{m_Mac[5]} << 8);
+    return true;
+  case IrqStatusOffset:
+    outData = m_IrqStatus;
+    return true;
+  case IrqEnableOffset:
+    outData = m_IrqEnable;
+    return true;
+  case ItrOffset:
+    outData = m_Itr;
+    return true;
+  case RxThresholdOffset:
+    outData = m_RxThreshold;
+    return true;
+  case TxBaseLoOffset:
+    outData = m_Tx.Base & 0xFFFFFFFFu;
+    return true;
+  case TxBaseHiOffset:
+    outData = m_Tx.Base >> 32;
+    return true;
+  case TxSizeOffset:
+    outData = m_Tx.Size;
+    return true;
+  case TxHeadOffset:
+    outData = m_Tx.Head;
+    return true;
+  case TxTailOffset:
+    outData = m_Tx.Tail;
+    return true;
+  case RxBaseLoOffset:
+    outData = m_Rx.Base & 0xFFFFFFFFu;
+    return true;
+  case RxBaseHiOffset:
+    outData = m_Rx.Base >> 32;
+    return true;
+  case RxSizeOffset:
+    outData = m_Rx.Size;
+    return true;
+  case RxHeadOffset:
+    outData = m_Rx.Head;
+    return true;
+  case RxTailOffset:
+    outData = m_Rx.Tail;
+    return true;
+  case TxFramesOffset:
+    outData = static_cast<std::uint32_t>(m_TxFrames);
+    return true;
+  case RxFramesOffset:
+    outData = static_cast<std::uint32_t>(m_RxFrames);
+    return true;
+  case RxDroppedOffset:
+    outData = static_cast<std::uint32_t>(m_RxDropped);
+    return true;
+  default:
+    outData = 0;
+    return true;
+  }
+}
+
+bool NetDevice::OnWrite(Core::Address addr, Core::Data inData) {
+  auto value = static_cast<std::uint32_t>(inData);
+
+  switch (addr - m_BaseAddr) {
+  case ControlOffset:
+    m_Control = value & (ControlRxEnable | ControlTxEnable);
+    return true;
+
+  case MacLoOffset:
+    for (std::size_t i = 0; i < 4; ++i) {
+      m_Mac[i] = static_cast<Core::Byte>(value >> (8 * i));
+    }
+    return true;
+
+  case MacHiOffset:
+    m_Mac[4] = static_cast<Core::Byte>(value);
+    m_Mac[5] = static_cast<Core::Byte>(value >> 8);
+    return true;
+
+  case IrqStatusOffset:
+    m_IrqStatus &= ~value; // W1C
+    return true;
+
+  case IrqEnableOffset:
+    m_IrqEnable = value & (IrqRx | IrqTx | IrqRxNoBuffer);
+    m_IrqArmed = (m_IrqStatus & m_IrqEnable) != 0;
+    return true;
+
+  case ItrOffset:
+    m_Itr = value;
+    return true;
+
+  case RxThresholdOffset:
+    m_RxThreshold = value;
+    return true;
+
+  case TxBaseLoOffset:
+  case TxBaseHiOffset:
+    SetHalf(m_Tx.Base, inData, addr - m_BaseAddr == TxBaseHiOffset);
+    return true;
+
+  case TxSizeOffset:
+    SetRingSize(m_Tx, inData);
+    return true;
+
+  case TxTailOffset:
+    if (m_Tx.Size != 0) {
+      m_Tx.Tail = value & (m_Tx.Size - 1);
+    }
+    return true;
+
+  case RxBaseLoOffset:
+  case RxBaseHiOffset:
+    SetHalf(m_Rx.Base, inData, addr - m_BaseAddr == RxBaseHiOffset);
+    return true;
+
+  case RxSizeOffset:
+    SetRingSize(m_Rx, inData);
+    return true;
+
+  case RxTailOffset:
+    if (m_Rx.Size != 0) {
+      m_Rx.Tail = value & (m_Rx.Size - 1);
+    }
+    return true;
+
+  default:
+    return true; // Read-only registers
+  }
+}
+
+void NetDevice::SetRingSize(Ring &ring, Core::Data value) {
+  // Power-of-two sizes only; resizing rewinds the ring
+  if (value != 0 && value <= MaxRingSize && (value & (value - 1)) == 0) {
+    ring.Size = static_cast<std::uint32_t>(value);
+    ring.Head = 0;
+    ring.Tail = 0;
+  }
+}
+
+void NetDevice::OnTick() {
+  ++m_Now;
+  if (!m_Bus) {
+    return;
+  }
+
+  if ((m_Control & ControlTxEnable) && m_Tx.HasWork()) {
+    ServiceTx();
+  }
+
+  if (m_Control & ControlRxEnable) {
+    if (m_Backend && m_Now % RxPollTicks == 0) {
+      PollBackend();
+    }
+    if (!m_RxBacklog.empty()) {
+      ServiceRx();
+    }
+  }
+
+  if (m_IrqArmed) {
+    UpdateInterrupt();
+  }
+}
+
+void NetDevice::ServiceTx() {
+  std::size_t completed = 0;
+
+  while (m_Tx.HasWork() && completed < BurstFrames) {
+    Core::Address desc = m_Tx.Base + DescriptorSize * m_Tx.Head;
+    std::array<Core::Byte, DescriptorSize> raw{};
+    if (!m_Bus->ReadBlock(desc, raw)) {
+      break; // Ring points at unmapped memory; leave it for the driver
+    }
+
+    Core::Address buffer = 0;
+    std::uint16_t length = 0;
+    std::memcpy(&buffer, raw.data(), 8);
+    std::memcpy(&length, raw.data() + 8, 2);
+
+    std::uint16_t flags = DescDone;
+    if (length < EthernetHeaderSize || length > MaxFrameSize) {
+      flags |= DescError;
+    } else {
+      Frame frame = TakeSpareFrame();
+      frame.resize(length);
+      if (!m_Bus->ReadBlock(buffer, frame)) {
+        flags |= DescError;
+        RecycleFrame(std::move(frame));
+      } else if (m_Backend) {
+        // Dropped by the backend still counts as sent: it left the NIC
+        m_Backend->Transmit(std::move(frame));
+        m_TxFrames++;
+      } else {
+        RecycleFrame(std::move(frame)); // Link down: onto the floor
+        m_TxFrames++;
+      }
+    }
+
+    std::array<Core::Byte, 2> status{static_cast<Core::Byte>(flags),
+                                     static_cast<Core::Byte>(flags >> 8)};
+    m_Bus->WriteBlock(desc + 10, status);
+
+    m_Tx.Head = (m_Tx.Head + 1) & (m_Tx.Size - 1);
+    completed++;
+  }
+
+  if (completed != 0) {
+    Signal(IrqTx);
+  }
+}
+
+void NetDevice::PollBackend() {
+  m_Incoming.clear();
+  m_Backend->Receive(m_Incoming, BurstFrames);
+
+  for (Frame &frame : m_Incoming) {
+    if (!AcceptsFrame(frame)) {
+      RecycleFrame(std::move(frame));
+    } else if (m_RxBacklog.size() >= RxBacklogDepth) {
+      // Guest is not posting buffers fast enough: overflow
+      m_RxDropped++;
+      Signal(IrqRxNoBuffer);
+      RecycleFrame(std::move(frame));
+    } else {
+      m_RxBacklog.push_back(std::move(frame));
+    }
+  }
+}
+
+void NetDevice::ServiceRx() {
+  std::size_t delivered = 0;
+  while (!m_RxBacklog.empty() && m_Rx.HasWork() && delivered < BurstFrames) {
+    Frame frame = std::move(m_RxBacklog.front());
+    m_RxBacklog.pop_front();
+    DeliverFrame(std::move(frame));
+    delivered++;
+  }
+}
+
+bool NetDevice::AcceptsFrame(const Frame &frame) const {
+  if (frame.size() < EthernetHeaderSize) {
+    return false;
+  }
+  // Group addresses (broadcast, multicast) or our own unicast address
+  return (frame[0] & 1) || std::equal(m_Mac.begin(), m_Mac.end(),
+                                      frame.begin());
+}
+
+void NetDevice::DeliverFrame(Frame &&frame) {
+  Core::Address desc = m_Rx.Base + DescriptorSize * m_Rx.Head;
+  std::array<Core::Byte, DescriptorSize> raw{};
+  if (!m_Bus->ReadBlock(desc, raw)) {
+    m_RxDropped++;
+    RecycleFrame(std::move(frame));
+    return;
+  }
+
+  Core::Address buffer = 0;
+  std::uint16_t capacity = 0;
+  std::memcpy(&buffer, raw.data(), 8);
+  std::memcpy(&capacity, raw.data() + 8, 2);
+
+  std::uint16_t length = 0;
+  std::uint16_t flags = DescDone;
+  if (frame.size() > capacity || !m_Bus->WriteBlock(buffer, frame)) {
+    flags |= DescError;
+    m_RxDropped++;
+  } else {
+    length = static_cast<std::uint16_t>(frame.size());
+    m_RxFrames++;
+    m_RxSinceIrq++;
+  }
+
+  std::array<Core::Byte, 4> status{
+      static_cast<Core::Byte>(length), static_cast<Core::Byte>(length >> 8),
+      static_cast<Core::Byte>(flags), static_cast<Core::Byte>(flags >> 8)};
+  m_Bus->WriteBlock(desc + 8, status);
+
+  m_Rx.Head = (m_Rx.Head + 1) & (m_Rx.Size - 1);
+  RecycleFrame(std::move(frame));
+  Signal(IrqRx);
+}
+
+void NetDevice::Signal(std::uint32_t cause) {
+  m_IrqStatus |= cause;
+  if (m_IrqStatus & m_IrqEnable) {
+    m_IrqArmed = true;
+  }
+}
+
+void NetDevice::UpdateInterrupt() {
+  if (!(m_IrqStatus & m_IrqEnable)) {
+    m_IrqArmed = false; // Acknowledged before it was delivered
+    return;
+  }
+
+  bool throttled = m_Interrupts != 0 && m_Now - m_LastIrq < m_Itr;
+  bool overThreshold = m_RxThreshold != 0 && m_RxSinceIrq >= m_RxThreshold;
+  if (throttled && !overThreshold) {
+    return;
+  }
+
+  if (m_Pic) {
+    m_Pic->RaiseIrq(Peripherals::PicDevice::IrqNet);
+  }
+  m_LastIrq = m_Now;
+  m_RxSinceIrq = 0;
+  m_Interrupts++;
+  m_IrqArmed = false;
+}
+
+Frame NetDevice::TakeSpareFrame() {
+  if (m_Spares.empty()) {
+    Frame frame;
+    frame.reserve(MaxFrameSize);
+    return frame;
+  }
+  Frame frame = std::move(m_Spares.back());
+  m_Spares.pop_back();
+  return frame;
+}
+
+void NetDevice::RecycleFrame(Frame &&frame) {
+  if (m_Spares.size() < RxBacklogDepth) {
+    frame.clear(); // Keeps capacity
+    m_Spares.push_back(std::move(frame));
+  }
+}
+
+} // namespace Aurelia::Network
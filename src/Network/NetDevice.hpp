@@ -0,0 +1,229 @@
+/**
+ * Paravirtual Network Device.
+ *
+ * Ethernet NIC with transmit and receive descriptor rings in guest RAM.
+ *
+ * The guest describes buffers in two rings and moves a tail index; the
+ * device consumes descriptors up to the tail, marks them DONE and moves
+ * its head index. No per-byte register traffic: a frame costs one
+ * descriptor write and one doorbell, however large it is.
+ *
+ * REGISTER MAP (32-bit registers, 4-byte stride):
+ * ┌────────────┬─────────────────────────────────────────────────┐
+ * │ Offset     │ Register                                        │
+ * ├────────────┼─────────────────────────────────────────────────┤
+ * │ 0x0000     │ ID           - 'ANIC' (RO)                      │
+ * │ 0x0004     │ CONTROL      - Bit 0 RX_EN, Bit 1 TX_EN (RW)    │
+ * │ 0x0008     │ STATUS       - Bit 0 LINK: backend attached (RO)│
+ * │ 0x000C     │ MAC_LO       - MAC bytes 0-3 (RW)               │
+ * │ 0x0010     │ MAC_HI       - MAC bytes 4-5 (RW)               │
+ * │ 0x0014     │ IRQ_STATUS   - Interrupt causes, see below (W1C)│
+ * │ 0x0018     │ IRQ_ENABLE   - Causes that raise the PIC (RW)   │
+ * │ 0x001C     │ ITR          - Min ticks between interrupts (RW)│
+ * │ 0x0020     │ RX_THRESHOLD - Frames that bypass ITR (RW)      │
+ * │ 0x0040/44  │ TX_BASE      - TX ring address, low/high (RW)   │
+ * │ 0x0048     │ TX_SIZE      - TX ring entries, power of 2 (RW) │
+ * │ 0x004C     │ TX_HEAD      - Next descriptor to send (RO)     │
+ * │ 0x0050     │ TX_TAIL      - One past last ready (RW, bell)   │
+ * │ 0x0060/64  │ RX_BASE      - RX ring address, low/high (RW)   │
+ * │ 0x0068     │ RX_SIZE      - RX ring entries, power of 2 (RW) │
+ * │ 0x006C     │ RX_HEAD      - Next descriptor to fill (RO)     │
+ * │ 0x0070     │ RX_TAIL      - One past last free buffer (RW)   │
+ * │ 0x0080     │ TX_FRAMES    - Frames sent (RO)                 │
+ * │ 0x0084     │ RX_FRAMES    - Frames received (RO)             │
+ * │ 0x0088     │ RX_DROPPED   - Frames lost, no buffer (RO)      │
+ * └────────────┴─────────────────────────────────────────────────┘
+ *
+ * DESCRIPTOR (16 bytes, little-endian):
+ * ┌────────┬──────┬──────────────────────────────────────────────────┐
+ * │ Offset │ Size │ Field                                            │
+ * ├────────┼──────┼──────────────────────────────────────────────────┤
+ * │ 0x00   │ 8    │ Buffer address                                   │
+ * │ 0x08   │ 2    │ Length: TX frame length / RX buffer size, then   │
+ * │        │      │ received frame length once DONE                  │
+ * │ 0x0A   │ 2    │ Flags: bit 0 DONE, bit 1 ERROR (device-written)  │
+ * │ 0x0C   │ 4    │ Reserved                                         │
+ * └────────┴──────┴──────────────────────────────────────────────────┘
+ * Descriptors from HEAD up to (not including) TAIL belong to the device.
+ * HEAD == TAIL means the device owns none, so a driver keeps one slot
+ * empty to tell a full ring from an empty one.
+ *
+ * INTERRUPT CAUSES (IRQ_STATUS / IRQ_ENABLE):
+ * - Bit 0 RX: Frame(s) written to the RX ring
+ * - Bit 1 TX: TX descriptor(s) completed
+ * - Bit 2 RX_NO_BUF: A frame was dropped for lack of RX buffers
+ *
+ * INTERRUPT MODERATION:
+ * Causes accumulate in IRQ_STATUS immediately. The PIC line IrqNet is
+ * raised at most once every ITR ticks, so a burst of frames costs one
+ * interrupt. Once RX_THRESHOLD frames (0 = disabled) have arrived since
+ * the last interrupt, the device stops waiting for ITR and interrupts
+ * anyway, so latency stays bounded under heavy receive load.
+ *
+ * THROUGHPUT:
+ * Up to BurstFrames descriptors per direction per tick. The backend is
+ * polled for receive every RxPollTicks ticks, which keeps an idle socket
+ * backend from costing a syscall per cycle. Frames that arrive while no
+ * RX buffer is posted wait in a RxBacklogDepth-frame backlog; past that
+ * they are dropped and counted (RX_DROPPED, RX_NO_BUF).
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Bus/Bus.hpp"
+#include "Bus/IBusDevice.hpp"
+#include "Core/Types.hpp"
+#include "Network/NetBackend.hpp"
+#include "Peripherals/PicDevice.hpp"
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace Aurelia::Network {
+
+class NetDevice final : public Bus::IBusDevice {
+public:
+  static constexpr std::uint32_t MaxRingSize = 1024;
+  static constexpr std::size_t DescriptorSize = 16;
+  static constexpr std::size_t BurstFrames = 8;
+  static constexpr std::size_t RxBacklogDepth = 64;
+  static constexpr Core::TickCount RxPollTicks = 16;
+
+  /**
+   * REGISTER OFFSETS
+   */
+  static constexpr Core::Address IdOffset = 0x00;
+  static constexpr Core::Address ControlOffset = 0x04;
+  static constexpr Core::Address StatusOffset = 0x08;
+  static constexpr Core::Address MacLoOffset = 0x0C;
+  static constexpr Core::Address MacHiOffset = 0x10;
+  static constexpr Core::Address IrqStatusOffset = 0x14;
+  static constexpr Core::Address IrqEnableOffset = 0x18;
+  static constexpr Core::Address ItrOffset = 0x1C;
+  static constexpr Core::Address RxThresholdOffset = 0x20;
+  static constexpr Core::Address TxBaseLoOffset = 0x40;
+  static constexpr Core::Address TxBaseHiOffset = 0x44;
+  static constexpr Core::Address TxSizeOffset = 0x48;
+  static constexpr Core::Address TxHeadOffset = 0x4C;
+  static constexpr Core::Address TxTailOffset = 0x50;
+  static constexpr Core::Address RxBaseLoOffset = 0x60;
+  static constexpr Core::Address RxBaseHiOffset = 0x64;
+  static constexpr Core::Address RxSizeOffset = 0x68;
+  static constexpr Core::Address RxHeadOffset = 0x6C;
+  static constexpr Core::Address RxTailOffset = 0x70;
+  static constexpr Core::Address TxFramesOffset = 0x80;
+  static constexpr Core::Address RxFramesOffset = 0x84;
+  static constexpr Core::Address RxDroppedOffset = 0x88;
+
+  static constexpr std::uint32_t DeviceId = 0x43494E41; // "ANIC"
+
+  static constexpr std::uint32_t ControlRxEnable = 1u << 0;
+  static constexpr std::uint32_t ControlTxEnable = 1u << 1;
+
+  static constexpr std::uint32_t IrqRx = 1u << 0;
+  static constexpr std::uint32_t IrqTx = 1u << 1;
+  static constexpr std::uint32_t IrqRxNoBuffer = 1u << 2;
+
+  static constexpr std::uint16_t DescDone = 1u << 0;
+  static constexpr std::uint16_t DescError = 1u << 1;
+
+  /**
+   * @brief Construct unlinked NIC at MemoryMap::NetBase.
+   *
+   * The MAC defaults to the locally administered 02:00:00:00:00:01.
+   */
+  NetDevice();
+
+  void SetBaseAddress(Core::Address base) { m_BaseAddr = base; }
+  void ConnectBus(Bus::Bus *bus) { m_Bus = bus; }
+  void ConnectPic(Peripherals::PicDevice *pic) { m_Pic = pic; }
+
+  /**
+   * @brief Plug in the host side of the link (not owned).
+   */
+  void ConnectBackend(INetBackend *backend) { m_Backend = backend; }
+
+  void SetMacAddress(const MacAddress &mac) { m_Mac = mac; }
+  [[nodiscard]] const MacAddress &GetMacAddress() const { return m_Mac; }
+
+  [[nodiscard]] bool IsAddressInRange(Core::Address addr) const override;
+  bool OnRead(Core::Address addr, Core::Data &outData) override;
+  bool OnWrite(Core::Address addr, Core::Data inData) override;
+
+  /**
+   * @brief Move frames between rings and backend; moderate interrupts.
+   */
+  void OnTick() override;
+
+  [[nodiscard]] std::uint64_t GetTxFrames() const { return m_TxFrames; }
+  [[nodiscard]] std::uint64_t GetRxFrames() const { return m_RxFrames; }
+  [[nodiscard]] std::uint64_t GetRxDropped() const { return m_RxDropped; }
+  [[nodiscard]] std::uint64_t GetInterruptCount() const {
+    return m_Interrupts;
+  }
+
+private:
+  static constexpr Core::Address RegisterBlockSize = 0x1000;
+
+  struct Ring {
+    Core::Address Base = 0;
+    std::uint32_t Size = 0;
+    std::uint32_t Head = 0;
+    std::uint32_t Tail = 0;
+
+    [[nodiscard]] bool HasWork() const { return Size != 0 && Head != Tail; }
+  };
+
+  void ServiceTx();
+  void PollBackend();
+  void ServiceRx();
+  bool AcceptsFrame(const Frame &frame) const;
+  void DeliverFrame(Frame &&frame);
+  void Signal(std::uint32_t cause);
+  void UpdateInterrupt();
+  Frame TakeSpareFrame();
+  void RecycleFrame(Frame &&frame);
+
+  static void SetRingSize(Ring &ring, Core::Data value);
+
+  Core::Address m_BaseAddr;
+  Bus::Bus *m_Bus = nullptr;
+  Peripherals::PicDevice *m_Pic = nullptr;
+  INetBackend *m_Backend = nullptr;
+
+  MacAddress m_Mac{0x02, 0x00, 0x00, 0x00, 0x00, 0x01};
+  std::uint32_t m_Control = 0;
+  Ring m_Tx;
+  Ring m_Rx;
+
+  /**
+   * INTERRUPT MODERATION
+   */
+  std::uint32_t m_IrqStatus = 0;
+  std::uint32_t m_IrqEnable = 0;
+  std::uint32_t m_Itr = 0;
+  std::uint32_t m_RxThreshold = 0;
+  std::uint32_t m_RxSinceIrq = 0;
+  Core::TickCount m_Now = 0;
+  Core::TickCount m_LastIrq = 0;
+  bool m_IrqArmed = false; // Enabled cause pending, not yet signalled
+
+  /**
+   * FRAME BUFFERS
+   * Backlog holds frames pulled from the backend while the guest had no
+   * RX buffer posted; spares are emptied frames kept for reuse.
+   */
+  std::deque<Frame> m_RxBacklog;
+  std::vector<Frame> m_Incoming; // Receive() scratch, capacity reused
+  std::vector<Frame> m_Spares;
+
+  std::uint64_t m_TxFrames = 0;
+  std::uint64_t m_RxFrames = 0;
+  std::uint64_t m_RxDropped = 0;
+  std::uint64_t m_Interrupts = 0;
+};
+
+} // namespace Aurelia::Network
@@ -0,0 +1,288 @@
+/**
+ * DMA Controller Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Peripherals/DmaController.hpp"
+#include "System/MemoryMap.hpp"
+#include <algorithm>
+#include <cstring>
+#include <span>
+
+namespace Aurelia::Peripherals {
+
+namespace {
+
+std::uint64_t LoadLe64(const Core::Byte *p) {
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < 8; ++i) {
+    value |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+  }
+  return value;
+}
+
+std::uint32_t LoadLe32(const Core::Byte *p) {
+  std::uint32_t value = 0;
+  for (std::size_t i = 0; i < 4; ++i) {
+    value |= static_cast<std::uint32_t>(p[i]) << (8 * i);
+  }
+  return value;
+}
+
+} // namespace
+
+DmaController::DmaController() : m_BaseAddr(System::DmaBase) {}
+
+bool DmaController::IsAddressInRange(Core::Address addr) const {
+  return addr >= m_BaseAddr && addr < m_BaseAddr + RegisterBlockSize;
+}
+
+bool DmaController::OnRead(Core::Address addr, Core::Data &outData) {
+  Core::Address offset = addr - m_BaseAddr;
+
+  if (offset >= ChannelBase &&
+      offset < ChannelBase + ChannelStride * ChannelCount) {
+    const Channel &ch = m_Channels[(offset - ChannelBase) / ChannelStride];
+    switch ((offset - ChannelBase) % ChannelStride) {
+    case ChDescOffset:
+      outData = ch.Desc;
+      return true;
+    case ChStatusOffset:
+      outData = static_cast<Core::Data>(ch.State);
+      return true;
+    case ChCountOffset:
+      outData = ch.Count;
+      return true;
+    default:
+      outData = 0; // CONTROL is write-only
+      return true;
+    }
+  }
+
+  switch (offset) {
+  case BusyOffset: {
+    Core::Data busy = 0;
+    for (std::size_t i = 0; i < ChannelCount; ++i) {
+      if (m_Channels[i].State == DmaChannelState::Busy) {
+        busy |= Core::Data{1} << i;
+      }
+    }
+    outData = busy;
+    return true;
+  }
+
+  case IrqStatusOffset:
+    outData = m_IrqStatus;
+    return true;
+
+  case IrqEnableOffset:
+    outData = m_IrqEnable;
+    return true;
+
+  default:
+    outData = 0;
+    return true;
+  }
+}
+
+bool DmaController::OnWrite(Core::Address addr, Core::Data inData) {
+  Core::Address offset = addr - m_BaseAddr;
+
+  if (offset >= ChannelBase &&
+      offset < ChannelBase + ChannelStride * ChannelCount) {
+    Channel &ch = m_Channels[(offset - ChannelBase) / ChannelStride];
+    switch ((offset - ChannelBase) % ChannelStride) {
+    case ChDescOffset:
+      if (ch.State != DmaChannelState::Busy) {
+        ch.Desc = inData; // Ignored while running
+      }
+      return true;
+
+    case ChControlOffset:
+      if (inData & ControlAbort) {
+        if (ch.State == DmaChannelState::Busy) {
+          ch.State = DmaChannelState::Idle;
+        }
+      } else if ((inData & ControlStart) &&
+                 ch.State != DmaChannelState::Busy) {
+        ch.State = DmaChannelState::Busy;
+        ch.Step = Phase::Fetch;
+        ch.Count = 0;
+      }
+      return true;
+
+    default:
+      return true;
+    }
+  }
+
+  switch (offset) {
+  case IrqStatusOffset:
+    m_IrqStatus &= static_cast<std::uint8_t>(~inData); // W1C
+    return true;
+
+  case IrqEnableOffset:
+    m_IrqEnable =
+        static_cast<std::uint8_t>(inData & ((1u << ChannelCount) - 1));
+    return true;
+
+  default:
+    return true;
+  }
+}
+
+void DmaController::OnTick() {
+  for (std::size_t i = 0; i < ChannelCount; ++i) {
+    if (m_Channels[i].State == DmaChannelState::Busy) {
+      StepChannel(i);
+    }
+  }
+}
+
+void DmaController::StepChannel(std::size_t index) {
+  Channel &ch = m_Channels[index];
+  if (!m_Bus) {
+    Fail(index);
+    return;
+  }
+
+  if (ch.Step == Phase::Fetch) {
+    if (!FetchDescriptor(ch)) {
+      Fail(index);
+      return;
+    }
+    ch.Step = Phase::Transfer;
+    if (ch.Length != 0) {
+      return; // Fetch took this tick
+    }
+  } else {
+    bool ok = (ch.Op == DmaOpcode::Copy || ch.Op == DmaOpcode::Fill)
+                  ? TransferBurst(ch)
+                  : TransferElement(ch);
+    if (!ok) {
+      Fail(index);
+      return;
+    }
+  }
+
+  if (ch.Done == ch.Length) {
+    FinishDescriptor(index);
+  }
+}
+
+bool DmaController::FetchDescriptor(Channel &ch) {
+  std::array<Core::Byte, DescriptorSize> raw{};
+  if ((ch.Desc & 7) != 0 || !m_Bus->ReadBlock(ch.Desc, raw)) {
+    return false;
+  }
+
+  ch.Op = static_cast<DmaOpcode>(raw[0]);
+  ch.Flags = raw[1];
+  ch.Length = LoadLe32(&raw[4]);
+  ch.Source = LoadLe64(&raw[8]);
+  ch.Destination = LoadLe64(&raw[16]);
+  ch.Next = LoadLe64(&raw[24]);
+  ch.Done = 0;
+
+  switch (ch.Op) {
+  case DmaOpcode::Copy:
+  case DmaOpcode::Fill:
+    return true;
+  case DmaOpcode::FromPort:
+    return m_Bus->IsMapped(ch.Source);
+  case DmaOpcode::ToPort:
+    return m_Bus->IsMapped(ch.Destination);
+  default:
+    return false;
+  }
+}
+
+bool DmaController::TransferBurst(Channel &ch) {
+  std::size_t n = std::min<std::size_t>(BurstBytes, ch.Length - ch.Done);
+  std::span<Core::Byte> chunk(m_Bounce.data(), n);
+
+  if (ch.Op == DmaOpcode::Copy) {
+    if (!m_Bus->ReadBlock(ch.Source + ch.Done, chunk)) {
+      return false;
+    }
+  } else {
+    // FILL: byte i of the destination is pattern byte (i mod 8)
+    for (std::size_t i = 0; i < n; ++i) {
+      std::size_t lane = (ch.Done + i) % 8;
+      chunk[i] = static_cast<Core::Byte>(ch.Source >> (8 * lane));
+    }
+  }
+
+  if (!m_Bus->WriteBlock(ch.Destination + ch.Done, chunk)) {
+    return false;
+  }
+
+  ch.Done += static_cast<std::uint32_t>(n);
+  m_BytesTransferred += n;
+  return true;
+}
+
+bool DmaController::TransferElement(Channel &ch) {
+  std::size_t width = std::size_t{1} << ((ch.Flags >> 1) & 3);
+  std::size_t n = std::min<std::size_t>(width, ch.Length - ch.Done);
+  std::span<Core::Byte> element(m_Bounce.data(), n);
+
+  if (ch.Op == DmaOpcode::FromPort) {
+    Core::Data word = 0;
+    if (!m_Bus->Read(ch.Source, word)) {
+      return true; // WAIT: retry next tick
+    }
+    std::memcpy(element.data(), &word, n);
+    if (!m_Bus->WriteBlock(ch.Destination + ch.Done, element)) {
+      return false;
+    }
+  } else {
+    if (!m_Bus->ReadBlock(ch.Source + ch.Done, element)) {
+      return false;
+    }
+    Core::Data word = 0;
+    std::memcpy(&word, element.data(), n);
+    if (!m_Bus->Write(ch.Destination, word)) {
+      return true; // WAIT: retry next tick
+    }
+  }
+
+  ch.Done += static_cast<std::uint32_t>(n);
+  m_BytesTransferred += n;
+  return true;
+}
+
+void DmaController::FinishDescriptor(std::size_t index) {
+  Channel &ch = m_Channels[index];
+  ch.Count++;
+
+  if (ch.Next == 0) {
+    ch.State = DmaChannelState::Done;
+    SignalChannel(index);
+    return;
+  }
+
+  if (ch.Flags & FlagIrq) {
+    SignalChannel(index);
+  }
+  ch.Desc = ch.Next;
+  ch.Step = Phase::Fetch;
+}
+
+void DmaController::Fail(std::size_t index) {
+  m_Channels[index].State = DmaChannelState::Error;
+  SignalChannel(index);
+}
+
+void DmaController::SignalChannel(std::size_t index) {
+  auto bit = static_cast<std::uint8_t>(1u << index);
+  m_IrqStatus |= bit;
+
+  if ((m_IrqEnable & bit) && m_Pic) {
+    m_Pic->RaiseIrq(static_cast<std::uint8_t>(PicDevice::IrqDma0 + index));
+  }
+}
+
+} // namespace Aurelia::Peripherals
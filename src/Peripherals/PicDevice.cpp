@@ -5,6 +5,7 @@
  * Email: KleaSCM@gmail.com
  */
 
+#include <algorithm>
 #include <bit>
 
 #include "Core/BitManip.hpp"
@@ -20,6 +21,7 @@ PicDevice::PicDevice() {
    * - No pending IRQs
    * - All IRQ lines disabled
    * - All configured as level-triggered
+   * - All lines at priority 1, threshold 0 (fixed LSB-first order)
    *
    * Software must explicitly enable IRQs after configuring handlers.
    * This prevents spurious interrupts during boot sequence.
@@ -27,6 +29,11 @@ PicDevice::PicDevice() {
   m_IrqStatus = 0;
   m_IrqEnable = 0;
   m_IrqTrigger = 0;
+  m_InService = 0;
+  m_Threshold = 0;
+  m_VectorBase = 0;
+  m_Priority.fill(DefaultPriority);
+  RebuildPriorityMasks();
 }
 
 bool PicDevice::IsAddressInRange(Core::Address addr) const {
@@ -37,9 +44,8 @@ bool PicDevice::IsAddressInRange(Core::Address addr) const {
    * Base: 0xE0002000
    * End:  0xE0002FFF (inclusive)
    *
-   * Current usage: 16 bytes (4 registers × 4 bytes)
+   * Current usage: 0x00-0x23 control, 0x100-0x13F priorities
    * Reserved space for:
-   * - Per-IRQ priority levels
    * - CPU affinity (multi-core routing)
    * - IRQ pending edge detection timestamps
    * - Interrupt statistics counters
@@ -125,7 +131,45 @@ bool PicDevice::OnRead(Core::Address addr, Core::Data &outData) {
     return true;
   }
 
+  case ThresholdOffset: {
+    outData = static_cast<Core::Data>(m_Threshold);
+    return true;
+  }
+
+  case ClaimOffset: {
+    /**
+     * CLAIM READ
+     *
+     * Unlike every other register read, this one has side effects: the
+     * returned line leaves IRQ_STATUS and enters IN_SERVICE. Debuggers
+     * should use GetPendingIrqNumber() instead.
+     */
+    outData = static_cast<Core::Data>(Claim());
+    return true;
+  }
+
+  case VectorBaseOffset: {
+    outData = static_cast<Core::Data>(m_VectorBase);
+    return true;
+  }
+
+  case VectorOffset: {
+    outData = static_cast<Core::Data>(GetVectorAddress());
+    return true;
+  }
+
+  case InServiceOffset: {
+    outData = static_cast<Core::Data>(m_InService);
+    return true;
+  }
+
   default:
+    if (offset >= PriorityBaseOffset &&
+        offset < PriorityBaseOffset + MaxIrqLines * 4 && (offset & 0x3) == 0) {
+      outData = m_Priority[(offset - PriorityBaseOffset) / 4];
+      return true;
+    }
+
     /**
      * RESERVED REGISTER READ
      *
@@ -233,7 +277,46 @@ bool PicDevice::OnWrite(Core::Address addr, Core::Data inData) {
     return true;
   }
 
+  case ThresholdOffset: {
+    m_Threshold = static_cast<std::uint8_t>(inData & MaxPriority);
+    RebuildPriorityMasks();
+    return true;
+  }
+
+  case ClaimOffset: {
+    /**
+     * COMPLETE WRITE
+     *
+     * Software writes back the number it claimed. Out-of-range values
+     * (including NoIrq from a spurious claim) are ignored.
+     */
+    if (inData < MaxIrqLines) {
+      Complete(static_cast<std::uint8_t>(inData));
+    }
+    return true;
+  }
+
+  case VectorBaseOffset: {
+    // Table slots are word-sized; keep the base word-aligned
+    m_VectorBase = inData & ~Core::Address{0x3};
+    return true;
+  }
+
   default:
+    if (offset >= PriorityBaseOffset &&
+        offset < PriorityBaseOffset + MaxIrqLines * 4 && (offset & 0x3) == 0) {
+      /**
+       * PRIORITY[N] WRITE
+       *
+       * Values above 7 saturate. 0 disables the line without touching
+       * IRQ_ENABLE.
+       */
+      m_Priority[(offset - PriorityBaseOffset) / 4] =
+          static_cast<std::uint8_t>(std::min<Core::Data>(inData, MaxPriority));
+      RebuildPriorityMasks();
+      return true;
+    }
+
     /**
      * RESERVED REGISTER WRITE
      *
@@ -341,16 +424,16 @@ bool PicDevice::HasPendingIrq() const {
    * Determines if CPU interrupt signal should be asserted.
    *
    * LOGIC:
-   * CPU IRQ = (IRQ_STATUS & IRQ_ENABLE) != 0
+   * CPU IRQ = (IRQ_STATUS & IRQ_ENABLE & ~IN_SERVICE & ELIGIBLE) != 0
    *
-   * Any pending interrupt that is also enabled triggers CPU.
-   * Masked interrupts do not propagate.
+   * ELIGIBLE is the set of lines whose priority exceeds THRESHOLD.
+   * Masked, in-service and below-threshold lines do not propagate.
    *
    * CPU POLLING:
    * CPU checks HasPendingIrq() after each instruction.
    * If true, CPU enters interrupt service routine.
    */
-  return (m_IrqStatus & m_IrqEnable) != 0;
+  return (m_IrqStatus & m_IrqEnable & ~m_InService & m_EligibleMask) != 0;
 }
 
 std::uint8_t PicDevice::GetPendingIrqNumber() const {
@@ -358,12 +441,13 @@ std::uint8_t PicDevice::GetPendingIrqNumber() const {
    * PRIORITY RESOLUTION
    *
    * Identifies highest-priority pending interrupt.
-   * Lower IRQ numbers have higher priority (IRQ 0 > IRQ 1 > ...).
+   * Higher PRIORITY wins; within a level, lower IRQ numbers win.
    *
    * ALGORITHM:
-   * Compute active IRQs: status & enable
-   * Find first set bit (LSB → MSB scan)
-   * Return bit position as IRQ number
+   * Compute active IRQs: status & enable & ~in_service & eligible
+   * For each level from 7 down to THRESHOLD+1:
+   *   candidates = active & level_mask[level]
+   *   if candidates: return countr_zero(candidates)
    *
    * HARDWARE EQUIVALENT:
    * Priority encoders in physical PICs use combinational logic
@@ -374,17 +458,68 @@ std::uint8_t PicDevice::GetPendingIrqNumber() const {
    * Constant-time operation on most architectures.
    */
 
-  std::uint16_t activeIrqs = m_IrqStatus & m_IrqEnable;
+  auto activeIrqs = static_cast<std::uint16_t>(m_IrqStatus & m_IrqEnable &
+                                               ~m_InService & m_EligibleMask);
 
   if (activeIrqs == 0) {
-    return 0xFF; // No pending IRQs
+    return NoIrq; // No pending IRQs
   }
 
-  // Find position of least significant set bit
-  std::uint8_t irqNumber =
-      static_cast<std::uint8_t>(std::countr_zero(activeIrqs));
+  for (std::size_t level = MaxPriority; level > m_Threshold; --level) {
+    auto candidates =
+        static_cast<std::uint16_t>(activeIrqs & m_LevelMask[level]);
+    if (candidates != 0) {
+      // Lowest-numbered line wins ties within a level
+      return static_cast<std::uint8_t>(std::countr_zero(candidates));
+    }
+  }
 
-  return irqNumber;
+  return NoIrq; // Unreachable: eligible mask covers exactly these levels
+}
+
+std::uint8_t PicDevice::Claim() {
+  /**
+   * CLAIM
+   *
+   * The claimed line leaves IRQ_STATUS (a level source that is still
+   * asserted will set it again via RaiseIrq) and is fenced off by
+   * IN_SERVICE until the handler completes it.
+   */
+  std::uint8_t irq = GetPendingIrqNumber();
+  if (irq == NoIrq) {
+    return NoIrq;
+  }
+
+  m_IrqStatus = Core::ClearBit(m_IrqStatus, irq);
+  m_InService = Core::SetBit(m_InService, irq);
+  return irq;
+}
+
+void PicDevice::Complete(std::uint8_t irqLine) {
+  if (irqLine >= MaxIrqLines) {
+    return;
+  }
+  m_InService = Core::ClearBit(m_InService, irqLine);
+}
+
+Core::Address PicDevice::GetVectorAddress() const {
+  std::uint8_t irq = GetPendingIrqNumber();
+  // Slot MaxIrqLines is the spurious-interrupt entry
+  Core::Address slot = (irq == NoIrq) ? MaxIrqLines : irq;
+  return m_VectorBase + slot * VectorStride;
+}
+
+void PicDevice::RebuildPriorityMasks() {
+  m_LevelMask.fill(0);
+  m_EligibleMask = 0;
+
+  for (std::uint8_t line = 0; line < MaxIrqLines; ++line) {
+    std::uint8_t priority = m_Priority[line];
+    m_LevelMask[priority] = Core::SetBit(m_LevelMask[priority], line);
+    if (priority > m_Threshold) {
+      m_EligibleMask = Core::SetBit(m_EligibleMask, line);
+    }
+  }
 }
 
 } // namespace Aurelia::Peripherals
@@ -23,6 +23,12 @@
  * │ 0x0004     │ IRQ_ENABLE  - Interrupt Enable Mask (RW)        │
  * │ 0x0008     │ IRQ_ACK     - Interrupt Acknowledge (W1C)       │
  * │ 0x000C     │ IRQ_TRIGGER - Edge vs Level Config (RW)         │
+ * │ 0x0010     │ THRESHOLD   - Minimum Priority to Deliver (RW)  │
+ * │ 0x0014     │ CLAIM       - Claim (R) / Complete (W)          │
+ * │ 0x0018     │ VECTOR_BASE - Handler Table Base Address (RW)   │
+ * │ 0x001C     │ VECTOR      - Handler Address for Next IRQ (RO) │
+ * │ 0x0020     │ IN_SERVICE  - Claimed, Not Completed (RO)       │
+ * │ 0x0100+4N  │ PRIORITY[N] - Per-Line Priority 0-7 (RW)        │
  * └────────────┴─────────────────────────────────────────────────┘
  *
  * IRQ_STATUS (Offset 0x0, Read-Only):
@@ -61,10 +67,36 @@
  * 5. CPU services interrupt, writes IRQ_ACK to clear
  * 6. PIC deasserts CPU IRQ line when no enabled IRQs pending
  *
- * PRIORITY RESOLUTION:
- * Lower-numbered IRQs have higher priority (IRQ 0 > IRQ 15).
- * CPU software scans IRQ_STATUS from LSB to MSB to service
- * highest-priority interrupt first.
+ * PRIORITY RESOLUTION (PLIC-style):
+ * Each line has a programmable priority 0-7 (reset value 1). Higher
+ * values win; ties go to the lower-numbered line. Priority 0 never
+ * interrupts. Only lines with priority strictly above THRESHOLD are
+ * delivered. With reset values this reduces to the original fixed
+ * ordering (IRQ 0 > IRQ 15).
+ *
+ * The controller keeps one 16-bit line mask per priority level, so
+ * resolution is at most 7 AND + countr_zero steps rather than a software
+ * scan of IRQ_STATUS in the guest.
+ *
+ * CLAIM / COMPLETE:
+ * 1. Handler reads CLAIM: returns the winning IRQ number (0xFF if none),
+ *    clears its pending bit and marks it in service
+ * 2. Handler services the device
+ * 3. Handler writes the IRQ number to CLAIM: marks it complete
+ * A line in service cannot be claimed again until completed, so a
+ * level-triggered source that stays asserted does not re-enter its own
+ * handler. IRQ_ACK remains available for polled drivers.
+ *
+ * VECTORED DISPATCH:
+ * VECTOR reads VECTOR_BASE + 4 * N for the IRQ that CLAIM would return
+ * next, i.e. a table of one 32-bit slot per line. When nothing is
+ * claimable it returns slot 16 (the spurious-interrupt entry). Reading
+ * VECTOR has no side effects.
+ *
+ * NOTE (KleaSCM) The CPU does not take interrupts yet and the ISA has no
+ * register-indirect branch, so today VECTOR serves dispatch code that
+ * keeps a table of branch slots and host-side tooling (GetVectorAddress).
+ * Hardware entry will read the same value once the core grows it.
  *
  * EDGE vs LEVEL SEMANTICS:
  * - Level: Signal held until source condition cleared AND acknowledged
@@ -84,6 +116,7 @@
 
 #include "Bus/IBusDevice.hpp"
 #include "Core/Types.hpp"
+#include <array>
 #include <cstdint>
 
 namespace Aurelia::Peripherals {
@@ -104,16 +137,30 @@ public:
    * IRQ LINE DEFINITIONS
    */
   static constexpr std::uint8_t MaxIrqLines = 16;
-  static constexpr std::uint8_t IrqUartRx = 0;   // UART receive data
-  static constexpr std::uint8_t IrqTimer = 1;    // Timer expire
-  static constexpr std::uint8_t IrqKeyboard = 2; // Keyboard data ready
-  static constexpr std::uint8_t IrqMouse = 3;    // Mouse movement/click
+  static constexpr std::uint8_t IrqUartRx = 0;       // UART receive data
+  static constexpr std::uint8_t IrqTimer = 1;        // Timer expire
+  static constexpr std::uint8_t IrqKeyboard = 2;     // Keyboard data ready
+  static constexpr std::uint8_t IrqMouse = 3;        // Mouse movement/click
+  static constexpr std::uint8_t IrqGpuVsync = 4;     // GPU vertical sync
+  static constexpr std::uint8_t IrqBlitter = 5;      // Blit queue drained
+  static constexpr std::uint8_t IrqDma0 = 6;         // DMA channels 0-3: 6-9
+  static constexpr std::uint8_t IrqVirtioBlock = 10; // Virtio used ring
+  static constexpr std::uint8_t IrqNet = 11;         // NIC RX/TX rings
+  static constexpr std::uint8_t IrqRtc = 12;         // RTC alarm
+
+  /**
+   * PRIORITY / VECTOR DEFINITIONS
+   */
+  static constexpr std::uint8_t NoIrq = 0xFF;
+  static constexpr std::uint8_t MaxPriority = 7;
+  static constexpr std::uint8_t DefaultPriority = 1;
+  static constexpr Core::Address VectorStride = 4;
 
   /**
    * @brief Check if address falls within PIC register range.
    *
    * PIC occupies 4KB page starting at PicBase (0xE0002000).
-   * Only first 16 bytes (4 registers) currently used.
+   * Control registers occupy 0x00-0x23, priorities 0x100-0x13F.
    *
    * @param addr Physical address to check
    * @return true if addr in [PicBase, PicBase + 0xFFF]
@@ -127,6 +174,8 @@ public:
    * IRQ_ENABLE (0x4): Return enabled IRQ mask
    * IRQ_ACK (0x8): Return current status (same as IRQ_STATUS)
    * IRQ_TRIGGER (0xC): Return trigger mode configuration
+   * CLAIM (0x14): Claim highest-priority IRQ (side effect!)
+   * VECTOR (0x1C): Handler address for next claimable IRQ
    *
    * @param addr Register address (offset from PicBase)
    * @param outData Reference to store read value
@@ -141,6 +190,10 @@ public:
    * IRQ_ENABLE (0x4): Update IRQ enable mask
    * IRQ_ACK (0x8): Clear pending IRQs (write-1-to-clear)
    * IRQ_TRIGGER (0xC): Configure edge vs level per IRQ
+   * THRESHOLD (0x10): Set delivery threshold
+   * CLAIM (0x14): Complete the written IRQ number
+   * VECTOR_BASE (0x18): Set handler table base
+   * PRIORITY[N] (0x100+4N): Set line priority (clamped to 0-7)
    *
    * @param addr Register address (offset from PicBase)
    * @param inData Value to write
@@ -184,7 +237,9 @@ public:
    * @brief Check if any enabled IRQ is pending.
    *
    * CPU polls this to determine if interrupt handling needed.
-   * True if: (IRQ_STATUS & IRQ_ENABLE) != 0
+   * True if an enabled, pending line that is not in service has a
+   * priority above THRESHOLD. With reset configuration this is
+   * (IRQ_STATUS & IRQ_ENABLE) != 0.
    *
    * @return true if CPU should service interrupt
    */
@@ -193,13 +248,29 @@ public:
   /**
    * @brief Get highest-priority pending IRQ number.
    *
-   * Scans IRQ_STATUS & IRQ_ENABLE from LSB to MSB, returning
-   * first set bit (lowest IRQ number = highest priority).
+   * Same selection as a CLAIM read, without the side effects.
    *
    * @return IRQ number (0-15), or 0xFF if none pending
    */
   [[nodiscard]] std::uint8_t GetPendingIrqNumber() const;
 
+  /**
+   * @brief Claim the highest-priority pending IRQ (CLAIM read).
+   *
+   * @return IRQ number, or NoIrq if nothing is claimable
+   */
+  std::uint8_t Claim();
+
+  /**
+   * @brief Complete a previously claimed IRQ (CLAIM write).
+   */
+  void Complete(std::uint8_t irqLine);
+
+  /**
+   * @brief Handler address for the next claimable IRQ (VECTOR read).
+   */
+  [[nodiscard]] Core::Address GetVectorAddress() const;
+
 private:
   /**
    * MEMORY MAP CONSTANTS
@@ -211,6 +282,12 @@ private:
   static constexpr Core::Address IrqEnableOffset = 0x4;
   static constexpr Core::Address IrqAckOffset = 0x8;
   static constexpr Core::Address IrqTriggerOffset = 0xC;
+  static constexpr Core::Address ThresholdOffset = 0x10;
+  static constexpr Core::Address ClaimOffset = 0x14;
+  static constexpr Core::Address VectorBaseOffset = 0x18;
+  static constexpr Core::Address VectorOffset = 0x1C;
+  static constexpr Core::Address InServiceOffset = 0x20;
+  static constexpr Core::Address PriorityBaseOffset = 0x100;
 
   /**
    * @brief Pending interrupt status.
@@ -239,6 +316,31 @@ private:
    * on RaiseIrq() and holds until software acknowledges.
    */
   std::uint16_t m_IrqTrigger = 0;
+
+  /**
+   * @brief Lines claimed but not yet completed.
+   */
+  std::uint16_t m_InService = 0;
+
+  /**
+   * PRIORITY STATE
+   *
+   * m_Priority is the architectural per-line value. m_LevelMask[p] is the
+   * set of lines at priority p, and m_EligibleMask the union of levels
+   * above the threshold. Both are derived and rebuilt on every PRIORITY
+   * or THRESHOLD write, which keeps resolution to mask arithmetic.
+   */
+  std::array<std::uint8_t, MaxIrqLines> m_Priority{};
+  std::array<std::uint16_t, MaxPriority + 1> m_LevelMask{};
+  std::uint16_t m_EligibleMask = 0;
+  std::uint8_t m_Threshold = 0;
+
+  Core::Address m_VectorBase = 0;
+
+  /**
+   * @brief Recompute m_LevelMask and m_EligibleMask.
+   */
+  void RebuildPriorityMasks();
 };
 
 } // namespace Aurelia::Peripherals
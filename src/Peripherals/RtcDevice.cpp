@@ -0,0 +1,200 @@
+/**
+ * Real-Time Clock Device Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Peripherals/RtcDevice.hpp"
+#include "System/ClockDomains.hpp"
+#include "System/MemoryMap.hpp"
+
+namespace Aurelia::Peripherals {
+
+namespace {
+
+constexpr std::uint64_t NsPerSecond = 1'000'000'000;
+
+/**
+ * @brief ticks × 10^9 / hz without overflowing 64 bits.
+ *
+ * Whole seconds and the remainder are converted separately; the
+ * remainder is below hz, so remainder × 10^9 fits for any hz < 2^34.
+ */
+std::uint64_t TicksToNs(std::uint64_t ticks, std::uint64_t hz) {
+  return (ticks / hz) * NsPerSecond + (ticks % hz) * NsPerSecond / hz;
+}
+
+/**
+ * @brief ns × scale / 2^16 without overflowing for any scale < 2^32.
+ */
+std::uint64_t ApplyScale(std::uint64_t ns, std::uint64_t scaleQ16) {
+  return (ns >> 16) * scaleQ16 + (((ns & 0xFFFF) * scaleQ16) >> 16);
+}
+
+} // namespace
+
+RtcDevice::RtcDevice()
+    : m_BaseAddr(System::RtcBase), m_Host(&Host::SystemHostClock::Instance()),
+      m_TickHz(System::NominalCoreHz) {
+  Reset();
+}
+
+void RtcDevice::ConnectClock(const Core::Clock *clock) {
+  Rebase();
+  m_Clock = clock;
+  m_AnchorTicks = Ticks();
+}
+
+void RtcDevice::ConnectHostClock(const Host::IHostClock *host) {
+  m_Host = host;
+  Reset();
+}
+
+void RtcDevice::Reset() {
+  m_AnchorNs = 0;
+  m_AnchorHostNs = m_Host->MonotonicNs();
+  m_AnchorTicks = Ticks();
+  m_WallOffsetNs = m_Host->WallNs();
+  m_Alarm = 0;
+  m_Status = 0;
+}
+
+std::uint64_t RtcDevice::Ticks() const {
+  return m_Clock ? m_Clock->GetTotalTicks() : 0;
+}
+
+std::uint64_t RtcDevice::GetMonotonicNs() const {
+  switch (m_Mode) {
+  case RtcMode::Real:
+    return m_AnchorNs + (m_Host->MonotonicNs() - m_AnchorHostNs);
+  case RtcMode::Scaled:
+    return m_AnchorNs +
+           ApplyScale(m_Host->MonotonicNs() - m_AnchorHostNs, m_Scale);
+  case RtcMode::Virtual:
+    return m_AnchorNs + TicksToNs(Ticks() - m_AnchorTicks, m_TickHz);
+  }
+  return m_AnchorNs;
+}
+
+std::int64_t RtcDevice::GetWallNs() const {
+  return m_WallOffsetNs + static_cast<std::int64_t>(GetMonotonicNs());
+}
+
+void RtcDevice::Rebase() {
+  m_AnchorNs = GetMonotonicNs();
+  m_AnchorHostNs = m_Host->MonotonicNs();
+  m_AnchorTicks = Ticks();
+}
+
+void RtcDevice::SetMode(RtcMode mode) {
+  Rebase();
+  m_Mode = mode;
+}
+
+void RtcDevice::SetScale(std::uint64_t scaleQ16) {
+  if (scaleQ16 >> 32) {
+    return; // ApplyScale() is only exact below 65536×
+  }
+  Rebase();
+  m_Scale = scaleQ16;
+}
+
+void RtcDevice::SetTickHz(std::uint64_t hz) {
+  if (hz == 0 || hz >> 34) {
+    return; // See TicksToNs()
+  }
+  Rebase();
+  m_TickHz = hz;
+}
+
+bool RtcDevice::IsAddressInRange(Core::Address addr) const {
+  return addr >= m_BaseAddr && addr < m_BaseAddr + RegisterBlockSize;
+}
+
+bool RtcDevice::OnRead(Core::Address addr, Core::Data &outData) {
+  switch (addr - m_BaseAddr) {
+  case IdOffset:
+    outData = DeviceId;
+    return true;
+  case MonotonicOffset:
+    outData = GetMonotonicNs();
+    return true;
+  case WallOffset:
+    outData = static_cast<Core::Data>(GetWallNs());
+    return true;
+  case ModeOffset:
+    outData = static_cast<Core::Data>(m_Mode);
+    return true;
+  case ScaleOffset:
+    outData = m_Scale;
+    return true;
+  case TickHzOffset:
+    outData = m_TickHz;
+    return true;
+  case AlarmOffset:
+    outData = m_Alarm;
+    return true;
+  case ControlOffset:
+    outData = m_Control;
+    return true;
+  case StatusOffset:
+    outData = m_Status;
+    return true;
+  default:
+    outData = 0;
+    return true;
+  }
+}
+
+bool RtcDevice::OnWrite(Core::Address addr, Core::Data inData) {
+  switch (addr - m_BaseAddr) {
+  case WallOffset:
+    m_WallOffsetNs = static_cast<std::int64_t>(inData) -
+                     static_cast<std::int64_t>(GetMonotonicNs());
+    return true;
+
+  case ModeOffset:
+    if (inData <= static_cast<Core::Data>(RtcMode::Virtual)) {
+      SetMode(static_cast<RtcMode>(inData));
+    }
+    return true;
+
+  case ScaleOffset:
+    SetScale(inData);
+    return true;
+
+  case TickHzOffset:
+    SetTickHz(inData);
+    return true;
+
+  case AlarmOffset:
+    m_Alarm = inData;
+    return true;
+
+  case ControlOffset:
+    m_Control = inData & ControlAlarmIrq;
+    return true;
+
+  case StatusOffset:
+    m_Status &= ~inData; // W1C
+    return true;
+
+  default:
+    return true; // Read-only registers
+  }
+}
+
+void RtcDevice::OnTick() {
+  if (m_Alarm == 0 || GetMonotonicNs() < m_Alarm) {
+    return;
+  }
+
+  m_Alarm = 0;
+  m_Status |= StatusAlarm;
+  if ((m_Control & ControlAlarmIrq) && m_Pic) {
+    m_Pic->RaiseIrq(PicDevice::IrqRtc);
+  }
+}
+
+} // namespace Aurelia::Peripherals
@@ -0,0 +1,172 @@
+/**
+ * Real-Time Clock Device.
+ *
+ * Monotonic clocksource and wall clock for the guest, in nanoseconds.
+ *
+ * TimerDevice counts ticks, which says nothing about how much real time
+ * has passed. The RTC answers that question in one of three time bases,
+ * chosen by the MODE register:
+ * ┌──────────┬──────────────────────────────────────────────────────────┐
+ * │ Mode     │ Guest nanoseconds advance with                           │
+ * ├──────────┼──────────────────────────────────────────────────────────┤
+ * │ Real     │ Host monotonic time, 1:1                                 │
+ * │ Scaled   │ Host monotonic time × SCALE (e.g. 0.5 = half speed)      │
+ * │ Virtual  │ Elapsed core cycles ÷ TICK_HZ; no host time at all       │
+ * └──────────┴──────────────────────────────────────────────────────────┘
+ * Virtual time is the one to use when cycles are skipped or run faster
+ * than real time: a guest waiting 10 ms for a timeout sees exactly
+ * TICK_HZ/100 cycles pass, however long that took on the host. It is
+ * also fully deterministic.
+ *
+ * REGISTER MAP (64-bit registers, 8-byte stride):
+ * ┌────────────┬─────────────────────────────────────────────────┐
+ * │ Offset     │ Register                                        │
+ * ├────────────┼─────────────────────────────────────────────────┤
+ * │ 0x0000     │ ID        - 'ARTC' (RO)                         │
+ * │ 0x0008     │ MONOTONIC - Guest ns since reset (RO)           │
+ * │ 0x0010     │ WALL      - Guest ns since Unix epoch (RW)      │
+ * │ 0x0018     │ MODE      - 0 Real, 1 Scaled, 2 Virtual (RW)    │
+ * │ 0x0020     │ SCALE     - Scaled-mode rate, Q16.16 (RW)       │
+ * │ 0x0028     │ TICK_HZ   - Virtual-mode cycles per second (RW) │
+ * │ 0x0030     │ ALARM     - MONOTONIC deadline, 0 = off (RW)    │
+ * │ 0x0038     │ CONTROL   - Bit 0 ALARM_IRQ_EN (RW)             │
+ * │ 0x0040     │ STATUS    - Bit 0 ALARM fired (W1C)             │
+ * └────────────┴─────────────────────────────────────────────────┘
+ *
+ * CONTINUITY:
+ * Changing MODE, SCALE or TICK_HZ re-anchors the clock at its current
+ * reading, so MONOTONIC never jumps or runs backwards across a switch.
+ * WALL is MONOTONIC plus an offset taken from the host wall clock at
+ * reset; writing WALL moves the offset, as setting the time does on a
+ * real RTC, and leaves MONOTONIC alone.
+ *
+ * ALARM:
+ * One-shot. Checked when the device ticks (control clock), so it fires
+ * within ControlClockDivider cycles of the deadline; it then disarms,
+ * sets STATUS and, if enabled, raises PIC line IrqRtc.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Bus/IBusDevice.hpp"
+#include "Core/Clock.hpp"
+#include "Core/Types.hpp"
+#include "Host/HostClock.hpp"
+#include "Peripherals/PicDevice.hpp"
+#include <cstdint>
+
+namespace Aurelia::Peripherals {
+
+enum class RtcMode : std::uint8_t { Real = 0, Scaled = 1, Virtual = 2 };
+
+class RtcDevice final : public Bus::IBusDevice {
+public:
+  /**
+   * REGISTER OFFSETS
+   */
+  static constexpr Core::Address IdOffset = 0x00;
+  static constexpr Core::Address MonotonicOffset = 0x08;
+  static constexpr Core::Address WallOffset = 0x10;
+  static constexpr Core::Address ModeOffset = 0x18;
+  static constexpr Core::Address ScaleOffset = 0x20;
+  static constexpr Core::Address TickHzOffset = 0x28;
+  static constexpr Core::Address AlarmOffset = 0x30;
+  static constexpr Core::Address ControlOffset = 0x38;
+  static constexpr Core::Address StatusOffset = 0x40;
+
+  static constexpr std::uint32_t DeviceId = 0x43545241; // "ARTC"
+  static constexpr std::uint64_t ScaleOne = 1u << 16;   // 1.0 in Q16.16
+
+  static constexpr std::uint64_t ControlAlarmIrq = 1u << 0;
+  static constexpr std::uint64_t StatusAlarm = 1u << 0;
+
+  /**
+   * @brief Construct RTC at MemoryMap::RtcBase in Real mode, reading the
+   * system host clock.
+   */
+  RtcDevice();
+
+  void SetBaseAddress(Core::Address base) { m_BaseAddr = base; }
+  void ConnectPic(PicDevice *pic) { m_Pic = pic; }
+
+  /**
+   * @brief Cycle counter for Virtual mode (not owned).
+   */
+  void ConnectClock(const Core::Clock *clock);
+
+  /**
+   * @brief Replace the host time source (not owned) and reset.
+   */
+  void ConnectHostClock(const Host::IHostClock *host);
+
+  /**
+   * @brief Host-side equivalents of writing MODE, SCALE and TICK_HZ.
+   */
+  void SetMode(RtcMode mode);
+  void SetScale(std::uint64_t scaleQ16);
+  void SetTickHz(std::uint64_t hz);
+
+  [[nodiscard]] RtcMode GetMode() const { return m_Mode; }
+
+  /**
+   * @brief Current guest monotonic time (the MONOTONIC register).
+   */
+  [[nodiscard]] std::uint64_t GetMonotonicNs() const;
+
+  /**
+   * @brief Current guest wall time (the WALL register).
+   */
+  [[nodiscard]] std::int64_t GetWallNs() const;
+
+  /**
+   * @brief Restart MONOTONIC at zero and resync WALL with the host.
+   */
+  void Reset();
+
+  [[nodiscard]] bool IsAddressInRange(Core::Address addr) const override;
+  bool OnRead(Core::Address addr, Core::Data &outData) override;
+  bool OnWrite(Core::Address addr, Core::Data inData) override;
+
+  /**
+   * @brief Check the alarm.
+   */
+  void OnTick() override;
+
+private:
+  static constexpr Core::Address RegisterBlockSize = 0x1000;
+
+  /**
+   * @brief Freeze the current reading as the origin for the next span.
+   */
+  void Rebase();
+
+  [[nodiscard]] std::uint64_t Ticks() const;
+
+  Core::Address m_BaseAddr;
+  PicDevice *m_Pic = nullptr;
+  const Core::Clock *m_Clock = nullptr;
+  const Host::IHostClock *m_Host;
+
+  RtcMode m_Mode = RtcMode::Real;
+  std::uint64_t m_Scale = ScaleOne;
+  std::uint64_t m_TickHz;
+
+  /**
+   * ANCHOR
+   * MONOTONIC = m_AnchorNs + time elapsed since the anchor, measured in
+   * the current mode's time base.
+   */
+  std::uint64_t m_AnchorNs = 0;
+  std::uint64_t m_AnchorHostNs = 0;
+  std::uint64_t m_AnchorTicks = 0;
+  std::int64_t m_WallOffsetNs = 0; // WALL - MONOTONIC
+
+  std::uint64_t m_Alarm = 0;
+  std::uint64_t m_Control = 0;
+  std::uint64_t m_Status = 0;
+};
+
+} // namespace Aurelia::Peripherals
@@ -7,7 +7,7 @@
 
 #include "Peripherals/UartDevice.hpp"
 #include "Core/BitManip.hpp"
-#include <iostream>
+#include <algorithm>
 
 namespace Aurelia::Peripherals {
 
@@ -17,16 +17,22 @@ UartDevice::UartDevice() {
    *
    * UART powers on in a known state:
    * - TX ready (can transmit immediately)
-   * - RX buffer empty
+   * - RX/TX FIFOs empty, FIFO mode on, trigger level 1
+   * - BAUD_DIV 0 (line modelled as infinitely fast)
    * - All interrupts disabled
    * - No pending IRQs
    *
-   * Physical UART would perform baud rate calibration,
-   * line state detection, and FIFO reset here.
+   * Physical UART would perform line state detection here.
    */
   m_Control = 0;
+  m_FifoCtrl = FifoCtrlResetValue;
+  m_BaudDiv = 0;
   m_IrqPending = false;
-  // m_RxBuffer default-constructed to empty queue
+}
+
+UartDevice::~UartDevice() {
+  // Nothing the guest transmitted may be lost at shutdown
+  FlushTx();
 }
 
 bool UartDevice::IsAddressInRange(Core::Address addr) const {
@@ -37,10 +43,8 @@ bool UartDevice::IsAddressInRange(Core::Address addr) const {
    * Base: 0xE0001000
    * End:  0xE0001FFF (inclusive)
    *
-   * Only first 12 bytes currently defined (3 regs × 4 bytes).
+   * Only first 28 bytes currently defined (7 regs × 4 bytes).
    * Remaining space reserved for:
-   * - FIFO control registers
-   * - Baud rate divisor
    * - Line control (parity, stop bits)
    * - Modem status/control
    */
@@ -55,8 +59,8 @@ bool UartDevice::OnRead(Core::Address addr, Core::Data &outData) {
    * appropriate value. All reads are synchronous (no wait states).
    *
    * NOTE (KleaSCM): Real UART may stall on RX read if FIFO
-   * is being drained by hardware state machine. We have no
-   * such timing constraints in simulation.
+   * is being filled by the hardware state machine. Our FIFO
+   * transfers are atomic with respect to the bus, so no stall.
    */
 
   if (!IsAddressInRange(addr)) {
@@ -70,19 +74,25 @@ bool UartDevice::OnRead(Core::Address addr, Core::Data &outData) {
     /**
      * DATA REGISTER READ (RX)
      *
-     * Pop oldest byte from receive buffer.
-     * If buffer empty, return 0x00 (null character).
+     * Pop oldest byte from the RX FIFO.
+     * If FIFO empty, return 0x00 (null character).
      *
      * HARDWARE BEHAVIOR:
-     * - Reading DATA clears RX_AVAIL flag when buffer empties
-     * - May trigger RX_EMPTY interrupt if configured
-     * - Hardware UART would shift next byte from FIFO
+     * - Reading DATA clears RX_AVAIL flag when FIFO empties
+     * - Clears a pending character timeout and restarts its timer
+     * - RX IRQ deasserts once the level drops below the trigger
      */
-    if (!m_RxBuffer.empty()) {
-      outData = static_cast<Core::Data>(m_RxBuffer.front());
-      m_RxBuffer.pop();
+    std::uint8_t rxByte = 0;
+    if (m_RxFifo.Pop(rxByte)) {
+      outData = static_cast<Core::Data>(rxByte);
 
-      // Update IRQ state after buffer change
+      m_RxActivity++;
+      m_RxTimeout = false;
+      if (!m_RxFifo.IsEmpty()) {
+        ArmRxTimeout();
+      }
+
+      // Update IRQ state after FIFO change
       UpdateIrqState();
     } else {
       // No data available
@@ -95,27 +105,48 @@ bool UartDevice::OnRead(Core::Address addr, Core::Data &outData) {
     /**
      * STATUS REGISTER READ
      *
-     * Bit 0 (TX_READY):  Always 1 (infinite TX buffer)
-     * Bit 1 (RX_AVAIL):  1 if RX buffer non-empty
-     * Bits [7:2]:        Reserved (read as 0)
+     * Bit 0 (TX_READY):   1 if TX FIFO has space
+     * Bit 1 (RX_AVAIL):   1 if RX FIFO non-empty
+     * Bit 2 (OVERRUN):    1 if a received byte was lost since last read
+     * Bit 3 (TX_EMPTY):   1 if TX FIFO and shift register both idle
+     * Bit 4 (RX_TRIG):    1 if RX level >= trigger level
+     * Bit 5 (RX_TIMEOUT): 1 if character timeout pending
+     * Bits [7:6]:         Reserved (read as 0)
+     *
+     * OVERRUN is sticky and cleared by this read, as on the 16550 LSR.
      *
-     * PHYSICAL UART STATUS BITS:
-     * - Overrun error (data lost due to full FIFO)
+     * PHYSICAL UART STATUS BITS NOT MODELLED:
      * - Parity error
      * - Framing error (invalid stop bit)
      * - Break detect (line held low)
      */
     Core::Data status = 0;
 
-    // TX always ready (bit 0)
-    status = Core::SetBit(status, StatusTxReady);
-
-    // RX available if buffer not empty (bit 1)
-    if (!m_RxBuffer.empty()) {
+    if (m_TxFifo.Size() < GetFifoLimit()) {
+      status = Core::SetBit(status, StatusTxReady);
+    }
+    if (!m_RxFifo.IsEmpty()) {
       status = Core::SetBit(status, StatusRxAvail);
     }
+    if (m_Overrun) {
+      status = Core::SetBit(status, StatusOverrun);
+    }
+    if (m_TxFifo.IsEmpty() && !m_TxShifting) {
+      status = Core::SetBit(status, StatusTxEmpty);
+    }
+    if (m_RxFifo.Size() >= GetRxTriggerLevel()) {
+      status = Core::SetBit(status, StatusRxTrigger);
+    }
+    if (m_RxTimeout) {
+      status = Core::SetBit(status, StatusRxTimeout);
+    }
 
     outData = status;
+
+    if (m_Overrun) {
+      m_Overrun = false;
+      UpdateIrqState();
+    }
     return true;
   }
 
@@ -130,6 +161,27 @@ bool UartDevice::OnRead(Core::Address addr, Core::Data &outData) {
     return true;
   }
 
+  case FifoCtrlRegOffset: {
+    // Reset bits are self-clearing and never read back
+    outData = static_cast<Core::Data>(m_FifoCtrl);
+    return true;
+  }
+
+  case BaudDivRegOffset: {
+    outData = m_BaudDiv;
+    return true;
+  }
+
+  case RxLevelRegOffset: {
+    outData = static_cast<Core::Data>(m_RxFifo.Size());
+    return true;
+  }
+
+  case TxLevelRegOffset: {
+    outData = static_cast<Core::Data>(m_TxFifo.Size());
+    return true;
+  }
+
   default:
     /**
      * RESERVED REGISTER ACCESS
@@ -164,26 +216,31 @@ bool UartDevice::OnWrite(Core::Address addr, Core::Data inData) {
     /**
      * DATA REGISTER WRITE (TX)
      *
-     * Transmit byte to host stdout.
+     * Push byte into the TX FIFO.
      * Only lower 8 bits used; upper bits ignored.
      *
      * HARDWARE BEHAVIOR:
      * - Byte placed in TX FIFO
-     * - Hardware state machine shifts bits out serial line
-     * - TX_READY cleared if FIFO becomes full
-     * - TX_COMPLETE IRQ fires when transmission finishes
+     * - Shift register takes the next byte whenever it goes idle
+     * - TX_READY cleared while FIFO is full
+     * - TX IRQ (THRE) fires again once the FIFO has drained
      *
-     * SIMULATION:
-     * - Direct write to stdout (no buffering)
-     * - Character immediately visible to user
-     * - No transmission delay
+     * Writing while TX_READY is clear loses the byte, as on hardware.
+     * With BAUD_DIV 0 the byte crosses the line instantly and the FIFO
+     * never fills.
      */
     std::uint8_t txByte = static_cast<std::uint8_t>(inData & 0xFF);
-    std::cout << static_cast<char>(txByte) << std::flush;
 
-    // TX IRQ could fire here if TX_IRQ_EN set
-    // (omitted since TX always succeeds immediately)
+    if (m_BaudDiv == 0 && !m_TxShifting && m_TxFifo.IsEmpty()) {
+      EmitToHost(txByte);
+    } else if (m_TxFifo.Size() < GetFifoLimit()) {
+      m_TxFifo.Push(txByte);
+      if (!m_TxShifting) {
+        StartTxFrame();
+      }
+    }
 
+    UpdateIrqState();
     return true;
   }
 
@@ -212,7 +269,6 @@ bool UartDevice::OnWrite(Core::Address addr, Core::Data inData) {
      * - Bit 3: RX_IRQ_EN
      *
      * FUTURE EXTENSIONS:
-     * - Baud rate select
      * - Parity enable/type
      * - Stop bit count
      * - Hardware flow control enable
@@ -225,6 +281,50 @@ bool UartDevice::OnWrite(Core::Address addr, Core::Data inData) {
     return true;
   }
 
+  case FifoCtrlRegOffset: {
+    /**
+     * FIFO_CTRL REGISTER WRITE
+     *
+     * Toggling FIFO_EN flushes both FIFOs (16550 FCR behaviour), since
+     * the usable depth changes underneath any queued data. The reset
+     * bits act once and are not stored. A byte already in the TX shift
+     * register still completes.
+     */
+    auto value = static_cast<std::uint8_t>(inData & 0xFF);
+    bool enableChanged =
+        ((value ^ m_FifoCtrl) & (1u << FifoCtrlEnable)) != 0;
+
+    if (enableChanged || Core::CheckBit(value, FifoCtrlRxReset)) {
+      m_RxFifo.Clear();
+      m_RxActivity++;
+      m_RxTimeout = false;
+    }
+    if (enableChanged || Core::CheckBit(value, FifoCtrlTxReset)) {
+      m_TxFifo.Clear();
+    }
+
+    m_FifoCtrl = static_cast<std::uint8_t>(
+        value & ((1u << FifoCtrlEnable) | (0x3u << FifoCtrlTriggerShift)));
+
+    UpdateIrqState();
+    return true;
+  }
+
+  case BaudDivRegOffset: {
+    /**
+     * BAUD_DIV REGISTER WRITE
+     *
+     * Frames already on the wire keep their original completion time;
+     * the new divisor applies from the next frame.
+     */
+    m_BaudDiv = static_cast<std::uint32_t>(inData);
+    return true;
+  }
+
+  case RxLevelRegOffset:
+  case TxLevelRegOffset:
+    return true; // Read-only
+
   default:
     /**
      * RESERVED REGISTER WRITE
@@ -238,18 +338,163 @@ bool UartDevice::OnWrite(Core::Address addr, Core::Data inData) {
 
 void UartDevice::OnTick() {
   /**
-   * TICK HANDLER (STATELESS)
+   * TICK HANDLER
    *
-   * UART has no asynchronous state transitions in this implementation.
    * Physical UART would use OnTick for:
    * - Baud rate generation (clock divider countdown)
    * - Bit-level TX/RX state machine
-   * - FIFO drain/fill operations
-   * - Break detection timing
    *
-   * Our implementation is purely reactive (register-driven),
-   * so OnTick is a no-op.
+   * We only model frame boundaries. Those are known in advance, so they
+   * sit on the event queue and the idle cost here is a single compare
+   * against the next deadline, plus the host batch deadline check.
+   */
+  ++m_Now;
+
+  Core::EventQueue::Event ev;
+  while (m_Events.PopDue(m_Now, ev)) {
+    HandleLineEvent(ev);
+  }
+
+  if (m_TxBatchCount == 0) {
+    return;
+  }
+
+  if (++m_TxBatchAge >= m_TxConfig.DeadlineTicks) {
+    FlushTx();
+  }
+}
+
+void UartDevice::HandleLineEvent(const Core::EventQueue::Event &ev) {
+  switch (static_cast<LineEvent>(ev.Id)) {
+  case LineEvent::TxFrameDone:
+    /**
+     * Stop bit sent: the byte is now on the host side of the wire.
+     * Reload the shift register from the FIFO if more is queued.
+     */
+    EmitToHost(m_TxShiftByte);
+    m_TxShifting = false;
+    if (!m_TxFifo.IsEmpty()) {
+      StartTxFrame();
+    }
+    break;
+
+  case LineEvent::RxFrameArrive: {
+    m_RxArriving = false;
+    std::uint8_t rxByte = 0;
+    if (m_RxWire.Pop(rxByte)) {
+      PushRxFifo(rxByte);
+    }
+    if (!m_RxWire.IsEmpty()) {
+      ScheduleRxArrival();
+    }
+    break;
+  }
+
+  case LineEvent::RxTimeout:
+    // Superseded if any RX FIFO activity happened since it was armed
+    if (ev.Payload == m_RxActivity && !m_RxFifo.IsEmpty()) {
+      m_RxTimeout = true;
+    }
+    break;
+  }
+
+  UpdateIrqState();
+}
+
+void UartDevice::StartTxFrame() {
+  m_TxFifo.Pop(m_TxShiftByte);
+  m_TxShifting = true;
+  m_Events.Schedule(m_Now + GetFrameTicks(),
+                    static_cast<std::uint32_t>(LineEvent::TxFrameDone));
+}
+
+void UartDevice::ScheduleRxArrival() {
+  m_RxArriving = true;
+  m_Events.Schedule(m_Now + GetFrameTicks(),
+                    static_cast<std::uint32_t>(LineEvent::RxFrameArrive));
+}
+
+void UartDevice::PushRxFifo(std::uint8_t data) {
+  /**
+   * RX SHIFT REGISTER → FIFO
+   *
+   * A full FIFO loses the incoming byte (the 16550 overwrites the shift
+   * register, FIFO contents survive) and latches OVERRUN.
    */
+  if (m_RxFifo.Size() >= GetFifoLimit()) {
+    m_Overrun = true;
+    m_RxOverrunCount++;
+    return;
+  }
+
+  m_RxFifo.Push(data);
+  m_RxActivity++;
+  m_RxTimeout = false;
+  ArmRxTimeout();
+}
+
+void UartDevice::ArmRxTimeout() {
+  /**
+   * Four character times, as on the 16550. With BAUD_DIV 0 there is no
+   * real character time, so a divisor of 1 is assumed to keep the
+   * timeout finite.
+   */
+  Core::TickCount charTicks =
+      FrameBits * std::max<std::uint32_t>(m_BaudDiv, 1);
+  m_Events.Schedule(m_Now + 4 * charTicks,
+                    static_cast<std::uint32_t>(LineEvent::RxTimeout),
+                    m_RxActivity);
+}
+
+std::size_t UartDevice::GetRxTriggerLevel() const {
+  static constexpr std::array<std::size_t, 4> Levels = {1, 4, 8, 14};
+  if (!IsFifoEnabled()) {
+    return 1;
+  }
+  return Levels[(m_FifoCtrl >> FifoCtrlTriggerShift) & 0x3];
+}
+
+void UartDevice::EmitToHost(std::uint8_t txByte) {
+  /**
+   * Append to the host batch buffer (single array store); the batch is
+   * drained to the sink on newline, threshold or deadline.
+   */
+  if (m_TxBatchCount == 0) {
+    m_TxBatchAge = 0; // Deadline measured from the oldest buffered byte
+  }
+  m_TxBatch[m_TxBatchCount++] = txByte;
+
+  if (m_TxBatchCount >= m_TxConfig.Threshold ||
+      (m_TxConfig.FlushOnNewline && txByte == '\n')) {
+    FlushTx();
+  }
+}
+
+void UartDevice::SetSink(IUartSink *sink) {
+  // Bytes already transmitted belong to the old destination
+  FlushTx();
+  m_Sink = sink ? sink : &m_DefaultSink;
+}
+
+void UartDevice::ConfigureTxBatching(const TxBatchConfig &config) {
+  FlushTx();
+  m_TxConfig = config;
+  m_TxConfig.Threshold =
+      std::clamp<std::size_t>(m_TxConfig.Threshold, 1, TxBatchCapacity);
+}
+
+void UartDevice::FlushTx() {
+  if (m_TxBatchCount == 0) {
+    return;
+  }
+
+  m_Sink->Write(std::span<const std::uint8_t>(m_TxBatch.data(),
+                                              m_TxBatchCount));
+  m_Sink->Flush();
+
+  m_TxBatchCount = 0;
+  m_TxBatchAge = 0;
+  m_TxFlushCount++;
 }
 
 void UartDevice::SimulateReceive(std::uint8_t data) {
@@ -260,17 +505,26 @@ void UartDevice::SimulateReceive(std::uint8_t data) {
    * hardware shifts bits into RX shift register, then moves
    * complete byte to FIFO when stop bit detected.
    *
-   * Here: Direct injection into RX buffer for testing.
+   * Here: with BAUD_DIV 0 the byte is pushed straight into the RX FIFO.
+   * Otherwise it queues on the wire and one byte arrives per frame time,
+   * so a burst of host input paces itself like a real serial line.
    *
    * USAGE:
    * Test code can call this to simulate keyboard input
    * or data arriving on serial line.
    *
-   * @param data Byte to place in RX buffer
+   * @param data Byte arriving on the serial line
    */
-  m_RxBuffer.push(data);
+  if (m_BaudDiv == 0 && m_RxWire.IsEmpty()) {
+    PushRxFifo(data);
+  } else {
+    // Host staging full: the byte never made it onto the wire
+    if (m_RxWire.Push(data) && !m_RxArriving) {
+      ScheduleRxArrival();
+    }
+  }
 
-  // RX data now available - update IRQ if enabled
+  // RX data may now be available - update IRQ if enabled
   UpdateIrqState();
 }
 
@@ -280,16 +534,16 @@ void UartDevice::UpdateIrqState() {
    *
    * Evaluates current conditions to determine if IRQ should be asserted:
    *
-   * CONDITION 1: RX Data Available
-   * - RX buffer not empty
+   * CONDITION 1: RX Needs Service
+   * - RX level at/above trigger, character timeout, or overrun latched
    * - RX_IRQ_EN bit set in CONTROL
    *
-   * CONDITION 2: TX Ready
-   * - TX buffer has space (always true here)
+   * CONDITION 2: TX Needs Refill
+   * - TX FIFO empty (16550 THRE; driver may now write a full FIFO)
    * - TX_IRQ_EN bit set in CONTROL
    *
    * IRQ remains asserted until:
-   * - Source condition cleared (RX buffer drained, IRQ disabled)
+   * - Source condition cleared (RX FIFO drained, IRQ disabled)
    * - CPU explicitly clears via ClearIrq() after servicing
    *
    * EDGE vs LEVEL:
@@ -297,12 +551,18 @@ void UartDevice::UpdateIrqState() {
    * Alternative: Edge-triggered (pulse on 0→1 transition only).
    */
 
+  bool rxNeedsService = m_RxFifo.Size() >= GetRxTriggerLevel() ||
+                        m_RxTimeout || m_Overrun;
   bool rxIrqCondition =
-      !m_RxBuffer.empty() && Core::CheckBit(m_Control, ControlRxIrqEn);
+      rxNeedsService && Core::CheckBit(m_Control, ControlRxIrqEn);
   bool txIrqCondition =
-      Core::CheckBit(m_Control, ControlTxIrqEn); // TX always ready
+      m_TxFifo.IsEmpty() && Core::CheckBit(m_Control, ControlTxIrqEn);
 
-  m_IrqPending = rxIrqCondition || txIrqCondition;
+  bool pending = rxIrqCondition || txIrqCondition;
+  if (pending && !m_IrqPending) {
+    m_IrqAssertCount++;
+  }
+  m_IrqPending = pending;
 }
 
 } // namespace Aurelia::Peripherals
@@ -13,26 +13,30 @@
  * ┌────────────┬─────────────────────────────────────────────────┐
  * │ Offset     │ Register                                        │
  * ├────────────┼─────────────────────────────────────────────────┤
- * │ 0x0000     │ DATA   - Transmit/Receive Data Register         │
- * │ 0x0004     │ STATUS - Status and Flag Register (Read-Only)   │
- * │ 0x0008     │ CONTROL - Control and Configuration Register    │
+ * │ 0x0000     │ DATA      - Transmit/Receive Data Register      │
+ * │ 0x0004     │ STATUS    - Status and Flag Register (RO)       │
+ * │ 0x0008     │ CONTROL   - Control and Configuration Register  │
+ * │ 0x000C     │ FIFO_CTRL - FIFO Enable, Reset, Trigger Level   │
+ * │ 0x0010     │ BAUD_DIV  - Clock Ticks per Serial Bit          │
+ * │ 0x0014     │ RX_LEVEL  - Bytes in RX FIFO (Read-Only)        │
+ * │ 0x0018     │ TX_LEVEL  - Bytes in TX FIFO (Read-Only)        │
  * └────────────┴─────────────────────────────────────────────────┘
  *
  * DATA REGISTER (Offset 0x0):
- * - Write: Transmit byte to UART TX buffer (stdout)
- * - Read: Receive byte from UART RX buffer (stdin)
+ * - Write: Push byte into TX FIFO (dropped if full)
+ * - Read: Pop byte from RX FIFO (0x00 if empty)
  * - Only bits [7:0] are significant; upper bits ignored
  *
  * STATUS REGISTER (Offset 0x4, Read-Only):
  * ┌───┬───┬───┬───┬───┬───┬───┬───┐
  * │ 7 │ 6 │ 5 │ 4 │ 3 │ 2 │ 1 │ 0 │
  * └───┴───┴───┴───┴───┴───┴───┴───┘
- *   │   │   │   │   │   │   │   └── TX_READY: Transmitter ready (always 1)
- *   │   │   │   │   │   │   └────── RX_AVAIL: Data available in RX buffer
- *   │   │   │   │   │   └────────── Reserved
- *   │   │   │   │   └────────────── Reserved
- *   │   │   │   └────────────────── Reserved
- *   │   │   └────────────────────── Reserved
+ *   │   │   │   │   │   │   │   └── TX_READY: TX FIFO has space
+ *   │   │   │   │   │   │   └────── RX_AVAIL: Data available in RX FIFO
+ *   │   │   │   │   │   └────────── OVERRUN: RX byte lost (clear on read)
+ *   │   │   │   │   └────────────── TX_EMPTY: FIFO and shifter both idle
+ *   │   │   │   └────────────────── RX_TRIG: RX level >= trigger level
+ *   │   │   └────────────────────── RX_TIMEOUT: Character timeout
  *   │   └────────────────────────── Reserved
  *   └────────────────────────────── Reserved
  *
@@ -49,16 +53,64 @@
  *   │   └────────────────────────── Reserved
  *   └────────────────────────────── Reserved
  *
+ * FIFO_CTRL REGISTER (Offset 0xC), modelled on the 16550 FCR:
+ * ┌───┬───┬───┬───┬───┬───┬───┬───┐
+ * │ 7 │ 6 │ 5 │ 4 │ 3 │ 2 │ 1 │ 0 │
+ * └───┴───┴───┴───┴───┴───┴───┴───┘
+ *   │   │   │   │   │   │   │   └── FIFO_EN: 16-byte FIFOs (0 = 1 byte)
+ *   │   │   │   │   │   │   └────── RX_RESET: Clear RX FIFO (self-clearing)
+ *   │   │   │   │   │   └────────── TX_RESET: Clear TX FIFO (self-clearing)
+ *   │   │   │   │   └────────────── Reserved
+ *   │   │   │   └────────────────── Reserved
+ *   │   │   └────────────────────── Reserved
+ *   └───┴────────────────────────── RX_TRIGGER: 00=1, 01=4, 10=8, 11=14
+ *
+ * Reset value is FIFO_EN with a trigger level of 1, so software that never
+ * touches FIFO_CTRL sees an interrupt per received byte, as before.
+ *
+ * BAUD_DIV REGISTER (Offset 0x10):
+ * Clock ticks per serial bit. A frame is 10 bits (start + 8 data + stop),
+ * so one byte occupies 10 * BAUD_DIV ticks on the wire in each direction.
+ * The reset value 0 selects an idealised infinitely fast line: transmitted
+ * bytes leave the TX FIFO immediately and received bytes land in the RX
+ * FIFO immediately.
+ *
  * INTERRUPT BEHAVIOR:
- * - TX IRQ: Fires when transmitter becomes ready (always ready in this impl)
- * - RX IRQ: Fires when data arrives in receive buffer
+ * - RX IRQ (RX_IRQ_EN): RX level reaches the trigger level, a character
+ *   timeout occurs, or an overrun is latched
+ * - TX IRQ (TX_IRQ_EN): TX FIFO empty (16550 THRE), i.e. the driver may
+ *   refill up to 16 bytes in one go
  * - IRQ line connects to PIC for system-level interrupt handling
  *
- * IMPLEMENTATION NOTES:
- * - Baud rate simulation omitted (instant transmission)
- * - No hardware FIFO (single-byte buffer)
- * - Non-blocking reads return 0x00 if no data available
- * - Writes to stdout are immediate (no buffering delay)
+ * CHARACTER TIMEOUT:
+ * With a trigger level above 1, a short message could sit below the
+ * trigger forever. As on the 16550, if the RX FIFO holds data and no byte
+ * has been received or read for 4 character times, RX_TIMEOUT is raised.
+ * Reading DATA clears it.
+ *
+ * TIMING MODEL:
+ * Frame completion is scheduled on a Core::EventQueue instead of counting
+ * down per tick. The tick handler therefore costs one compare against the
+ * next deadline while the line is busy and nothing otherwise.
+ *
+ * Host input injected with SimulateReceive() is staged on a "wire" queue
+ * and delivered into the RX FIFO one frame time apart. If the guest does
+ * not drain the RX FIFO fast enough, arriving bytes are lost and OVERRUN
+ * is latched, which is exactly the failure mode a real driver must be
+ * tuned against.
+ *
+ * HOST TRANSMIT BATCHING:
+ * Writing every byte straight to std::cout with a flush costs one host
+ * write syscall per guest STR. Instead, transmitted bytes collect in a
+ * fixed-size batch buffer that is drained to the active sink when:
+ * - A newline is transmitted (interactive console stays line-responsive)
+ * - The buffer reaches the configured size threshold
+ * - The oldest buffered byte has waited DeadlineTicks clock ticks
+ * - FlushTx() is called explicitly, or the device is destroyed
+ *
+ * Batching sits behind the TX shifter: a byte is appended to the host
+ * batch when its frame finishes on the wire. The guest cannot observe
+ * batching; only the moment the host sees the bytes moves.
  *
  * PHYSICAL UART EQUIVALENTS:
  * - 16550 UART: Industry-standard PC serial controller
@@ -72,27 +124,75 @@
 #pragma once
 
 #include "Bus/IBusDevice.hpp"
+#include "Core/EventQueue.hpp"
+#include "Core/RingBuffer.hpp"
 #include "Core/Types.hpp"
+#include "Peripherals/UartSink.hpp"
+#include <array>
 #include <cstdint>
-#include <queue>
 
 namespace Aurelia::Peripherals {
 
 class UartDevice final : public Bus::IBusDevice {
 public:
+  /**
+   * @brief Capacity of the host transmit batch buffer in bytes.
+   */
+  static constexpr std::size_t TxBatchCapacity = 256;
+
+  /**
+   * @brief Hardware FIFO depth in each direction (16550: 16 bytes).
+   */
+  static constexpr std::size_t FifoDepth = 16;
+
+  /**
+   * @brief Host-side staging for bytes not yet delivered over the wire.
+   */
+  static constexpr std::size_t RxWireCapacity = 4096;
+
+  /**
+   * @brief Serial frame length in bits (start + 8 data + stop).
+   */
+  static constexpr Core::TickCount FrameBits = 10;
+
+  /**
+   * @brief Host transmit batching policy.
+   *
+   * Threshold:      Flush once this many bytes are buffered (1 disables
+   *                 batching entirely; clamped to TxBatchCapacity).
+   * FlushOnNewline: Flush immediately after a '\n' is transmitted.
+   * DeadlineTicks:  Flush once the oldest buffered byte has waited this many
+   *                 ticks, so unterminated prompts still reach the host.
+   */
+  struct TxBatchConfig {
+    std::size_t Threshold = TxBatchCapacity;
+    bool FlushOnNewline = true;
+    Core::TickCount DeadlineTicks = 100000;
+  };
+
   /**
    * @brief Construct UART device.
    *
-   * Initializes UART with empty RX buffer, TX ready, and IRQs disabled.
+   * Initializes UART with empty FIFOs, FIFO mode enabled at trigger level
+   * 1, BAUD_DIV 0 (instant line) and IRQs disabled.
    * Base address is fixed at MemoryMap::UartBase (0xE0001000).
+   * Transmitted bytes go to std::cout until SetSink() is called.
    */
   UartDevice();
 
+  /**
+   * @brief Flushes any buffered transmit bytes to the active sink.
+   */
+  ~UartDevice() override;
+
+  UartDevice(const UartDevice &) = delete;
+  UartDevice &operator=(const UartDevice &) = delete;
+
   /**
    * @brief Check if address falls within UART register range.
    *
    * UART occupies a 4KB page starting at UartBase for future expansion.
-   * Currently only 12 bytes (3 registers * 4 bytes) are used.
+   * Currently only 28 bytes (7 registers * 4 bytes) are used.
    *
    * @param addr Physical address to check
    * @return true if addr in [UartBase, UartBase + 0xFFF]
@@ -102,9 +202,11 @@ public:
   /**
    * @brief Handle read from UART register.
    *
-   * DATA (0x0): Pop byte from RX buffer, return 0x00 if empty
-   * STATUS (0x4): Return status flags (TX_READY | RX_AVAIL)
+   * DATA (0x0): Pop byte from RX FIFO, return 0x00 if empty
+   * STATUS (0x4): Return status flags (clears OVERRUN)
    * CONTROL (0x8): Return current control register value
+   * FIFO_CTRL (0xC), BAUD_DIV (0x10): Return current configuration
+   * RX_LEVEL (0x14), TX_LEVEL (0x18): Return FIFO occupancy
    *
    * @param addr Register address (offset from UartBase)
    * @param outData Reference to store read value
@@ -115,9 +217,11 @@ public:
   /**
    * @brief Handle write to UART register.
    *
-   * DATA (0x0): Transmit byte to stdout
+   * DATA (0x0): Push byte into TX FIFO
    * STATUS (0x4): Read-only, writes ignored
    * CONTROL (0x8): Update TX/RX IRQ enable bits
+   * FIFO_CTRL (0xC): Enable/reset FIFOs, select RX trigger level
+   * BAUD_DIV (0x10): Set ticks per bit (takes effect on the next frame)
    *
    * @param addr Register address (offset from UartBase)
    * @param inData Value to write (only lower 8 bits for DATA)
@@ -128,18 +232,67 @@ public:
   /**
    * @brief Tick handler for UART state machine.
    *
-   * UART is stateless in this implementation (no baud rate simulation).
-   * This method is a no-op but required by IBusDevice interface.
-   * Future: Could implement FIFO drain delays here.
+   * Advances device time and fires due line events (TX frame complete,
+   * RX frame arrival, character timeout). Also enforces the host transmit
+   * batch deadline: if bytes have been buffered for longer than
+   * TxBatchConfig::DeadlineTicks, they are flushed to the sink.
    */
   void OnTick() override;
 
+  /**
+   * @brief Redirect transmitted bytes to a host sink.
+   *
+   * Buffered bytes are flushed to the previous sink first. The UART does
+   * not take ownership; the sink must outlive the device or be replaced.
+   *
+   * @param sink New sink, or nullptr to restore the default stdout sink
+   */
+  void SetSink(IUartSink *sink);
+
+  /**
+   * @brief Replace the host transmit batching policy.
+   */
+  void ConfigureTxBatching(const TxBatchConfig &config);
+
+  /**
+   * @brief Drain the host transmit batch buffer to the active sink.
+   *
+   * Call before printing host-side output that must appear after the
+   * guest's console output (e.g. end-of-run telemetry).
+   */
+  void FlushTx();
+
+  /**
+   * @brief Number of batches delivered to the sink so far.
+   *
+   * Each batch costs one sink Write() + Flush() pair, i.e. roughly one host
+   * syscall for the console sinks.
+   */
+  [[nodiscard]] std::size_t GetTxFlushCount() const { return m_TxFlushCount; }
+
+  /**
+   * @brief Number of times the IRQ line went from idle to asserted.
+   *
+   * The figure of merit when comparing interrupt-per-byte drivers against
+   * FIFO-batched ones: same data, fewer assertions.
+   */
+  [[nodiscard]] std::size_t GetIrqAssertCount() const {
+    return m_IrqAssertCount;
+  }
+
+  /**
+   * @brief Number of received bytes lost to a full RX FIFO.
+   */
+  [[nodiscard]] std::size_t GetRxOverrunCount() const {
+    return m_RxOverrunCount;
+  }
+
   /**
    * @brief Check if IRQ is pending.
    *
    * IRQ asserted when:
-   * - RX data available AND RX_IRQ_EN set
-   * - TX ready AND TX_IRQ_EN set (always ready, so fires immediately)
+   * - RX trigger reached, timeout or overrun AND RX_IRQ_EN set
+   * - TX FIFO empty AND TX_IRQ_EN set
    *
    * @return true if interrupt should be signaled to PIC
    */
@@ -157,13 +310,25 @@ public:
   /**
    * @brief Simulate incoming data (for testing).
    *
-   * Pushes byte into RX buffer and triggers RX IRQ if enabled.
-   * In real hardware, this would be driven by serial line input.
+   * With BAUD_DIV 0 the byte lands in the RX FIFO immediately. Otherwise
+   * it is staged on the wire and arrives one frame time after the previous
+   * byte. Either way, a full RX FIFO loses the byte and latches OVERRUN.
    *
-   * @param data Byte to place in RX buffer
+   * @param data Byte arriving on the serial line
    */
   void SimulateReceive(std::uint8_t data);
 
+  /**
+   * @brief True if a byte passed to SimulateReceive() now would be kept.
+   *
+   * Lets a host feeder act as hardware flow control (CTS): it holds
+   * bytes back while the guest is behind instead of overrunning the
+   * FIFO.
+   */
+  [[nodiscard]] bool CanReceive() const {
+    return m_RxWire.IsEmpty() && m_RxFifo.Size() < GetFifoLimit();
+  }
+
 private:
   /**
    * MEMORY MAP CONSTANTS
@@ -174,12 +339,20 @@ private:
   static constexpr Core::Address DataRegOffset = 0x0;
   static constexpr Core::Address StatusRegOffset = 0x4;
   static constexpr Core::Address ControlRegOffset = 0x8;
+  static constexpr Core::Address FifoCtrlRegOffset = 0xC;
+  static constexpr Core::Address BaudDivRegOffset = 0x10;
+  static constexpr Core::Address RxLevelRegOffset = 0x14;
+  static constexpr Core::Address TxLevelRegOffset = 0x18;
 
   /**
    * STATUS REGISTER BIT POSITIONS
    */
-  static constexpr std::uint8_t StatusTxReady = 0; // Bit 0
-  static constexpr std::uint8_t StatusRxAvail = 1; // Bit 1
+  static constexpr std::uint8_t StatusTxReady = 0;   // Bit 0
+  static constexpr std::uint8_t StatusRxAvail = 1;   // Bit 1
+  static constexpr std::uint8_t StatusOverrun = 2;   // Bit 2
+  static constexpr std::uint8_t StatusTxEmpty = 3;   // Bit 3
+  static constexpr std::uint8_t StatusRxTrigger = 4; // Bit 4
+  static constexpr std::uint8_t StatusRxTimeout = 5; // Bit 5
 
   /**
    * CONTROL REGISTER BIT POSITIONS
@@ -188,16 +361,59 @@ private:
   static constexpr std::uint8_t ControlRxIrqEn = 3; // Bit 3
 
   /**
-   * @brief Receive buffer.
+   * FIFO_CTRL REGISTER BIT POSITIONS
+   */
+  static constexpr std::uint8_t FifoCtrlEnable = 0;  // Bit 0
+  static constexpr std::uint8_t FifoCtrlRxReset = 1; // Bit 1
+  static constexpr std::uint8_t FifoCtrlTxReset = 2; // Bit 2
+  static constexpr std::uint8_t FifoCtrlTriggerShift = 6;
+  static constexpr std::uint8_t FifoCtrlResetValue = 0x01;
+
+  /**
+   * @brief Line events scheduled on m_Events.
    *
-   * In physical UART: FIFO with depth 1-16 bytes.
-   * Here: Queue simulating infinite buffer (limited by memory).
+   * RxTimeout carries the RX activity generation in its payload; a timeout
+   * whose generation no longer matches was superseded by later activity.
+   */
+  enum class LineEvent : std::uint32_t {
+    TxFrameDone = 0,
+    RxFrameArrive = 1,
+    RxTimeout = 2,
+  };
+
+  /**
+   * @brief Hardware FIFOs.
    *
-   * NOTE (KleaSCM) std::queue uses std::deque internally, which is
-   * inefficient for single-byte storage but acceptable for simulation.
-   * Production UART would use circular buffer with fixed size.
+   * Fixed 16-byte rings, as on the 16550. With FIFO_EN clear only one
+   * entry of each is usable (16450 compatibility mode).
    */
-  std::queue<std::uint8_t> m_RxBuffer;
+  Core::RingBuffer<std::uint8_t, FifoDepth> m_RxFifo;
+  Core::RingBuffer<std::uint8_t, FifoDepth> m_TxFifo;
+
+  /**
+   * @brief Bytes injected by the host that have not crossed the wire yet.
+   */
+  Core::RingBuffer<std::uint8_t, RxWireCapacity> m_RxWire;
+
+  /**
+   * LINE STATE
+   *
+   * m_TxShifting: a byte is in the TX shift register (frame in flight).
+   * m_RxArriving: an RxFrameArrive event is outstanding.
+   * m_RxActivity: bumped on every RX FIFO push/pop to invalidate stale
+   *               character-timeout events.
+   */
+  Core::EventQueue m_Events;
+  Core::TickCount m_Now = 0;
+  std::uint8_t m_TxShiftByte = 0;
+  bool m_TxShifting = false;
+  bool m_RxArriving = false;
+  bool m_Overrun = false;
+  bool m_RxTimeout = false;
+  std::uint64_t m_RxActivity = 0;
+
+  std::uint8_t m_FifoCtrl = FifoCtrlResetValue;
+  std::uint32_t m_BaudDiv = 0;
 
   /**
    * @brief Control register state.
@@ -207,25 +423,64 @@ private:
    */
   std::uint8_t m_Control = 0;
 
+  std::size_t m_IrqAssertCount = 0;
+  std::size_t m_RxOverrunCount = 0;
+
   /**
    * @brief IRQ pending flag.
    *
-   * Set when interrupt condition met (RX data + enabled, or TX ready +
-   * enabled). Cleared by external call to ClearIrq() after CPU services
-   * interrupt.
+   * Set when interrupt condition met (RX trigger/timeout/overrun +
+   * enabled, or TX FIFO empty + enabled). Cleared by external call to
+   * ClearIrq() after CPU services interrupt.
    */
   bool m_IrqPending = false;
 
+  /**
+   * HOST TRANSMIT PATH
+   *
+   * m_TxBatch holds bytes the guest has transmitted but the host has not
+   * yet seen. m_TxBatchAge counts ticks since the first of those bytes was
+   * written, for the deadline flush.
+   */
+  StdoutSink m_DefaultSink;
+  IUartSink *m_Sink = &m_DefaultSink;
+  TxBatchConfig m_TxConfig;
+  std::array<std::uint8_t, TxBatchCapacity> m_TxBatch{};
+  std::size_t m_TxBatchCount = 0;
+  Core::TickCount m_TxBatchAge = 0;
+  std::size_t m_TxFlushCount = 0;
+
   /**
    * @brief Update IRQ pending state based on current conditions.
    *
    * Evaluates:
-   * - RX_AVAIL && RX_IRQ_EN → assert IRQ
-   * - TX_READY && TX_IRQ_EN → assert IRQ (TX always ready)
+   * - (RX_TRIG || RX_TIMEOUT || OVERRUN) && RX_IRQ_EN → assert IRQ
+   * - TX FIFO empty && TX_IRQ_EN → assert IRQ
    *
-   * Called after RX buffer changes or CONTROL register write.
+   * Called after FIFO changes or CONTROL/FIFO_CTRL register write.
    */
   void UpdateIrqState();
+
+  /**
+   * LINE HELPERS
+   */
+  [[nodiscard]] bool IsFifoEnabled() const {
+    return (m_FifoCtrl & (1u << FifoCtrlEnable)) != 0;
+  }
+  [[nodiscard]] std::size_t GetFifoLimit() const {
+    return IsFifoEnabled() ? FifoDepth : 1;
+  }
+  [[nodiscard]] std::size_t GetRxTriggerLevel() const;
+  [[nodiscard]] Core::TickCount GetFrameTicks() const {
+    return FrameBits * m_BaudDiv;
+  }
+
+  void HandleLineEvent(const Core::EventQueue::Event &ev);
+  void StartTxFrame();
+  void ScheduleRxArrival();
+  void PushRxFifo(std::uint8_t data);
+  void ArmRxTimeout();
+  void EmitToHost(std::uint8_t txByte);
 };
 
 } // namespace Aurelia::Peripherals
@@ -0,0 +1,172 @@
+/**
+ * UART Host Sinks Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Peripherals/UartSink.hpp"
+#include <algorithm>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <stdlib.h>
+#include <unistd.h>
+#define AURELIA_HAS_PTY 1
+#endif
+
+namespace Aurelia::Peripherals {
+
+// -------------------------------------------------------------------------
+// StdoutSink
+// -------------------------------------------------------------------------
+
+void StdoutSink::Write(std::span<const std::uint8_t> bytes) {
+  std::cout.write(reinterpret_cast<const char *>(bytes.data()),
+                  static_cast<std::streamsize>(bytes.size()));
+}
+
+void StdoutSink::Flush() { std::cout.flush(); }
+
+// -------------------------------------------------------------------------
+// FileSink
+// -------------------------------------------------------------------------
+
+FileSink::FileSink(const std::string &path) {
+  m_File = std::fopen(path.c_str(), "wb");
+}
+
+FileSink::~FileSink() {
+  if (m_File) {
+    std::fclose(m_File);
+  }
+}
+
+void FileSink::Write(std::span<const std::uint8_t> bytes) {
+  if (!m_File) {
+    return;
+  }
+  std::fwrite(bytes.data(), 1, bytes.size(), m_File);
+}
+
+void FileSink::Flush() {
+  if (m_File) {
+    std::fflush(m_File);
+  }
+}
+
+// -------------------------------------------------------------------------
+// RingSink
+// -------------------------------------------------------------------------
+
+RingSink::RingSink(std::size_t capacity)
+    : m_Storage(std::max<std::size_t>(capacity, 1)) {}
+
+void RingSink::Write(std::span<const std::uint8_t> bytes) {
+  m_WriteCount++;
+
+  const std::size_t capacity = m_Storage.size();
+  for (std::uint8_t byte : bytes) {
+    m_Storage[m_Head] = byte;
+    m_Head = (m_Head + 1) % capacity;
+    if (m_Count < capacity) {
+      m_Count++;
+    }
+  }
+}
+
+std::string RingSink::Contents() const {
+  /**
+   * The oldest retained byte sits `m_Count` positions behind the head.
+   */
+  const std::size_t capacity = m_Storage.size();
+  std::size_t start = (m_Head + capacity - m_Count) % capacity;
+
+  std::string out;
+  out.reserve(m_Count);
+  for (std::size_t i = 0; i < m_Count; ++i) {
+    out.push_back(static_cast<char>(m_Storage[(start + i) % capacity]));
+  }
+  return out;
+}
+
+void RingSink::Clear() {
+  m_Head = 0;
+  m_Count = 0;
+  m_WriteCount = 0;
+  m_FlushCount = 0;
+}
+
+// -------------------------------------------------------------------------
+// BufferSink
+// -------------------------------------------------------------------------
+
+void BufferSink::Write(std::span<const std::uint8_t> bytes) {
+  std::size_t room = m_Limit - m_Buffer.size();
+  std::size_t kept = std::min(room, bytes.size());
+  m_Buffer.append(reinterpret_cast<const char *>(bytes.data()), kept);
+  m_Dropped += bytes.size() - kept;
+}
+
+// -------------------------------------------------------------------------
+// PtySink
+// -------------------------------------------------------------------------
+
+PtySink::PtySink() {
+#if defined(AURELIA_HAS_PTY)
+  int fd = posix_openpt(O_RDWR | O_NOCTTY);
+  if (fd < 0) {
+    return;
+  }
+
+  if (grantpt(fd) != 0 || unlockpt(fd) != 0) {
+    ::close(fd);
+    return;
+  }
+
+  const char *name = ptsname(fd);
+  if (!name) {
+    ::close(fd);
+    return;
+  }
+
+  // Never let a stalled terminal block the simulation thread
+  int flags = fcntl(fd, F_GETFL);
+  fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+
+  m_MasterFd = fd;
+  m_SlaveName = name;
+#endif
+}
+
+PtySink::~PtySink() {
+#if defined(AURELIA_HAS_PTY)
+  if (m_MasterFd >= 0) {
+    ::close(m_MasterFd);
+  }
+#endif
+}
+
+void PtySink::Write(std::span<const std::uint8_t> bytes) {
+#if defined(AURELIA_HAS_PTY)
+  if (m_MasterFd < 0) {
+    return;
+  }
+
+  std::size_t written = 0;
+  while (written < bytes.size()) {
+    auto n = ::write(m_MasterFd, bytes.data() + written,
+                     bytes.size() - written);
+    if (n <= 0) {
+      // EAGAIN (no reader draining the slave) or error: drop remainder
+      return;
+    }
+    written += static_cast<std::size_t>(n);
+  }
+#else
+  (void)bytes;
+#endif
+}
+
+} // namespace Aurelia::Peripherals
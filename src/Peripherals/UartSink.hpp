@@ -0,0 +1,192 @@
+/**
+ * UART Host Sinks.
+ *
+ * Pluggable destinations for bytes transmitted by the guest through the
+ * UART DATA register.
+ *
+ * The UartDevice never talks to the host directly. Instead it accumulates
+ * transmitted bytes in a batch buffer and hands complete batches to an
+ * IUartSink. This keeps the per-byte cost of a guest STR to the DATA
+ * register at a single array store, and moves the expensive part (the host
+ * write syscall) to batch boundaries.
+ *
+ * AVAILABLE SINKS:
+ * ┌─────────────┬───────────────────────────────────────────────────┐
+ * │ Sink        │ Destination                                       │
+ * ├─────────────┼───────────────────────────────────────────────────┤
+ * │ StdoutSink  │ std::cout (default console behaviour)             │
+ * │ FileSink    │ Host file (log capture, golden-output comparison) │
+ * │ RingSink    │ Fixed-size in-memory ring (unit tests)            │
+ * │ BufferSink  │ Growable in-memory capture (batch runs)           │
+ * │ PtySink     │ Pseudo-terminal master (screen/minicom attach)    │
+ * └─────────────┴───────────────────────────────────────────────────┘
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Aurelia::Peripherals {
+
+class IUartSink {
+public:
+  virtual ~IUartSink() = default;
+
+  /**
+   * @brief Deliver a batch of transmitted bytes to the host.
+   *
+   * Called by the UART whenever its batch buffer is drained. The span is
+   * only valid for the duration of the call.
+   */
+  virtual void Write(std::span<const std::uint8_t> bytes) = 0;
+
+  /**
+   * @brief Push any sink-internal buffering out to the host.
+   *
+   * Called once after each Write() batch. Sinks without internal
+   * buffering may leave this as a no-op.
+   */
+  virtual void Flush() {}
+};
+
+/**
+ * @brief Console sink writing through std::cout.
+ *
+ * Uses std::cout (rather than the raw file descriptor) so that callers who
+ * redirect std::cout's streambuf, such as tests, still observe the output.
+ */
+class StdoutSink final : public IUartSink {
+public:
+  void Write(std::span<const std::uint8_t> bytes) override;
+  void Flush() override;
+};
+
+/**
+ * @brief Host file sink.
+ *
+ * Opens (truncates) the given path on construction. Writes go through
+ * stdio, so the sink adds no syscalls of its own beyond the batch flush.
+ */
+class FileSink final : public IUartSink {
+public:
+  explicit FileSink(const std::string &path);
+  ~FileSink() override;
+
+  FileSink(const FileSink &) = delete;
+  FileSink &operator=(const FileSink &) = delete;
+
+  [[nodiscard]] bool IsOpen() const { return m_File != nullptr; }
+
+  void Write(std::span<const std::uint8_t> bytes) override;
+  void Flush() override;
+
+private:
+  std::FILE *m_File = nullptr;
+};
+
+/**
+ * @brief Fixed-capacity in-memory ring.
+ *
+ * Retains the most recent `capacity` bytes written. Older bytes are
+ * overwritten once the ring is full. Intended for tests that need to
+ * inspect guest console output without touching the host console.
+ */
+class RingSink final : public IUartSink {
+public:
+  explicit RingSink(std::size_t capacity = 4096);
+
+  void Write(std::span<const std::uint8_t> bytes) override;
+  void Flush() override { m_FlushCount++; }
+
+  /**
+   * @brief Return retained bytes, oldest first.
+   */
+  [[nodiscard]] std::string Contents() const;
+
+  [[nodiscard]] std::size_t GetWriteCount() const { return m_WriteCount; }
+  [[nodiscard]] std::size_t GetFlushCount() const { return m_FlushCount; }
+
+  void Clear();
+
+private:
+  std::vector<std::uint8_t> m_Storage;
+  std::size_t m_Head = 0; // Next write position
+  std::size_t m_Count = 0;
+  std::size_t m_WriteCount = 0;
+  std::size_t m_FlushCount = 0;
+};
+
+/**
+ * @brief Growable in-memory capture.
+ *
+ * Keeps everything the guest transmits, up to `limit` bytes; anything
+ * beyond is counted but dropped, so a runaway guest cannot exhaust host
+ * memory. Used by headless machines whose whole output is compared
+ * against a golden file.
+ */
+class BufferSink final : public IUartSink {
+public:
+  explicit BufferSink(std::size_t limit = 16 * 1024 * 1024) : m_Limit(limit) {}
+
+  void Write(std::span<const std::uint8_t> bytes) override;
+
+  [[nodiscard]] const std::string &Contents() const { return m_Buffer; }
+  [[nodiscard]] std::size_t GetDroppedCount() const { return m_Dropped; }
+
+  void Clear() {
+    m_Buffer.clear();
+    m_Dropped = 0;
+  }
+
+private:
+  std::string m_Buffer;
+  std::size_t m_Limit;
+  std::size_t m_Dropped = 0;
+};
+
+/**
+ * @brief Pseudo-terminal sink.
+ *
+ * Allocates a PTY pair and writes guest output to the master side. A
+ * terminal program attached to GetSlaveName() sees the guest console.
+ *
+ * NOTE (KleaSCM) The master is opened non-blocking. If nobody drains the
+ * slave side and the kernel buffer fills, further output is dropped rather
+ * than stalling the simulation thread, which is what a real UART with no
+ * flow control would do.
+ */
+class PtySink final : public IUartSink {
+public:
+  PtySink();
+  ~PtySink() override;
+
+  PtySink(const PtySink &) = delete;
+  PtySink &operator=(const PtySink &) = delete;
+
+  [[nodiscard]] bool IsOpen() const { return m_MasterFd >= 0; }
+  [[nodiscard]] const std::string &GetSlaveName() const { return m_SlaveName; }
+
+  /**
+   * @brief Master descriptor, for reading what the terminal user types.
+   *
+   * Register it with Host::HostInputPump to give the guest a
+   * bidirectional console. Owned by the sink; do not close.
+   */
+  [[nodiscard]] int GetMasterFd() const { return m_MasterFd; }
+
+  void Write(std::span<const std::uint8_t> bytes) override;
+
+private:
+  int m_MasterFd = -1;
+  std::string m_SlaveName;
+};
+
+} // namespace Aurelia::Peripherals
@@ -9,6 +9,7 @@
 
 #include "Storage/Controller/StorageController.hpp"
 #include "Core/BitManip.hpp"
+#include "Core/Instrument.hpp"
 #include <cstring>
 
 namespace Aurelia::Storage::Controller {
@@ -115,6 +116,7 @@ void StorageController::FetchCommand() {
 }
 
 void StorageController::ExecuteCommand() {
+  AURELIA_INSTRUMENT_SCOPE(NvmeCommand);
   m_HasPendingCmd = false;
   std::uint16_t status = 0; // Success
 
@@ -123,32 +125,24 @@ void StorageController::ExecuteCommand() {
     // Block Size = 4KB. Length = Dword12 + 1 (0-based)
     // For now, support 1 block transfer
     std::vector<Core::Byte> buffer(4096);
-    // DMA Read (Byte by Byte... slow but strict)
-    for (size_t i = 0; i < 4096; ++i) {
-      Core::Data b;
-      // Bus 8-bit read not implemented, assume 32-bit aligned buffer
-      // Just Read word every 4 bytes
-      if (i % 4 == 0) {
-        m_Bus->Read(m_PendingCmd.Prp1 + i, b);
-        std::memcpy(&buffer[i], &b, 4);
-      }
+    // DMA Read: PRP1 → buffer in one bulk transfer
+    if (!m_Bus->ReadBlock(m_PendingCmd.Prp1, buffer)) {
+      status = 0x0004; // Data Transfer Error
+    } else {
+      auto ftlStatus = m_Ftl->Write(m_PendingCmd.Dword10, buffer);
+      if (ftlStatus != Nand::NandStatus::Success)
+        status = 0x0001; // Internal Error
     }
 
-    auto ftlStatus = m_Ftl->Write(m_PendingCmd.Dword10, buffer);
-    if (ftlStatus != Nand::NandStatus::Success)
-      status = 0x0001; // Internal Error
-
   } else if (m_PendingCmd.Opcode == static_cast<Core::Byte>(NvmeOpcode::Read)) {
     std::vector<Core::Byte> buffer(4096);
     auto ftlStatus = m_Ftl->Read(m_PendingCmd.Dword10, buffer);
     if (ftlStatus != Nand::NandStatus::Success)
       status = 0x0281; // Unrecovered Read Error
 
-    // DMA Write Data -> PRP1
-    for (size_t i = 0; i < 4096; i += 4) {
-      Core::Data b;
-      std::memcpy(&b, &buffer[i], 4);
-      m_Bus->Write(m_PendingCmd.Prp1 + i, b);
+    // DMA Write: buffer → PRP1 in one bulk transfer
+    if (!m_Bus->WriteBlock(m_PendingCmd.Prp1, buffer)) {
+      status = 0x0004; // Data Transfer Error
     }
   } else {
     status = 0x0001; // Invalid Command
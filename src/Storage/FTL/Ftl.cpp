@@ -6,6 +6,7 @@
  */
 
 #include "Storage/FTL/Ftl.hpp"
+#include "Core/Instrument.hpp"
 #include <algorithm>
 #include <bit>
 #include <cstring>
@@ -27,7 +28,7 @@ Ftl::Ftl(Nand::NandChip *nand, std::size_t totalBlocks)
 }
 
 void Ftl::ScanAndMount() {
-  std::vector<Core::Byte> buffer(Nand::PageDataSize);
+  // Mounting needs only OOB metadata; page data is never read here
   std::vector<Core::Byte> oob(Nand::OobSize);
 
   m_FreeList.clear();
@@ -42,7 +43,7 @@ void Ftl::ScanAndMount() {
     bool blockIsActive = false;
 
     // Check Page 0 first to determine if block is used
-    if (m_Nand->ReadPage(b, 0, buffer, oob) != Nand::NandStatus::Success) {
+    if (m_Nand->ReadOob(b, 0, oob) != Nand::NandStatus::Success) {
       m_BlockTable[b].State = BlockState::Bad;
       continue;
     }
@@ -56,7 +57,7 @@ void Ftl::ScanAndMount() {
 
       // Scan remaining pages to rebuild full map and find active frontier
       for (std::size_t p = 1; p < 64; ++p) {
-        if (m_Nand->ReadPage(b, p, buffer, oob) != Nand::NandStatus::Success) {
+        if (m_Nand->ReadOob(b, p, oob) != Nand::NandStatus::Success) {
           break; // Stop scanning if read fails (shouldn't happen on valid
                  // block)
         }
@@ -92,8 +93,12 @@ std::size_t Ftl::AllocateNewActiveBlock() {
     if (!GarbageCollect()) {
       return std::numeric_limits<std::size_t>::max();
     }
-    // Check again! GC might have succeeded but consumed the block immediately
-    // (CopyBack)
+    // Copy-back rewrites the victim's valid pages through Write(), which
+    // opens the reclaimed block itself; keep filling it rather than
+    // failing because the free list is empty again.
+    if (m_CurrentActiveBlock != std::numeric_limits<std::size_t>::max()) {
+      return m_CurrentActiveBlock;
+    }
     if (m_FreeList.empty()) {
       return std::numeric_limits<std::size_t>::max();
     }
@@ -112,6 +117,7 @@ std::size_t Ftl::AllocateNewActiveBlock() {
 }
 
 Nand::NandStatus Ftl::Write(Lba lba, std::span<const Core::Byte> data) {
+  AURELIA_INSTRUMENT_SCOPE(FtlWrite);
   if (data.size() != Nand::PageDataSize) {
     return Nand::NandStatus::WriteError;
   }
@@ -143,7 +149,6 @@ Nand::NandStatus Ftl::Write(Lba lba, std::span<const Core::Byte> data) {
     if (m_CurrentActiveBlock == std::numeric_limits<std::size_t>::max()) {
       return Nand::NandStatus::WriteError; // No free blocks (GC required)
     }
-    m_CurrentPageOffset = 0;
   }
 
   // Perform NAND Program
@@ -171,6 +176,7 @@ Nand::NandStatus Ftl::Write(Lba lba, std::span<const Core::Byte> data) {
 }
 
 Nand::NandStatus Ftl::Read(Lba lba, std::span<Core::Byte> buffer) {
+  AURELIA_INSTRUMENT_SCOPE(FtlRead);
   if (!m_MappingTable.contains(lba)) {
     // Unmapped LBA - We fill with 0xFF (erased state simulation)
     std::fill(buffer.begin(), buffer.end(), 0xFF);
@@ -185,6 +191,7 @@ Nand::NandStatus Ftl::Read(Lba lba, std::span<Core::Byte> buffer) {
 }
 
 bool Ftl::GarbageCollect() {
+  AURELIA_INSTRUMENT_SCOPE(FtlGc);
   // 1. Greedy Victim Selection
   // Find the block with the MAXIMUM number of INVALID pages (Least Valid).
   std::size_t victimBlock = std::numeric_limits<std::size_t>::max();
@@ -257,6 +264,7 @@ bool Ftl::GarbageCollect() {
   m_FreeList.push_back(victimBlock);
 
   // 5. Write Back (Resurrect Valid Data)
+  AURELIA_INSTRUMENT_COUNT(FtlGcCopy, validPages.size());
   for (const auto &page : validPages) {
     if (Write(page.LogicalAddr, page.Data) != Nand::NandStatus::Success) {
       return false;
@@ -0,0 +1,187 @@
+/**
+ * LZ Block Codec Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Storage/Image/Lz.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+namespace Aurelia::Storage::Image {
+
+namespace {
+
+constexpr std::size_t MinMatch = 4;
+constexpr std::size_t LastLiterals = 5; // Block always ends in literals
+constexpr std::size_t MatchSearchEnd = 12; // No match may start after this
+constexpr std::size_t MaxOffset = 65535;
+constexpr unsigned HashBits = 12;
+
+std::uint32_t Read32(const Core::Byte *p) {
+  std::uint32_t value;
+  std::memcpy(&value, p, sizeof(value));
+  return value;
+}
+
+std::uint32_t Hash(std::uint32_t sequence) {
+  // Knuth multiplicative hash; top bits are the best mixed
+  return (sequence * 2654435761u) >> (32 - HashBits);
+}
+
+void PutLength(std::vector<Core::Byte> &out, std::size_t length) {
+  for (; length >= 255; length -= 255) {
+    out.push_back(255);
+  }
+  out.push_back(static_cast<Core::Byte>(length));
+}
+
+void EmitSequence(std::vector<Core::Byte> &out,
+                  std::span<const Core::Byte> literals, std::size_t offset,
+                  std::size_t matchLength) {
+  std::size_t lit = literals.size();
+  std::size_t match = matchLength - MinMatch;
+  auto token = static_cast<Core::Byte>(((lit < 15 ? lit : 15) << 4) |
+                                       (match < 15 ? match : 15));
+  out.push_back(token);
+  if (lit >= 15) {
+    PutLength(out, lit - 15);
+  }
+  out.insert(out.end(), literals.begin(), literals.end());
+  out.push_back(static_cast<Core::Byte>(offset));
+  out.push_back(static_cast<Core::Byte>(offset >> 8));
+  if (match >= 15) {
+    PutLength(out, match - 15);
+  }
+}
+
+void EmitLastLiterals(std::vector<Core::Byte> &out,
+                      std::span<const Core::Byte> literals) {
+  std::size_t lit = literals.size();
+  out.push_back(static_cast<Core::Byte>((lit < 15 ? lit : 15) << 4));
+  if (lit >= 15) {
+    PutLength(out, lit - 15);
+  }
+  out.insert(out.end(), literals.begin(), literals.end());
+}
+
+/**
+ * Read an extended length; false if it runs off the end of the input.
+ */
+bool GetLength(std::span<const Core::Byte> in, std::size_t &ip,
+               std::size_t &length) {
+  Core::Byte b;
+  do {
+    if (ip >= in.size()) {
+      return false;
+    }
+    b = in[ip++];
+    length += b;
+  } while (b == 255);
+  return true;
+}
+
+} // namespace
+
+std::size_t LzCompress(std::span<const Core::Byte> in,
+                       std::vector<Core::Byte> &out) {
+  const std::size_t start = out.size();
+  const std::size_t n = in.size();
+  const Core::Byte *src = in.data();
+  std::size_t anchor = 0;
+
+  if (n > MatchSearchEnd) {
+    // Positions are stored +1 so that 0 means "empty slot"
+    std::array<std::uint32_t, 1u << HashBits> table{};
+    const std::size_t matchLimit = n - LastLiterals;
+    std::size_t ip = 0;
+
+    while (ip < n - MatchSearchEnd) {
+      std::uint32_t sequence = Read32(src + ip);
+      std::uint32_t &slot = table[Hash(sequence)];
+      std::size_t candidate = slot;
+      slot = static_cast<std::uint32_t>(ip + 1);
+
+      if (candidate == 0 || ip - (candidate - 1) > MaxOffset ||
+          Read32(src + candidate - 1) != sequence) {
+        ++ip;
+        continue;
+      }
+
+      std::size_t ref = candidate - 1;
+      std::size_t length = MinMatch;
+      while (ip + length < matchLimit &&
+             src[ref + length] == src[ip + length]) {
+        ++length;
+      }
+
+      EmitSequence(out, in.subspan(anchor, ip - anchor), ip - ref, length);
+      ip += length;
+      anchor = ip;
+    }
+  }
+
+  EmitLastLiterals(out, in.subspan(anchor));
+  return out.size() - start;
+}
+
+bool LzDecompress(std::span<const Core::Byte> in, std::span<Core::Byte> out) {
+  std::size_t ip = 0;
+  std::size_t op = 0;
+
+  while (ip < in.size()) {
+    Core::Byte token = in[ip++];
+
+    std::size_t lit = token >> 4;
+    if (lit == 15 && !GetLength(in, ip, lit)) {
+      return false;
+    }
+    if (lit > in.size() - ip || lit > out.size() - op) {
+      return false;
+    }
+    std::memcpy(out.data() + op, in.data() + ip, lit);
+    ip += lit;
+    op += lit;
+
+    if (ip == in.size()) {
+      break; // Final literal-only sequence
+    }
+
+    if (in.size() - ip < 2) {
+      return false;
+    }
+    std::size_t offset = static_cast<std::size_t>(in[ip]) |
+                         (static_cast<std::size_t>(in[ip + 1]) << 8);
+    ip += 2;
+    if (offset == 0 || offset > op) {
+      return false;
+    }
+
+    std::size_t match = token & 0x0F;
+    if (match == 15 && !GetLength(in, ip, match)) {
+      return false;
+    }
+    match += MinMatch;
+    if (match > out.size() - op) {
+      return false;
+    }
+
+    Core::Byte *dst = out.data() + op;
+    const Core::Byte *ref = dst - offset;
+    if (offset >= match) {
+      std::memcpy(dst, ref, match);
+    } else {
+      // Overlapping copy replicates the last `offset` bytes
+      for (std::size_t i = 0; i < match; ++i) {
+        dst[i] = ref[i];
+      }
+    }
+    op += match;
+  }
+
+  return op == out.size();
+}
+
+} // namespace Aurelia::Storage::Image
@@ -0,0 +1,61 @@
+/**
+ * LZ Block Codec.
+ *
+ * Byte-oriented LZ77 compression in the LZ4 block format, implemented in
+ * tree so images need no external library. Chosen for decode speed: a
+ * 4 KB page decodes in well under a microsecond, which keeps on-demand
+ * page faults cheap.
+ *
+ * BLOCK FORMAT (a sequence of sequences):
+ * ┌───────────────┬────────────────────────────────────────────────────┐
+ * │ Field         │ Encoding                                           │
+ * ├───────────────┼────────────────────────────────────────────────────┤
+ * │ Token         │ High nibble literal length, low nibble match - 4   │
+ * │ Literal ext.  │ If nibble is 15: bytes of 255... then remainder    │
+ * │ Literals      │ Raw bytes                                          │
+ * │ Offset        │ 16-bit little-endian distance back (1..65535)      │
+ * │ Match ext.    │ As literal extension                               │
+ * └───────────────┴────────────────────────────────────────────────────┘
+ * The final sequence is literals only (no offset). Matches may overlap
+ * their own output, so a run of one byte is a 1-byte literal plus a
+ * match at offset 1.
+ *
+ * The compressor is greedy with a single-probe hash table: fast rather
+ * than maximal. The decompressor checks every length and offset against
+ * both buffers, so corrupt input is rejected, never overruns.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Core/Types.hpp"
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Aurelia::Storage::Image {
+
+/**
+ * @brief Worst-case compressed size for `inputSize` bytes.
+ */
+[[nodiscard]] constexpr std::size_t LzCompressBound(std::size_t inputSize) {
+  return inputSize + inputSize / 255 + 16;
+}
+
+/**
+ * @brief Compress `in`, appending the block to `out`.
+ * @return Number of bytes appended
+ */
+std::size_t LzCompress(std::span<const Core::Byte> in,
+                       std::vector<Core::Byte> &out);
+
+/**
+ * @brief Decompress a block that must expand to exactly `out.size()`.
+ * @return false if `in` is malformed or does not fill `out` exactly
+ */
+[[nodiscard]] bool LzDecompress(std::span<const Core::Byte> in,
+                                std::span<Core::Byte> out);
+
+} // namespace Aurelia::Storage::Image
@@ -0,0 +1,234 @@
+/**
+ * Compressed Page Image Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Storage/Image/PageImage.hpp"
+#include "Storage/Image/Lz.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace Aurelia::Storage::Image {
+
+namespace {
+
+template <typename T> void Store(std::vector<Core::Byte> &out, T value) {
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    out.push_back(static_cast<Core::Byte>(
+        static_cast<std::uint64_t>(value) >> (8 * i)));
+  }
+}
+
+template <typename T> T Load(const Core::Byte *p) {
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    value |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+  }
+  return static_cast<T>(value);
+}
+
+} // namespace
+
+// ============================================================================
+// Writer
+// ============================================================================
+
+PageImageWriter::PageImageWriter(std::size_t pageSize, PageLayout layout)
+    : m_PageSize(pageSize), m_Layout(layout) {}
+
+void PageImageWriter::AddPage(std::span<const Core::Byte> page) {
+  Entry entry{m_Payload.size(), 0, PageEncoding::Fill, 0};
+  m_LogicalSize += page.size();
+
+  if (!page.empty() &&
+      std::all_of(page.begin(), page.end(),
+                  [first = page[0]](Core::Byte b) { return b == first; })) {
+    entry.Fill = page[0];
+    m_Index.push_back(entry);
+    return;
+  }
+
+  std::size_t stored = LzCompress(page, m_Payload);
+  if (stored >= page.size()) {
+    // Incompressible: keep it verbatim so decoding is a plain copy
+    m_Payload.resize(entry.Offset);
+    m_Payload.insert(m_Payload.end(), page.begin(), page.end());
+    stored = page.size();
+    entry.Encoding = PageEncoding::Raw;
+  } else {
+    entry.Encoding = PageEncoding::Lz;
+  }
+  entry.Size = static_cast<std::uint32_t>(stored);
+  m_Index.push_back(entry);
+}
+
+std::vector<Core::Byte> PageImageWriter::Finish() const {
+  std::size_t payloadBase =
+      PageImage::HeaderSize + PageImage::IndexEntrySize * m_Index.size();
+
+  std::vector<Core::Byte> out;
+  out.reserve(payloadBase + m_Payload.size());
+
+  Store<std::uint32_t>(out, PageImage::Magic);
+  Store<std::uint16_t>(out, PageImage::Version);
+  Store<std::uint16_t>(out, static_cast<std::uint16_t>(m_Layout));
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(m_PageSize));
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(m_Index.size()));
+  Store<std::uint64_t>(out, m_LogicalSize);
+  Store<std::uint64_t>(out, 0);
+
+  for (const Entry &entry : m_Index) {
+    Store<std::uint64_t>(out, payloadBase + entry.Offset);
+    Store<std::uint32_t>(out, entry.Size);
+    Store<std::uint8_t>(out, static_cast<std::uint8_t>(entry.Encoding));
+    Store<std::uint8_t>(out, entry.Fill);
+    Store<std::uint16_t>(out, 0);
+  }
+
+  out.insert(out.end(), m_Payload.begin(), m_Payload.end());
+  return out;
+}
+
+std::vector<Core::Byte>
+PageImageWriter::Pack(std::span<const Core::Byte> raw, std::size_t pageSize) {
+  PageImageWriter writer(pageSize, PageLayout::Flat);
+  for (std::size_t offset = 0; offset < raw.size(); offset += pageSize) {
+    writer.AddPage(
+        raw.subspan(offset, std::min(pageSize, raw.size() - offset)));
+  }
+  return writer.Finish();
+}
+
+// ============================================================================
+// Reader
+// ============================================================================
+
+bool PageImage::Open(const std::string &filename, std::string &error) {
+  // Pages are faulted in wherever the guest happens to touch
+  if (!m_File.Open(filename, Host::MappedFileHint::Random)) {
+    error = "Cannot open image: " + filename;
+    return false;
+  }
+  return Attach(m_File.Bytes(), error);
+}
+
+bool PageImage::HasMagic(std::span<const Core::Byte> file) {
+  return file.size() >= 4 && Load<std::uint32_t>(file.data()) == Magic;
+}
+
+bool PageImage::Attach(std::span<const Core::Byte> file, std::string &error) {
+  m_Bytes = {};
+  m_PageCount = 0;
+
+  if (file.size() < HeaderSize || !HasMagic(file)) {
+    error = "Not a page image";
+    return false;
+  }
+  if (Load<std::uint16_t>(file.data() + 4) != Version) {
+    error = "Unsupported page image version";
+    return false;
+  }
+
+  auto layout = Load<std::uint16_t>(file.data() + 6);
+  std::size_t pageSize = Load<std::uint32_t>(file.data() + 8);
+  std::size_t pageCount = Load<std::uint32_t>(file.data() + 12);
+  std::uint64_t logicalSize = Load<std::uint64_t>(file.data() + 16);
+
+  if (layout > static_cast<std::uint16_t>(PageLayout::NandBlocks)) {
+    error = "Unknown page image layout";
+    return false;
+  }
+  // Only the last page may be short, and it may not be empty
+  if (pageSize == 0 || logicalSize > std::uint64_t{pageSize} * pageCount ||
+      (pageCount != 0 &&
+       logicalSize <= std::uint64_t{pageSize} * (pageCount - 1))) {
+    error = "Page image geometry does not match its size";
+    return false;
+  }
+  if (pageCount > (file.size() - HeaderSize) / IndexEntrySize) {
+    error = "Truncated page index";
+    return false;
+  }
+
+  // Check every entry now so page faults never have to
+  for (std::size_t i = 0; i < pageCount; ++i) {
+    const Core::Byte *entry = file.data() + HeaderSize + IndexEntrySize * i;
+    std::uint64_t offset = Load<std::uint64_t>(entry);
+    std::size_t size = Load<std::uint32_t>(entry + 8);
+    std::uint8_t encoding = entry[12];
+    std::size_t bytes =
+        i + 1 < pageCount
+            ? pageSize
+            : static_cast<std::size_t>(logicalSize - pageSize * i);
+
+    bool valid = offset <= file.size() && size <= file.size() - offset;
+    switch (static_cast<PageEncoding>(encoding)) {
+    case PageEncoding::Fill:
+      valid = valid && size == 0;
+      break;
+    case PageEncoding::Raw:
+      valid = valid && size == bytes;
+      break;
+    case PageEncoding::Lz:
+      valid = valid && size != 0;
+      break;
+    default:
+      valid = false;
+      break;
+    }
+    if (!valid) {
+      error = "Bad page index entry " + std::to_string(i);
+      return false;
+    }
+  }
+
+  m_Bytes = file;
+  m_Layout = static_cast<PageLayout>(layout);
+  m_PageSize = pageSize;
+  m_PageCount = pageCount;
+  m_LogicalSize = logicalSize;
+  return true;
+}
+
+std::size_t PageImage::GetPageBytes(std::size_t index) const {
+  if (index >= m_PageCount) {
+    return 0;
+  }
+  return index + 1 < m_PageCount
+             ? m_PageSize
+             : static_cast<std::size_t>(m_LogicalSize - m_PageSize * index);
+}
+
+PageEncoding PageImage::GetEncoding(std::size_t index) const {
+  return static_cast<PageEncoding>(
+      m_Bytes[HeaderSize + IndexEntrySize * index + 12]);
+}
+
+bool PageImage::ReadPage(std::size_t index, std::span<Core::Byte> out) const {
+  std::size_t bytes = GetPageBytes(index);
+  if (index >= m_PageCount || out.size() < bytes) {
+    return false;
+  }
+  out = out.first(bytes);
+
+  const Core::Byte *entry =
+      m_Bytes.data() + HeaderSize + IndexEntrySize * index;
+  auto offset = static_cast<std::size_t>(Load<std::uint64_t>(entry));
+  std::size_t size = Load<std::uint32_t>(entry + 8);
+
+  switch (static_cast<PageEncoding>(entry[12])) {
+  case PageEncoding::Fill:
+    std::memset(out.data(), entry[13], bytes);
+    return true;
+  case PageEncoding::Raw:
+    std::memcpy(out.data(), m_Bytes.data() + offset, bytes);
+    return true;
+  case PageEncoding::Lz:
+    return LzDecompress(m_Bytes.subspan(offset, size), out);
+  }
+  return false;
+}
+
+} // namespace Aurelia::Storage::Image
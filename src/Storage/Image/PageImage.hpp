@@ -0,0 +1,163 @@
+/**
+ * Compressed Page Image (API).
+ *
+ * Container for RAM and NAND images stored as independently compressed
+ * fixed-size pages behind an index. Any page can be decoded on its own,
+ * so a device backed by an image decodes a page the first time the guest
+ * touches it; a cold start reads and decodes only the working set.
+ *
+ * FILE LAYOUT (little-endian):
+ * ┌─────────────────────┬──────────────────────────────────────────────┐
+ * │ Part                │ Contents                                     │
+ * ├─────────────────────┼──────────────────────────────────────────────┤
+ * │ Header (32 B)       │ Magic, version, layout, geometry             │
+ * │ Page index          │ PageCount × 16 B                             │
+ * │ Payload             │ Stored page bytes, in index order            │
+ * └─────────────────────┴──────────────────────────────────────────────┘
+ *
+ * HEADER:                              INDEX ENTRY:
+ * ┌────────┬──────┬──────────────────┐ ┌────────┬──────┬──────────────┐
+ * │ 0x00   │ 4    │ Magic "API1"     │ │ 0x00   │ 8    │ Offset       │
+ * │ 0x04   │ 2    │ Version (1)      │ │ 0x08   │ 4    │ Stored size  │
+ * │ 0x06   │ 2    │ Layout           │ │ 0x0C   │ 1    │ Encoding     │
+ * │ 0x08   │ 4    │ PageSize         │ │ 0x0D   │ 1    │ Fill byte    │
+ * │ 0x0C   │ 4    │ PageCount        │ │ 0x0E   │ 2    │ Reserved (0) │
+ * │ 0x10   │ 8    │ LogicalSize      │ └────────┴──────┴──────────────┘
+ * │ 0x18   │ 8    │ Reserved (0)     │
+ * └────────┴──────┴──────────────────┘
+ *
+ * PAGE ENCODINGS:
+ * ┌──────────┬─────────────────────────────────────────────────────────┐
+ * │ Encoding │ Stored as                                               │
+ * ├──────────┼─────────────────────────────────────────────────────────┤
+ * │ Fill     │ Nothing: every byte equals Fill byte (zero RAM, erased  │
+ * │          │ NAND)                                                   │
+ * │ Raw      │ The page itself, when compression would not shrink it  │
+ * │ Lz       │ One LZ block (Storage/Image/Lz.hpp)                     │
+ * └──────────┴─────────────────────────────────────────────────────────┘
+ * Every page is PageSize bytes except the last, which holds the
+ * remainder of LogicalSize.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Core/Types.hpp"
+#include "Host/MappedFile.hpp"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Aurelia::Storage::Image {
+
+/**
+ * What the pages represent, so a device can refuse a foreign image.
+ */
+enum class PageLayout : std::uint16_t {
+  Flat = 0,      // Byte image: page i covers [i × PageSize, ...)
+  NandBlocks = 1 // Per block: one page of packed OOB, then the data pages
+};
+
+enum class PageEncoding : std::uint8_t { Fill = 0, Raw = 1, Lz = 2 };
+
+/**
+ * Builds an image one page at a time.
+ */
+class PageImageWriter {
+public:
+  PageImageWriter(std::size_t pageSize, PageLayout layout);
+
+  /**
+   * @brief Append the next page; only the last may be short.
+   */
+  void AddPage(std::span<const Core::Byte> page);
+
+  /**
+   * @brief Encode the header, index and payload as a file.
+   */
+  [[nodiscard]] std::vector<Core::Byte> Finish() const;
+
+  /**
+   * @brief Compress a whole flat byte image.
+   */
+  [[nodiscard]] static std::vector<Core::Byte>
+  Pack(std::span<const Core::Byte> raw, std::size_t pageSize);
+
+private:
+  struct Entry {
+    std::uint64_t Offset;
+    std::uint32_t Size;
+    PageEncoding Encoding;
+    Core::Byte Fill;
+  };
+
+  std::size_t m_PageSize;
+  PageLayout m_Layout;
+  std::uint64_t m_LogicalSize = 0;
+  std::vector<Entry> m_Index;
+  std::vector<Core::Byte> m_Payload;
+};
+
+/**
+ * Read side: validates an image once, then decodes pages on request.
+ *
+ * Owns the mapping when opened from a file; Attach() views a caller's
+ * buffer instead, which must outlive the PageImage.
+ */
+class PageImage {
+public:
+  static constexpr std::uint32_t Magic = 0x31495041; // "API1"
+  static constexpr std::uint16_t Version = 1;
+  static constexpr std::size_t HeaderSize = 32;
+  static constexpr std::size_t IndexEntrySize = 16;
+
+  PageImage() = default;
+  PageImage(const PageImage &) = delete;
+  PageImage &operator=(const PageImage &) = delete;
+
+  /**
+   * @brief Map and validate an image file.
+   * @param error Set to a description on failure
+   */
+  bool Open(const std::string &filename, std::string &error);
+
+  /**
+   * @brief Validate an image held in memory (not copied).
+   */
+  bool Attach(std::span<const Core::Byte> file, std::string &error);
+
+  [[nodiscard]] static bool HasMagic(std::span<const Core::Byte> file);
+
+  [[nodiscard]] PageLayout GetLayout() const { return m_Layout; }
+  [[nodiscard]] std::size_t GetPageSize() const { return m_PageSize; }
+  [[nodiscard]] std::size_t GetPageCount() const { return m_PageCount; }
+  [[nodiscard]] std::uint64_t GetLogicalSize() const { return m_LogicalSize; }
+  [[nodiscard]] std::size_t GetFileSize() const { return m_Bytes.size(); }
+
+  /**
+   * @brief Decoded size of page `index` (PageSize, or less for the last).
+   */
+  [[nodiscard]] std::size_t GetPageBytes(std::size_t index) const;
+
+  [[nodiscard]] PageEncoding GetEncoding(std::size_t index) const;
+
+  /**
+   * @brief Decode page `index` into the first GetPageBytes() of `out`.
+   * @return false if the index is out of range, `out` is too small, or
+   *         the stored page is corrupt
+   */
+  bool ReadPage(std::size_t index, std::span<Core::Byte> out) const;
+
+private:
+  Host::MappedFile m_File;
+  std::span<const Core::Byte> m_Bytes;
+  PageLayout m_Layout = PageLayout::Flat;
+  std::size_t m_PageSize = 0;
+  std::size_t m_PageCount = 0;
+  std::uint64_t m_LogicalSize = 0;
+};
+
+} // namespace Aurelia::Storage::Image
@@ -9,11 +9,29 @@
 
 #include "Storage/Nand/NandChip.hpp"
 #include <algorithm>
+#include <bit>
 #include <cstring>
 
 namespace Aurelia::Storage::Nand {
 
-NandChip::NandChip(std::size_t numBlocks) { m_Blocks.resize(numBlocks); }
+// NOTE (KleaSCM) A block's OOB areas pack exactly into one image page.
+static_assert(PagesPerBlock * OobSize == PageDataSize);
+static_assert(PagesPerBlock == 64, "Pending masks are one word per block");
+
+NandChip::NandChip(std::size_t numBlocks) {
+  m_Blocks.resize(numBlocks);
+  m_PendingPages.assign(numBlocks, 0);
+}
+
+bool NandChip::FaultIn(std::size_t blockIdx, std::size_t pageIdx) {
+  std::uint64_t bit = std::uint64_t{1} << pageIdx;
+  if (!(m_PendingPages[blockIdx] & bit)) {
+    return true;
+  }
+  m_PendingPages[blockIdx] &= ~bit;
+  return m_Image->ReadPage(blockIdx * ImagePagesPerBlock + 1 + pageIdx,
+                           m_Blocks[blockIdx].Pages[pageIdx].Data);
+}
 
 NandStatus NandChip::ReadPage(std::size_t blockIdx, std::size_t pageIdx,
                               std::span<Core::Byte> buffer,
@@ -26,6 +44,10 @@ NandStatus NandChip::ReadPage(std::size_t blockIdx, std::size_t pageIdx,
     return NandStatus::InvalidAddress; // Buffer too small
   }
 
+  if (!FaultIn(blockIdx, pageIdx)) {
+    return NandStatus::EccError;
+  }
+
   const auto &page = m_Blocks[blockIdx].Pages[pageIdx];
   std::copy(page.Data.begin(), page.Data.end(), buffer.begin());
 
@@ -46,6 +68,11 @@ NandStatus NandChip::ProgramPage(std::size_t blockIdx, std::size_t pageIdx,
     return NandStatus::InvalidAddress;
   }
 
+  // NOTE (KleaSCM) Programming ANDs into the current contents.
+  if (!FaultIn(blockIdx, pageIdx)) {
+    return NandStatus::EccError;
+  }
+
   auto &page = m_Blocks[blockIdx].Pages[pageIdx];
 
   // NOTE (KleaSCM) Physics Verification (Data Area)
@@ -85,9 +112,88 @@ NandStatus NandChip::EraseBlock(std::size_t blockIdx) {
   }
 
   m_Blocks[blockIdx].Erase();
+  m_PendingPages[blockIdx] = 0; // Snapshot contents are gone: no decode
+  return NandStatus::Success;
+}
+
+NandStatus NandChip::ReadOob(std::size_t blockIdx, std::size_t pageIdx,
+                             std::span<Core::Byte> oobBuffer) {
+  if (blockIdx >= m_Blocks.size() || pageIdx >= PagesPerBlock ||
+      oobBuffer.size() < OobSize) {
+    return NandStatus::InvalidAddress;
+  }
+
+  const auto &oob = m_Blocks[blockIdx].Pages[pageIdx].Oob;
+  std::copy(oob.begin(), oob.end(), oobBuffer.begin());
   return NandStatus::Success;
 }
 
 std::size_t NandChip::GetBlockCount() const { return m_Blocks.size(); }
 
+bool NandChip::AttachImage(const Image::PageImage *image) {
+  if (!image || image->GetLayout() != Image::PageLayout::NandBlocks ||
+      image->GetPageSize() != PageDataSize ||
+      image->GetLogicalSize() !=
+          std::uint64_t{PageDataSize} * ImagePagesPerBlock * m_Blocks.size()) {
+    return false;
+  }
+
+  // NOTE (KleaSCM) Decode every OOB page before touching the array, so a
+  // corrupt snapshot leaves the chip as it was.
+  std::vector<Core::Byte> oob(PageDataSize * m_Blocks.size());
+  for (std::size_t b = 0; b < m_Blocks.size(); ++b) {
+    std::span<Core::Byte> packed(oob.data() + b * PageDataSize, PageDataSize);
+    if (!image->ReadPage(b * ImagePagesPerBlock, packed)) {
+      return false;
+    }
+  }
+
+  for (std::size_t b = 0; b < m_Blocks.size(); ++b) {
+    for (std::size_t p = 0; p < PagesPerBlock; ++p) {
+      auto src = oob.begin() +
+                 static_cast<std::ptrdiff_t>(b * PageDataSize + p * OobSize);
+      std::copy(src, src + OobSize, m_Blocks[b].Pages[p].Oob.begin());
+    }
+  }
+  m_PendingPages.assign(m_Blocks.size(), ~std::uint64_t{0});
+  m_Image = image;
+  return true;
+}
+
+std::vector<Core::Byte> NandChip::ExportImage() const {
+  Image::PageImageWriter writer(PageDataSize, Image::PageLayout::NandBlocks);
+  std::vector<Core::Byte> packed(PageDataSize);
+  std::vector<Core::Byte> pending(PageDataSize);
+
+  for (std::size_t b = 0; b < m_Blocks.size(); ++b) {
+    const Block &block = m_Blocks[b];
+    for (std::size_t p = 0; p < PagesPerBlock; ++p) {
+      std::copy(block.Pages[p].Oob.begin(), block.Pages[p].Oob.end(),
+                packed.begin() + static_cast<std::ptrdiff_t>(p * OobSize));
+    }
+    writer.AddPage(packed);
+
+    for (std::size_t p = 0; p < PagesPerBlock; ++p) {
+      // Still-compressed pages are decoded into scratch, not materialised
+      if (m_PendingPages[b] & (std::uint64_t{1} << p)) {
+        if (!m_Image->ReadPage(b * ImagePagesPerBlock + 1 + p, pending)) {
+          std::fill(pending.begin(), pending.end(), Core::Byte{0xFF});
+        }
+        writer.AddPage(pending);
+      } else {
+        writer.AddPage(block.Pages[p].Data);
+      }
+    }
+  }
+  return writer.Finish();
+}
+
+std::size_t NandChip::GetPendingImagePages() const {
+  std::size_t count = 0;
+  for (std::uint64_t mask : m_PendingPages) {
+    count += static_cast<std::size_t>(std::popcount(mask));
+  }
+  return count;
+}
+
 } // namespace Aurelia::Storage::Nand
@@ -4,13 +4,31 @@
  * Manages the array of Blocks and enforces Program/Erase constraints.
  * Supports Data and OOB (Spare) area access.
  *
+ * SNAPSHOTS:
+ * ExportImage() saves the array as a compressed page image
+ * (Storage/Image/PageImage.hpp, NandBlocks layout) and AttachImage()
+ * restores one lazily. Per block the image holds one page of packed OOB
+ * areas followed by the 64 data pages:
+ * ┌──────────────────┬───────────────────────────────────────────────┐
+ * │ Image page       │ Contents                                      │
+ * ├──────────────────┼───────────────────────────────────────────────┤
+ * │ b × 65           │ OOB of pages 0..63 of block b (64 × 64 B)     │
+ * │ b × 65 + 1 + p   │ Data of page p of block b                     │
+ * └──────────────────┴───────────────────────────────────────────────┘
+ * OOB pages are decoded at attach time, which is all the FTL needs to
+ * mount (ReadOob); data pages are decoded on their first read or
+ * program, and an erase discards a block's pending pages undecoded.
+ * Erase counts and bad-block marks are not part of the snapshot.
+ *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
  */
 
 #pragma once
 
+#include "Storage/Image/PageImage.hpp"
 #include "Storage/Nand/NandDefs.hpp"
+#include <cstdint>
 #include <span>
 #include <vector>
 
@@ -33,12 +51,41 @@ public:
               std::span<const Core::Byte> data,
               std::span<const Core::Byte> oobData = {});
 
+  // NOTE (KleaSCM) Reads only the OOB area; never touches page data.
+  [[nodiscard]] NandStatus ReadOob(std::size_t blockIdx, std::size_t pageIdx,
+                                   std::span<Core::Byte> oobBuffer);
+
   [[nodiscard]] NandStatus EraseBlock(std::size_t blockIdx);
 
   [[nodiscard]] std::size_t GetBlockCount() const;
 
+  /**
+   * @brief Restore a snapshot; data pages decode on first access.
+   *
+   * The image must outlive the chip or the next AttachImage().
+   *
+   * @return false (chip unchanged) unless the image is a NandBlocks
+   *         snapshot of exactly this many blocks with readable OOB pages
+   */
+  bool AttachImage(const Image::PageImage *image);
+
+  /**
+   * @brief Save the whole array as a compressed NandBlocks image.
+   */
+  [[nodiscard]] std::vector<Core::Byte> ExportImage() const;
+
+  [[nodiscard]] std::size_t GetPendingImagePages() const;
+
 private:
+  static constexpr std::size_t ImagePagesPerBlock = PagesPerBlock + 1;
+
   std::vector<Block> m_Blocks;
+
+  // Snapshot pages not yet decoded: one bit per page, one word per block
+  const Image::PageImage *m_Image = nullptr;
+  std::vector<std::uint64_t> m_PendingPages;
+
+  [[nodiscard]] bool FaultIn(std::size_t blockIdx, std::size_t pageIdx);
 };
 
 } // namespace Aurelia::Storage::Nand
@@ -53,7 +53,8 @@ struct Block {
 enum class NandStatus {
   Success,
   WriteError, // Tried to flip 0 -> 1 without erase
-  InvalidAddress
+  InvalidAddress,
+  EccError // Page could not be recovered (corrupt image page)
 };
 
 } // namespace Aurelia::Storage::Nand
@@ -0,0 +1,568 @@
+/**
+ * Virtio Block Device Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Storage/Virtio/VirtioBlockDevice.hpp"
+#include "System/MemoryMap.hpp"
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AURELIA_HAS_PREAD 1
+#endif
+
+namespace Aurelia::Storage::Virtio {
+
+namespace {
+
+constexpr char DeviceIdString[] = "aurelia-vblk";
+constexpr std::size_t DeviceIdLength = 20; // virtio-blk GET_ID size
+
+/**
+ * @brief Replace the low or high 32 bits of a 64-bit ring address.
+ */
+void SetHalf(Core::Address &reg, Core::Data value, bool high) {
+  auto half = static_cast<std::uint32_t>(value);
+  if (high) {
+    reg = (reg & 0xFFFFFFFFull) | (static_cast<Core::Address>(half) << 32);
+  } else {
+    reg = (reg & ~0xFFFFFFFFull) | half;
+  }
+}
+
+} // namespace
+
+VirtioBlockDevice::VirtioBlockDevice() : m_BaseAddr(System::VirtioBlockBase) {
+  m_FreeSlots.reserve(QueueNumMax);
+  for (std::uint16_t i = QueueNumMax; i-- > 0;) {
+    m_FreeSlots.push_back(i);
+  }
+}
+
+VirtioBlockDevice::~VirtioBlockDevice() {
+  // The host may still be writing into request buffers
+  for (Request &req : m_Requests) {
+    req.Orphaned = req.Active;
+  }
+  while (m_HostPending != 0) {
+    m_Aio->Wait();
+    HarvestHostIo();
+  }
+
+#if defined(AURELIA_HAS_PREAD)
+  if (m_Fd >= 0) {
+    ::close(m_Fd);
+  }
+#endif
+}
+
+bool VirtioBlockDevice::OpenImage(const std::string &path, bool readOnly) {
+#if defined(AURELIA_HAS_PREAD)
+  int fd = ::open(path.c_str(), (readOnly ? O_RDONLY : O_RDWR) | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    return false;
+  }
+
+  if (m_Fd >= 0) {
+    ::close(m_Fd);
+  }
+  m_Fd = fd;
+  m_ReadOnly = readOnly;
+  m_CapacitySectors = static_cast<std::uint64_t>(st.st_size) / SectorSize;
+  return true;
+#else
+  (void)path;
+  (void)readOnly;
+  return false;
+#endif
+}
+
+bool VirtioBlockDevice::IsAddressInRange(Core::Address addr) const {
+  return addr >= m_BaseAddr && addr < m_BaseAddr + RegisterBlockSize;
+}
+
+bool VirtioBlockDevice::OnRead(Core::Address addr, Core::Data &outData) {
+  switch (addr - m_BaseAddr) {
+  case MagicOffset:
+    outData = MagicValue;
+    return true;
+  case VersionOffset:
+    outData = 2;
+    return true;
+  case DeviceIdOffset:
+    outData = BlockDeviceId;
+    return true;
+  case VendorIdOffset:
+    outData = VendorValue;
+    return true;
+  case DeviceFeaturesOffset:
+    outData = FeatureFlush | (m_ReadOnly ? FeatureReadOnly : 0u);
+    return true;
+  case QueueNumMaxOffset:
+    outData = QueueNumMax;
+    return true;
+  case QueueNumOffset:
+    outData = m_QueueNum;
+    return true;
+  case QueueReadyOffset:
+    outData = m_QueueReady ? 1u : 0u;
+    return true;
+  case InterruptStatusOffset:
+    outData = m_InterruptStatus;
+    return true;
+  case StatusOffset:
+    outData = m_Status;
+    return true;
+  case CapacityOffset:
+    outData = m_CapacitySectors;
+    return true;
+  default:
+    outData = 0;
+    return true;
+  }
+}
+
+bool VirtioBlockDevice::OnWrite(Core::Address addr, Core::Data inData) {
+  auto value = static_cast<std::uint32_t>(inData);
+
+  switch (addr - m_BaseAddr) {
+  case QueueNumOffset:
+    // Power-of-two sizes only, so ring indices wrap with a mask
+    if (value != 0 && value <= QueueNumMax && (value & (value - 1)) == 0) {
+      m_QueueNum = value;
+    }
+    return true;
+
+  case QueueReadyOffset:
+    m_QueueReady = (value & 1) != 0 && m_QueueNum != 0;
+    return true;
+
+  case QueueNotifyOffset:
+    m_Notified = true;
+    return true;
+
+  case InterruptAckOffset:
+    m_InterruptStatus &= ~value;
+    return true;
+
+  case StatusOffset:
+    if (value == 0) {
+      Reset();
+    } else {
+      m_Status = value;
+    }
+    return true;
+
+  case QueueDescLowOffset:
+  case QueueDescHighOffset:
+    SetHalf(m_DescTable, inData,
+            addr - m_BaseAddr == QueueDescHighOffset);
+    return true;
+
+  case QueueDriverLowOffset:
+  case QueueDriverHighOffset:
+    SetHalf(m_AvailRing, inData,
+            addr - m_BaseAddr == QueueDriverHighOffset);
+    return true;
+
+  case QueueDeviceLowOffset:
+  case QueueDeviceHighOffset:
+    SetHalf(m_UsedRing, inData,
+            addr - m_BaseAddr == QueueDeviceHighOffset);
+    return true;
+
+  default:
+    return true; // DRIVER_FEATURES and read-only registers
+  }
+}
+
+void VirtioBlockDevice::Reset() {
+  /**
+   * Requests still waiting on the host keep their slot (and buffer) until
+   * the host is done with it; everything else is dropped.
+   */
+  for (std::size_t i = 0; i < m_Requests.size(); ++i) {
+    Request &req = m_Requests[i];
+    if (req.Active && !req.HostDone) {
+      req.Orphaned = true;
+    } else if (req.Active) {
+      ReleaseSlot(static_cast<std::uint16_t>(i));
+    }
+  }
+  m_Events.Clear();
+
+  m_Status = 0;
+  m_InterruptStatus = 0;
+  m_QueueNum = 0;
+  m_QueueReady = false;
+  m_DescTable = 0;
+  m_AvailRing = 0;
+  m_UsedRing = 0;
+  m_LastAvail = 0;
+  m_UsedIdx = 0;
+  m_Notified = false;
+}
+
+void VirtioBlockDevice::OnTick() {
+  ++m_Now;
+
+  if (m_Notified) {
+    m_Notified = false;
+    if (m_QueueReady && m_Bus) {
+      ProcessQueue();
+    }
+  }
+
+  if (m_HostPending != 0) {
+    HarvestHostIo();
+  }
+
+  Core::EventQueue::Event ev;
+  while (m_Events.PopDue(m_Now, ev)) {
+    OnDeadline(static_cast<std::uint16_t>(ev.Payload));
+  }
+}
+
+void VirtioBlockDevice::ProcessQueue() {
+  std::uint16_t availIdx = 0;
+  if (!ReadU16(m_AvailRing + 2, availIdx)) {
+    return;
+  }
+
+  const std::uint16_t mask = static_cast<std::uint16_t>(m_QueueNum - 1);
+  while (m_LastAvail != availIdx) {
+    if (m_FreeSlots.empty() || (m_Aio && !m_Aio->HasCapacity())) {
+      m_Notified = true; // Out of slots: pick up the rest next tick
+      break;
+    }
+
+    std::uint16_t head = 0;
+    Core::Address entry = m_AvailRing + 4 + 2u * (m_LastAvail & mask);
+    if (!ReadU16(entry, head)) {
+      break;
+    }
+    m_LastAvail++;
+
+    std::uint16_t slot = m_FreeSlots.back();
+    m_FreeSlots.pop_back();
+    BeginRequest(slot, head);
+  }
+
+  if (m_Aio) {
+    m_Aio->Kick(); // One submission for the whole batch
+  }
+}
+
+void VirtioBlockDevice::BeginRequest(std::uint16_t slot, std::uint16_t head) {
+  Request &req = m_Requests[slot];
+  req.Active = true;
+  req.HostDone = false;
+  req.DeadlinePassed = false;
+  req.Orphaned = false;
+  req.Head = head;
+  req.Status = BlockStatus::Ok;
+  req.StatusAddr = 0;
+  req.Length = 0;
+  req.Result = 0;
+  req.Data.clear();
+  m_Events.Schedule(m_Now + m_LatencyTicks, EventComplete, slot);
+
+  /**
+   * Walk the chain: header, data buffers, status byte. A chain longer
+   * than the ring can only be a loop.
+   */
+  Descriptor header;
+  Descriptor desc;
+  std::uint16_t index = head;
+  for (std::uint32_t n = 0;; ++n) {
+    if (n == m_QueueNum || !ReadDescriptor(index, desc)) {
+      req.Status = BlockStatus::IoError; // No usable status descriptor
+      req.Data.clear();
+      req.HostDone = true;
+      return;
+    }
+    if (n == 0) {
+      header = desc;
+    } else {
+      req.Data.push_back(desc);
+    }
+    if (!(desc.Flags & DescNext)) {
+      break;
+    }
+    index = desc.Next;
+  }
+
+  if (req.Data.empty() || !(req.Data.back().Flags & DescWrite) ||
+      req.Data.back().Len < 1) {
+    req.Status = BlockStatus::IoError;
+    req.Data.clear();
+    req.HostDone = true;
+    return;
+  }
+  req.StatusAddr = req.Data.back().Addr;
+  req.Data.pop_back();
+
+  std::array<Core::Byte, 16> raw{};
+  if (header.Len < raw.size() || !m_Bus->ReadBlock(header.Addr, raw)) {
+    req.Status = BlockStatus::IoError;
+    req.HostDone = true;
+    return;
+  }
+
+  std::uint32_t type = 0;
+  std::uint64_t sector = 0;
+  std::memcpy(&type, raw.data(), 4);
+  std::memcpy(&sector, raw.data() + 8, 8);
+  req.Type = static_cast<BlockRequestType>(type);
+
+  // Data buffers must all point the same way for the request type
+  bool deviceWrites = req.Type == BlockRequestType::In ||
+                      req.Type == BlockRequestType::GetId;
+  std::uint64_t total = 0;
+  for (const Descriptor &data : req.Data) {
+    if (((data.Flags & DescWrite) != 0) != deviceWrites) {
+      req.Status = BlockStatus::IoError;
+    }
+    total += data.Len;
+  }
+
+  switch (req.Type) {
+  case BlockRequestType::In:
+  case BlockRequestType::Out:
+    // Range check in sectors first: the guest's sector may overflow bytes
+    if (total > MaxRequestBytes || sector >= m_CapacitySectors ||
+        total > (m_CapacitySectors - sector) * SectorSize ||
+        (req.Type == BlockRequestType::Out && m_ReadOnly)) {
+      req.Status = BlockStatus::IoError;
+    }
+    req.Offset = sector * SectorSize;
+    break;
+  case BlockRequestType::Flush:
+    break;
+  case BlockRequestType::GetId:
+    total = std::min<std::uint64_t>(total, DeviceIdLength);
+    break;
+  default:
+    req.Status = BlockStatus::Unsupported;
+    break;
+  }
+
+  if (req.Status != BlockStatus::Ok) {
+    req.HostDone = true;
+    return;
+  }
+  req.Length = static_cast<std::uint32_t>(total);
+  req.Buffer.resize(req.Length);
+
+  if (req.Type == BlockRequestType::GetId) {
+    std::fill(req.Buffer.begin(), req.Buffer.end(), Core::Byte{0});
+    std::memcpy(req.Buffer.data(), DeviceIdString,
+                std::min<std::size_t>(req.Length, sizeof(DeviceIdString) - 1));
+    req.Result = req.Length;
+    req.HostDone = true;
+    return;
+  }
+
+  if (req.Type == BlockRequestType::Out) {
+    // Gather now: the guest owns these buffers again after completion
+    std::size_t at = 0;
+    for (const Descriptor &data : req.Data) {
+      if (!m_Bus->ReadBlock(data.Addr,
+                            std::span(req.Buffer.data() + at, data.Len))) {
+        req.Status = BlockStatus::IoError;
+        req.HostDone = true;
+        return;
+      }
+      at += data.Len;
+    }
+  }
+
+  StartHostIo(slot);
+}
+
+void VirtioBlockDevice::StartHostIo(std::uint16_t slot) {
+  Request &req = m_Requests[slot];
+
+  Host::AsyncIoRequest io;
+  io.Fd = m_Fd;
+  io.Offset = req.Offset;
+  io.Buffer = req.Buffer.data();
+  io.Length = req.Length;
+  io.Tag = slot;
+  switch (req.Type) {
+  case BlockRequestType::In:
+    io.Op = Host::AsyncIoOp::Read;
+    break;
+  case BlockRequestType::Out:
+    io.Op = Host::AsyncIoOp::Write;
+    break;
+  default:
+    io.Op = Host::AsyncIoOp::Fsync;
+    break;
+  }
+
+  if (m_Aio && m_Aio->Submit(io)) {
+    m_HostPending++;
+    return;
+  }
+
+  // No AsyncIo (or it refused): do it now
+  req.Result = m_Fd >= 0 ? Host::AsyncIo::ExecuteBlocking(io) : -1;
+  req.HostDone = true;
+}
+
+void VirtioBlockDevice::HarvestHostIo() {
+  std::array<Host::AsyncIoCompletion, 32> done{};
+  std::size_t n = 0;
+  while ((n = m_Aio->Reap(done)) != 0) {
+    for (std::size_t i = 0; i < n; ++i) {
+      auto slot = static_cast<std::uint16_t>(done[i].Tag);
+      Request &req = m_Requests[slot];
+      m_HostPending--;
+      req.HostDone = true;
+      req.Result = done[i].Result;
+
+      if (req.Orphaned) {
+        ReleaseSlot(slot);
+      } else if (req.DeadlinePassed) {
+        FinishRequest(slot);
+      }
+    }
+  }
+}
+
+void VirtioBlockDevice::OnDeadline(std::uint16_t slot) {
+  Request &req = m_Requests[slot];
+  if (!req.HostDone) {
+    if (!m_Deterministic) {
+      req.DeadlinePassed = true; // HarvestHostIo finishes it
+      return;
+    }
+    while (!req.HostDone) {
+      m_Aio->Wait();
+      HarvestHostIo();
+    }
+  }
+  FinishRequest(slot);
+}
+
+void VirtioBlockDevice::FinishRequest(std::uint16_t slot) {
+  Request &req = m_Requests[slot];
+  BlockStatus status = req.Status;
+  std::uint32_t written = 0;
+
+  if (status == BlockStatus::Ok) {
+    switch (req.Type) {
+    case BlockRequestType::In:
+    case BlockRequestType::GetId: {
+      if (req.Result != static_cast<std::int64_t>(req.Length)) {
+        status = BlockStatus::IoError;
+        break;
+      }
+      std::size_t at = 0;
+      for (const Descriptor &data : req.Data) {
+        std::size_t n = std::min<std::size_t>(data.Len, req.Length - at);
+        if (!m_Bus->WriteBlock(data.Addr,
+                               std::span(req.Buffer.data() + at, n))) {
+          status = BlockStatus::IoError;
+          break;
+        }
+        at += n;
+      }
+      written = req.Length;
+      break;
+    }
+    case BlockRequestType::Out:
+      if (req.Result != static_cast<std::int64_t>(req.Length)) {
+        status = BlockStatus::IoError;
+      }
+      break;
+    default: // Flush
+      if (req.Result != 0) {
+        status = BlockStatus::IoError;
+      }
+      break;
+    }
+  }
+
+  if (req.StatusAddr != 0) {
+    std::array<Core::Byte, 1> statusByte{static_cast<Core::Byte>(status)};
+    m_Bus->WriteBlock(req.StatusAddr, statusByte);
+    written += 1;
+  }
+
+  /**
+   * USED RING
+   *
+   * Element first, then the index, so a driver polling idx never sees
+   * an entry that has not been filled in yet.
+   */
+  const std::uint16_t mask = static_cast<std::uint16_t>(m_QueueNum - 1);
+  std::array<Core::Byte, 8> elem{};
+  std::uint32_t id = req.Head;
+  std::memcpy(elem.data(), &id, 4);
+  std::memcpy(elem.data() + 4, &written, 4);
+  m_Bus->WriteBlock(m_UsedRing + 4 + 8u * (m_UsedIdx & mask), elem);
+  m_UsedIdx++;
+  WriteU16(m_UsedRing + 2, m_UsedIdx);
+
+  ReleaseSlot(slot);
+  m_Completed++;
+
+  m_InterruptStatus |= 1;
+  if (m_Pic) {
+    m_Pic->RaiseIrq(Peripherals::PicDevice::IrqVirtioBlock);
+  }
+}
+
+void VirtioBlockDevice::ReleaseSlot(std::uint16_t slot) {
+  m_Requests[slot].Active = false;
+  m_Requests[slot].Orphaned = false;
+  m_FreeSlots.push_back(slot);
+}
+
+bool VirtioBlockDevice::ReadDescriptor(std::uint16_t index, Descriptor &out) {
+  if (index >= m_QueueNum) {
+    return false;
+  }
+
+  std::array<Core::Byte, 16> raw{};
+  if (!m_Bus->ReadBlock(m_DescTable + 16u * index, raw)) {
+    return false;
+  }
+  std::memcpy(&out.Addr, raw.data(), 8);
+  std::memcpy(&out.Len, raw.data() + 8, 4);
+  std::memcpy(&out.Flags, raw.data() + 12, 2);
+  std::memcpy(&out.Next, raw.data() + 14, 2);
+  return true;
+}
+
+bool VirtioBlockDevice::ReadU16(Core::Address addr, std::uint16_t &out) {
+  std::array<Core::Byte, 2> raw{};
+  if (!m_Bus->ReadBlock(addr, raw)) {
+    return false;
+  }
+  out = static_cast<std::uint16_t>(raw[0] | (raw[1] << 8));
+  return true;
+}
+
+bool VirtioBlockDevice::WriteU16(Core::Address addr, std::uint16_t value) {
+  std::array<Core::Byte, 2> raw{static_cast<Core::Byte>(value),
+                                static_cast<Core::Byte>(value >> 8)};
+  return m_Bus->WriteBlock(addr, raw);
+}
+
+} // namespace Aurelia::Storage::Virtio
@@ -0,0 +1,317 @@
+/**
+ * Virtio Block Device.
+ *
+ * Paravirtual disk backed directly by a host image file.
+ *
+ * The NVMe-style StorageController routes every sector through the NAND
+ * and FTL models, which is the point when studying flash behaviour and
+ * pure overhead when a guest just needs a disk. This device follows the
+ * virtio-mmio (v2) register layout and the virtio-blk request format, so
+ * a guest driver only has to place requests in a ring in RAM and ring a
+ * doorbell. Each request becomes one read/write/fsync on the image.
+ *
+ * REGISTER MAP (virtio-mmio subset, 32-bit registers):
+ * ┌────────────┬─────────────────────────────────────────────────┐
+ * │ Offset     │ Register                                        │
+ * ├────────────┼─────────────────────────────────────────────────┤
+ * │ 0x000      │ MAGIC           - 'virt' (RO)                   │
+ * │ 0x004      │ VERSION         - 2 (RO)                        │
+ * │ 0x008      │ DEVICE_ID       - 2 = block (RO)                │
+ * │ 0x00C      │ VENDOR_ID       - 'AURE' (RO)                   │
+ * │ 0x010      │ DEVICE_FEATURES - RO, FLUSH (RO)                │
+ * │ 0x020      │ DRIVER_FEATURES - Accepted, ignored (WO)        │
+ * │ 0x034      │ QUEUE_NUM_MAX   - 256 (RO)                      │
+ * │ 0x038      │ QUEUE_NUM       - Ring size, power of two (RW)  │
+ * │ 0x044      │ QUEUE_READY     - 1 = rings configured (RW)     │
+ * │ 0x050      │ QUEUE_NOTIFY    - Doorbell (WO)                 │
+ * │ 0x060      │ INTERRUPT_STATUS- Bit 0: used ring updated (RO) │
+ * │ 0x064      │ INTERRUPT_ACK   - W1C for INTERRUPT_STATUS (WO) │
+ * │ 0x070      │ STATUS          - Driver status, 0 = reset (RW) │
+ * │ 0x080/0x084│ QUEUE_DESC      - Descriptor table, low/high    │
+ * │ 0x090/0x094│ QUEUE_DRIVER    - Available ring, low/high      │
+ * │ 0x0A0/0x0A4│ QUEUE_DEVICE    - Used ring, low/high           │
+ * │ 0x100      │ CAPACITY        - Disk size in sectors (RO)     │
+ * └────────────┴─────────────────────────────────────────────────┘
+ *
+ * VIRTQUEUE (split layout, all little-endian, in guest RAM):
+ * - Descriptor: addr(u64) len(u32) flags(u16: NEXT=1, WRITE=2) next(u16)
+ * - Available:  flags(u16) idx(u16) ring[QUEUE_NUM](u16)
+ * - Used:       flags(u16) idx(u16) ring[QUEUE_NUM]{id(u32), len(u32)}
+ *
+ * REQUEST CHAIN:
+ * ┌──────────────────┬──────────────────────┬─────────────────────────┐
+ * │ Header (RO, 16B) │ Data (0..n buffers)  │ Status (WRITE, 1 byte)  │
+ * │ type, rsvd, sect │ WRITE for IN/GET_ID  │ 0 OK, 1 IOERR, 2 UNSUPP │
+ * └──────────────────┴──────────────────────┴─────────────────────────┘
+ * Types: 0 IN (read), 1 OUT (write), 4 FLUSH, 8 GET_ID.
+ *
+ * TIMING:
+ * A doorbell is serviced on the next tick: every available request is
+ * parsed, and its host I/O is started. The request completes
+ * LatencyTicks later (default 0, i.e. the same tick), or when the host
+ * I/O finishes if that is later. Completion writes the status byte and
+ * used ring entry, sets INTERRUPT_STATUS and raises PIC IrqVirtioBlock.
+ *
+ * HOST I/O:
+ * ┌───────────────────┬───────────────────────────────────────────────┐
+ * │ Mode              │ Behaviour                                     │
+ * ├───────────────────┼───────────────────────────────────────────────┤
+ * │ No AsyncIo        │ pread/pwrite inline; the tick waits for disk  │
+ * │ AsyncIo,          │ I/O runs while the guest executes. At the     │
+ * │ deterministic     │ deadline the device waits if the host is not  │
+ * │ (default)         │ done, so completion ticks are reproducible.   │
+ * │ AsyncIo,          │ Completion is delivered on the first tick at  │
+ * │ free-running      │ or after the deadline on which the host is    │
+ * │                   │ done. Never stalls; timing depends on host.   │
+ * └───────────────────┴───────────────────────────────────────────────┘
+ * Completions are scheduled on a Core::EventQueue keyed by deadline, so
+ * an idle device costs one compare per tick plus one atomic load while
+ * host I/O is outstanding.
+ *
+ * NOTE (KleaSCM) With AsyncIo, the overlap the guest gets is the latency
+ * window: a deterministic device with LatencyTicks = 0 still waits for
+ * every request, just with the whole batch in flight at once. Set a
+ * latency close to what the modelled disk would take.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Bus/Bus.hpp"
+#include "Bus/IBusDevice.hpp"
+#include "Core/EventQueue.hpp"
+#include "Core/Types.hpp"
+#include "Host/AsyncIo.hpp"
+#include "Peripherals/PicDevice.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Aurelia::Storage::Virtio {
+
+enum class BlockRequestType : std::uint32_t {
+  In = 0,
+  Out = 1,
+  Flush = 4,
+  GetId = 8,
+};
+
+enum class BlockStatus : std::uint8_t {
+  Ok = 0,
+  IoError = 1,
+  Unsupported = 2,
+};
+
+class VirtioBlockDevice final : public Bus::IBusDevice {
+public:
+  static constexpr std::uint32_t SectorSize = 512;
+  static constexpr std::uint32_t QueueNumMax = 256;
+  static constexpr std::uint32_t MaxRequestBytes = 1024 * 1024;
+
+  /**
+   * REGISTER OFFSETS
+   */
+  static constexpr Core::Address MagicOffset = 0x000;
+  static constexpr Core::Address VersionOffset = 0x004;
+  static constexpr Core::Address DeviceIdOffset = 0x008;
+  static constexpr Core::Address VendorIdOffset = 0x00C;
+  static constexpr Core::Address DeviceFeaturesOffset = 0x010;
+  static constexpr Core::Address DriverFeaturesOffset = 0x020;
+  static constexpr Core::Address QueueNumMaxOffset = 0x034;
+  static constexpr Core::Address QueueNumOffset = 0x038;
+  static constexpr Core::Address QueueReadyOffset = 0x044;
+  static constexpr Core::Address QueueNotifyOffset = 0x050;
+  static constexpr Core::Address InterruptStatusOffset = 0x060;
+  static constexpr Core::Address InterruptAckOffset = 0x064;
+  static constexpr Core::Address StatusOffset = 0x070;
+  static constexpr Core::Address QueueDescLowOffset = 0x080;
+  static constexpr Core::Address QueueDescHighOffset = 0x084;
+  static constexpr Core::Address QueueDriverLowOffset = 0x090;
+  static constexpr Core::Address QueueDriverHighOffset = 0x094;
+  static constexpr Core::Address QueueDeviceLowOffset = 0x0A0;
+  static constexpr Core::Address QueueDeviceHighOffset = 0x0A4;
+  static constexpr Core::Address CapacityOffset = 0x100;
+
+  static constexpr std::uint32_t MagicValue = 0x74726976;  // "virt"
+  static constexpr std::uint32_t VendorValue = 0x45525541; // "AURE"
+  static constexpr std::uint32_t BlockDeviceId = 2;
+
+  /**
+   * FEATURE BITS (virtio-blk)
+   */
+  static constexpr std::uint32_t FeatureReadOnly = 1u << 5;
+  static constexpr std::uint32_t FeatureFlush = 1u << 9;
+
+  /**
+   * DESCRIPTOR FLAGS
+   */
+  static constexpr std::uint16_t DescNext = 1;
+  static constexpr std::uint16_t DescWrite = 2;
+
+  /**
+   * @brief Construct device with no image at MemoryMap::VirtioBlockBase.
+   *
+   * Without an image the capacity is 0 and every request fails IOERR.
+   */
+  VirtioBlockDevice();
+
+  /**
+   * @brief Waits out host I/O still in flight, then closes the image.
+   *
+   * A connected AsyncIo must outlive the device.
+   */
+  ~VirtioBlockDevice() override;
+
+  VirtioBlockDevice(const VirtioBlockDevice &) = delete;
+  VirtioBlockDevice &operator=(const VirtioBlockDevice &) = delete;
+
+  /**
+   * @brief Open a host file as the disk image.
+   *
+   * Capacity is the file size rounded down to whole sectors.
+   *
+   * @return false if the file could not be opened
+   */
+  bool OpenImage(const std::string &path, bool readOnly = false);
+
+  void SetBaseAddress(Core::Address base) { m_BaseAddr = base; }
+  void ConnectBus(Bus::Bus *bus) { m_Bus = bus; }
+  void ConnectPic(Peripherals::PicDevice *pic) { m_Pic = pic; }
+
+  /**
+   * @brief Run host I/O through `aio` instead of on the tick.
+   *
+   * Connect before the guest submits requests; pass nullptr to return to
+   * inline I/O once nothing is in flight.
+   */
+  void ConnectAsyncIo(Host::AsyncIo *aio) { m_Aio = aio; }
+
+  /**
+   * @brief Minimum ticks from doorbell to completion.
+   */
+  void SetLatencyTicks(Core::TickCount ticks) { m_LatencyTicks = ticks; }
+
+  /**
+   * @brief Wait for late host I/O at the deadline (true, default) or let
+   * the completion slip to whenever the host finishes (false).
+   */
+  void SetDeterministic(bool deterministic) {
+    m_Deterministic = deterministic;
+  }
+
+  [[nodiscard]] bool IsAddressInRange(Core::Address addr) const override;
+  bool OnRead(Core::Address addr, Core::Data &outData) override;
+  bool OnWrite(Core::Address addr, Core::Data inData) override;
+
+  /**
+   * @brief Start requests after a doorbell; deliver due completions.
+   */
+  void OnTick() override;
+
+  [[nodiscard]] std::uint64_t GetCapacitySectors() const {
+    return m_CapacitySectors;
+  }
+  [[nodiscard]] std::uint64_t GetCompletedRequests() const {
+    return m_Completed;
+  }
+  [[nodiscard]] std::size_t GetOutstandingRequests() const {
+    return QueueNumMax - m_FreeSlots.size();
+  }
+
+private:
+  static constexpr Core::Address RegisterBlockSize = 0x1000;
+
+  static constexpr std::uint32_t EventComplete = 0;
+
+  struct Descriptor {
+    std::uint64_t Addr = 0;
+    std::uint32_t Len = 0;
+    std::uint16_t Flags = 0;
+    std::uint16_t Next = 0;
+  };
+
+  /**
+   * One in-flight request. Slots are never reallocated, so Buffer stays
+   * put while the host writes into it.
+   */
+  struct Request {
+    bool Active = false;
+    bool HostDone = false;       // Host result (or rejection) is in
+    bool DeadlinePassed = false; // Free-running: finish on host result
+    bool Orphaned = false;       // Reset while host I/O was outstanding
+    std::uint16_t Head = 0;
+    BlockRequestType Type = BlockRequestType::In;
+    BlockStatus Status = BlockStatus::Ok; // Rejected before any I/O
+    std::uint64_t Offset = 0;
+    std::uint32_t Length = 0; // Total data bytes
+    Core::Address StatusAddr = 0;
+    std::vector<Descriptor> Data;
+    std::vector<Core::Byte> Buffer;
+    std::int64_t Result = 0;
+  };
+
+  void Reset();
+  void ProcessQueue();
+
+  /**
+   * @brief Parse a chain into `req` and start its host I/O.
+   */
+  void BeginRequest(std::uint16_t slot, std::uint16_t head);
+  void StartHostIo(std::uint16_t slot);
+  void HarvestHostIo();
+  void OnDeadline(std::uint16_t slot);
+
+  /**
+   * @brief Scatter read data, write status and used ring, interrupt.
+   */
+  void FinishRequest(std::uint16_t slot);
+  void ReleaseSlot(std::uint16_t slot);
+
+  bool ReadDescriptor(std::uint16_t index, Descriptor &out);
+  bool ReadU16(Core::Address addr, std::uint16_t &out);
+  bool WriteU16(Core::Address addr, std::uint16_t value);
+
+  Core::Address m_BaseAddr;
+  Bus::Bus *m_Bus = nullptr;
+  Peripherals::PicDevice *m_Pic = nullptr;
+  Host::AsyncIo *m_Aio = nullptr;
+
+  /**
+   * BACKING IMAGE
+   */
+  int m_Fd = -1;
+  bool m_ReadOnly = false;
+  std::uint64_t m_CapacitySectors = 0;
+
+  /**
+   * TRANSPORT STATE
+   */
+  std::uint32_t m_Status = 0;
+  std::uint32_t m_InterruptStatus = 0;
+  std::uint32_t m_QueueNum = 0;
+  bool m_QueueReady = false;
+  Core::Address m_DescTable = 0;
+  Core::Address m_AvailRing = 0;
+  Core::Address m_UsedRing = 0;
+  std::uint16_t m_LastAvail = 0;
+  std::uint16_t m_UsedIdx = 0;
+  bool m_Notified = false;
+
+  /**
+   * REQUEST TRACKING
+   */
+  std::array<Request, QueueNumMax> m_Requests{};
+  std::vector<std::uint16_t> m_FreeSlots;
+  std::size_t m_HostPending = 0; // Submitted to AsyncIo, not yet reaped
+  Core::EventQueue m_Events;     // EventComplete, payload = slot
+  Core::TickCount m_Now = 0;
+  Core::TickCount m_LatencyTicks = 0;
+  bool m_Deterministic = true;
+
+  std::uint64_t m_Completed = 0;
+};
+
+} // namespace Aurelia::Storage::Virtio
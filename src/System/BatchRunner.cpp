@@ -0,0 +1,271 @@
+/**
+ * Aurelia Headless Batch Runner Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "System/BatchRunner.hpp"
+#include "Host/ThreadPool.hpp"
+#include "System/VirtualMachine.hpp"
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+
+namespace Aurelia::System {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+bool ReadTextFile(const std::string &path, std::string &out) {
+  std::ifstream file(path, std::ios::in | std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  out.assign(std::istreambuf_iterator<char>(file),
+             std::istreambuf_iterator<char>());
+  return true;
+}
+
+std::string ResolvePath(const std::string &baseDir, std::string_view path) {
+  if (baseDir.empty() || path.starts_with('/')) {
+    return std::string(path);
+  }
+  std::string resolved = baseDir;
+  if (!resolved.ends_with('/')) {
+    resolved += '/';
+  }
+  resolved += path;
+  return resolved;
+}
+
+std::string_view NextField(std::string_view &line) {
+  std::size_t start = line.find_first_not_of(" \t\r");
+  if (start == std::string_view::npos) {
+    line = {};
+    return {};
+  }
+  std::size_t end = line.find_first_of(" \t\r", start);
+  std::string_view field = line.substr(start, end - start);
+  line = end == std::string_view::npos ? std::string_view{} : line.substr(end);
+  return field;
+}
+
+} // namespace
+
+bool ParseManifest(std::string_view text, const std::string &baseDir,
+                   std::vector<BatchJob> &jobs, std::string &error) {
+  std::size_t lineNumber = 0;
+  while (!text.empty()) {
+    std::size_t newline = text.find('\n');
+    std::string_view line = text.substr(0, newline);
+    text = newline == std::string_view::npos ? std::string_view{}
+                                             : text.substr(newline + 1);
+    ++lineNumber;
+
+    if (std::size_t hash = line.find('#'); hash != std::string_view::npos) {
+      line = line.substr(0, hash);
+    }
+    std::string_view name = NextField(line);
+    if (name.empty()) {
+      continue;
+    }
+    std::string_view image = NextField(line);
+    if (image.empty()) {
+      error = "Line " + std::to_string(lineNumber) + ": missing image path";
+      return false;
+    }
+
+    BatchJob job;
+    job.Name = name;
+    job.Image = ResolvePath(baseDir, image);
+
+    for (std::string_view option = NextField(line); !option.empty();
+         option = NextField(line)) {
+      std::size_t equals = option.find('=');
+      std::string_view key = option.substr(0, equals);
+      std::string_view value = equals == std::string_view::npos
+                                   ? std::string_view{}
+                                   : option.substr(equals + 1);
+
+      if (key == "cycles") {
+        auto [end, ec] = std::from_chars(
+            value.data(), value.data() + value.size(), job.CycleBudget);
+        if (ec != std::errc{} || end != value.data() + value.size() ||
+            job.CycleBudget == 0) {
+          error = "Line " + std::to_string(lineNumber) +
+                  ": bad cycle budget '" + std::string(value) + "'";
+          return false;
+        }
+      } else if (key == "input" && !value.empty()) {
+        job.InputPath = ResolvePath(baseDir, value);
+      } else if (key == "expect" && !value.empty()) {
+        job.ExpectPath = ResolvePath(baseDir, value);
+      } else {
+        error = "Line " + std::to_string(lineNumber) + ": unknown option '" +
+                std::string(option) + "'";
+        return false;
+      }
+    }
+    jobs.push_back(std::move(job));
+  }
+  return true;
+}
+
+namespace {
+
+/**
+ * A job between slices: its machine and what its output must match.
+ */
+struct LiveJob {
+  std::unique_ptr<VirtualMachine> Vm;
+  std::string Expected;
+};
+
+bool StartJob(const BatchJob &job, LiveJob &live, JobResult &result) {
+  std::string input;
+  if (!job.InputPath.empty() && !ReadTextFile(job.InputPath, input)) {
+    result.Error = "Cannot read input: " + job.InputPath;
+    return false;
+  }
+  if (!job.ExpectPath.empty() &&
+      !ReadTextFile(job.ExpectPath, live.Expected)) {
+    result.Error = "Cannot read expected output: " + job.ExpectPath;
+    return false;
+  }
+
+  live.Vm = std::make_unique<VirtualMachine>();
+  if (!live.Vm->LoadExecutable(job.Image)) {
+    result.Error = live.Vm->GetErrorMessage();
+    live.Vm.reset();
+    return false;
+  }
+  live.Vm->QueueInput(input);
+  live.Vm->SetCycleLimit(job.CycleBudget);
+  return true;
+}
+
+/**
+ * @brief Run one slice of a started job.
+ * @return true once the job is finished and `result` is final
+ */
+bool RunJobSlice(const BatchJob &job, LiveJob &live, JobResult &result,
+                 Core::TickCount quantum) {
+  auto start = Clock::now();
+  VmExit exit = live.Vm->RunSlice(quantum);
+  result.Seconds +=
+      std::chrono::duration<double>(Clock::now() - start).count();
+  result.Slices++;
+  result.Cycles = live.Vm->GetCycles();
+  if (exit == VmExit::Yielded) {
+    return false;
+  }
+
+  result.Output = live.Vm->GetOutput();
+  if (exit == VmExit::BudgetExhausted) {
+    result.Status = JobStatus::Timeout;
+  } else if (!job.ExpectPath.empty() && result.Output != live.Expected) {
+    result.Status = JobStatus::Fail;
+    std::size_t at = 0;
+    while (at < result.Output.size() && at < live.Expected.size() &&
+           result.Output[at] == live.Expected[at]) {
+      ++at;
+    }
+    result.Error = "Output differs at byte " + std::to_string(at);
+  } else {
+    result.Status = JobStatus::Pass;
+  }
+  return true;
+}
+
+} // namespace
+
+JobResult RunJob(const BatchJob &job) {
+  JobResult result;
+  LiveJob live;
+  if (StartJob(job, live, result)) {
+    // The cycle limit ends the run; the quantum never does
+    RunJobSlice(job, live, result, job.CycleBudget);
+  }
+  return result;
+}
+
+const char *ToString(JobStatus status) {
+  switch (status) {
+  case JobStatus::Pass:
+    return "PASS";
+  case JobStatus::Fail:
+    return "FAIL";
+  case JobStatus::Timeout:
+    return "TIMEOUT";
+  case JobStatus::Error:
+    return "ERROR";
+  }
+  return "?";
+}
+
+std::vector<JobResult> BatchRunner::Run(const std::vector<BatchJob> &jobs) {
+  std::vector<JobResult> results(jobs.size());
+  std::vector<LiveJob> live(jobs.size());
+  auto start = Clock::now();
+
+  // Unsliced runs are ended by each job's cycle limit alone
+  Core::TickCount quantum = m_Quantum;
+  if (quantum == 0) {
+    quantum = std::numeric_limits<Core::TickCount>::max();
+  }
+  std::atomic<std::size_t> nextJob{0};
+  std::function<void(std::size_t)> slice; // Outlives the pool's tasks
+
+  {
+    Host::ThreadPool pool(m_Threads);
+    m_UsedThreads = pool.GetThreadCount();
+    std::size_t maxLive =
+        m_MaxLiveVms != 0 ? m_MaxLiveVms : 4 * m_UsedThreads;
+
+    // A job's slices form a chain of tasks, one in flight at a time, so
+    // its LiveJob and JobResult slots are only touched by one thread at
+    // once (the deque locks order the hand-offs) and need no lock
+    auto admit = [&] {
+      std::size_t i = nextJob.fetch_add(1, std::memory_order_relaxed);
+      if (i < jobs.size()) {
+        pool.Submit([&slice, i] { slice(i); });
+      }
+    };
+    slice = [&](std::size_t i) {
+      if (!live[i].Vm && !StartJob(jobs[i], live[i], results[i])) {
+        admit();
+        return;
+      }
+      if (!RunJobSlice(jobs[i], live[i], results[i], quantum)) {
+        pool.Defer([&slice, i] { slice(i); });
+        return;
+      }
+      live[i] = {}; // Release the machine before admitting the next
+      admit();
+    };
+
+    for (std::size_t i = 0; i < maxLive && i < jobs.size(); ++i) {
+      admit();
+    }
+    pool.Wait();
+    m_Steals = pool.GetStealCount();
+  }
+
+  m_WallSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+  m_TotalCycles = 0;
+  m_Slices = 0;
+  for (const JobResult &result : results) {
+    m_TotalCycles += result.Cycles;
+    m_Slices += result.Slices;
+  }
+  return results;
+}
+
+} // namespace Aurelia::System
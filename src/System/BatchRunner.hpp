@@ -0,0 +1,144 @@
+/**
+ * Aurelia Headless Batch Runner.
+ *
+ * Runs a manifest of guest programs, each in its own VirtualMachine, on a
+ * work-stealing thread pool, and checks every program's console output
+ * against an expected transcript. Thousands of short regression programs
+ * then cost one process start instead of thousands.
+ *
+ * MANIFEST FORMAT:
+ * One job per line; '#' starts a comment; blank lines are ignored.
+ *
+ *   <name> <image> [cycles=<N>] [input=<file>] [expect=<file>]
+ *
+ * ┌──────────┬──────────────────────────────────────────────────────────┐
+ * │ Field    │ Meaning                                                  │
+ * ├──────────┼──────────────────────────────────────────────────────────┤
+ * │ name     │ Label used in the report                                 │
+ * │ image    │ AEX executable or flat binary (see Loader)               │
+ * │ cycles   │ Guest cycle budget; exceeding it is a TIMEOUT            │
+ * │ input    │ File fed to the console UART as the guest reads it       │
+ * │ expect   │ File the console output must equal byte for byte         │
+ * └──────────┴──────────────────────────────────────────────────────────┘
+ * Relative paths are resolved against the manifest's directory. A job
+ * without `expect` passes if the guest halts within its budget.
+ *
+ * SCHEDULING:
+ * Jobs run in time slices of SetQuantum() guest cycles. A job that is
+ * still running after its slice goes to the back of its worker's queue
+ * (ThreadPool::Defer) and resumes later, possibly on another thread, so
+ * one long guest cannot hold a worker while short ones wait:
+ *
+ *   Unsliced:  A A A A A A A A A A | B | C     (B and C wait for A)
+ *   Sliced:    A | B | C | A | A | A | A ...  (B and C finish early)
+ *
+ * At most SetMaxLiveVms() machines exist at once; the next job in the
+ * manifest is admitted as each one finishes, bounding memory however
+ * long the manifest is. The cycle budget is a hard limit on the VM
+ * itself, so it is enforced identically whatever the quantum.
+ *
+ * RESULTS:
+ * Results come back in manifest order whatever order the jobs finished
+ * in, so reports are stable across thread counts and quanta.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Core/Types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Aurelia::System {
+
+struct BatchJob {
+  std::string Name;
+  std::string Image;
+  std::string InputPath;  // Empty: no console input
+  std::string ExpectPath; // Empty: halting is enough to pass
+  Core::TickCount CycleBudget = DefaultCycleBudget;
+
+  static constexpr Core::TickCount DefaultCycleBudget = 100'000'000;
+};
+
+enum class JobStatus : std::uint8_t {
+  Pass,    // Halted, output matched (or nothing to match)
+  Fail,    // Halted, output differed
+  Timeout, // Cycle budget exhausted before HALT
+  Error    // Image or input/expect file could not be read
+};
+
+struct JobResult {
+  JobStatus Status = JobStatus::Error;
+  Core::TickCount Cycles = 0;
+  double Seconds = 0.0;     // Host time spent running this job's slices
+  std::uint32_t Slices = 0; // Quanta the job ran for
+  std::string Output;       // Captured console output
+  std::string Error;        // Set for Error (and a hint for Fail)
+};
+
+/**
+ * @brief Parse manifest text into jobs.
+ * @param baseDir Directory relative paths are resolved against
+ * @return false with `error` naming the offending line
+ */
+bool ParseManifest(std::string_view text, const std::string &baseDir,
+                   std::vector<BatchJob> &jobs, std::string &error);
+
+/**
+ * @brief Run one job to completion in a fresh VirtualMachine, unsliced.
+ */
+JobResult RunJob(const BatchJob &job);
+
+[[nodiscard]] const char *ToString(JobStatus status);
+
+class BatchRunner {
+public:
+  /**
+   * @param threads Worker count; 0 uses the host's hardware concurrency
+   */
+  explicit BatchRunner(std::size_t threads = 0) : m_Threads(threads) {}
+
+  static constexpr Core::TickCount DefaultQuantum = 1'000'000; // 10 ms
+
+  /**
+   * @brief Guest cycles a job runs before yielding (0 = run to the end).
+   */
+  void SetQuantum(Core::TickCount cycles) { m_Quantum = cycles; }
+
+  /**
+   * @brief Machines alive at once (0 = four per worker thread).
+   */
+  void SetMaxLiveVms(std::size_t count) { m_MaxLiveVms = count; }
+
+  /**
+   * @brief Run every job and return their results in manifest order.
+   */
+  std::vector<JobResult> Run(const std::vector<BatchJob> &jobs);
+
+  // Aggregates of the last Run()
+  [[nodiscard]] Core::TickCount GetTotalCycles() const {
+    return m_TotalCycles;
+  }
+  [[nodiscard]] double GetWallSeconds() const { return m_WallSeconds; }
+  [[nodiscard]] std::size_t GetThreadCount() const { return m_UsedThreads; }
+  [[nodiscard]] std::uint64_t GetStealCount() const { return m_Steals; }
+  [[nodiscard]] std::uint64_t GetSliceCount() const { return m_Slices; }
+
+private:
+  std::size_t m_Threads;
+  Core::TickCount m_Quantum = DefaultQuantum;
+  std::size_t m_MaxLiveVms = 0;
+  std::size_t m_UsedThreads = 0;
+  Core::TickCount m_TotalCycles = 0;
+  double m_WallSeconds = 0.0;
+  std::uint64_t m_Steals = 0;
+  std::uint64_t m_Slices = 0;
+};
+
+} // namespace Aurelia::System
@@ -0,0 +1,51 @@
+/**
+ * Aurelia Clock Domains.
+ *
+ * Tick dividers for each device class, relative to the CPU clock.
+ * Passed to Core::System::AddDevice() when assembling a machine.
+ *
+ * CLOCK TREE:
+ * ┌──────────────────┬─────────┬──────────────────────────────────────┐
+ * │ Domain           │ Divider │ Members                              │
+ * ├──────────────────┼─────────┼──────────────────────────────────────┤
+ * │ Core             │ 1       │ CPU, Bus, RAM, UART, Storage, Virtio │
+ * │                  │         │ disk, GPU, Blitter, DMA, NIC         │
+ * │ Timer            │ 4       │ TimerDevice                          │
+ * │ Control          │ 1024    │ PIC, Keyboard, Mouse, RTC, host      │
+ * │                  │         │ input                                │
+ * └──────────────────┴─────────┴──────────────────────────────────────┘
+ *
+ * DESIGN RATIONALE:
+ * - Anything with cycle-level timing the guest can observe (RAM wait
+ *   states, UART baud timing, storage busy periods) stays on the core
+ *   clock.
+ * - The timer runs from a prescaled clock, as on most SoCs, which also
+ *   gives guest software a longer maximum period per reload value.
+ * - PIC, keyboard and mouse do no work in OnTick (they react to register
+ *   accesses and host events), and host input only needs to be sampled
+ *   at human timescales, so ticking them every cycle is pure overhead.
+ *   The RTC computes its time on each read, so only its alarm is
+ *   sampled at this rate.
+ *
+ * NOMINAL FREQUENCY:
+ * The simulator has no fixed speed, but guest-visible time in virtual
+ * mode (RtcDevice) and latency settings expressed in wall time need one.
+ * NominalCoreHz is that agreed rate for the core clock.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Core/Types.hpp"
+
+namespace Aurelia::System {
+
+constexpr Core::TickCount CoreClockDivider = 1;
+constexpr Core::TickCount TimerClockDivider = 4;
+constexpr Core::TickCount ControlClockDivider = 1024;
+
+constexpr std::uint64_t NominalCoreHz = 100'000'000; // 100 MHz
+
+} // namespace Aurelia::System
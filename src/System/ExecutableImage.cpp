@@ -0,0 +1,192 @@
+/**
+ * Aurelia Executable Image Format Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "System/ExecutableImage.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace Aurelia::System {
+
+namespace {
+
+template <typename T> void Store(std::vector<Core::Byte> &out, T value) {
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    out.push_back(static_cast<Core::Byte>(
+        static_cast<std::uint64_t>(value) >> (8 * i)));
+  }
+}
+
+template <typename T> T Load(const Core::Byte *p) {
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    value |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+  }
+  return static_cast<T>(value);
+}
+
+constexpr std::size_t AlignUp(std::size_t value, std::size_t align) {
+  return (value + align - 1) & ~(align - 1);
+}
+
+bool IsValidKind(std::uint8_t kind) {
+  return kind >= static_cast<std::uint8_t>(SectionKind::Text) &&
+         kind <= static_cast<std::uint8_t>(SectionKind::Bss);
+}
+
+} // namespace
+
+std::vector<Core::Byte> ExecutableImage::Serialize() const {
+  std::string strings;
+  std::vector<std::uint32_t> nameOffsets;
+  nameOffsets.reserve(Symbols.size());
+  for (const ImageSymbol &sym : Symbols) {
+    nameOffsets.push_back(static_cast<std::uint32_t>(strings.size()));
+    strings += sym.Name;
+    strings.push_back('\0');
+  }
+
+  std::size_t offset = HeaderSize + SectionEntrySize * Sections.size() +
+                       SymbolEntrySize * Symbols.size() + strings.size();
+  std::vector<std::uint64_t> dataOffsets;
+  for (const ImageSection &sec : Sections) {
+    if (sec.Kind == SectionKind::Bss) {
+      dataOffsets.push_back(0);
+      continue;
+    }
+    offset = AlignUp(offset, 8);
+    dataOffsets.push_back(offset);
+    offset += sec.Bytes.size();
+  }
+
+  std::vector<Core::Byte> out;
+  out.reserve(offset);
+
+  Store<std::uint32_t>(out, Magic);
+  Store<std::uint16_t>(out, Version);
+  Store<std::uint16_t>(out, static_cast<std::uint16_t>(Sections.size()));
+  Store<std::uint64_t>(out, Entry);
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(Symbols.size()));
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(strings.size()));
+  Store<std::uint64_t>(out, 0);
+
+  for (std::size_t i = 0; i < Sections.size(); ++i) {
+    const ImageSection &sec = Sections[i];
+    Store<std::uint8_t>(out, static_cast<std::uint8_t>(sec.Kind));
+    out.insert(out.end(), 7, 0);
+    Store<std::uint64_t>(out, sec.Address);
+    Store<std::uint64_t>(out, sec.Kind == SectionKind::Bss
+                                  ? sec.Size
+                                  : sec.Bytes.size());
+    Store<std::uint64_t>(out, dataOffsets[i]);
+  }
+
+  for (std::size_t i = 0; i < Symbols.size(); ++i) {
+    const ImageSymbol &sym = Symbols[i];
+    Store<std::uint32_t>(out, nameOffsets[i]);
+    Store<std::uint8_t>(out, static_cast<std::uint8_t>(sym.Section));
+    Store<std::uint8_t>(out, sym.IsGlobal ? SymbolGlobal : 0);
+    Store<std::uint16_t>(out, 0);
+    Store<std::uint64_t>(out, sym.Address);
+  }
+
+  out.insert(out.end(), strings.begin(), strings.end());
+
+  for (std::size_t i = 0; i < Sections.size(); ++i) {
+    if (Sections[i].Kind == SectionKind::Bss) {
+      continue;
+    }
+    out.resize(dataOffsets[i], 0); // Alignment padding
+    out.insert(out.end(), Sections[i].Bytes.begin(), Sections[i].Bytes.end());
+  }
+
+  return out;
+}
+
+bool ExecutableImage::HasMagic(std::span<const Core::Byte> file) {
+  return file.size() >= 4 && Load<std::uint32_t>(file.data()) == Magic;
+}
+
+bool ExecutableImage::Parse(std::span<const Core::Byte> file,
+                            std::string &error) {
+  Sections.clear();
+  Symbols.clear();
+
+  if (file.size() < HeaderSize || !HasMagic(file)) {
+    error = "Not an AEX image";
+    return false;
+  }
+  if (Load<std::uint16_t>(file.data() + 4) != Version) {
+    error = "Unsupported AEX version";
+    return false;
+  }
+
+  std::size_t sectionCount = Load<std::uint16_t>(file.data() + 6);
+  Entry = Load<std::uint64_t>(file.data() + 8);
+  std::size_t symbolCount = Load<std::uint32_t>(file.data() + 16);
+  std::size_t stringSize = Load<std::uint32_t>(file.data() + 20);
+
+  // All counts are at most 32 bits, so these sums cannot overflow
+  std::size_t symbolBase = HeaderSize + SectionEntrySize * sectionCount;
+  std::size_t stringBase = symbolBase + SymbolEntrySize * symbolCount;
+  if (stringBase + stringSize > file.size()) {
+    error = "Truncated AEX tables";
+    return false;
+  }
+
+  Sections.reserve(sectionCount);
+  for (std::size_t i = 0; i < sectionCount; ++i) {
+    const Core::Byte *entry = file.data() + HeaderSize + SectionEntrySize * i;
+    std::uint8_t kind = entry[0];
+    if (!IsValidKind(kind)) {
+      error = "Bad section kind in entry " + std::to_string(i);
+      return false;
+    }
+
+    ImageSection sec;
+    sec.Kind = static_cast<SectionKind>(kind);
+    sec.Address = Load<std::uint64_t>(entry + 8);
+    sec.Size = Load<std::uint64_t>(entry + 16);
+    std::uint64_t offset = Load<std::uint64_t>(entry + 24);
+
+    if (sec.Kind != SectionKind::Bss) {
+      if (offset > file.size() || sec.Size > file.size() - offset) {
+        error = "Section " + std::to_string(i) + " extends past end of file";
+        return false;
+      }
+      sec.Bytes = file.subspan(static_cast<std::size_t>(offset),
+                               static_cast<std::size_t>(sec.Size));
+    }
+    Sections.push_back(sec);
+  }
+
+  const char *strings = reinterpret_cast<const char *>(file.data()) +
+                        stringBase;
+  Symbols.reserve(symbolCount);
+  for (std::size_t i = 0; i < symbolCount; ++i) {
+    const Core::Byte *entry = file.data() + symbolBase + SymbolEntrySize * i;
+    std::size_t name = Load<std::uint32_t>(entry);
+    const char *end = name < stringSize
+                          ? static_cast<const char *>(std::memchr(
+                                strings + name, '\0', stringSize - name))
+                          : nullptr;
+    if (!end || !IsValidKind(entry[4])) {
+      error = "Bad symbol entry " + std::to_string(i);
+      return false;
+    }
+
+    ImageSymbol sym;
+    sym.Name.assign(strings + name, end);
+    sym.Section = static_cast<SectionKind>(entry[4]);
+    sym.IsGlobal = (entry[5] & SymbolGlobal) != 0;
+    sym.Address = Load<std::uint64_t>(entry + 8);
+    Symbols.push_back(std::move(sym));
+  }
+
+  return true;
+}
+
+} // namespace Aurelia::System
@@ -0,0 +1,121 @@
+/**
+ * Aurelia Executable Image Format (AEX).
+ *
+ * Sectioned container produced by `asm -f aex` and loaded by
+ * System::Loader. A minimal ELF: each section knows its load address,
+ * zero-filled data costs no file space, and the entry point and symbols
+ * travel with the code.
+ *
+ * FILE LAYOUT (little-endian):
+ * ┌─────────────────────┬──────────────────────────────────────────────┐
+ * │ Part                │ Contents                                     │
+ * ├─────────────────────┼──────────────────────────────────────────────┤
+ * │ Header (32 B)       │ Magic, version, counts, entry point          │
+ * │ Section table       │ SectionCount × 32 B                          │
+ * │ Symbol table        │ SymbolCount × 16 B                           │
+ * │ String table        │ NUL-terminated symbol names                  │
+ * │ Section data        │ Raw bytes of each non-BSS section, 8-aligned │
+ * └─────────────────────┴──────────────────────────────────────────────┘
+ *
+ * HEADER:
+ * ┌────────┬──────┬────────────────────────────────────────────────────┐
+ * │ Offset │ Size │ Field                                              │
+ * ├────────┼──────┼────────────────────────────────────────────────────┤
+ * │ 0x00   │ 4    │ Magic "AEX1"                                       │
+ * │ 0x04   │ 2    │ Version (1)                                        │
+ * │ 0x06   │ 2    │ SectionCount                                       │
+ * │ 0x08   │ 8    │ Entry point address                                │
+ * │ 0x10   │ 4    │ SymbolCount                                        │
+ * │ 0x14   │ 4    │ StringTableSize                                    │
+ * │ 0x18   │ 8    │ Reserved (0)                                       │
+ * └────────┴──────┴────────────────────────────────────────────────────┘
+ *
+ * SECTION ENTRY:               SYMBOL ENTRY:
+ * ┌────────┬──────┬─────────┐  ┌────────┬──────┬─────────────────────┐
+ * │ 0x00   │ 1    │ Kind    │  │ 0x00   │ 4    │ Name (string offset)│
+ * │ 0x08   │ 8    │ Address │  │ 0x04   │ 1    │ Section kind        │
+ * │ 0x10   │ 8    │ Size    │  │ 0x05   │ 1    │ Bit 0 GLOBAL        │
+ * │ 0x18   │ 8    │ Offset  │  │ 0x08   │ 8    │ Address             │
+ * └────────┴──────┴─────────┘  └────────┴──────┴─────────────────────┘
+ * Size is the size in memory. Every section except BSS stores exactly
+ * Size bytes at file Offset; BSS stores nothing and has Offset 0.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Core/Types.hpp"
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Aurelia::System {
+
+enum class SectionKind : std::uint8_t {
+  Text = 1,   // Instructions
+  RoData = 2, // Constants
+  Data = 3,   // Initialised variables
+  Bss = 4     // Zero-initialised variables (no file bytes)
+};
+
+struct ImageSection {
+  SectionKind Kind = SectionKind::Text;
+  Core::Address Address = 0;
+  std::uint64_t Size = 0;
+  std::span<const Core::Byte> Bytes; // Empty for BSS; not owned
+};
+
+struct ImageSymbol {
+  std::string Name;
+  Core::Address Address = 0;
+  SectionKind Section = SectionKind::Text;
+  bool IsGlobal = false;
+};
+
+/**
+ * In-memory form of an AEX file.
+ *
+ * Section bytes are views: Serialize() reads them from wherever the
+ * producer keeps them, and Parse() points them into the caller's buffer
+ * (typically an mmap'd file), so neither direction copies section data
+ * more than once.
+ */
+struct ExecutableImage {
+  static constexpr std::uint32_t Magic = 0x31584541; // "AEX1"
+  static constexpr std::uint16_t Version = 1;
+  static constexpr std::size_t HeaderSize = 32;
+  static constexpr std::size_t SectionEntrySize = 32;
+  static constexpr std::size_t SymbolEntrySize = 16;
+  static constexpr std::uint8_t SymbolGlobal = 1u << 0;
+
+  Core::Address Entry = 0;
+  std::vector<ImageSection> Sections;
+  std::vector<ImageSymbol> Symbols;
+
+  /**
+   * @brief Encode as an AEX file.
+   */
+  [[nodiscard]] std::vector<Core::Byte> Serialize() const;
+
+  /**
+   * @brief Decode an AEX file; sections view into `file`.
+   *
+   * Every count, offset and size is checked against the buffer, so a
+   * truncated or corrupt file is rejected rather than read out of bounds.
+   *
+   * @param file  Whole file contents (must outlive the image)
+   * @param error Set to a description on failure
+   * @return false if `file` is not a well-formed AEX image
+   */
+  bool Parse(std::span<const Core::Byte> file, std::string &error);
+
+  /**
+   * @brief True if `file` starts with the AEX magic.
+   */
+  [[nodiscard]] static bool HasMagic(std::span<const Core::Byte> file);
+};
+
+} // namespace Aurelia::System
@@ -7,34 +7,31 @@
 
 #include "System/Loader.hpp"
 #include "System/MemoryMap.hpp"
-#include <fstream>
+#include "Host/MappedFile.hpp"
 #include <sstream>
+#include <vector>
 
 namespace Aurelia::System {
 
+using Host::MappedFile;
+
 Loader::Loader(Bus::Bus &bus) : m_Bus(bus) {}
 
 bool Loader::LoadBinary(const std::string &filename, Address loadAddress) {
   /**
-   * STAGE 1: READ FILE INTO BUFFER
+   * STAGE 1: MAP FILE
    *
-   * Open binary file and read entire contents into memory.
-   * We use binary mode (std::ios::binary) to prevent any text
-   * translation that might corrupt machine code.
+   * The whole file is made addressable at once; with mmap the kernel
+   * pages it in as the bulk copy below walks through it.
    */
-  std::ifstream file(filename, std::ios::in | std::ios::binary);
-  if (!file.is_open()) {
+  MappedFile file;
+  if (!file.Open(filename)) {
     m_ErrorMessage = "Cannot open file: " + filename;
     return false;
   }
 
-  // Read entire file into buffer using streambuf iterator
-  std::vector<std::uint8_t> buffer((std::istreambuf_iterator<char>(file)),
-                                   std::istreambuf_iterator<char>());
-
-  file.close();
-
-  if (buffer.empty()) {
+  std::span<const std::uint8_t> image = file.Bytes();
+  if (image.empty()) {
     m_ErrorMessage = "File is empty: " + filename;
     return false;
   }
@@ -45,21 +42,7 @@ bool Loader::LoadBinary(const std::string &filename, Address loadAddress) {
    * Ensure the target address + file size doesn't exceed RAM bounds.
    * This prevents accidentally writing into MMIO space or unmapped regions.
    */
-  Address endAddress = loadAddress + buffer.size() - 1;
-
-  if (!IsRamAddress(loadAddress)) {
-    std::ostringstream oss;
-    oss << "Load address 0x" << std::hex << loadAddress
-        << " is not in RAM region";
-    m_ErrorMessage = oss.str();
-    return false;
-  }
-
-  if (!IsRamAddress(endAddress)) {
-    std::ostringstream oss;
-    oss << "Program too large: ends at 0x" << std::hex << endAddress
-        << " (exceeds RAM bounds)";
-    m_ErrorMessage = oss.str();
+  if (!ValidateRange(loadAddress, image.size())) {
     return false;
   }
 
@@ -68,48 +51,125 @@ bool Loader::LoadBinary(const std::string &filename, Address loadAddress) {
    *
    * Delegate actual Bus write to helper method.
    */
-  return WriteToBus(buffer, loadAddress);
+  return WriteToBus(image, loadAddress);
+}
+
+bool Loader::LoadImage(const std::string &filename) {
+  MappedFile file;
+  if (!file.Open(filename)) {
+    m_ErrorMessage = "Cannot open file: " + filename;
+    return false;
+  }
+  return LoadImageData(file.Bytes());
+}
+
+bool Loader::LoadImageData(std::span<const std::uint8_t> image) {
+  ExecutableImage exe;
+  if (!exe.Parse(image, m_ErrorMessage)) {
+    return false;
+  }
+
+  // Validate every section before writing any
+  for (const ImageSection &sec : exe.Sections) {
+    if (sec.Size != 0 &&
+        !ValidateRange(sec.Address, static_cast<std::size_t>(sec.Size))) {
+      return false;
+    }
+  }
+
+  for (const ImageSection &sec : exe.Sections) {
+    bool ok = sec.Kind == SectionKind::Bss
+                  ? m_Bus.ZeroBlock(sec.Address,
+                                    static_cast<std::size_t>(sec.Size))
+                  : WriteToBus(sec.Bytes, sec.Address);
+    if (!ok) {
+      std::ostringstream oss;
+      oss << "Section at 0x" << std::hex << sec.Address
+          << " is not backed by a single RAM device";
+      m_ErrorMessage = oss.str();
+      return false;
+    }
+  }
+
+  m_EntryPoint = exe.Entry;
+  m_Symbols = std::move(exe.Symbols);
+  m_ErrorMessage.clear();
+  return true;
+}
+
+bool Loader::LoadExecutable(const std::string &filename,
+                            Address flatAddress) {
+  MappedFile file;
+  if (!file.Open(filename)) {
+    m_ErrorMessage = "Cannot open file: " + filename;
+    return false;
+  }
+
+  if (ExecutableImage::HasMagic(file.Bytes())) {
+    return LoadImageData(file.Bytes());
+  }
+
+  m_Symbols.clear();
+  m_EntryPoint = flatAddress;
+  if (file.Bytes().empty()) {
+    m_ErrorMessage = "File is empty: " + filename;
+    return false;
+  }
+  return ValidateRange(flatAddress, file.Bytes().size()) &&
+         WriteToBus(file.Bytes(), flatAddress);
 }
 
-bool Loader::LoadData(const std::vector<std::uint8_t> &data,
+bool Loader::LoadData(std::span<const std::uint8_t> data,
                       Address loadAddress) {
   if (data.empty()) {
     m_ErrorMessage = "Cannot load empty data";
     return false;
   }
 
-  // Validate address range
-  Address endAddress = loadAddress + data.size() - 1;
+  if (!ValidateRange(loadAddress, data.size())) {
+    return false;
+  }
 
-  if (!IsRamAddress(loadAddress) || !IsRamAddress(endAddress)) {
+  return WriteToBus(data, loadAddress);
+}
+
+bool Loader::ValidateRange(Address loadAddress, std::size_t size) {
+  if (!IsRamAddress(loadAddress)) {
     std::ostringstream oss;
-    oss << "Data range [0x" << std::hex << loadAddress << ", 0x" << endAddress
-        << "] exceeds RAM bounds";
+    oss << "Load address 0x" << std::hex << loadAddress
+        << " is not in RAM region";
     m_ErrorMessage = oss.str();
     return false;
   }
 
-  return WriteToBus(data, loadAddress);
+  // RamEnd is far below 2^64, so only the subtraction form is safe
+  if (size - 1 > RamEnd - loadAddress) {
+    std::ostringstream oss;
+    oss << "Program too large: " << std::dec << size << " bytes at 0x"
+        << std::hex << loadAddress << " (exceeds RAM bounds)";
+    m_ErrorMessage = oss.str();
+    return false;
+  }
+
+  return true;
 }
 
-bool Loader::WriteToBus(const std::vector<std::uint8_t> &data,
+bool Loader::WriteToBus(std::span<const std::uint8_t> data,
                         Address loadAddress) {
   /**
    * BUS WRITE STRATEGY
    *
-   * Use Bus::Write() for direct DMA-style writes.
-   * This bypasses the transactional timing and writes immediately.
+   * One Bus::WriteBlock: a single device lookup, then RamDevice copies
+   * the whole image with memcpy. Bypasses the transactional timing and
+   * writes immediately, as DMA would.
    */
-  for (std::size_t i = 0; i < data.size(); ++i) {
-    Address addr = loadAddress + i;
-    Core::Data byteData = static_cast<Core::Data>(data[i]);
-
-    if (!m_Bus.Write(addr, byteData)) {
-      std::ostringstream oss;
-      oss << "Write failed at 0x" << std::hex << addr;
-      m_ErrorMessage = oss.str();
-      return false;
-    }
+  if (!m_Bus.WriteBlock(loadAddress, data)) {
+    std::ostringstream oss;
+    oss << "Write failed: [0x" << std::hex << loadAddress << ", 0x"
+        << loadAddress + data.size() - 1
+        << "] is not backed by a single RAM device";
+    m_ErrorMessage = oss.str();
+    return false;
   }
 
   m_ErrorMessage.clear();
@@ -12,9 +12,30 @@
  * 4. Reset CPU and run
  *
  * LOADING STRATEGY:
- * The loader reads the binary file and uses the Bus to sequentially
- * write bytes to RAM. This simulates DMA or a bootloader copying
- * program code from external storage into main memory.
+ * The image is copied into RAM with a single Bus::WriteBlock, which the
+ * RAM device serves with one memcpy; like a DMA engine, not a CPU
+ * storing bytes one at a time. On POSIX hosts the file is mmap'd
+ * read-only, so the bytes go page cache → guest RAM with no
+ * intermediate buffer. Elsewhere it is read in one call.
+ *
+ * ┌──────────────────────────┬───────────────────────────────────────┐
+ * │ Step                     │ Cost for an N-byte image              │
+ * ├──────────────────────────┼───────────────────────────────────────┤
+ * │ Per-byte Bus::Write      │ N device lookups + N 64-bit writes    │
+ * │ Bus::WriteBlock          │ 1 device lookup + 1 memcpy of N bytes │
+ * └──────────────────────────┴───────────────────────────────────────┘
+ *
+ * SECTIONED IMAGES:
+ * LoadImage() understands the AEX format (System/ExecutableImage.hpp).
+ * Each section is validated and copied to its own load address; BSS is
+ * not copied at all but zero-filled with Bus::ZeroBlock, which RAM
+ * serves by releasing pages rather than writing them. The image's entry
+ * point and symbols are kept for the caller (CPU reset, profiler).
+ *
+ * VALIDATION:
+ * Both ends of the destination range must pass IsRamAddress, so an image
+ * can never spill into MMIO space. The whole range must then be backed
+ * by one connected RAM device, or nothing is written.
  *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
@@ -24,7 +45,9 @@
 
 #include "Bus/Bus.hpp"
 #include "Core/Types.hpp"
+#include "System/ExecutableImage.hpp"
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -53,14 +76,14 @@ public:
    * @return true if file loaded successfully, false on error
    *
    * OPERATION:
-   * 1. Read entire binary file into memory buffer
-   * 2. Write buffer contents to Bus sequentially
-   * 3. Bus routes writes to RAM device
+   * 1. Map the file (or read it whole where mmap is unavailable)
+   * 2. Validate the destination range against RAM
+   * 3. Copy it into RAM with one bulk bus transfer
    *
    * ERROR CONDITIONS:
    * - File not found or cannot be opened
    * - Load address + file size exceeds RAM bounds
-   * - Bus write failure (device not connected, etc.)
+   * - Range not backed by a connected RAM device
    *
    * EXAMPLE:
    *   Loader loader(bus);
@@ -85,9 +108,44 @@ public:
    *   std::vector<uint8_t> program = {0x00, 0x00, 0x00, 0x80}; // MOV R0, #0
    *   loader.LoadData(program, 0x0);
    */
-  [[nodiscard]] bool LoadData(const std::vector<std::uint8_t> &data,
+  [[nodiscard]] bool LoadData(std::span<const std::uint8_t> data,
                               Address loadAddress = 0x0);
 
+  /**
+   * @brief Loads an AEX image file: all sections, entry point, symbols.
+   *
+   * @return false if the file is unreadable, malformed, or any section
+   *         falls outside RAM. Sections are validated before any is
+   *         written, so a rejected image leaves RAM untouched.
+   */
+  [[nodiscard]] bool LoadImage(const std::string &filename);
+
+  /**
+   * @brief Loads an AEX image already in memory.
+   */
+  [[nodiscard]] bool LoadImageData(std::span<const std::uint8_t> image);
+
+  /**
+   * @brief Loads an AEX image, or a flat binary at `flatAddress`.
+   *
+   * The format is chosen by the file's magic number. For flat binaries
+   * the entry point is `flatAddress` and there are no symbols.
+   */
+  [[nodiscard]] bool LoadExecutable(const std::string &filename,
+                                    Address flatAddress = 0x0);
+
+  /**
+   * @brief Where execution should start after the last successful load.
+   */
+  [[nodiscard]] Address GetEntryPoint() const { return m_EntryPoint; }
+
+  /**
+   * @brief Symbols of the last loaded image (empty for flat binaries).
+   */
+  [[nodiscard]] const std::vector<ImageSymbol> &GetSymbols() const {
+    return m_Symbols;
+  }
+
   /**
    * @brief Returns the last error message.
    *
@@ -103,18 +161,27 @@ public:
 private:
   Bus::Bus &m_Bus;
   std::string m_ErrorMessage;
+  Address m_EntryPoint = 0;
+  std::vector<ImageSymbol> m_Symbols;
+
+  /**
+   * @brief Check [loadAddress, loadAddress + size) lies in RAM.
+   *
+   * Updates m_ErrorMessage on failure.
+   */
+  bool ValidateRange(Address loadAddress, std::size_t size);
 
   /**
    * @brief Internal helper to write data to Bus.
    *
-   * Writes byte sequence to Bus starting at loadAddress.
+   * Copies the bytes to loadAddress in one Bus::WriteBlock.
    * Updates m_ErrorMessage on failure.
    *
    * @param data Bytes to write
    * @param loadAddress Starting address
-   * @return true if all writes succeeded
+   * @return true if the transfer succeeded
    */
-  bool WriteToBus(const std::vector<std::uint8_t> &data, Address loadAddress);
+  bool WriteToBus(std::span<const std::uint8_t> data, Address loadAddress);
 };
 
 } // namespace Aurelia::System
@@ -14,11 +14,32 @@
  * │ 0x1000_0000 -    │ Reserved (Future Expansion)            │
  * │ 0xDFFF_FFFF      │                                        │
  * ├──────────────────┼────────────────────────────────────────┤
- * │ 0xE000_0000 -    │ Storage Controller MMIO                │
- * │ 0xE000_0FFF      │ Size: 4 KB (NVMe-like registers)       │
+ * │ 0xE000_0000 -    │ SSD Buffer Window                      │
+ * │ 0xE000_0FFF      │ Size: 4 KB (raw persistence scratch)   │
  * ├──────────────────┼────────────────────────────────────────┤
- * │ 0xE000_1000 -    │ Reserved (Future: UART, PIC, Timer)    │
- * │ 0xFFFF_FFFF      │                                        │
+ * │ 0xE000_1000 -    │ UART, PIC, Timer, Keyboard, Mouse,     │
+ * │ 0xE000_8FFF      │ DMA, NIC, RTC (4 KB each)              │
+ * ├──────────────────┼────────────────────────────────────────┤
+ * │ 0xE001_0000 -    │ Storage Controller MMIO                │
+ * │ 0xE001_1FFF      │ Size: 8 KB (NVMe registers + doorbells)│
+ * ├──────────────────┼────────────────────────────────────────┤
+ * │ 0xE001_2000 -    │ Reserved (Future Expansion)            │
+ * │ 0xE001_FFFF      │                                        │
+ * ├──────────────────┼────────────────────────────────────────┤
+ * │ 0xE002_0000 -    │ Virtio Block Device (virtio-mmio)      │
+ * │ 0xE002_0FFF      │ Size: 4 KB                             │
+ * ├──────────────────┼────────────────────────────────────────┤
+ * │ 0xE002_1000 -    │ Reserved (Future Expansion)            │
+ * │ 0xEFFF_FFFF      │                                        │
+ * ├──────────────────┼────────────────────────────────────────┤
+ * │ 0xF000_0000 -    │ GPU Control Registers                  │
+ * │ 0xF000_0FFF      │ Size: 4 KB                             │
+ * ├──────────────────┼────────────────────────────────────────┤
+ * │ 0xF000_1000 -    │ 2D Blitter Registers                   │
+ * │ 0xF000_1FFF      │ Size: 4 KB                             │
+ * ├──────────────────┼────────────────────────────────────────┤
+ * │ 0xF010_0000 -    │ GPU VRAM (640 × 480 RGBA8888)          │
+ * │ 0xF022_BFFF      │ Size: 1200 KB                          │
  * └──────────────────┴────────────────────────────────────────┘
  *
  * DESIGN RATIONALE:
@@ -74,38 +95,99 @@ constexpr Address RamEnd = RamBase + RamSize - 1;  // 0x0FFF_FFFF
 constexpr Address MmioBase = 0xE0000000;
 
 /**
- * Storage Controller MMIO
+ * SSD Buffer Window
  *
  * Base Address: 0xE000_0000
  * Size: 4 KB (0x1000 bytes)
  *
+ * Plain RAM-backed scratch page used by the built-in demo and integration
+ * tests to check the CPU → Bus → MMIO store path.
+ */
+constexpr Address SsdBufferBase = MmioBase;
+constexpr std::size_t SsdBufferSize = 4096; // 4 KB
+
+/**
+ * Storage Controller MMIO
+ *
+ * Base Address: 0xE001_0000
+ * Size: 8 KB (0x2000 bytes)
+ *
  * Maps the NVMe-like controller registers:
  * - CAP (Capabilities)
  * - CC (Controller Configuration)
  * - CSTS (Controller Status)
  * - Admin Queue Addresses
- * - Doorbell Registers
+ * - Doorbell Registers (at +0x1000, per the NVMe layout)
+ *
+ * NOTE (KleaSCM) The controller used to sit at 0xE000_0000, but its
+ * doorbell page then overlapped the UART at 0xE000_1000. It now has its
+ * own 64 KB-aligned slot above the small peripherals.
  *
  * See Storage/Controller/StorageController.hpp for register layout.
  */
-constexpr Address StorageControllerBase = MmioBase;
-constexpr std::size_t StorageControllerSize = 4096; // 4 KB
+constexpr Address StorageControllerBase = 0xE0010000;
+constexpr std::size_t StorageControllerSize = 0x2000; // 8 KB
 constexpr Address StorageControllerEnd =
     StorageControllerBase + StorageControllerSize - 1;
 
 /**
- * Future Peripheral Regions (Phase 8)
- *
- * Reserved address space for upcoming I/O devices:
- * - UART (Serial Console): Will be at 0xE000_1000
- * - PIC (Interrupt Controller): Will be at 0xE000_2000
- * - Timer: Will be at 0xE000_3000
+ * Peripheral Regions
+ *
+ * - UART (Serial Console): 0xE000_1000
+ * - PIC (Interrupt Controller): 0xE000_2000
+ * - Timer: 0xE000_3000
+ * - Keyboard Controller: 0xE000_4000
+ * - Mouse: 0xE000_5000
+ * - DMA Controller: 0xE000_6000
+ * - Network Interface: 0xE000_7000
+ * - Real-Time Clock: 0xE000_8000
  */
 constexpr Address UartBase = 0xE0001000;     // 4 KB reserved
 constexpr Address PicBase = 0xE0002000;      // 4 KB reserved
 constexpr Address TimerBase = 0xE0003000;    // 4 KB reserved
 constexpr Address KeyboardBase = 0xE0004000; // 4 KB reserved
 constexpr Address MouseBase = 0xE0005000;    // 4 KB reserved
+constexpr Address DmaBase = 0xE0006000;      // 4 KB reserved
+constexpr Address NetBase = 0xE0007000;      // 4 KB reserved
+constexpr Address RtcBase = 0xE0008000;      // 4 KB reserved
+
+/**
+ * Virtio Block Device
+ *
+ * Base Address: 0xE002_0000
+ * Size: 4 KB
+ *
+ * Paravirtual disk backed by a host image file, bypassing NAND/FTL.
+ * See Storage/Virtio/VirtioBlockDevice.hpp for the register layout.
+ */
+constexpr Address VirtioBlockBase = 0xE0020000;
+
+/**
+ * GPU (Framebuffer)
+ *
+ * Registers: 0xF000_0000 (4 KB)
+ * VRAM:      0xF010_0000 (640 × 480 × 4 bytes, linear, RGBA8888)
+ *
+ * NOTE (KleaSCM) VRAM starts on a 1 MB boundary so guest code can form
+ * the base with a single shift, and the register page stays put if the
+ * framebuffer ever grows.
+ *
+ * See Graphics/GpuDevice.hpp for the register layout.
+ */
+constexpr Address GpuBase = 0xF0000000;
+constexpr Address GpuVramBase = 0xF0100000;
+constexpr std::size_t GpuVramSize = 640 * 480 * 4; // 1200 KB
+
+/**
+ * 2D Blitter
+ *
+ * Base Address: 0xF000_1000
+ * Size: 4 KB
+ *
+ * Command-queue fill/copy/blend engine drawing into GPU VRAM.
+ * See Graphics/BlitterDevice.hpp for the register layout.
+ */
+constexpr Address BlitterBase = 0xF0001000;
 
 /**
  * Reset Vector
@@ -0,0 +1,120 @@
+/**
+ * Aurelia Headless Virtual Machine Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "System/VirtualMachine.hpp"
+#include "System/ClockDomains.hpp"
+#include "System/Loader.hpp"
+
+namespace Aurelia::System {
+
+VirtualMachine::VirtualMachine(const VmConfig &config)
+    : m_Ram(config.RamBytes, 0), m_Output(config.OutputLimit),
+      m_Input(m_Uart) {
+  m_Bus.ConnectDevice(&m_Ram);
+  m_Bus.ConnectDevice(&m_Uart);
+  m_Bus.ConnectDevice(&m_Pic);
+  m_Bus.ConnectDevice(&m_Timer);
+  m_Bus.ConnectDevice(&m_Rtc);
+  m_Cpu.ConnectBus(&m_Bus);
+  m_Rtc.ConnectPic(&m_Pic);
+
+  // Nothing reads the console interactively: batch it all
+  m_Uart.SetSink(&m_Output);
+  m_Uart.ConfigureTxBatching({Peripherals::UartDevice::TxBatchCapacity,
+                              false, 1'000'000});
+
+  // Same clock tree as the full machine (System/ClockDomains.hpp)
+  m_Machine.AddDevice(&m_Cpu, CoreClockDivider);
+  m_Machine.AddDevice(&m_Bus, CoreClockDivider);
+  m_Machine.AddDevice(&m_Ram, CoreClockDivider);
+  m_Machine.AddDevice(&m_Uart, CoreClockDivider);
+  m_Machine.AddDevice(&m_Timer, TimerClockDivider);
+  m_Machine.AddDevice(&m_Pic, ControlClockDivider);
+  m_Machine.AddDevice(&m_Rtc, ControlClockDivider);
+  m_Machine.AddDevice(&m_Input, ControlClockDivider);
+  m_Rtc.ConnectClock(&m_Machine.GetClock());
+  if (config.VirtualTime) {
+    m_Rtc.SetMode(Peripherals::RtcMode::Virtual);
+  }
+
+  if (config.NandBlocks != 0) {
+    m_Nand = std::make_unique<Storage::Nand::NandChip>(config.NandBlocks);
+    m_Ftl = std::make_unique<Storage::FTL::Ftl>(m_Nand.get(),
+                                                config.NandBlocks);
+    m_Storage =
+        std::make_unique<Storage::Controller::StorageController>(m_Ftl.get());
+    m_Storage->SetBaseAddress(StorageControllerBase);
+    m_Storage->ConnectBus(&m_Bus); // DMA master
+    m_Bus.ConnectDevice(m_Storage.get());
+    m_Machine.AddDevice(m_Storage.get(), CoreClockDivider);
+  }
+
+  m_Cpu.Reset(ResetVector);
+}
+
+bool VirtualMachine::LoadExecutable(const std::string &path) {
+  Loader loader(m_Bus);
+  if (!loader.LoadExecutable(path, ResetVector)) {
+    m_ErrorMessage = loader.GetErrorMessage();
+    return false;
+  }
+  m_Cpu.Reset(loader.GetEntryPoint());
+  return true;
+}
+
+bool VirtualMachine::LoadProgram(std::span<const std::uint8_t> program,
+                                 Core::Address address) {
+  Loader loader(m_Bus);
+  if (!loader.LoadData(program, address)) {
+    m_ErrorMessage = loader.GetErrorMessage();
+    return false;
+  }
+  m_Cpu.Reset(address);
+  return true;
+}
+
+void VirtualMachine::QueueInput(std::string_view bytes) {
+  m_Input.Queue(bytes);
+}
+
+VmExit VirtualMachine::Run(Core::TickCount budget) {
+  if (!m_Cpu.IsHalted()) {
+    m_Machine.RunUntil([this] { return m_Cpu.IsHalted(); }, budget);
+  }
+  m_Uart.FlushTx();
+  return m_Cpu.IsHalted() ? VmExit::Halted : VmExit::BudgetExhausted;
+}
+
+VmExit VirtualMachine::RunSlice(Core::TickCount quantum) {
+  Core::RunExit exit = Core::RunExit::Done;
+  if (!m_Cpu.IsHalted()) {
+    exit = m_Machine.RunSlice([this] { return m_Cpu.IsHalted(); }, quantum);
+  }
+  m_Uart.FlushTx();
+
+  switch (exit) {
+  case Core::RunExit::Done:
+    return VmExit::Halted;
+  case Core::RunExit::Yielded:
+    return VmExit::Yielded;
+  case Core::RunExit::LimitReached:
+    break;
+  }
+  return VmExit::BudgetExhausted;
+}
+
+void VirtualMachine::InputFeeder::OnTick() {
+  while (m_Next < m_Pending.size() && m_Uart.CanReceive()) {
+    m_Uart.SimulateReceive(static_cast<std::uint8_t>(m_Pending[m_Next++]));
+  }
+  if (m_Next == m_Pending.size() && m_Next != 0) {
+    m_Pending.clear(); // All delivered: release the buffer
+    m_Next = 0;
+  }
+}
+
+} // namespace Aurelia::System
@@ -0,0 +1,186 @@
+/**
+ * Aurelia Headless Virtual Machine.
+ *
+ * One complete, self-contained guest machine as an object: its own bus,
+ * RAM, CPU, console UART and timers, with no host console, files or
+ * threads attached. Any number can live in one process, on any threads,
+ * which is what the batch runner does instead of starting a process per
+ * guest program.
+ *
+ * DEVICES:
+ * ┌────────────┬────────────┬─────────────────────────────────────────┐
+ * │ Device     │ Address    │ Host side                               │
+ * ├────────────┼────────────┼─────────────────────────────────────────┤
+ * │ RAM        │ 0x00000000 │ Sparse anonymous mapping (RamDevice)    │
+ * │ UART       │ 0xE0001000 │ RX fed from QueueInput(), TX captured   │
+ * │ PIC        │ 0xE0002000 │                                         │
+ * │ Timer      │ 0xE0003000 │                                         │
+ * │ RTC        │ 0xE0008000 │ Virtual time by default (reproducible)  │
+ * │ NVMe       │ 0xE0010000 │ Only if NandBlocks != 0: FTL on a fresh │
+ * │            │            │ in-memory NAND array                    │
+ * └────────────┴────────────┴─────────────────────────────────────────┘
+ * GPU, network and input devices are left out, and storage is opt-in:
+ * regression programs talk through the console, and every extra device
+ * is per-cycle work multiplied by thousands of runs.
+ *
+ * CONSOLE INPUT:
+ * QueueInput() bytes are delivered to the UART as the guest drains its
+ * RX FIFO, like a serial line with hardware flow control, so arbitrarily
+ * long input never overruns the 16-byte FIFO.
+ *
+ * TIME SLICING:
+ * RunSlice() runs at most one quantum and returns Yielded if the program
+ * is still going; the machine resumes exactly where it stopped on the
+ * next call, on any thread. SetCycleLimit() is a hard cap on the total
+ * cycles however the run is sliced.
+ *
+ * THREADING:
+ * A VirtualMachine shares nothing with any other, so separate instances
+ * may run concurrently. A single instance is not thread-safe, but may
+ * move between threads as long as the hand-off is synchronised.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Bus/Bus.hpp"
+#include "Core/System.hpp"
+#include "Cpu/Cpu.hpp"
+#include "Memory/RamDevice.hpp"
+#include "Peripherals/PicDevice.hpp"
+#include "Peripherals/RtcDevice.hpp"
+#include "Peripherals/TimerDevice.hpp"
+#include "Peripherals/UartDevice.hpp"
+#include "Peripherals/UartSink.hpp"
+#include "Storage/Controller/StorageController.hpp"
+#include "Storage/FTL/Ftl.hpp"
+#include "Storage/Nand/NandChip.hpp"
+#include "System/MemoryMap.hpp"
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace Aurelia::System {
+
+struct VmConfig {
+  std::size_t RamBytes = RamSize;
+  bool VirtualTime = true;                    // RTC counts guest cycles
+  std::size_t OutputLimit = 16 * 1024 * 1024; // Captured console bytes
+  std::size_t NandBlocks = 0; // NVMe storage size; 0 = no controller
+};
+
+enum class VmExit : std::uint8_t {
+  Halted,         // CPU executed HALT
+  BudgetExhausted, // Cycle budget (or limit) ran out first
+  Yielded          // RunSlice() quantum used up; still running
+};
+
+class VirtualMachine {
+public:
+  explicit VirtualMachine(const VmConfig &config = {});
+
+  VirtualMachine(const VirtualMachine &) = delete;
+  VirtualMachine &operator=(const VirtualMachine &) = delete;
+
+  /**
+   * @brief Load an AEX image or flat binary and reset the CPU to its entry.
+   * @return false with GetErrorMessage() set if the file cannot be loaded
+   */
+  bool LoadExecutable(const std::string &path);
+
+  /**
+   * @brief Load a flat program from memory at `address` and reset to it.
+   */
+  bool LoadProgram(std::span<const std::uint8_t> program,
+                   Core::Address address = ResetVector);
+
+  /**
+   * @brief Append bytes to the console input line.
+   */
+  void QueueInput(std::string_view bytes);
+
+  /**
+   * @brief Run until HALT or until `budget` more cycles have elapsed.
+   *
+   * May be called again to continue a machine that ran out of budget.
+   * Console output is flushed to GetOutput() before returning.
+   */
+  VmExit Run(Core::TickCount budget);
+
+  /**
+   * @brief Run for at most `quantum` cycles, then yield.
+   *
+   * Returns Halted, Yielded, or BudgetExhausted once the cycle limit is
+   * reached. Console output is flushed before returning.
+   */
+  VmExit RunSlice(Core::TickCount quantum);
+
+  /**
+   * @brief Hard cap on total cycles for RunSlice() (0 = unlimited).
+   */
+  void SetCycleLimit(Core::TickCount limit) {
+    m_Machine.SetCycleLimit(limit);
+  }
+
+  [[nodiscard]] const std::string &GetOutput() const {
+    return m_Output.Contents();
+  }
+
+  /**
+   * @brief Console bytes discarded after OutputLimit was reached.
+   */
+  [[nodiscard]] std::size_t GetOutputDropped() const {
+    return m_Output.GetDroppedCount();
+  }
+
+  [[nodiscard]] Core::TickCount GetCycles() const {
+    return m_Machine.GetClock().GetTotalTicks();
+  }
+
+  [[nodiscard]] const std::string &GetErrorMessage() const {
+    return m_ErrorMessage;
+  }
+
+  [[nodiscard]] Cpu::Cpu &GetCpu() { return m_Cpu; }
+  [[nodiscard]] Bus::Bus &GetBus() { return m_Bus; }
+
+private:
+  /**
+   * Feeds queued console input to the UART whenever it can take a byte.
+   */
+  class InputFeeder final : public Core::ITickable {
+  public:
+    explicit InputFeeder(Peripherals::UartDevice &uart) : m_Uart(uart) {}
+
+    void Queue(std::string_view bytes) { m_Pending.append(bytes); }
+    void OnTick() override;
+
+  private:
+    Peripherals::UartDevice &m_Uart;
+    std::string m_Pending;
+    std::size_t m_Next = 0;
+  };
+
+  Bus::Bus m_Bus;
+  Memory::RamDevice m_Ram;
+  Cpu::Cpu m_Cpu;
+  Peripherals::UartDevice m_Uart;
+  Peripherals::PicDevice m_Pic;
+  Peripherals::TimerDevice m_Timer;
+  Peripherals::RtcDevice m_Rtc;
+  Peripherals::BufferSink m_Output;
+  InputFeeder m_Input;
+  Core::System m_Machine;
+
+  // Optional NVMe stack (VmConfig::NandBlocks)
+  std::unique_ptr<Storage::Nand::NandChip> m_Nand;
+  std::unique_ptr<Storage::FTL::Ftl> m_Ftl;
+  std::unique_ptr<Storage::Controller::StorageController> m_Storage;
+
+  std::string m_ErrorMessage;
+};
+
+} // namespace Aurelia::System
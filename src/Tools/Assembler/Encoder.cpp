@@ -29,7 +29,7 @@
 
 namespace Aurelia::Tools::Assembler {
 
-Encoder::Encoder(const std::vector<ParsedInstruction> &instructions)
+Encoder::Encoder(std::span<const ParsedInstruction> instructions)
     : m_Instructions(instructions) {}
 
 bool Encoder::Encode() {
@@ -55,6 +55,11 @@ bool Encoder::Encode() {
   return true;
 }
 
+bool Encoder::EncodeOne(const ParsedInstruction &instr, std::uint32_t &word) {
+  word = EncodeInstruction(instr);
+  return !m_HasError;
+}
+
 std::uint32_t Encoder::EncodeInstruction(const ParsedInstruction &instr) {
   /**
    * OPCODE-SPECIFIC ENCODING STRATEGY
@@ -82,7 +87,7 @@ std::uint32_t Encoder::EncodeInstruction(const ParsedInstruction &instr) {
      * Format: Op (all register/immediate fields zero)
      */
     if (!instr.Operands.empty()) {
-      Error(instr, instr.Mnemonic + " takes no operands");
+      Error(instr, std::string(instr.Mnemonic) + " takes no operands");
       return 0;
     }
     break;
@@ -105,13 +110,15 @@ std::uint32_t Encoder::EncodeInstruction(const ParsedInstruction &instr) {
      * Maximum backward jump: -1024 bytes = 256 instructions
      */
     if (instr.Operands.size() != 1) {
-      Error(instr, instr.Mnemonic + " requires exactly 1 operand (offset)");
+      Error(instr, std::string(instr.Mnemonic) +
+                       " requires exactly 1 operand (offset)");
       return 0;
     }
 
     if (instr.Operands[0].Type != OperandType::Immediate) {
-      Error(instr, instr.Mnemonic + " operand must be immediate offset (labels "
-                                    "resolved by Resolver)");
+      Error(instr, std::string(instr.Mnemonic) +
+                       " operand must be immediate offset (labels "
+                       "resolved by Resolver)");
       return 0;
     }
 
@@ -283,14 +290,15 @@ std::uint32_t Encoder::EncodeInstruction(const ParsedInstruction &instr) {
      * - Op Rd, Rn, #Imm → Rd, Rn, and Immediate fields used, Rm=0
      */
     if (instr.Operands.size() != 3) {
-      Error(instr,
-            instr.Mnemonic + " requires exactly 3 operands (Rd, Rn, Src)");
+      Error(instr, std::string(instr.Mnemonic) +
+                       " requires exactly 3 operands (Rd, Rn, Src)");
       return 0;
     }
 
     // Destination must be register
     if (instr.Operands[0].Type != OperandType::Register) {
-      Error(instr, instr.Mnemonic + " destination must be a register");
+      Error(instr, std::string(instr.Mnemonic) +
+                       " destination must be a register");
       return 0;
     }
 
@@ -304,7 +312,8 @@ std::uint32_t Encoder::EncodeInstruction(const ParsedInstruction &instr) {
 
     // First source must be register
     if (instr.Operands[1].Type != OperandType::Register) {
-      Error(instr, instr.Mnemonic + " first source must be a register");
+      Error(instr, std::string(instr.Mnemonic) +
+                       " first source must be a register");
       return 0;
     }
 
@@ -335,15 +344,15 @@ std::uint32_t Encoder::EncodeInstruction(const ParsedInstruction &instr) {
           std::get<ImmediateOperand>(instr.Operands[2].Value).Value;
 
       if (val > 2047) {
-        Error(instr, instr.Mnemonic + " immediate out of range: " +
+        Error(instr, std::string(instr.Mnemonic) + " immediate out of range: " +
                          std::to_string(val) + " (must be in [0, 2047])");
         return 0;
       }
 
       imm = static_cast<std::uint32_t>(val);
     } else {
-      Error(instr,
-            instr.Mnemonic + " second source must be register or immediate");
+      Error(instr, std::string(instr.Mnemonic) +
+                       " second source must be register or immediate");
       return 0;
     }
     break;
@@ -366,14 +375,15 @@ std::uint32_t Encoder::EncodeInstruction(const ParsedInstruction &instr) {
      * still encodes in the Rd field per ISA specification.
      */
     if (instr.Operands.size() != 2) {
-      Error(instr, instr.Mnemonic +
+      Error(instr, std::string(instr.Mnemonic) +
                        " requires exactly 2 operands (Rd, [Rn, #Offset])");
       return 0;
     }
 
     // First operand must be register (data register)
     if (instr.Operands[0].Type != OperandType::Register) {
-      Error(instr, instr.Mnemonic + " data operand must be a register");
+      Error(instr, std::string(instr.Mnemonic) +
+                       " data operand must be a register");
       return 0;
     }
 
@@ -387,7 +397,7 @@ std::uint32_t Encoder::EncodeInstruction(const ParsedInstruction &instr) {
 
     // Second operand must be memory (bracket syntax)
     if (instr.Operands[1].Type != OperandType::Memory) {
-      Error(instr, instr.Mnemonic +
+      Error(instr, std::string(instr.Mnemonic) +
                        " address operand must be memory syntax [Rn, #Offset]");
       return 0;
     }
@@ -403,7 +413,7 @@ std::uint32_t Encoder::EncodeInstruction(const ParsedInstruction &instr) {
 
       // Validate signed 11-bit offset range
       if (mem.Offset < -1024 || mem.Offset > 1023) {
-        Error(instr, instr.Mnemonic +
+        Error(instr, std::string(instr.Mnemonic) +
                          " offset out of range: " + std::to_string(mem.Offset) +
                          " (must be in [-1024, +1023])");
         return 0;
@@ -415,7 +425,8 @@ std::uint32_t Encoder::EncodeInstruction(const ParsedInstruction &instr) {
     break;
 
   default:
-    Error(instr, "Unknown or unimplemented opcode: " + instr.Mnemonic);
+    Error(instr, "Unknown or unimplemented opcode: " +
+                     std::string(instr.Mnemonic));
     return 0;
   }
 
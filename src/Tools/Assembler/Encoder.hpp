@@ -10,7 +10,7 @@
  * instruction width with RISC-like encoding principles.
  *
  * ENCODING PIPELINE:
- * Input:  std::vector<ParsedInstruction> (from Resolver, labels resolved)
+ * Input:  ParsedInstructions (from Resolver, labels resolved)
  * Output: std::vector<uint8_t> (ready-to-execute machine code)
  *
  * The encoding process validates operand types, maps operands to bit fields,
@@ -29,6 +29,7 @@
 
 #include "Tools/Assembler/Parser.hpp"
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -59,9 +60,9 @@ public:
    *                     of the Encoder or until Encode() completes.
    *
    * NOTE (KleaSCM) The Encoder does NOT take ownership of instructions.
-   * The caller must ensure the instruction vector outlives the Encoder.
+   * The caller must ensure the instructions outlive the Encoder.
    */
-  explicit Encoder(const std::vector<ParsedInstruction> &instructions);
+  explicit Encoder(std::span<const ParsedInstruction> instructions);
 
   /**
    * @brief Encodes all instructions into binary machine code.
@@ -82,6 +83,18 @@ public:
    */
   [[nodiscard]] bool Encode();
 
+  /**
+   * @brief Encodes one instruction on its own, outside the sequence.
+   *
+   * For callers that produce instructions one at a time and place the
+   * words themselves (StreamingAssembler). GetBinary() is untouched;
+   * errors are reported as for Encode().
+   *
+   * @param[out] word The 32-bit instruction word on success.
+   */
+  [[nodiscard]] bool EncodeOne(const ParsedInstruction &instr,
+                               std::uint32_t &word);
+
   /**
    * @brief Retrieves the encoded binary output.
    *
@@ -117,7 +130,7 @@ private:
    */
 
   /// @brief Reference to source instruction sequence (immutable).
-  const std::vector<ParsedInstruction> &m_Instructions;
+  std::span<const ParsedInstruction> m_Instructions;
 
   /// @brief Output binary buffer (grows during encoding).
   std::vector<std::uint8_t> m_Binary;
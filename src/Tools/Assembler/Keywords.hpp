@@ -0,0 +1,195 @@
+/**
+ * Assembler Keyword Table.
+ *
+ * Classifies an identifier or directive as a mnemonic, register or known
+ * directive with one hash, one table probe and one compare. The table and
+ * its hash seed are built at compile time; an identifier that is not a
+ * keyword costs the same as one that is.
+ *
+ * LOOKUP:
+ * ┌──────┬────────────────────────────────────────────────────────────────┐
+ * │ Step │ Work                                                           │
+ * ├──────┼────────────────────────────────────────────────────────────────┤
+ * │ 1    │ Length above MaxKeywordLength: a name, done                    │
+ * │ 2    │ FNV-1a over the case-folded bytes, top SlotBits bits           │
+ * │ 3    │ Slot -> entry index (or Empty: a name, done)                   │
+ * │ 4    │ Compare the folded text against that one entry                 │
+ * └──────┴────────────────────────────────────────────────────────────────┘
+ *
+ * The seed is the first one under which no two keywords share a slot, so
+ * step 4 never has to look at a second entry. Adding a keyword re-runs the
+ * search at compile time; if none is found the build fails.
+ *
+ * NOTE (KleaSCM) Folding is `c | 0x20`, which lower-cases letters and
+ * leaves digits and '.' alone. It is only sound for what the Lexer feeds
+ * in: letters, digits, '_' and a leading '.'. ('_' folds to DEL, which no
+ * keyword contains.)
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Cpu/InstructionDefs.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace Aurelia::Tools::Assembler {
+
+/**
+ * Known directives; a Directive token's Id. Unknown is 0, so a directive
+ * missing from the table needs no special case in the Lexer.
+ */
+enum class Directive : std::uint8_t {
+  Unknown,
+  String,
+  Space,
+  Text,
+  RoData,
+  Data,
+  Bss,
+  Global,
+  Entry
+};
+
+/**
+ * A keyword's token type and Id (opcode, register index or Directive).
+ */
+struct Keyword {
+  TokenType Type;
+  std::uint32_t Id;
+};
+
+namespace Keywords {
+
+struct Entry {
+  std::string_view Name; // Lower case
+  Keyword Value;
+};
+
+constexpr Entry Op(std::string_view name, Cpu::Opcode opcode) {
+  return {name, {TokenType::Mnemonic, static_cast<std::uint32_t>(opcode)}};
+}
+
+constexpr Entry Reg(std::string_view name, std::uint32_t index) {
+  return {name, {TokenType::Register, index}};
+}
+
+constexpr Entry Dir(std::string_view name, Directive directive) {
+  return {name,
+          {TokenType::Directive, static_cast<std::uint32_t>(directive)}};
+}
+
+inline constexpr auto Table = std::to_array<Entry>({
+    Op("add", Cpu::Opcode::ADD),   Op("sub", Cpu::Opcode::SUB),
+    Op("and", Cpu::Opcode::AND),   Op("or", Cpu::Opcode::OR),
+    Op("xor", Cpu::Opcode::XOR),   Op("lsl", Cpu::Opcode::LSL),
+    Op("lsr", Cpu::Opcode::LSR),   Op("asr", Cpu::Opcode::ASR),
+    Op("mov", Cpu::Opcode::MOV),   Op("ldr", Cpu::Opcode::LDR),
+    Op("str", Cpu::Opcode::STR),   Op("b", Cpu::Opcode::B),
+    Op("beq", Cpu::Opcode::BEQ),   Op("bne", Cpu::Opcode::BNE),
+    Op("cmp", Cpu::Opcode::CMP),   Op("nop", Cpu::Opcode::NOP),
+    Op("halt", Cpu::Opcode::Halt),
+
+    Reg("r0", 0),   Reg("r1", 1),   Reg("r2", 2),   Reg("r3", 3),
+    Reg("r4", 4),   Reg("r5", 5),   Reg("r6", 6),   Reg("r7", 7),
+    Reg("r8", 8),   Reg("r9", 9),   Reg("r10", 10), Reg("r11", 11),
+    Reg("r12", 12), Reg("r13", 13), Reg("r14", 14), Reg("r15", 15),
+    Reg("r16", 16), Reg("r17", 17), Reg("r18", 18), Reg("r19", 19),
+    Reg("r20", 20), Reg("r21", 21), Reg("r22", 22), Reg("r23", 23),
+    Reg("r24", 24), Reg("r25", 25), Reg("r26", 26), Reg("r27", 27),
+    Reg("r28", 28), Reg("r29", 29), Reg("r30", 30), Reg("r31", 31),
+    Reg("sp", 30),  Reg("lr", 31),  Reg("pc", 32), // PC: not a GPR
+
+    Dir(".string", Directive::String), Dir(".space", Directive::Space),
+    Dir(".text", Directive::Text),     Dir(".rodata", Directive::RoData),
+    Dir(".data", Directive::Data),     Dir(".bss", Directive::Bss),
+    Dir(".global", Directive::Global), Dir(".entry", Directive::Entry),
+});
+
+inline constexpr std::size_t MaxKeywordLength = [] {
+  std::size_t longest = 0;
+  for (const Entry &entry : Table) {
+    longest = entry.Name.size() > longest ? entry.Name.size() : longest;
+  }
+  return longest;
+}();
+
+// 512 one-byte slots for ~60 keywords: sparse enough that a collision-free
+// seed turns up within a few dozen tries
+inline constexpr unsigned SlotBits = 9;
+inline constexpr std::size_t SlotCount = std::size_t{1} << SlotBits;
+inline constexpr std::uint8_t Empty = 0xFF;
+static_assert(Table.size() < Empty, "Slot indices are one byte");
+
+constexpr char Fold(char c) { return static_cast<char>(c | 0x20); }
+
+constexpr std::size_t Hash(std::string_view text, std::uint32_t seed) {
+  std::uint32_t hash = 0x811C9DC5u ^ seed;
+  for (char c : text) {
+    hash = (hash ^ static_cast<unsigned char>(Fold(c))) * 0x01000193u;
+  }
+  return hash >> (32 - SlotBits);
+}
+
+/**
+ * @brief Slot table for `seed`, or nullopt if two keywords collide.
+ */
+constexpr std::optional<std::array<std::uint8_t, SlotCount>>
+BuildSlots(std::uint32_t seed) {
+  std::array<std::uint8_t, SlotCount> slots{};
+  slots.fill(Empty);
+  for (std::size_t i = 0; i < Table.size(); ++i) {
+    std::uint8_t &slot = slots[Hash(Table[i].Name, seed)];
+    if (slot != Empty) {
+      return std::nullopt;
+    }
+    slot = static_cast<std::uint8_t>(i);
+  }
+  return slots;
+}
+
+inline constexpr std::uint32_t Seed = [] {
+  std::uint32_t seed = 0;
+  while (!BuildSlots(seed)) {
+    ++seed; // Not found: the build stops at the constexpr step limit
+  }
+  return seed;
+}();
+
+inline constexpr std::array<std::uint8_t, SlotCount> Slots = *BuildSlots(Seed);
+
+} // namespace Keywords
+
+/**
+ * @brief Mnemonic, register or directive named by `text`, case-insensitive.
+ *
+ * `text` is an identifier or a '.'-prefixed directive as the Lexer scans
+ * them; anything else returns nullopt.
+ */
+[[nodiscard]] constexpr std::optional<Keyword>
+FindKeyword(std::string_view text) {
+  if (text.empty() || text.size() > Keywords::MaxKeywordLength) {
+    return std::nullopt;
+  }
+  std::uint8_t index = Keywords::Slots[Keywords::Hash(text, Keywords::Seed)];
+  if (index == Keywords::Empty) {
+    return std::nullopt;
+  }
+  const Keywords::Entry &entry = Keywords::Table[index];
+  if (entry.Name.size() != text.size()) {
+    return std::nullopt;
+  }
+  for (std::size_t i = 0; i < text.size(); ++i) {
+    if (Keywords::Fold(text[i]) != entry.Name[i]) {
+      return std::nullopt;
+    }
+  }
+  return entry.Value;
+}
+
+} // namespace Aurelia::Tools::Assembler
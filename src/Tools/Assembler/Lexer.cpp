@@ -8,18 +8,35 @@
  */
 
 #include "Tools/Assembler/Lexer.hpp"
-#include <algorithm>
+#include "Tools/Assembler/Keywords.hpp"
 #include <cctype>
 #include <charconv>
-#include <iostream>
-#include <unordered_map>
 
 namespace Aurelia::Tools::Assembler {
 
 Lexer::Lexer(std::string_view source) : m_Source(source) {}
 
+Lexer::Lexer() : m_Symbols(NameStorage::Copy), m_LineMode(true) {}
+
 std::vector<Token> Lexer::Tokenize() {
   std::vector<Token> tokens;
+  // Generated code averages a token per 4-5 source bytes; one up-front
+  // reservation replaces the growth reallocations on multi-MB inputs
+  tokens.reserve(m_Source.size() / 4 + 1);
+  ScanTokens(tokens);
+  return tokens;
+}
+
+void Lexer::TokenizeLine(std::string_view line, std::vector<Token> &tokens) {
+  m_Source = line;
+  m_Current = 0;
+  m_LineStart = 0;
+  tokens.clear();
+  ScanTokens(tokens);
+  m_Line++; // The newline the caller stripped
+}
+
+void Lexer::ScanTokens(std::vector<Token> &tokens) {
   while (!IsAtEnd()) {
     SkipWhitespace();
     if (IsAtEnd())
@@ -34,7 +51,6 @@ std::vector<Token> Lexer::Tokenize() {
   // vector bounds.
   tokens.push_back({TokenType::EndOfFile, "", std::nullopt, m_Line,
                     m_Current - m_LineStart});
-  return tokens;
 }
 
 char Lexer::Peek(std::size_t offset) const {
@@ -100,12 +116,13 @@ Token Lexer::ScanToken() {
     if (std::isalpha(Peek())) {
       while (std::isalnum(Peek()))
         Advance();
-      return {TokenType::Directive,
-              std::string(m_Source.substr(start, m_Current - start)),
-              std::nullopt, m_Line, column};
+      std::string_view text = m_Source.substr(start, m_Current - start);
+      std::optional<Keyword> keyword = FindKeyword(text);
+      return {TokenType::Directive, text, std::nullopt, m_Line, column,
+              keyword ? keyword->Id : 0}; // Unknown ones are the parser's
     }
-    return {TokenType::Unknown, std::string(1, c), std::nullopt, m_Line,
-            column};
+    return {TokenType::Unknown, m_Source.substr(start, 1), std::nullopt,
+            m_Line, column};
   case '#':
     return ScanNumber();
   default:
@@ -117,7 +134,8 @@ Token Lexer::ScanToken() {
     break;
   }
 
-  return {TokenType::Unknown, std::string(1, c), std::nullopt, m_Line, column};
+  return {TokenType::Unknown, m_Source.substr(start, 1), std::nullopt, m_Line,
+          column};
 }
 
 Token Lexer::ScanNumber() {
@@ -166,18 +184,19 @@ Token Lexer::ScanNumber() {
   std::int64_t value = 0;
   auto result = std::from_chars(first, last, value, base);
 
-  std::string fullText(m_Source.substr(start, m_Current - start));
-
   if (result.ec != std::errc()) {
     // Overflow or invalid
-    return {TokenType::Unknown, fullText, std::nullopt, m_Line, column};
+    return {TokenType::Unknown, m_Source.substr(start, m_Current - start),
+            std::nullopt, m_Line, column};
   }
 
   if (isNegative) {
     value = -value;
   }
 
-  return {TokenType::Immediate, "#" + fullText,
+  // Text keeps the '#', which sits just before `start`
+  return {TokenType::Immediate,
+          m_Source.substr(start - 1, m_Current - start + 1),
           static_cast<std::uint64_t>(value), m_Line, column};
 }
 
@@ -198,11 +217,9 @@ Token Lexer::ScanString() {
 
   Advance(); // Consume closing quote
 
-  // Store content *without* quotes
-  std::string text =
-      std::string(m_Source.substr(start + 1, m_Current - start - 2));
-
-  return {TokenType::String, text, std::nullopt, m_Line, column};
+  // Content *without* quotes
+  return {TokenType::String, m_Source.substr(start + 1, m_Current - start - 2),
+          std::nullopt, m_Line, column};
 }
 
 Token Lexer::ScanIdentifier() {
@@ -213,62 +230,24 @@ Token Lexer::ScanIdentifier() {
     Advance();
   }
 
-  std::string text(m_Source.substr(start, m_Current - start));
-  TokenType type = CheckKeyword(text);
+  std::string_view text = m_Source.substr(start, m_Current - start);
 
   // Check for Label definition (Identifier followed by colon)
   if (Peek() == ':') {
     Advance(); // Consume ':'
-    return {TokenType::Label, text, std::nullopt, m_Line,
-            column}; // Return name without colon as label
+    // Name without colon; labels are case-sensitive, keywords are not
+    SymbolId id = m_Symbols.Intern(text);
+    return {TokenType::Label, m_LineMode ? m_Symbols.GetName(id) : text,
+            std::nullopt, m_Line, column, id};
   }
 
-  return {type, text, std::nullopt, m_Line, column};
-}
-
-TokenType Lexer::CheckKeyword(std::string_view text) const {
-  // Uppercase for case-insensitive check
-  std::string upperText;
-  upperText.reserve(text.length());
-  for (char c : text)
-    upperText += static_cast<char>(std::toupper(c));
-
-  static const std::unordered_map<std::string, TokenType> keywords = {
-      {"ADD", TokenType::Mnemonic},  {"SUB", TokenType::Mnemonic},
-      {"AND", TokenType::Mnemonic},  {"OR", TokenType::Mnemonic},
-      {"XOR", TokenType::Mnemonic},  {"LSL", TokenType::Mnemonic},
-      {"LSR", TokenType::Mnemonic},  {"ASR", TokenType::Mnemonic},
-      {"MOV", TokenType::Mnemonic},  {"LDR", TokenType::Mnemonic},
-      {"STR", TokenType::Mnemonic},  {"B", TokenType::Mnemonic},
-      {"BEQ", TokenType::Mnemonic},  {"BNE", TokenType::Mnemonic},
-      {"CMP", TokenType::Mnemonic},  {"NOP", TokenType::Mnemonic},
-      {"HALT", TokenType::Mnemonic},
-
-      {"R0", TokenType::Register},   {"R1", TokenType::Register},
-      {"R2", TokenType::Register},   {"R3", TokenType::Register},
-      {"R4", TokenType::Register},   {"R5", TokenType::Register},
-      {"R6", TokenType::Register},   {"R7", TokenType::Register},
-      {"R8", TokenType::Register},   {"R9", TokenType::Register},
-      {"R10", TokenType::Register},  {"R11", TokenType::Register},
-      {"R12", TokenType::Register},  {"R13", TokenType::Register},
-      {"R14", TokenType::Register},  {"R15", TokenType::Register},
-      {"R16", TokenType::Register},  {"R17", TokenType::Register},
-      {"R18", TokenType::Register},  {"R19", TokenType::Register},
-      {"R20", TokenType::Register},  {"R21", TokenType::Register},
-      {"R22", TokenType::Register},  {"R23", TokenType::Register},
-      {"R24", TokenType::Register},  {"R25", TokenType::Register},
-      {"R26", TokenType::Register},  {"R27", TokenType::Register},
-      {"R28", TokenType::Register},  {"R29", TokenType::Register},
-      {"R30", TokenType::Register},  {"R31", TokenType::Register},
-      {"SP", TokenType::Register},   {"LR", TokenType::Register},
-      {"PC", TokenType::Register}};
-
-  auto it = keywords.find(upperText);
-  if (it != keywords.end()) {
-    return it->second;
+  if (std::optional<Keyword> keyword = FindKeyword(text)) {
+    return {keyword->Type, text, std::nullopt, m_Line, column, keyword->Id};
   }
-
-  return TokenType::LabelRef; // Anything else is a reference to a label
+  // Anything else is a reference to a label
+  SymbolId id = m_Symbols.Intern(text);
+  return {TokenType::LabelRef, m_LineMode ? m_Symbols.GetName(id) : text,
+          std::nullopt, m_Line, column, id};
 }
 
 } // namespace Aurelia::Tools::Assembler
@@ -4,6 +4,31 @@
  * Responsible for tokenizing assembly source code into structured tokens.
  * Handles mnemonics, registers, immediates, labels, and directives.
  *
+ * ZERO-COPY TOKENS:
+ * A token's Text is a view into the source, never a copy, and keywords
+ * and names are resolved while lexing so the parser never re-reads text:
+ * ┌────────────────────┬────────────────────────────────────────────────┐
+ * │ Token              │ Id                                             │
+ * ├────────────────────┼────────────────────────────────────────────────┤
+ * │ Mnemonic           │ Cpu::Opcode                                    │
+ * │ Register           │ Register index (SP = 30, LR = 31, PC = 32)     │
+ * │ Directive          │ Directive (Unknown = 0), see Keywords.hpp      │
+ * │ Label, LabelRef    │ SymbolId from GetSymbols()                     │
+ * │ Everything else    │ 0                                              │
+ * └────────────────────┴────────────────────────────────────────────────┘
+ *
+ * NOTE (KleaSCM) Tokens, and anything the parser builds from them, borrow
+ * the source buffer: keep it alive (and unmodified) until assembly is
+ * done. Tokenizing a temporary std::string leaves every token dangling.
+ *
+ * LINE MODE:
+ * A default-constructed Lexer takes its source one line at a time through
+ * TokenizeLine(), for sources too large to hold (see StreamingAssembler).
+ * Symbol IDs and line numbers carry over from line to line, and label
+ * names are copied into the interner, so Label and LabelRef Text stays
+ * valid after the line buffer is reused. All other Text still points
+ * into the current line only.
+ *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
  */
@@ -11,8 +36,8 @@
 #pragma once
 
 #include "Core/Types.hpp"
+#include "Tools/Assembler/StringInterner.hpp"
 #include <optional>
-#include <string>
 #include <string_view>
 #include <vector>
 
@@ -37,10 +62,11 @@ enum class TokenType {
 
 struct Token {
   TokenType Type;
-  std::string Text;
+  std::string_view Text;              // Into the source (see above)
   std::optional<std::uint64_t> Value; // For Immediates
   std::size_t Line;
   std::size_t Column;
+  std::uint32_t Id = 0; // Opcode, register, Directive or SymbolId
 
   bool operator==(const Token &other) const = default;
 };
@@ -49,8 +75,26 @@ class Lexer {
 public:
   explicit Lexer(std::string_view source);
 
+  /**
+   * @brief Line mode: no source yet, feed it through TokenizeLine().
+   */
+  Lexer();
+
   std::vector<Token> Tokenize();
 
+  /**
+   * @brief Replace `tokens` with those of the next source line.
+   *
+   * `line` excludes its newline. The tokens end in EndOfFile, exactly as
+   * Tokenize() would return for a one-line source.
+   */
+  void TokenizeLine(std::string_view line, std::vector<Token> &tokens);
+
+  /**
+   * @brief Label names seen so far; Label and LabelRef Ids index this.
+   */
+  [[nodiscard]] const StringInterner &GetSymbols() const { return m_Symbols; }
+
 private:
   char Peek(std::size_t offset = 0) const;
   char Advance();
@@ -63,9 +107,11 @@ private:
   Token ScanIdentifier();
   Token ScanNumber();
   Token ScanString();
-  TokenType CheckKeyword(std::string_view text) const;
+  void ScanTokens(std::vector<Token> &tokens);
 
   std::string_view m_Source;
+  StringInterner m_Symbols;
+  bool m_LineMode = false;
   std::size_t m_Current = 0;
   std::size_t m_Line = 1;
   std::size_t m_LineStart = 0;
@@ -0,0 +1,178 @@
+/**
+ * Object Linker Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Tools/Assembler/Linker.hpp"
+#include <algorithm>
+
+namespace Aurelia::Tools::Assembler {
+
+namespace {
+
+constexpr std::size_t AlignUp(std::size_t value, std::size_t align) {
+  return (value + align - 1) & ~(align - 1);
+}
+
+constexpr std::size_t SlotOf(System::SectionKind kind) {
+  return static_cast<std::size_t>(kind) - 1;
+}
+
+constexpr std::uint32_t ImmediateMask = 0x7FF; // Bits [10:0]
+
+} // namespace
+
+Linker::Linker(Address base)
+    : m_Base(base), m_Layout(SectionLayout::Sequential(base, 0, 0, 0)),
+      m_Entry(base) {}
+
+void Linker::AddObject(std::string name, const ObjectFile &object) {
+  m_Inputs.push_back({std::move(name), &object});
+}
+
+bool Linker::Link() {
+  Place();
+  DefineSymbols();
+  for (const Input &input : m_Inputs) {
+    if (m_HasError) {
+      break;
+    }
+    ApplyRelocations(input);
+  }
+  return !m_HasError;
+}
+
+void Linker::Place() {
+  std::size_t sizes[4] = {};
+  for (Input &input : m_Inputs) {
+    const ObjectFile &object = *input.Object;
+    std::size_t pieces[4] = {object.Text.size(), object.RoData.size(),
+                             object.Data.size(),
+                             static_cast<std::size_t>(object.BssSize)};
+    for (std::size_t i = 0; i < 4; ++i) {
+      input.Offsets[i] = AlignUp(sizes[i], SectionLayout::Alignment);
+      sizes[i] = input.Offsets[i] + pieces[i];
+    }
+  }
+
+  m_Text.assign(sizes[0], 0);
+  m_RoData.assign(sizes[1], 0);
+  m_Data.assign(sizes[2], 0);
+  m_BssSize = sizes[3];
+  for (const Input &input : m_Inputs) {
+    const ObjectFile &object = *input.Object;
+    std::copy(object.Text.begin(), object.Text.end(),
+              m_Text.begin() + static_cast<std::ptrdiff_t>(input.Offsets[0]));
+    std::copy(object.RoData.begin(), object.RoData.end(),
+              m_RoData.begin() +
+                  static_cast<std::ptrdiff_t>(input.Offsets[1]));
+    std::copy(object.Data.begin(), object.Data.end(),
+              m_Data.begin() + static_cast<std::ptrdiff_t>(input.Offsets[2]));
+  }
+
+  m_Layout = SectionLayout::Sequential(m_Base, m_Text.size(), m_RoData.size(),
+                                       m_Data.size());
+  m_Entry = m_Layout.TextBase;
+}
+
+Address Linker::AddressOf(const Input &input,
+                          const ObjectSymbol &symbol) const {
+  return m_Layout.BaseOf(*symbol.Section) +
+         input.Offsets[SlotOf(*symbol.Section)] + symbol.Offset;
+}
+
+void Linker::DefineSymbols() {
+  const Input *entryInput = nullptr;
+  for (const Input &input : m_Inputs) {
+    const ObjectFile &object = *input.Object;
+    for (const ObjectSymbol &symbol : object.Symbols) {
+      if (!symbol.Section) {
+        continue; // Import: bound in ApplyRelocations()
+      }
+      Address address = AddressOf(input, symbol);
+      if (symbol.IsGlobal) {
+        if (m_Globals.Contains(symbol.Name)) {
+          Error(input, 0, "Duplicate global symbol: " + symbol.Name);
+          return;
+        }
+        m_Globals.Define(symbol.Name, address);
+      }
+      m_Symbols.push_back(
+          {symbol.Name, address, *symbol.Section, symbol.IsGlobal});
+    }
+
+    if (object.Entry) {
+      if (entryInput) {
+        Error(input, 0, "Second .entry; the first is in " + entryInput->Name);
+        return;
+      }
+      entryInput = &input;
+      m_Entry = AddressOf(input, object.Symbols[*object.Entry]);
+    }
+  }
+}
+
+void Linker::ApplyRelocations(const Input &input) {
+  const ObjectFile &object = *input.Object;
+  for (const Relocation &reloc : object.Relocations) {
+    const ObjectSymbol &symbol = object.Symbols[reloc.Symbol];
+    Address target = 0;
+    if (symbol.Section) {
+      target = AddressOf(input, symbol);
+    } else if (auto global = m_Globals.Resolve(symbol.Name)) {
+      target = *global;
+    } else {
+      Error(input, reloc.Line, "Undefined Symbol: " + symbol.Name);
+      return;
+    }
+
+    std::size_t at = input.Offsets[0] + static_cast<std::size_t>(reloc.Offset);
+    Address pc = m_Layout.TextBase + at;
+    std::uint32_t value = 0;
+    if (reloc.Kind == RelocationKind::Branch) {
+      // Same range as PatchLabelOperand()
+      std::int64_t diff =
+          static_cast<std::int64_t>(target) - static_cast<std::int64_t>(pc);
+      if (diff < -1024 || diff > 1023) {
+        Error(input, reloc.Line,
+              "Branch target out of range (" + std::to_string(diff) + ")");
+        return;
+      }
+      value = static_cast<std::uint32_t>(diff) & ImmediateMask;
+    } else {
+      if (target > ImmediateMask) {
+        std::string message = "Address of " + symbol.Name;
+        message += " does not fit an immediate (" + std::to_string(target);
+        Error(input, reloc.Line, message + ")");
+        return;
+      }
+      value = static_cast<std::uint32_t>(target);
+    }
+
+    // Little-endian word; only the immediate field changes
+    std::uint32_t word = 0;
+    for (std::size_t i = 0; i < 4; ++i) {
+      word |= static_cast<std::uint32_t>(m_Text[at + i]) << (8 * i);
+    }
+    word = (word & ~ImmediateMask) | value;
+    for (std::size_t i = 0; i < 4; ++i) {
+      m_Text[at + i] = static_cast<Core::Byte>(word >> (8 * i));
+    }
+  }
+}
+
+void Linker::Error(const Input &input, std::uint32_t line,
+                   const std::string &message) {
+  if (m_HasError)
+    return;
+  m_HasError = true;
+  m_ErrorMessage = input.Name + ": ";
+  if (line != 0) {
+    m_ErrorMessage += "[Line " + std::to_string(line) + "] ";
+  }
+  m_ErrorMessage += message;
+}
+
+} // namespace Aurelia::Tools::Assembler
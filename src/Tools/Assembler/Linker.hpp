@@ -0,0 +1,127 @@
+/**
+ * Object Linker.
+ *
+ * Combines ObjectFiles into one program: lays every object's sections out
+ * back to back, binds each undefined symbol to the one object that
+ * exports it with .global, and patches every relocation.
+ *
+ * LAYOUT (objects in the order added):
+ * ┌────────────────────────────────────────────────────────────────────┐
+ * │ base: [text a][text b]... [rodata a][rodata b]... [data ...][bss]  │
+ * └────────────────────────────────────────────────────────────────────┘
+ * Each object's piece of a section starts SectionLayout::Alignment
+ * aligned; the sections themselves follow SectionLayout::Sequential, so a
+ * single object links to exactly what the flat pipeline produces.
+ *
+ * SYMBOLS:
+ * ┌────────────────────────┬───────────────────────────────────────────┐
+ * │ Case                   │ Result                                    │
+ * ├────────────────────────┼───────────────────────────────────────────┤
+ * │ Local label            │ Used only by its own object's relocations │
+ * │ .global label          │ Resolves other objects' imports           │
+ * │ Two .global, same name │ Error: duplicate global symbol            │
+ * │ Import nobody exports  │ Error: undefined symbol, at its use       │
+ * │ .entry in two objects  │ Error                                     │
+ * └────────────────────────┴───────────────────────────────────────────┘
+ * Every defined label, local or not, lands in GetSymbols(), as a
+ * single-file build lists them.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Tools/Assembler/ObjectFile.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include "Tools/Assembler/SymbolTable.hpp"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Aurelia::Tools::Assembler {
+
+class Linker {
+public:
+  /**
+   * @param base Load address of .text; the other sections follow it.
+   */
+  explicit Linker(Address base = 0);
+
+  /**
+   * @brief Queue `object` for linking; it must outlive Link().
+   * @param name Shown in error messages (typically the file name)
+   */
+  void AddObject(std::string name, const ObjectFile &object);
+
+  /**
+   * @brief Lay out, resolve and relocate every added object.
+   */
+  bool Link();
+
+  [[nodiscard]] const std::vector<Core::Byte> &GetText() const {
+    return m_Text;
+  }
+
+  [[nodiscard]] const std::vector<Core::Byte> &GetRoDataSegment() const {
+    return m_RoData;
+  }
+
+  [[nodiscard]] const std::vector<Core::Byte> &GetDataSegment() const {
+    return m_Data;
+  }
+
+  [[nodiscard]] std::size_t GetBssSize() const { return m_BssSize; }
+
+  [[nodiscard]] const SectionLayout &GetLayout() const { return m_Layout; }
+
+  /**
+   * @brief Every defined label with its address, object by object.
+   */
+  [[nodiscard]] const std::vector<ResolvedSymbol> &GetSymbols() const {
+    return m_Symbols;
+  }
+
+  /**
+   * @brief The .entry label's address, or the start of .text.
+   */
+  [[nodiscard]] Address GetEntry() const { return m_Entry; }
+
+  [[nodiscard]] bool HasError() const { return m_HasError; }
+  [[nodiscard]] std::string GetErrorMessage() const { return m_ErrorMessage; }
+
+private:
+  struct Input {
+    std::string Name;
+    const ObjectFile *Object;
+    // Offset of this object's piece of each section, by SectionKind - 1
+    std::array<std::size_t, 4> Offsets{};
+  };
+
+  void Place();
+  void DefineSymbols();
+  void ApplyRelocations(const Input &input);
+  [[nodiscard]] Address AddressOf(const Input &input,
+                                  const ObjectSymbol &symbol) const;
+  void Error(const Input &input, std::uint32_t line,
+             const std::string &message);
+
+  Address m_Base;
+  std::vector<Input> m_Inputs;
+
+  std::vector<Core::Byte> m_Text;
+  std::vector<Core::Byte> m_RoData;
+  std::vector<Core::Byte> m_Data;
+  std::size_t m_BssSize = 0;
+  SectionLayout m_Layout;
+
+  SymbolTable m_Globals;
+  std::vector<ResolvedSymbol> m_Symbols;
+  Address m_Entry = 0;
+
+  bool m_HasError = false;
+  std::string m_ErrorMessage;
+};
+
+} // namespace Aurelia::Tools::Assembler
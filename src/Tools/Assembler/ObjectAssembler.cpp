@@ -0,0 +1,112 @@
+/**
+ * Object Assembler Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Tools/Assembler/ObjectAssembler.hpp"
+#include "Tools/Assembler/Encoder.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include <limits>
+#include <vector>
+
+namespace Aurelia::Tools::Assembler {
+
+namespace {
+
+constexpr std::uint32_t NoSymbol = std::numeric_limits<std::uint32_t>::max();
+
+} // namespace
+
+bool AssembleObject(std::string_view source, ObjectFile &object,
+                    std::string &error) {
+  object = {};
+
+  Lexer lexer(source);
+  std::vector<Token> tokens = lexer.Tokenize();
+  if (tokens.empty() && !source.empty()) {
+    error = "Failed to tokenize source";
+    return false;
+  }
+
+  Parser parser(tokens);
+  if (!parser.Parse()) {
+    error = parser.GetErrorMessage();
+    return false;
+  }
+
+  const auto &roData = parser.GetRoDataSegment();
+  const auto &data = parser.GetDataSegment();
+  object.RoData.assign(roData.begin(), roData.end());
+  object.Data.assign(data.begin(), data.end());
+  object.BssSize = parser.GetBssSize();
+
+  // Defined labels first, in definition order, as the Resolver lists them
+  std::vector<std::uint32_t> symbolById; // SymbolId -> object.Symbols index
+  auto indexOf = [&](SymbolId id) -> std::uint32_t & {
+    if (symbolById.size() <= id) {
+      symbolById.resize(id + 1, NoSymbol);
+    }
+    return symbolById[id];
+  };
+  for (const Parser::LabelDef &label : parser.GetLabels()) {
+    indexOf(label.Id) = static_cast<std::uint32_t>(object.Symbols.size());
+    std::uint64_t offset = label.Section == System::SectionKind::Text
+                               ? label.InstructionIndex * 4
+                               : label.Offset;
+    object.Symbols.push_back(
+        {std::string(label.Name), label.Section, offset, label.IsGlobal});
+    if (label.Name == parser.GetEntryLabel()) {
+      object.Entry = indexOf(label.Id);
+    }
+  }
+
+  std::vector<ParsedInstruction> instructions(
+      parser.GetInstructions().begin(), parser.GetInstructions().end());
+  for (std::size_t i = 0; i < instructions.size(); ++i) {
+    ParsedInstruction &instr = instructions[i];
+    Address pc = static_cast<Address>(i * 4);
+
+    for (Operand &op : instr.Operands) {
+      if (op.Type != OperandType::Label) {
+        continue;
+      }
+      const LabelOperand &label = std::get<LabelOperand>(op.Value);
+      std::uint32_t &index = indexOf(label.Id);
+      if (index == NoSymbol) {
+        index = static_cast<std::uint32_t>(object.Symbols.size());
+        object.Symbols.push_back({std::string(label.Name), std::nullopt});
+      }
+      const ObjectSymbol &symbol = object.Symbols[index];
+
+      bool branch = IsPcRelative(instr.Op);
+      if (branch && symbol.Section == System::SectionKind::Text) {
+        std::string reason;
+        if (!PatchLabelOperand(instr, op, pc, symbol.Offset, reason)) {
+          error = "[Line " + std::to_string(instr.Line) + "] ";
+          error += reason;
+          return false;
+        }
+        continue;
+      }
+
+      object.Relocations.push_back(
+          {pc, branch ? RelocationKind::Branch : RelocationKind::Absolute,
+           index, static_cast<std::uint32_t>(instr.Line)});
+      op = {OperandType::Immediate, ImmediateOperand{0}}; // The Linker's
+    }
+  }
+
+  Encoder encoder(instructions);
+  if (!encoder.Encode()) {
+    error = encoder.GetErrorMessage();
+    return false;
+  }
+  object.Text = encoder.GetBinary();
+  return true;
+}
+
+} // namespace Aurelia::Tools::Assembler
@@ -0,0 +1,46 @@
+/**
+ * Object Assembler.
+ *
+ * Assembles one source file into a relocatable ObjectFile (`asm -c`).
+ * Lexer and Parser run as for a flat binary; resolution then stops at
+ * what this file alone can know.
+ *
+ * LABEL OPERANDS:
+ * ┌──────────────────────────────────┬──────────────────────────────────┐
+ * │ Reference                        │ Result                           │
+ * ├──────────────────────────────────┼──────────────────────────────────┤
+ * │ Branch to a label in this .text  │ Offset encoded now               │
+ * │ Branch to anything else          │ Placeholder 0 + Branch reloc     │
+ * │ Any other use of a label         │ Placeholder 0 + Absolute reloc   │
+ * │ Name not defined in this file    │ Undefined symbol (an import)     │
+ * └──────────────────────────────────┴──────────────────────────────────┘
+ * Every label becomes a symbol, local or .global, so the linked image has
+ * the same symbol table a single-file build would. Only .global ones can
+ * satisfy another file's imports.
+ *
+ * Each call is independent, so separate files can be assembled on
+ * separate threads.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Tools/Assembler/ObjectFile.hpp"
+#include <string>
+#include <string_view>
+
+namespace Aurelia::Tools::Assembler {
+
+/**
+ * @brief Assemble `source` into `object`.
+ *
+ * @param error Set to the first lexer/parser/encoder error on failure;
+ *              messages carry "[Line N]" like the flat pipeline's
+ * @return false if `source` does not assemble
+ */
+bool AssembleObject(std::string_view source, ObjectFile &object,
+                    std::string &error);
+
+} // namespace Aurelia::Tools::Assembler
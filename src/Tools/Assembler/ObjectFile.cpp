@@ -0,0 +1,220 @@
+/**
+ * Aurelia Relocatable Object Format Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Tools/Assembler/ObjectFile.hpp"
+#include <cstring>
+
+namespace Aurelia::Tools::Assembler {
+
+namespace {
+
+template <typename T> void Store(std::vector<Core::Byte> &out, T value) {
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    out.push_back(static_cast<Core::Byte>(
+        static_cast<std::uint64_t>(value) >> (8 * i)));
+  }
+}
+
+template <typename T> T Load(const Core::Byte *p) {
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    value |= static_cast<std::uint64_t>(p[i]) << (8 * i);
+  }
+  return static_cast<T>(value);
+}
+
+constexpr std::size_t AlignUp(std::size_t value, std::size_t align) {
+  return (value + align - 1) & ~(align - 1);
+}
+
+bool IsValidKind(std::uint8_t kind) {
+  return kind >= static_cast<std::uint8_t>(System::SectionKind::Text) &&
+         kind <= static_cast<std::uint8_t>(System::SectionKind::Bss);
+}
+
+} // namespace
+
+std::vector<Core::Byte> ObjectFile::Serialize() const {
+  std::string strings;
+  std::vector<std::uint32_t> nameOffsets;
+  nameOffsets.reserve(Symbols.size());
+  for (const ObjectSymbol &sym : Symbols) {
+    nameOffsets.push_back(static_cast<std::uint32_t>(strings.size()));
+    strings += sym.Name;
+    strings.push_back('\0');
+  }
+
+  std::vector<Core::Byte> out;
+  out.reserve(HeaderSize + SymbolEntrySize * Symbols.size() +
+              RelocationEntrySize * Relocations.size() + strings.size() +
+              Text.size() + RoData.size() + Data.size() + 24);
+
+  Store<std::uint32_t>(out, Magic);
+  Store<std::uint16_t>(out, Version);
+  Store<std::uint16_t>(out, 0);
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(Symbols.size()));
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(Relocations.size()));
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(strings.size()));
+  Store<std::uint32_t>(out, Entry ? *Entry + 1 : 0);
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(Text.size()));
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(RoData.size()));
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(Data.size()));
+  Store<std::uint32_t>(out, static_cast<std::uint32_t>(BssSize));
+
+  for (std::size_t i = 0; i < Symbols.size(); ++i) {
+    const ObjectSymbol &sym = Symbols[i];
+    Store<std::uint32_t>(out, nameOffsets[i]);
+    Store<std::uint8_t>(out, sym.Section ? static_cast<std::uint8_t>(
+                                               *sym.Section)
+                                         : 0);
+    Store<std::uint8_t>(out, sym.IsGlobal ? SymbolGlobal : 0);
+    Store<std::uint16_t>(out, 0);
+    Store<std::uint64_t>(out, sym.Offset);
+  }
+
+  for (const Relocation &reloc : Relocations) {
+    Store<std::uint32_t>(out, static_cast<std::uint32_t>(reloc.Offset));
+    Store<std::uint8_t>(out, static_cast<std::uint8_t>(reloc.Kind));
+    out.insert(out.end(), 3, 0);
+    Store<std::uint32_t>(out, reloc.Symbol);
+    Store<std::uint32_t>(out, reloc.Line);
+  }
+
+  out.insert(out.end(), strings.begin(), strings.end());
+
+  for (const std::vector<Core::Byte> *bytes : {&Text, &RoData, &Data}) {
+    out.resize(AlignUp(out.size(), 8), 0);
+    out.insert(out.end(), bytes->begin(), bytes->end());
+  }
+
+  return out;
+}
+
+bool ObjectFile::HasMagic(std::span<const Core::Byte> file) {
+  return file.size() >= 4 && Load<std::uint32_t>(file.data()) == Magic;
+}
+
+bool ObjectFile::Parse(std::span<const Core::Byte> file,
+                       std::string &error) {
+  Text.clear();
+  RoData.clear();
+  Data.clear();
+  Symbols.clear();
+  Relocations.clear();
+  Entry.reset();
+
+  if (file.size() < HeaderSize || !HasMagic(file)) {
+    error = "Not an AOB object";
+    return false;
+  }
+  if (Load<std::uint16_t>(file.data() + 4) != Version) {
+    error = "Unsupported AOB version";
+    return false;
+  }
+
+  std::size_t symbolCount = Load<std::uint32_t>(file.data() + 8);
+  std::size_t relocCount = Load<std::uint32_t>(file.data() + 12);
+  std::size_t stringSize = Load<std::uint32_t>(file.data() + 16);
+  std::uint32_t entry = Load<std::uint32_t>(file.data() + 20);
+  std::size_t sizes[] = {Load<std::uint32_t>(file.data() + 24),
+                         Load<std::uint32_t>(file.data() + 28),
+                         Load<std::uint32_t>(file.data() + 32)};
+  BssSize = Load<std::uint32_t>(file.data() + 36);
+
+  // All counts are at most 32 bits, so these sums cannot overflow
+  std::size_t relocBase = HeaderSize + SymbolEntrySize * symbolCount;
+  std::size_t stringBase = relocBase + RelocationEntrySize * relocCount;
+  std::size_t offset = stringBase + stringSize;
+  if (offset > file.size()) {
+    error = "Truncated AOB tables";
+    return false;
+  }
+  if (sizes[0] % 4 != 0) {
+    error = "Text size is not a whole number of instructions";
+    return false;
+  }
+
+  std::vector<Core::Byte> *sections[] = {&Text, &RoData, &Data};
+  for (std::size_t i = 0; i < 3; ++i) {
+    offset = AlignUp(offset, 8);
+    if (offset > file.size() || sizes[i] > file.size() - offset) {
+      error = "Section data extends past end of file";
+      return false;
+    }
+    sections[i]->assign(file.begin() + static_cast<std::ptrdiff_t>(offset),
+                        file.begin() +
+                            static_cast<std::ptrdiff_t>(offset + sizes[i]));
+    offset += sizes[i];
+  }
+
+  const char *strings = reinterpret_cast<const char *>(file.data()) +
+                        stringBase;
+  Symbols.reserve(symbolCount);
+  for (std::size_t i = 0; i < symbolCount; ++i) {
+    const Core::Byte *p = file.data() + HeaderSize + SymbolEntrySize * i;
+    std::size_t name = Load<std::uint32_t>(p);
+    const char *end = name < stringSize
+                          ? static_cast<const char *>(std::memchr(
+                                strings + name, '\0', stringSize - name))
+                          : nullptr;
+    if (!end || (p[4] != 0 && !IsValidKind(p[4]))) {
+      error = "Bad symbol entry " + std::to_string(i);
+      return false;
+    }
+
+    ObjectSymbol sym;
+    sym.Name.assign(strings + name, end);
+    if (p[4] != 0) {
+      sym.Section = static_cast<System::SectionKind>(p[4]);
+    }
+    sym.IsGlobal = (p[5] & SymbolGlobal) != 0;
+    sym.Offset = Load<std::uint64_t>(p + 8);
+
+    std::uint64_t limit = 0;
+    if (sym.Section == System::SectionKind::Bss) {
+      limit = BssSize;
+    } else if (sym.Section) {
+      limit = sections[static_cast<std::size_t>(*sym.Section) - 1]->size();
+    }
+    if (sym.Offset > limit) {
+      error = "Symbol " + sym.Name + " lies outside its section";
+      return false;
+    }
+    Symbols.push_back(std::move(sym));
+  }
+
+  Relocations.reserve(relocCount);
+  for (std::size_t i = 0; i < relocCount; ++i) {
+    const Core::Byte *p = file.data() + relocBase + RelocationEntrySize * i;
+    Relocation reloc;
+    reloc.Offset = Load<std::uint32_t>(p);
+    reloc.Kind = static_cast<RelocationKind>(p[4]);
+    reloc.Symbol = Load<std::uint32_t>(p + 8);
+    reloc.Line = Load<std::uint32_t>(p + 12);
+
+    if (reloc.Offset % 4 != 0 || reloc.Offset >= Text.size() ||
+        (reloc.Kind != RelocationKind::Branch &&
+         reloc.Kind != RelocationKind::Absolute) ||
+        reloc.Symbol >= Symbols.size()) {
+      error = "Bad relocation entry " + std::to_string(i);
+      return false;
+    }
+    Relocations.push_back(reloc);
+  }
+
+  if (entry != 0) {
+    if (entry > Symbols.size() || !Symbols[entry - 1].Section) {
+      error = "Entry is not a defined symbol";
+      return false;
+    }
+    Entry = entry - 1;
+  }
+
+  return true;
+}
+
+} // namespace Aurelia::Tools::Assembler
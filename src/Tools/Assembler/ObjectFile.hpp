@@ -0,0 +1,136 @@
+/**
+ * Aurelia Relocatable Object Format (AOB).
+ *
+ * What `asm -c` writes for one source file and the Linker reads: the
+ * file's sections as if each started at address 0, every label it
+ * defines, every symbol it uses but does not define, and a relocation for
+ * each instruction whose immediate depends on where things end up.
+ *
+ * FILE LAYOUT (little-endian):
+ * ┌─────────────────────┬──────────────────────────────────────────────┐
+ * │ Part                │ Contents                                     │
+ * ├─────────────────────┼──────────────────────────────────────────────┤
+ * │ Header (40 B)       │ Magic, version, counts, section sizes        │
+ * │ Symbol table        │ SymbolCount × 16 B                           │
+ * │ Relocation table    │ RelocationCount × 16 B                       │
+ * │ String table        │ NUL-terminated symbol names                  │
+ * │ Section data        │ Text, rodata, data bytes, each 8-aligned     │
+ * └─────────────────────┴──────────────────────────────────────────────┘
+ *
+ * HEADER:
+ * ┌────────┬──────┬────────────────────────────────────────────────────┐
+ * │ Offset │ Size │ Field                                              │
+ * ├────────┼──────┼────────────────────────────────────────────────────┤
+ * │ 0x00   │ 4    │ Magic "AOB1"                                       │
+ * │ 0x04   │ 2    │ Version (1)                                        │
+ * │ 0x06   │ 2    │ Reserved (0)                                       │
+ * │ 0x08   │ 4    │ SymbolCount                                        │
+ * │ 0x0C   │ 4    │ RelocationCount                                    │
+ * │ 0x10   │ 4    │ StringTableSize                                    │
+ * │ 0x14   │ 4    │ Entry symbol index + 1 (0: no .entry)              │
+ * │ 0x18   │ 4    │ Text size                                          │
+ * │ 0x1C   │ 4    │ RoData size                                        │
+ * │ 0x20   │ 4    │ Data size                                          │
+ * │ 0x24   │ 4    │ Bss size                                           │
+ * └────────┴──────┴────────────────────────────────────────────────────┘
+ *
+ * SYMBOL ENTRY:                 RELOCATION ENTRY:
+ * ┌────────┬──────┬──────────┐  ┌────────┬──────┬────────────────────┐
+ * │ 0x00   │ 4    │ Name     │  │ 0x00   │ 4    │ Text offset        │
+ * │ 0x04   │ 1    │ Section  │  │ 0x04   │ 1    │ Kind               │
+ * │ 0x05   │ 1    │ Bit 0    │  │ 0x08   │ 4    │ Symbol index       │
+ * │        │      │ GLOBAL   │  │ 0x0C   │ 4    │ Source line        │
+ * │ 0x08   │ 8    │ Offset   │  └────────┴──────┴────────────────────┘
+ * └────────┴──────┴──────────┘
+ * A symbol's Section is 0 when it is undefined: a name this file uses
+ * and expects another file to export with .global.
+ *
+ * RELOCATIONS:
+ * Every instruction keeps its immediate in bits [10:0], so a relocation
+ * names the word and how to compute what goes there:
+ * ┌──────────┬──────────────────────────────────────┬──────────────────┐
+ * │ Kind     │ Value                                │ Range            │
+ * ├──────────┼──────────────────────────────────────┼──────────────────┤
+ * │ Branch   │ Symbol address - instruction address │ [-1024, +1023]   │
+ * │ Absolute │ Symbol address                       │ [0, 2047]        │
+ * └──────────┴──────────────────────────────────────┴──────────────────┘
+ * A branch to a label in the same file's .text needs none: the Linker
+ * moves each text section whole, so the distance never changes.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Core/Types.hpp"
+#include "System/ExecutableImage.hpp"
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace Aurelia::Tools::Assembler {
+
+struct ObjectSymbol {
+  std::string Name;
+  std::optional<System::SectionKind> Section; // nullopt: undefined
+  std::uint64_t Offset = 0;                   // Within Section
+  bool IsGlobal = false;
+};
+
+enum class RelocationKind : std::uint8_t {
+  Branch = 1,  // PC-relative, signed
+  Absolute = 2 // Address, unsigned
+};
+
+struct Relocation {
+  std::uint64_t Offset = 0; // Byte offset of the word in .text
+  RelocationKind Kind = RelocationKind::Absolute;
+  std::uint32_t Symbol = 0; // Index into ObjectFile::Symbols
+  std::uint32_t Line = 0;   // For link errors
+};
+
+/**
+ * In-memory form of an AOB file. Unlike ExecutableImage it owns its
+ * bytes: objects are small, and the Linker copies them into place anyway.
+ */
+struct ObjectFile {
+  static constexpr std::uint32_t Magic = 0x31424F41; // "AOB1"
+  static constexpr std::uint16_t Version = 1;
+  static constexpr std::size_t HeaderSize = 40;
+  static constexpr std::size_t SymbolEntrySize = 16;
+  static constexpr std::size_t RelocationEntrySize = 16;
+  static constexpr std::uint8_t SymbolGlobal = 1u << 0;
+
+  std::vector<Core::Byte> Text;
+  std::vector<Core::Byte> RoData;
+  std::vector<Core::Byte> Data;
+  std::uint64_t BssSize = 0;
+  std::vector<ObjectSymbol> Symbols;
+  std::vector<Relocation> Relocations;
+  std::optional<std::uint32_t> Entry; // Symbol index named by .entry
+
+  /**
+   * @brief Encode as an AOB file.
+   */
+  [[nodiscard]] std::vector<Core::Byte> Serialize() const;
+
+  /**
+   * @brief Decode an AOB file.
+   *
+   * Counts, offsets and indices are checked against the buffer and each
+   * other, so a truncated or corrupt file is rejected, not half-read.
+   *
+   * @return false if `file` is not a well-formed AOB object
+   */
+  bool Parse(std::span<const Core::Byte> file, std::string &error);
+
+  /**
+   * @brief True if `file` starts with the AOB magic.
+   */
+  [[nodiscard]] static bool HasMagic(std::span<const Core::Byte> file);
+};
+
+} // namespace Aurelia::Tools::Assembler
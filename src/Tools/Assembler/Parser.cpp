@@ -9,21 +9,87 @@
  */
 
 #include "Tools/Assembler/Parser.hpp"
+#include "System/MemoryMap.hpp"
+#include "Tools/Assembler/Keywords.hpp"
 #include <algorithm>
-#include <charconv>
-#include <unordered_map>
+#include <cstddef>
+#include <limits>
+#include <string>
 
 namespace Aurelia::Tools::Assembler {
 
-Parser::Parser(const std::vector<Token> &tokens) : m_Tokens(tokens) {}
+namespace {
+
+constexpr std::size_t NoLabel = std::numeric_limits<std::size_t>::max();
+
+} // namespace
+
+Parser::AstBounds Parser::AstBounds::Count(const std::vector<Token> &tokens) {
+  AstBounds bounds;
+  for (const Token &token : tokens) {
+    switch (token.Type) {
+    case TokenType::Mnemonic:
+      bounds.Instructions++;
+      break;
+    case TokenType::Label:
+      bounds.Labels++;
+      [[fallthrough]];
+    case TokenType::LabelRef: // .global/.entry targets index by Id too
+      bounds.Symbols = std::max<std::size_t>(bounds.Symbols, token.Id + 1);
+      break;
+    default:
+      break;
+    }
+  }
+  return bounds;
+}
+
+std::size_t Parser::AstBounds::ArenaBytes() const {
+  // Plus a little for the .global list, the only vector left to grow
+  return Instructions * sizeof(ParsedInstruction) +
+         Labels * sizeof(LabelDef) + Symbols * sizeof(std::size_t) +
+         8 * sizeof(Token) + 4 * alignof(std::max_align_t);
+}
+
+Parser::Parser(const std::vector<Token> &tokens)
+    : m_Tokens(tokens), m_Bounds(AstBounds::Count(tokens)),
+      m_Arena(m_Bounds.ArenaBytes()) {
+  m_Instructions.reserve(m_Bounds.Instructions);
+  m_Labels.reserve(m_Bounds.Labels);
+  m_LabelBySymbol.assign(m_Bounds.Symbols, NoLabel);
+}
+
+Parser::Parser()
+    : m_Instructions(std::pmr::new_delete_resource()),
+      m_Labels(std::pmr::new_delete_resource()),
+      m_LabelBySymbol(std::pmr::new_delete_resource()),
+      m_GlobalRefs(std::pmr::new_delete_resource()) {}
 
 bool Parser::Parse() {
+  ParseStatements();
+  return Finish();
+}
+
+bool Parser::ParseLine(std::span<const Token> tokens) {
+  m_Tokens = tokens;
+  m_Current = 0;
+  ParseStatements();
+  return !m_HasError;
+}
+
+bool Parser::Finish() {
+  if (!m_HasError) {
+    ApplySymbolDirectives();
+  }
+  return !m_HasError;
+}
+
+void Parser::ParseStatements() {
   while (!IsAtEnd()) {
     if (m_HasError)
-      return false;
+      return;
     ParseStatement();
   }
-  return !m_HasError;
 }
 
 void Parser::ParseStatement() {
@@ -47,7 +113,7 @@ void Parser::ParseStatement() {
   }
 
   // Unexpected token
-  Error(Peek(), "Unexpected token in statement: " + Peek().Text);
+  Error(Peek(), "Unexpected token in statement: " + std::string(Peek().Text));
   Synchronize();
 }
 
@@ -55,13 +121,32 @@ void Parser::ParseLabel() {
   if (Check(TokenType::Label)) {
     Token token = Advance();
     // Check duplicates
-    if (m_DefinedLabels.contains(token.Text)) {
-      Error(token, "Duplicate label definition: " + token.Text);
+    if (FindLabel(token.Id)) {
+      Error(token, "Duplicate label definition: " + std::string(token.Text));
       return;
     }
 
-    m_Labels.push_back({token.Text, m_Instructions.size()});
-    m_DefinedLabels.insert(token.Text);
+    LabelDef def{token.Text, m_InstructionCount, m_Section};
+    def.Id = token.Id;
+    switch (m_Section) {
+    case System::SectionKind::Text:
+      def.Offset = m_InstructionCount * 4;
+      break;
+    case System::SectionKind::RoData:
+      def.Offset = m_RoDataSegment.size();
+      break;
+    case System::SectionKind::Data:
+      def.Offset = m_DataSegment.size();
+      break;
+    case System::SectionKind::Bss:
+      def.Offset = m_BssSize;
+      break;
+    }
+    if (m_LabelBySymbol.size() <= token.Id) {
+      m_LabelBySymbol.resize(token.Id + 1, NoLabel); // Line mode only
+    }
+    m_LabelBySymbol[token.Id] = m_Labels.size();
+    m_Labels.push_back(def);
 
     // Lexer strips colon.
   }
@@ -69,18 +154,49 @@ void Parser::ParseLabel() {
 
 void Parser::ParseDirective() {
   Token token = Advance();
-  std::string dir = token.Text;
-
-  // Normalize directive name
-  std::transform(dir.begin(), dir.end(), dir.begin(),
-                 [](unsigned char c) { return std::tolower(c); });
 
-  if (dir == ".string") {
+  // The Lexer already matched the name (case-insensitively) to its Id
+  switch (static_cast<Directive>(token.Id)) {
+  case Directive::String:
     ParseStringDirective();
-  } else if (dir == ".data" || dir == ".text") {
-    // Section switching placeholder
-  } else {
-    Error(token, "Unknown directive: " + token.Text);
+    break;
+  case Directive::Space:
+    ParseSpaceDirective(token);
+    break;
+  case Directive::Text:
+    m_Section = System::SectionKind::Text;
+    break;
+  case Directive::RoData:
+    m_Section = System::SectionKind::RoData;
+    break;
+  case Directive::Data:
+    m_Section = System::SectionKind::Data;
+    break;
+  case Directive::Bss:
+    m_Section = System::SectionKind::Bss;
+    break;
+  case Directive::Global: {
+    Token ref = Peek();
+    std::string_view name;
+    if (ParseSymbolName(name)) {
+      m_GlobalRefs.push_back(ref);
+    }
+    break;
+  }
+  case Directive::Entry: {
+    Token ref = Peek();
+    std::string_view name;
+    if (!m_EntryLabel.empty()) {
+      Error(token, "Duplicate .entry directive");
+    } else if (ParseSymbolName(name)) {
+      m_EntryLabel = name;
+      m_EntryRef = ref;
+    }
+    break;
+  }
+  case Directive::Unknown:
+    Error(token, "Unknown directive: " + std::string(token.Text));
+    break;
   }
 
   // Directives end logic usually
@@ -88,13 +204,88 @@ void Parser::ParseDirective() {
     Consume(TokenType::NewLine, "Expected newline after directive");
 }
 
+std::vector<std::uint8_t> *Parser::CurrentDataSegment() {
+  switch (m_Section) {
+  case System::SectionKind::RoData:
+    return &m_RoDataSegment;
+  case System::SectionKind::Bss:
+    return nullptr;
+  case System::SectionKind::Text:
+  case System::SectionKind::Data:
+    break;
+  }
+  return &m_DataSegment;
+}
+
+bool Parser::ParseSymbolName(std::string_view &name) {
+  if (!Match(TokenType::LabelRef)) {
+    Error(Peek(), "Expected symbol name");
+    return false;
+  }
+  name = Previous().Text;
+  return true;
+}
+
+std::optional<std::size_t> Parser::FindLabel(SymbolId id) const {
+  if (id < m_LabelBySymbol.size() && m_LabelBySymbol[id] != NoLabel) {
+    return m_LabelBySymbol[id];
+  }
+  return std::nullopt;
+}
+
+void Parser::ApplySymbolDirectives() {
+  for (const Token &ref : m_GlobalRefs) {
+    std::optional<std::size_t> label = FindLabel(ref.Id);
+    if (!label) {
+      Error(ref, "Undefined symbol in .global: " + std::string(ref.Text));
+      return;
+    }
+    m_Labels[*label].IsGlobal = true;
+  }
+
+  if (!m_EntryLabel.empty() && !FindLabel(m_EntryRef.Id)) {
+    Error(m_EntryRef, "Undefined entry label: " + m_EntryLabel);
+  }
+}
+
+void Parser::ParseSpaceDirective(const Token &directive) {
+  if (!Check(TokenType::Immediate)) {
+    Error(Peek(), "Expected byte count");
+    return;
+  }
+  Token count = Advance();
+  std::uint64_t bytes = count.Value.value_or(0);
+
+  if (bytes > System::RamSize) {
+    Error(count, ".space larger than RAM");
+    return;
+  }
+  if (m_Section == System::SectionKind::Text) {
+    Error(directive, ".space is not allowed in .text");
+    return;
+  }
+
+  if (std::vector<std::uint8_t> *segment = CurrentDataSegment()) {
+    segment->resize(segment->size() + bytes, 0);
+  } else {
+    m_BssSize += bytes; // Reserved, never stored
+  }
+}
+
 void Parser::ParseStringDirective() {
   if (!Match(TokenType::String)) {
     Error(Peek(), "Expected string literal");
     return;
   }
 
-  std::string raw = Previous().Text;
+  std::vector<std::uint8_t> *segment = CurrentDataSegment();
+  if (!segment) {
+    Error(Previous(), ".string is not allowed in .bss");
+    return;
+  }
+  std::vector<std::uint8_t> &out = *segment;
+
+  std::string_view raw = Previous().Text;
   if (raw.size() >= 2 && raw.front() == '"' && raw.back() == '"') {
     raw = raw.substr(1, raw.size() - 2);
   }
@@ -105,26 +296,26 @@ void Parser::ParseStringDirective() {
       char next = raw[i + 1];
       switch (next) {
       case 'n':
-        m_DataSegment.push_back('\n');
+        out.push_back('\n');
         break;
       case 't':
-        m_DataSegment.push_back('\t');
+        out.push_back('\t');
         break;
       case 'r':
-        m_DataSegment.push_back('\r');
+        out.push_back('\r');
         break;
       case '0':
-        m_DataSegment.push_back('\0');
+        out.push_back('\0');
         break;
       case '\\':
-        m_DataSegment.push_back('\\');
+        out.push_back('\\');
         break;
       case '"':
-        m_DataSegment.push_back('"');
+        out.push_back('"');
         break;
       default:
-        m_DataSegment.push_back(static_cast<std::uint8_t>(c)); // Keep backslash
-        m_DataSegment.push_back(static_cast<std::uint8_t>(next));
+        out.push_back(static_cast<std::uint8_t>(c)); // Keep backslash
+        out.push_back(static_cast<std::uint8_t>(next));
         break;
       }
       if (next == 'n' || next == 't' || next == 'r' || next == '0' ||
@@ -132,10 +323,10 @@ void Parser::ParseStringDirective() {
         i++; // Skip next char
       }
     } else {
-      m_DataSegment.push_back(static_cast<std::uint8_t>(c));
+      out.push_back(static_cast<std::uint8_t>(c));
     }
   }
-  m_DataSegment.push_back(0); // Null terminator
+  out.push_back(0); // Null terminator
 }
 
 void Parser::ParseInstruction() {
@@ -145,29 +336,8 @@ void Parser::ParseInstruction() {
   instr.Line = mnemonicToken.Line;
   instr.Column = mnemonicToken.Column;
 
-  // Resolve Opcode
-  static const std::unordered_map<std::string, Cpu::Opcode> OpMap = {
-      {"ADD", Cpu::Opcode::ADD},  {"SUB", Cpu::Opcode::SUB},
-      {"AND", Cpu::Opcode::AND},  {"OR", Cpu::Opcode::OR},
-      {"XOR", Cpu::Opcode::XOR},  {"LSL", Cpu::Opcode::LSL},
-      {"LSR", Cpu::Opcode::LSR},  {"ASR", Cpu::Opcode::ASR},
-      {"MOV", Cpu::Opcode::MOV},  {"LDR", Cpu::Opcode::LDR},
-      {"STR", Cpu::Opcode::STR},  {"B", Cpu::Opcode::B},
-      {"BEQ", Cpu::Opcode::BEQ},  {"BNE", Cpu::Opcode::BNE},
-      {"CMP", Cpu::Opcode::CMP},  {"NOP", Cpu::Opcode::NOP},
-      {"HALT", Cpu::Opcode::Halt}};
-
-  std::string upper = instr.Mnemonic;
-  std::transform(upper.begin(), upper.end(), upper.begin(),
-                 [](unsigned char c) { return std::toupper(c); });
-
-  auto it = OpMap.find(upper);
-  if (it != OpMap.end()) {
-    instr.Op = it->second;
-  } else {
-    Error(mnemonicToken, "Unknown Mnemonic");
-    return;
-  }
+  // The Lexer only emits Mnemonic tokens for known opcodes
+  instr.Op = static_cast<Cpu::Opcode>(mnemonicToken.Id);
 
   // Parse Operands (comma separated)
   if (!Check(TokenType::NewLine) && !IsAtEnd()) {
@@ -178,7 +348,11 @@ void Parser::ParseInstruction() {
         Synchronize();
         return;
       }
-      instr.Operands.push_back(op);
+      if (!instr.Operands.push_back(op)) {
+        Error(Previous(), "Too many operands");
+        Synchronize();
+        return;
+      }
     } while (Match(TokenType::Comma));
   }
 
@@ -187,6 +361,7 @@ void Parser::ParseInstruction() {
 
   if (!m_HasError) {
     m_Instructions.push_back(instr);
+    m_InstructionCount++;
   }
 }
 
@@ -253,38 +428,12 @@ Operand Parser::ParseRegister() {
     return {OperandType::Invalid, {}};
   }
   Token token = Advance(); // Consume Register token
-  std::string text = token.Text;
-
-  // Normalize
-  std::string upper = text;
-  std::transform(upper.begin(), upper.end(), upper.begin(),
-                 [](unsigned char c) { return std::toupper(c); });
-
-  int regIndex = 0;
-
-  // Alias Handling
-  if (upper == "SP")
-    regIndex = 30;
-  else if (upper == "LR")
-    regIndex = 31;
-  else if (upper == "PC")
-    regIndex = 32; // Placeholder, not strictly gpr
-  else if (upper.size() > 1 && upper[0] == 'R') {
-    // R<num>
-    auto result = std::from_chars(upper.data() + 1, upper.data() + upper.size(),
-                                  regIndex);
-    if (result.ec != std::errc()) {
-      Error(token, "Invalid Register Format");
-      return {OperandType::Invalid, {}};
-    }
-  } else {
-    Error(token, "Unknown Register Name");
-    return {OperandType::Invalid, {}};
-  }
 
+  // Index (aliases included) was resolved by the Lexer; PC is 32, a
+  // placeholder rather than a GPR
   Operand op;
   op.Type = OperandType::Register;
-  op.Value = RegisterOperand{static_cast<std::uint8_t>(regIndex)};
+  op.Value = RegisterOperand{static_cast<std::uint8_t>(token.Id)};
   return op;
 }
 
@@ -314,7 +463,7 @@ Operand Parser::ParseLabelRef() {
   Token token = Advance();
   Operand op;
   op.Type = OperandType::Label;
-  op.Value = LabelOperand{token.Text};
+  op.Value = LabelOperand{token.Text, token.Id};
   return op;
 }
 
@@ -354,7 +503,7 @@ const Token &Parser::Previous() const {
   return m_Tokens[m_Current - 1];
 }
 
-void Parser::Consume(TokenType type, const std::string &message) {
+void Parser::Consume(TokenType type, std::string_view message) {
   if (Check(type)) {
     Advance();
     return;
@@ -362,11 +511,12 @@ void Parser::Consume(TokenType type, const std::string &message) {
   Error(Peek(), message);
 }
 
-void Parser::Error(const Token &token, const std::string &message) {
+void Parser::Error(const Token &token, std::string_view message) {
   if (m_HasError)
     return; // Suppress cascade
   m_HasError = true;
-  m_ErrorMessage = "[Line " + std::to_string(token.Line) + "] " + message;
+  m_ErrorMessage = "[Line " + std::to_string(token.Line) + "] ";
+  m_ErrorMessage += message;
 }
 
 void Parser::Synchronize() {
@@ -8,6 +8,48 @@
  * Implements a recursive descent parser with strict syntax validation
  * and support for various addressing modes.
  *
+ * SECTIONS:
+ * ┌────────────┬──────────────────────────────────────────────────────┐
+ * │ Directive  │ Effect                                               │
+ * ├────────────┼──────────────────────────────────────────────────────┤
+ * │ .text      │ Following instructions and labels go to text         │
+ * │ .rodata    │ Following .string/.space and labels go to rodata     │
+ * │ .data      │ Following .string/.space and labels go to data       │
+ * │ .bss       │ Following .space reserves zeroed bytes; no file data │
+ * │ .string    │ NUL-terminated string into rodata, or data otherwise │
+ * │ .space #N  │ N zero bytes in the current data-type section        │
+ * │ .global x  │ Mark label x as exported in the symbol table         │
+ * │ .entry x   │ Start execution at label x                           │
+ * └────────────┴──────────────────────────────────────────────────────┘
+ * A .string in .text goes to data, as it always has. Labels record the
+ * section they were defined in and their offset within it; addresses are
+ * assigned later by the Resolver.
+ *
+ * Mnemonics, registers and label names arrive already resolved in each
+ * token's Id, so the parser matches integers, not text. Label operand
+ * names stay views into the source (see Lexer.hpp).
+ *
+ * AST MEMORY:
+ * ┌────────────────────┬─────────────────────────────────────────────────┐
+ * │ Piece              │ Storage                                         │
+ * ├────────────────────┼─────────────────────────────────────────────────┤
+ * │ Operands           │ Inline OperandList, at most three               │
+ * │ Mnemonic, names    │ Views into the source                           │
+ * │ Instructions,      │ One arena per Parser, sized from the token      │
+ * │   labels, lookups  │ stream up front and released with the Parser    │
+ * └────────────────────┴─────────────────────────────────────────────────┘
+ * A ParsedInstruction owns no heap memory, so the whole program costs a
+ * single allocation instead of several per instruction, and copying the
+ * instruction list (the Resolver rewrites a copy) is one block copy.
+ *
+ * LINE MODE:
+ * A default-constructed Parser takes one line's tokens at a time through
+ * ParseLine() and checks .global/.entry in Finish(). The caller drains
+ * GetInstructions() after each line with ClearInstructions(); labels keep
+ * counting instructions across the drains. Nothing is known up front in
+ * this mode, so its vectors use the heap rather than an arena that would
+ * keep every outgrown buffer.
+ *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
  */
@@ -15,11 +57,16 @@
 #pragma once
 
 #include "Cpu/InstructionDefs.hpp"
+#include "System/ExecutableImage.hpp"
 #include "Tools/Assembler/Lexer.hpp"
+#include <array>
+#include <concepts>
 #include <cstdint>
+#include <memory_resource>
 #include <optional>
+#include <span>
 #include <string>
-#include <unordered_set>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -51,7 +98,8 @@ struct MemoryOperand {
 };
 
 struct LabelOperand {
-  std::string Name;
+  std::string_view Name;
+  SymbolId Id = 0;
 };
 
 using OperandValue = std::variant<RegisterOperand, ImmediateOperand,
@@ -62,10 +110,61 @@ struct Operand {
   OperandValue Value;
 };
 
+/**
+ * An instruction's operands, stored inline.
+ *
+ * No Aurelia instruction takes more than Capacity operands, so there is
+ * nothing to allocate. Lower-case members mirror std::vector so callers
+ * index and iterate it the same way.
+ */
+class OperandList {
+public:
+  static constexpr std::size_t Capacity = 3;
+
+  OperandList() = default;
+
+  template <typename... Operands>
+    requires(sizeof...(Operands) <= Capacity &&
+             (std::convertible_to<Operands, Operand> && ...))
+  OperandList(const Operands &...operands) // Implicit: `Operands = {a, b}`
+      : m_Operands{operands...}, m_Size(sizeof...(Operands)) {}
+
+  /**
+   * @brief Append `operand`.
+   * @return false, leaving the list unchanged, if it is already full.
+   */
+  bool push_back(const Operand &operand) {
+    if (m_Size == Capacity) {
+      return false;
+    }
+    m_Operands[m_Size++] = operand;
+    return true;
+  }
+
+  [[nodiscard]] std::size_t size() const { return m_Size; }
+  [[nodiscard]] bool empty() const { return m_Size == 0; }
+
+  Operand &operator[](std::size_t index) { return m_Operands[index]; }
+  const Operand &operator[](std::size_t index) const {
+    return m_Operands[index];
+  }
+
+  Operand *begin() { return m_Operands.data(); }
+  Operand *end() { return m_Operands.data() + m_Size; }
+  [[nodiscard]] const Operand *begin() const { return m_Operands.data(); }
+  [[nodiscard]] const Operand *end() const {
+    return m_Operands.data() + m_Size;
+  }
+
+private:
+  std::array<Operand, Capacity> m_Operands{};
+  std::size_t m_Size = 0;
+};
+
 struct ParsedInstruction {
   Cpu::Opcode Op;
-  std::string Mnemonic; // Stored for error reporting context
-  std::vector<Operand> Operands;
+  std::string_view Mnemonic; // Error context; into the source
+  OperandList Operands;
   std::size_t Line;
   std::size_t Column;
 };
@@ -80,16 +179,40 @@ class Parser {
 public:
   explicit Parser(const std::vector<Token> &tokens);
 
+  /**
+   * @brief Line mode: no tokens yet, feed them through ParseLine().
+   */
+  Parser();
+
   /**
    * @brief Parses the token stream into instructions and data.
    * @return true if parsing succeeded without errors.
    */
   bool Parse();
 
+  /**
+   * @brief Line mode: parse one line's tokens (ending in EndOfFile).
+   *
+   * Label tokens must stay valid until Finish(), as they do from a
+   * line-mode Lexer; the other tokens are done with on return.
+   */
+  bool ParseLine(std::span<const Token> tokens);
+
+  /**
+   * @brief Line mode: resolve .global and .entry once every line is in.
+   */
+  bool Finish();
+
+  /**
+   * @brief Line mode: drop the instructions the caller has consumed.
+   */
+  void ClearInstructions() { m_Instructions.clear(); }
+
   /**
    * @brief Retrieves the list of parsed instructions.
    */
-  [[nodiscard]] const std::vector<ParsedInstruction> &GetInstructions() const {
+  [[nodiscard]] const std::pmr::vector<ParsedInstruction> &
+  GetInstructions() const {
     return m_Instructions;
   }
 
@@ -100,14 +223,40 @@ public:
     return m_DataSegment;
   }
 
+  /**
+   * @brief Retrieves the read-only data segment bytes (.rodata).
+   */
+  [[nodiscard]] const std::vector<std::uint8_t> &GetRoDataSegment() const {
+    return m_RoDataSegment;
+  }
+
+  /**
+   * @brief Size of the zero-initialised segment (.bss).
+   */
+  [[nodiscard]] std::size_t GetBssSize() const { return m_BssSize; }
+
+  /**
+   * @brief Label named by .entry, or empty for the start of .text.
+   */
+  [[nodiscard]] const std::string &GetEntryLabel() const {
+    return m_EntryLabel;
+  }
+
   /**
    * @brief Retrieves collected local labels.
+   *
+   * Text labels are located by InstructionIndex; all others by Offset,
+   * the byte offset within their section.
    */
   struct LabelDef {
-    std::string Name;
+    std::string_view Name; // Into the source
     std::size_t InstructionIndex;
+    System::SectionKind Section = System::SectionKind::Text;
+    std::size_t Offset = 0;
+    bool IsGlobal = false;
+    SymbolId Id = 0; // From the Lexer's interner
   };
-  [[nodiscard]] const std::vector<LabelDef> &GetLabels() const {
+  [[nodiscard]] const std::pmr::vector<LabelDef> &GetLabels() const {
     return m_Labels;
   }
 
@@ -115,13 +264,39 @@ public:
   [[nodiscard]] std::string GetErrorMessage() const { return m_ErrorMessage; }
 
 private:
-  const std::vector<Token> &m_Tokens;
+  /**
+   * Upper bounds on what the token stream can produce, counted before
+   * parsing so the arena is allocated once and nothing regrows.
+   */
+  struct AstBounds {
+    std::size_t Instructions = 0; // Mnemonic tokens
+    std::size_t Labels = 0;       // Label tokens
+    std::size_t Symbols = 0;      // Highest label SymbolId + 1
+
+    [[nodiscard]] static AstBounds Count(const std::vector<Token> &tokens);
+    [[nodiscard]] std::size_t ArenaBytes() const;
+  };
+
+  std::span<const Token> m_Tokens;
   std::size_t m_Current = 0;
+  std::size_t m_InstructionCount = 0; // Including cleared ones
+
+  AstBounds m_Bounds;
+  std::pmr::monotonic_buffer_resource m_Arena; // Must precede its users
 
-  std::vector<ParsedInstruction> m_Instructions;
+  std::pmr::vector<ParsedInstruction> m_Instructions{&m_Arena};
   std::vector<std::uint8_t> m_DataSegment;
-  std::vector<LabelDef> m_Labels;
-  std::unordered_set<std::string> m_DefinedLabels;
+  std::vector<std::uint8_t> m_RoDataSegment;
+  std::size_t m_BssSize = 0;
+  std::pmr::vector<LabelDef> m_Labels{&m_Arena};
+  // SymbolId -> m_Labels index
+  std::pmr::vector<std::size_t> m_LabelBySymbol{&m_Arena};
+
+  System::SectionKind m_Section = System::SectionKind::Text;
+  std::string m_EntryLabel;
+  Token m_EntryRef{};
+  // Checked once all labels are known
+  std::pmr::vector<Token> m_GlobalRefs{&m_Arena};
 
   bool m_HasError = false;
   std::string m_ErrorMessage;
@@ -133,9 +308,10 @@ private:
   Token Advance();
   bool Check(TokenType type) const;
   bool Match(TokenType type);
-  void Consume(TokenType type, const std::string &message);
+  void Consume(TokenType type, std::string_view message);
 
   // -- Parsing Routines --
+  void ParseStatements();
   void ParseStatement();
   void ParseLabel();
   void ParseDirective();
@@ -148,9 +324,23 @@ private:
   Operand ParseLabelRef();
 
   void ParseStringDirective();
+  void ParseSpaceDirective(const Token &directive);
+  bool ParseSymbolName(std::string_view &name);
+
+  /**
+   * @brief Index in m_Labels of the label interned as `id`, if defined.
+   */
+  [[nodiscard]] std::optional<std::size_t> FindLabel(SymbolId id) const;
+  void ApplySymbolDirectives();
+
+  /**
+   * @brief Segment receiving .string/.space bytes in the current section.
+   * @return nullptr in .bss, which has no bytes
+   */
+  std::vector<std::uint8_t> *CurrentDataSegment();
 
   // -- Error Handling --
-  void Error(const Token &token, const std::string &message);
+  void Error(const Token &token, std::string_view message);
   void Synchronize();
 };
 
@@ -0,0 +1,61 @@
+/**
+ * Program Output Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Tools/Assembler/ProgramOutput.hpp"
+
+namespace Aurelia::Tools::Assembler {
+
+Address FindEntry(std::span<const ResolvedSymbol> symbols,
+                  std::string_view label, Address fallback) {
+  Address entry = fallback;
+  if (!label.empty()) {
+    for (const auto &sym : symbols) {
+      if (sym.Name == label) {
+        entry = sym.Address;
+      }
+    }
+  }
+  return entry;
+}
+
+System::ExecutableImage BuildImage(const AssembledProgram &program) {
+  using System::SectionKind;
+  System::ExecutableImage image;
+  image.Entry = program.Entry;
+  auto addSection = [&](SectionKind kind, std::span<const std::uint8_t> b,
+                        std::size_t size) {
+    if (size != 0) {
+      image.Sections.push_back({kind, program.Layout.BaseOf(kind), size, b});
+    }
+  };
+  addSection(SectionKind::Text, program.Text, program.Text.size());
+  addSection(SectionKind::RoData, program.RoData, program.RoData.size());
+  addSection(SectionKind::Data, program.Data, program.Data.size());
+  addSection(SectionKind::Bss, {}, program.BssSize);
+
+  for (const auto &sym : program.Symbols) {
+    image.Symbols.push_back({sym.Name, sym.Address, sym.Section,
+                             sym.IsGlobal});
+  }
+  return image;
+}
+
+std::vector<std::uint8_t> BuildFlatBinary(const AssembledProgram &program) {
+  // Padding between sections comes from the resize
+  std::vector<std::uint8_t> output(program.Text.begin(), program.Text.end());
+  if (!program.RoData.empty()) {
+    output.resize(program.Layout.RoDataBase - program.Layout.TextBase, 0);
+    output.insert(output.end(), program.RoData.begin(), program.RoData.end());
+  }
+  if (!program.Data.empty()) {
+    output.resize(program.Layout.DataBase - program.Layout.TextBase, 0);
+    output.insert(output.end(), program.Data.begin(), program.Data.end());
+  }
+  return output;
+}
+
+} // namespace Aurelia::Tools::Assembler
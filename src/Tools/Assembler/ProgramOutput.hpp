@@ -0,0 +1,64 @@
+/**
+ * Program Output.
+ *
+ * Turns an assembled or linked program into the bytes `asm` and `alink`
+ * write. Both tools, and every pipeline behind them (batch, streaming,
+ * linked objects), hand over the same AssembledProgram.
+ *
+ * ┌────────┬───────────────────────────────────────────────────────────┐
+ * │ Format │ Contents                                                  │
+ * ├────────┼───────────────────────────────────────────────────────────┤
+ * │ flat   │ [text][rodata][data] from TextBase, padded to the layout; │
+ * │        │ the entry point is lost and .bss relies on zeroed RAM     │
+ * │ aex    │ Sectioned image with entry point and symbol table; .bss   │
+ * │        │ takes no file space (System/ExecutableImage.hpp)          │
+ * └────────┴───────────────────────────────────────────────────────────┘
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "System/ExecutableImage.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace Aurelia::Tools::Assembler {
+
+/**
+ * A finished program; every span views the producer's buffers.
+ */
+struct AssembledProgram {
+  std::span<const std::uint8_t> Text;
+  std::span<const std::uint8_t> RoData;
+  std::span<const std::uint8_t> Data;
+  std::size_t BssSize = 0;
+  SectionLayout Layout;
+  std::span<const ResolvedSymbol> Symbols;
+  Address Entry = 0;
+};
+
+/**
+ * @brief Address of the symbol named `label`, or `fallback` if the label
+ * is empty or not among `symbols`.
+ */
+[[nodiscard]] Address FindEntry(std::span<const ResolvedSymbol> symbols,
+                                std::string_view label, Address fallback);
+
+/**
+ * @brief AEX image of `program`; its sections view `program`'s buffers.
+ */
+[[nodiscard]] System::ExecutableImage
+BuildImage(const AssembledProgram &program);
+
+/**
+ * @brief Flat RAM image of `program`, starting at its TextBase.
+ */
+[[nodiscard]] std::vector<std::uint8_t>
+BuildFlatBinary(const AssembledProgram &program);
+
+} // namespace Aurelia::Tools::Assembler
@@ -11,11 +11,81 @@
 
 namespace Aurelia::Tools::Assembler {
 
-using Address = Core::Address;
+namespace {
 
-Resolver::Resolver(std::vector<ParsedInstruction> &instructions,
-                   const std::vector<Parser::LabelDef> &labels)
-    : m_Instructions(instructions), m_Labels(labels) {}
+constexpr Address AlignUp(Address value, std::size_t align) {
+  return (value + align - 1) & ~static_cast<Address>(align - 1);
+}
+
+} // namespace
+
+SectionLayout SectionLayout::Sequential(Address base, std::size_t textBytes,
+                                        std::size_t roDataBytes,
+                                        std::size_t dataBytes) {
+  SectionLayout layout;
+  layout.TextBase = base;
+  layout.RoDataBase = AlignUp(base + textBytes, Alignment);
+  layout.DataBase = AlignUp(layout.RoDataBase + roDataBytes, Alignment);
+  layout.BssBase = AlignUp(layout.DataBase + dataBytes, Alignment);
+  return layout;
+}
+
+Address SectionLayout::BaseOf(System::SectionKind kind) const {
+  switch (kind) {
+  case System::SectionKind::Text:
+    return TextBase;
+  case System::SectionKind::RoData:
+    return RoDataBase;
+  case System::SectionKind::Data:
+    return DataBase;
+  case System::SectionKind::Bss:
+    return BssBase;
+  }
+  return TextBase;
+}
+
+bool PatchLabelOperand(const ParsedInstruction &instr, Operand &op,
+                       Address pc, Address target, std::string &error) {
+  // Branch Resolution (PC Relative)
+  // B, BEQ, BNE, CMP? No CMP doesn't use label usually.
+  // BL (if exists).
+  // We assume Branch opcodes need PC-Relative offset.
+  if (IsPcRelative(instr.Op)) {
+    // PC is Current (Cpu adds OpB to current PC)
+    // Offset = Target - PC
+    std::int64_t diff =
+        static_cast<std::int64_t>(target) - static_cast<std::int64_t>(pc);
+
+    // Check Range (11-bit signed: -1024 to +1023)
+    if (diff < -1024 || diff > 1023) {
+      error = "Branch target out of range (" + std::to_string(diff) + ")";
+      return false;
+    }
+
+    // Replace with Immediate
+    op.Type = OperandType::Immediate;
+    // Cast to uint64 for storage, Encoder will enforce bitmask
+    op.Value = ImmediateOperand{static_cast<std::uint64_t>(diff)};
+  } else {
+    // Absolute address for non-branch instructions
+    op.Type = OperandType::Immediate;
+    op.Value = ImmediateOperand{target};
+  }
+  return true;
+}
+
+Resolver::Resolver(std::span<ParsedInstruction> instructions,
+                   std::span<const Parser::LabelDef> labels)
+    : m_Instructions(instructions), m_Labels(labels) {
+  // Section sizes are unknown here: every other section starts where
+  // text ends, which is right for [text][data] flat binaries
+  m_Layout = SectionLayout::Sequential(0, instructions.size() * 4, 0, 0);
+}
+
+Resolver::Resolver(std::span<ParsedInstruction> instructions,
+                   std::span<const Parser::LabelDef> labels,
+                   const SectionLayout &layout)
+    : m_Instructions(instructions), m_Labels(labels), m_Layout(layout) {}
 
 bool Resolver::Resolve() {
   BuildSymbolTable();
@@ -27,17 +97,32 @@ bool Resolver::Resolve() {
 }
 
 void Resolver::BuildSymbolTable() {
-  // Pass 1: Assign Addresses (4 bytes per instruction)
+  // Pass 1: Assign Addresses (4 bytes per instruction in text)
+  m_Symbols.clear();
+  m_Symbols.reserve(m_Labels.size());
+  m_AddressBySymbol.clear();
   for (const auto &label : m_Labels) {
-    Address addr = static_cast<Address>(label.InstructionIndex * 4);
-
-    if (m_SymbolTable.Contains(label.Name)) {
-      m_ErrorMessage = "Duplicate Label Definition: " + label.Name;
+    if (m_AddressBySymbol.size() <= label.Id) {
+      m_AddressBySymbol.resize(label.Id + 1);
+    }
+  }
+  for (const auto &label : m_Labels) {
+    std::size_t offset = label.Section == System::SectionKind::Text
+                             ? label.InstructionIndex * 4
+                             : label.Offset;
+    Address addr = m_Layout.BaseOf(label.Section) + offset;
+
+    std::optional<Address> &slot = m_AddressBySymbol[label.Id];
+    if (slot.has_value()) {
+      m_ErrorMessage = "Duplicate Label Definition: ";
+      m_ErrorMessage += label.Name;
       m_HasError = true;
       return;
     }
 
-    m_SymbolTable.Define(label.Name, addr);
+    slot = addr;
+    m_Symbols.push_back(
+        {std::string(label.Name), addr, label.Section, label.IsGlobal});
   }
 }
 
@@ -45,50 +130,24 @@ void Resolver::ResolveOperands() {
   // Pass 2: Patch Operands
   for (size_t i = 0; i < m_Instructions.size(); ++i) {
     auto &instr = m_Instructions[i];
-    Address currentAddr = static_cast<Address>(i * 4);
+    Address currentAddr = m_Layout.TextBase + static_cast<Address>(i * 4);
 
     for (auto &op : instr.Operands) {
       if (op.Type == OperandType::Label) {
         // Resolve Label
-        auto labelOp = std::get<LabelOperand>(op.Value);
-        std::string name = labelOp.Name;
+        const LabelOperand &label = std::get<LabelOperand>(op.Value);
 
-        auto targetAddrOpt = m_SymbolTable.Resolve(name);
-        if (!targetAddrOpt.has_value()) {
-          Error(instr, "Undefined Symbol: " + name);
+        if (label.Id >= m_AddressBySymbol.size() ||
+            !m_AddressBySymbol[label.Id].has_value()) {
+          Error(instr, "Undefined Symbol: " + std::string(label.Name));
           return;
         }
-        Address targetAddr = targetAddrOpt.value();
-
-        // Branch Resolution (PC Relative)
-        // B, BEQ, BNE, CMP? No CMP doesn't use label usually.
-        // BL (if exists).
-        // We assume Branch opcodes need PC-Relative offset.
-        bool isBranch =
-            (instr.Op == Cpu::Opcode::B || instr.Op == Cpu::Opcode::BEQ ||
-             instr.Op == Cpu::Opcode::BNE);
-
-        if (isBranch) {
-          // PC is Current (Cpu adds OpB to current PC)
-          // Offset = Target - PC
-          std::int64_t diff = static_cast<std::int64_t>(targetAddr) -
-                              static_cast<std::int64_t>(currentAddr);
-
-          // Check Range (11-bit signed: -1024 to +1023)
-          if (diff < -1024 || diff > 1023) {
-            Error(instr,
-                  "Branch target out of range (" + std::to_string(diff) + ")");
-            return;
-          }
-
-          // Replace with Immediate
-          op.Type = OperandType::Immediate;
-          // Cast to uint64 for storage, Encoder will enforce bitmask
-          op.Value = ImmediateOperand{static_cast<std::uint64_t>(diff)};
-        } else {
-          // Absolute address for non-branch instructions
-          op.Type = OperandType::Immediate;
-          op.Value = ImmediateOperand{targetAddr};
+        Address targetAddr = *m_AddressBySymbol[label.Id];
+
+        std::string error;
+        if (!PatchLabelOperand(instr, op, currentAddr, targetAddr, error)) {
+          Error(instr, error);
+          return;
         }
       }
     }
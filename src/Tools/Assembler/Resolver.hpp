@@ -6,36 +6,117 @@
  * Pass 2: Resolve label references to immediate values (e.g., PC-relative
  * offsets).
  *
+ * LAYOUT:
+ * Labels are turned into addresses using a SectionLayout giving the base
+ * of each section. The default places text at 0 with the other sections
+ * packed after it, which for programs using only .text and .string is
+ * exactly the flat binary layout: [text][data].
+ *
+ * Labels and label operands carry the SymbolId the Lexer interned them
+ * under, so both passes index a dense table by ID; names are only read
+ * back for error messages and GetSymbols().
+ *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
  */
 
 #pragma once
 
+#include "Core/Types.hpp"
 #include "Tools/Assembler/Parser.hpp"
-#include "Tools/Assembler/SymbolTable.hpp"
+#include <optional>
+#include <span>
 #include <string>
 #include <vector>
 
 namespace Aurelia::Tools::Assembler {
 
+using Address = Core::Address;
+
+/**
+ * Load address of each section.
+ */
+struct SectionLayout {
+  static constexpr std::size_t Alignment = 4; // Keeps the flat layout
+
+  Address TextBase = 0;
+  Address RoDataBase = 0;
+  Address DataBase = 0;
+  Address BssBase = 0;
+
+  /**
+   * @brief Text at `base`, then rodata, data and bss, each aligned.
+   */
+  [[nodiscard]] static SectionLayout Sequential(Address base,
+                                                std::size_t textBytes,
+                                                std::size_t roDataBytes,
+                                                std::size_t dataBytes);
+
+  [[nodiscard]] Address BaseOf(System::SectionKind kind) const;
+};
+
+/**
+ * A label with its final address.
+ */
+struct ResolvedSymbol {
+  std::string Name;
+  Core::Address Address;
+  System::SectionKind Section;
+  bool IsGlobal;
+};
+
+/**
+ * @brief True for opcodes whose label operand is PC-relative (branches).
+ */
+[[nodiscard]] constexpr bool IsPcRelative(Cpu::Opcode op) {
+  return op == Cpu::Opcode::B || op == Cpu::Opcode::BEQ ||
+         op == Cpu::Opcode::BNE;
+}
+
+/**
+ * @brief Turn label operand `op` of `instr`, which sits at `pc`, into the
+ * immediate that reaches `target`: PC-relative for branches, the absolute
+ * address otherwise.
+ *
+ * @return false, with the reason in `error`, if a branch cannot reach.
+ */
+[[nodiscard]] bool PatchLabelOperand(const ParsedInstruction &instr,
+                                     Operand &op, Address pc,
+                                     Address target, std::string &error);
+
 class Resolver {
 public:
   // The Resolver modifies instructions in-place to replace Labels with
   // Immediates.
-  explicit Resolver(std::vector<ParsedInstruction> &instructions,
-                    const std::vector<Parser::LabelDef> &labels);
+  explicit Resolver(std::span<ParsedInstruction> instructions,
+                    std::span<const Parser::LabelDef> labels);
+
+  /**
+   * @brief Resolve against an explicit section layout.
+   */
+  Resolver(std::span<ParsedInstruction> instructions,
+           std::span<const Parser::LabelDef> labels,
+           const SectionLayout &layout);
 
   // Run Pass 1 and Pass 2
   [[nodiscard]] bool Resolve();
 
+  /**
+   * @brief Every label with its address, in definition order.
+   */
+  [[nodiscard]] const std::vector<ResolvedSymbol> &GetSymbols() const {
+    return m_Symbols;
+  }
+
   [[nodiscard]] bool HasError() const { return m_HasError; }
   [[nodiscard]] std::string GetErrorMessage() const { return m_ErrorMessage; }
 
 private:
-  std::vector<ParsedInstruction> &m_Instructions;
-  const std::vector<Parser::LabelDef> &m_Labels;
-  SymbolTable m_SymbolTable;
+  std::span<ParsedInstruction> m_Instructions;
+  std::span<const Parser::LabelDef> m_Labels;
+  SectionLayout m_Layout;
+  std::vector<std::optional<Address>> m_AddressBySymbol; // By SymbolId
+  std::vector<ResolvedSymbol> m_Symbols;
 
   bool m_HasError = false;
   std::string m_ErrorMessage;
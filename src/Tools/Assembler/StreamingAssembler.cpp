@@ -0,0 +1,190 @@
+/**
+ * Streaming Assembler Implementation.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Tools/Assembler/StreamingAssembler.hpp"
+#include <algorithm>
+#include <istream>
+
+namespace Aurelia::Tools::Assembler {
+
+StreamingAssembler::StreamingAssembler(Address base)
+    : m_Base(base), m_Layout(SectionLayout::Sequential(base, 0, 0, 0)) {}
+
+bool StreamingAssembler::AssembleLine(std::string_view line) {
+  if (m_HasError) {
+    return false;
+  }
+
+  m_Lexer.TokenizeLine(line, m_LineTokens);
+  if (!m_Parser.ParseLine(m_LineTokens)) {
+    Fail(m_Parser.GetErrorMessage());
+    return false;
+  }
+
+  // Labels first: "loop: B loop" defines the label before the branch
+  RecordTextLabels();
+  for (const ParsedInstruction &instr : m_Parser.GetInstructions()) {
+    Emit(instr);
+  }
+  m_Parser.ClearInstructions();
+  return !m_HasError;
+}
+
+bool StreamingAssembler::Assemble(std::istream &in) {
+  std::string line;
+  while (std::getline(in, line)) {
+    if (!AssembleLine(line)) {
+      return false;
+    }
+  }
+  return Finish();
+}
+
+void StreamingAssembler::RecordTextLabels() {
+  const auto &labels = m_Parser.GetLabels();
+  for (; m_LabelsSeen < labels.size(); ++m_LabelsSeen) {
+    const Parser::LabelDef &label = labels[m_LabelsSeen];
+    if (label.Section != System::SectionKind::Text) {
+      continue; // Placed after text: unknown until Finish()
+    }
+    if (m_TextLabels.size() <= label.Id) {
+      m_TextLabels.resize(label.Id + 1);
+    }
+    m_TextLabels[label.Id] =
+        m_Base + static_cast<Address>(label.InstructionIndex * 4);
+  }
+}
+
+void StreamingAssembler::Emit(ParsedInstruction instr) {
+  std::size_t index = m_Text.size() / 4;
+  Address pc = m_Base + static_cast<Address>(index * 4);
+
+  bool pending = false;
+  for (Operand &op : instr.Operands) {
+    if (op.Type != OperandType::Label) {
+      continue;
+    }
+    SymbolId id = std::get<LabelOperand>(op.Value).Id;
+    if (id >= m_TextLabels.size() || !m_TextLabels[id]) {
+      pending = true; // Forward, or not in .text
+      continue;
+    }
+    std::string error;
+    if (!PatchLabelOperand(instr, op, pc, *m_TextLabels[id], error)) {
+      Error(instr, error);
+      return;
+    }
+  }
+
+  m_Text.resize(m_Text.size() + 4, 0);
+  if (pending) {
+    Fixup fixup{index, instr};
+    std::copy_n(instr.Mnemonic.begin(),
+                std::min(instr.Mnemonic.size(), fixup.Mnemonic.size()),
+                fixup.Mnemonic.begin());
+    m_Fixups.push_back(fixup);
+    m_PeakFixups = std::max(m_PeakFixups, m_Fixups.size());
+    return;
+  }
+
+  std::uint32_t word = 0;
+  if (!m_Encoder.EncodeOne(instr, word)) {
+    Fail(m_Encoder.GetErrorMessage());
+    return;
+  }
+  StoreWord(index, word);
+}
+
+bool StreamingAssembler::Finish() {
+  if (m_HasError) {
+    return false;
+  }
+  if (!m_Parser.Finish()) {
+    Fail(m_Parser.GetErrorMessage());
+    return false;
+  }
+
+  m_Layout = SectionLayout::Sequential(m_Base, m_Text.size(),
+                                       GetRoDataSegment().size(),
+                                       GetDataSegment().size());
+
+  // Pass 1 of the batch Resolver over the labels alone
+  const auto &labels = m_Parser.GetLabels();
+  Resolver resolver({}, labels, m_Layout);
+  if (!resolver.Resolve()) {
+    Fail(resolver.GetErrorMessage());
+    return false;
+  }
+  m_Symbols = resolver.GetSymbols();
+
+  std::vector<std::optional<Address>> addresses; // By SymbolId
+  for (std::size_t i = 0; i < labels.size(); ++i) {
+    if (addresses.size() <= labels[i].Id) {
+      addresses.resize(labels[i].Id + 1);
+    }
+    addresses[labels[i].Id] = m_Symbols[i].Address;
+  }
+
+  for (Fixup &fixup : m_Fixups) {
+    ParsedInstruction &instr = fixup.Instr;
+    instr.Mnemonic = std::string_view(
+        fixup.Mnemonic.data(),
+        std::find(fixup.Mnemonic.begin(), fixup.Mnemonic.end(), '\0') -
+            fixup.Mnemonic.begin());
+    Address pc = m_Base + static_cast<Address>(fixup.Index * 4);
+
+    for (Operand &op : instr.Operands) {
+      if (op.Type != OperandType::Label) {
+        continue;
+      }
+      const LabelOperand &label = std::get<LabelOperand>(op.Value);
+      if (label.Id >= addresses.size() || !addresses[label.Id]) {
+        Error(instr, "Undefined Symbol: " + std::string(label.Name));
+        return false;
+      }
+      std::string error;
+      if (!PatchLabelOperand(instr, op, pc, *addresses[label.Id], error)) {
+        Error(instr, error);
+        return false;
+      }
+    }
+
+    std::uint32_t word = 0;
+    if (!m_Encoder.EncodeOne(instr, word)) {
+      Fail(m_Encoder.GetErrorMessage());
+      return false;
+    }
+    StoreWord(fixup.Index, word);
+  }
+
+  m_Fixups.clear();
+  m_Fixups.shrink_to_fit();
+  return true;
+}
+
+void StreamingAssembler::StoreWord(std::size_t index, std::uint32_t word) {
+  // Little-endian, as Encoder::Encode() emits
+  for (std::size_t i = 0; i < 4; ++i) {
+    m_Text[index * 4 + i] = static_cast<std::uint8_t>(word >> (8 * i));
+  }
+}
+
+void StreamingAssembler::Error(const ParsedInstruction &instr,
+                               std::string_view message) {
+  std::string text = "[Line " + std::to_string(instr.Line) + "] ";
+  text += message;
+  Fail(std::move(text));
+}
+
+void StreamingAssembler::Fail(std::string message) {
+  if (m_HasError)
+    return; // Keep the first error
+  m_HasError = true;
+  m_ErrorMessage = std::move(message);
+}
+
+} // namespace Aurelia::Tools::Assembler
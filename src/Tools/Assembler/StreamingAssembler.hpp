@@ -0,0 +1,157 @@
+/**
+ * Streaming Assembler.
+ *
+ * Single-pass assembly for sources too large to hold as tokens: each line
+ * is lexed, parsed and encoded straight into the text buffer, and only
+ * what cannot be encoded yet is kept back.
+ *
+ * PER LINE:
+ * ┌────────────────────┬─────────────────────────────────────────────────┐
+ * │ Stage              │ Work                                            │
+ * ├────────────────────┼─────────────────────────────────────────────────┤
+ * │ Lexer (line mode)  │ Tokens for this line, into a reused buffer      │
+ * │ Parser (line mode) │ Labels, data bytes, this line's instructions    │
+ * │ Encode             │ Word appended to the text buffer; a label       │
+ * │                    │ defined earlier in .text is patched in first    │
+ * │ Otherwise          │ Placeholder word plus a fixup                   │
+ * └────────────────────┴─────────────────────────────────────────────────┘
+ *
+ * Finish() lays the sections out (text at the base, rodata, data and bss
+ * after it, as SectionLayout::Sequential), resolves every label and
+ * re-encodes each fixup in place. The result matches the batch pipeline
+ * (Lexer -> Parser -> Resolver -> Encoder) byte for byte.
+ *
+ * MEMORY:
+ * Output bytes, the label table and the pending fixups. Tokens and
+ * instructions are dropped line by line. Backward branches, the common
+ * case in loops, never become fixups; forward references and references
+ * to rodata/data/bss labels do, because their address depends on where
+ * text ends.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include "Tools/Assembler/Encoder.hpp"
+#include "Tools/Assembler/Keywords.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Aurelia::Tools::Assembler {
+
+class StreamingAssembler {
+public:
+  /**
+   * @param base Load address of .text; the other sections follow it.
+   */
+  explicit StreamingAssembler(Address base = 0);
+
+  StreamingAssembler(const StreamingAssembler &) = delete;
+  StreamingAssembler &operator=(const StreamingAssembler &) = delete;
+
+  /**
+   * @brief Assemble the next source line (without its newline).
+   * @return false on the first error; later calls do nothing.
+   */
+  bool AssembleLine(std::string_view line);
+
+  /**
+   * @brief Assemble every line of `in`, then Finish().
+   */
+  bool Assemble(std::istream &in);
+
+  /**
+   * @brief Lay out sections, resolve labels and patch every fixup.
+   */
+  bool Finish();
+
+  /**
+   * @brief Encoded .text; complete once Finish() succeeds.
+   */
+  [[nodiscard]] const std::vector<std::uint8_t> &GetText() const {
+    return m_Text;
+  }
+
+  [[nodiscard]] const std::vector<std::uint8_t> &GetRoDataSegment() const {
+    return m_Parser.GetRoDataSegment();
+  }
+
+  [[nodiscard]] const std::vector<std::uint8_t> &GetDataSegment() const {
+    return m_Parser.GetDataSegment();
+  }
+
+  [[nodiscard]] std::size_t GetBssSize() const {
+    return m_Parser.GetBssSize();
+  }
+
+  [[nodiscard]] const std::string &GetEntryLabel() const {
+    return m_Parser.GetEntryLabel();
+  }
+
+  /**
+   * @brief Section bases; valid after Finish().
+   */
+  [[nodiscard]] const SectionLayout &GetLayout() const { return m_Layout; }
+
+  /**
+   * @brief Every label with its address, after Finish().
+   */
+  [[nodiscard]] const std::vector<ResolvedSymbol> &GetSymbols() const {
+    return m_Symbols;
+  }
+
+  /**
+   * @brief Most fixups held at once: the streaming memory overhead.
+   */
+  [[nodiscard]] std::size_t GetPeakFixups() const { return m_PeakFixups; }
+
+  [[nodiscard]] bool HasError() const { return m_HasError; }
+  [[nodiscard]] std::string GetErrorMessage() const { return m_ErrorMessage; }
+
+private:
+  /**
+   * An instruction waiting on label addresses, and its slot in m_Text.
+   */
+  struct Fixup {
+    std::size_t Index; // Instruction index; the word is at Index * 4
+    ParsedInstruction Instr;
+    // Instr.Mnemonic views the line it came from, long gone by Finish()
+    std::array<char, Keywords::MaxKeywordLength> Mnemonic{};
+  };
+
+  void RecordTextLabels();
+  void Emit(ParsedInstruction instr);
+  void StoreWord(std::size_t index, std::uint32_t word);
+  void Error(const ParsedInstruction &instr, std::string_view message);
+  void Fail(std::string message);
+
+  Address m_Base;
+  Lexer m_Lexer;
+  Parser m_Parser;
+  Encoder m_Encoder{{}};
+  std::vector<Token> m_LineTokens; // Reused for every line
+
+  std::vector<std::uint8_t> m_Text;
+  std::vector<std::optional<Address>> m_TextLabels; // By SymbolId
+  std::size_t m_LabelsSeen = 0;
+  std::vector<Fixup> m_Fixups;
+  std::size_t m_PeakFixups = 0;
+
+  SectionLayout m_Layout;
+  std::vector<ResolvedSymbol> m_Symbols;
+
+  bool m_HasError = false;
+  std::string m_ErrorMessage;
+};
+
+} // namespace Aurelia::Tools::Assembler
@@ -0,0 +1,92 @@
+/**
+ * String Interner.
+ *
+ * Maps each distinct name to a small dense SymbolId, so later passes
+ * compare and index symbols by integer instead of hashing strings again.
+ *
+ * ┌──────────────────┬──────────────────────────────────────────────────┐
+ * │ Call             │ Effect                                           │
+ * ├──────────────────┼──────────────────────────────────────────────────┤
+ * │ Intern("loop")   │ 0 the first time, the same 0 on every later call │
+ * │ Intern("done")   │ 1                                                │
+ * │ Find("exit")     │ nullopt: never interned                          │
+ * │ GetName(1)       │ "done"                                           │
+ * └──────────────────┴──────────────────────────────────────────────────┘
+ *
+ * NOTE (KleaSCM) By default the interner stores views, not copies. Every
+ * name must outlive it; the Lexer interns straight out of the source
+ * buffer, which its caller keeps alive anyway. NameStorage::Copy keeps
+ * its own copy of each distinct name instead, for sources read a line at
+ * a time into a reused buffer.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Aurelia::Tools::Assembler {
+
+using SymbolId = std::uint32_t;
+
+enum class NameStorage {
+  Borrow, // Views into the caller's buffer
+  Copy    // Owned copies; the caller's buffer may be reused
+};
+
+class StringInterner {
+public:
+  explicit StringInterner(NameStorage storage = NameStorage::Borrow)
+      : m_Storage(storage) {}
+
+  /**
+   * @brief ID of `name`, assigning the next free one on first sight.
+   */
+  SymbolId Intern(std::string_view name) {
+    if (m_Storage == NameStorage::Copy) {
+      if (auto it = m_Ids.find(name); it != m_Ids.end()) {
+        return it->second;
+      }
+      name = m_Owned.emplace_back(name); // Deque: never relocated
+    }
+    auto [it, inserted] =
+        m_Ids.try_emplace(name, static_cast<SymbolId>(m_Names.size()));
+    if (inserted) {
+      m_Names.push_back(name);
+    }
+    return it->second;
+  }
+
+  [[nodiscard]] std::optional<SymbolId> Find(std::string_view name) const {
+    auto it = m_Ids.find(name);
+    if (it != m_Ids.end()) {
+      return it->second;
+    }
+    return std::nullopt;
+  }
+
+  [[nodiscard]] std::string_view GetName(SymbolId id) const {
+    return m_Names[id];
+  }
+
+  /**
+   * @brief Number of distinct names; every ID is below this.
+   */
+  [[nodiscard]] std::size_t GetCount() const { return m_Names.size(); }
+
+private:
+  NameStorage m_Storage;
+  std::unordered_map<std::string_view, SymbolId> m_Ids;
+  std::vector<std::string_view> m_Names;
+  std::deque<std::string> m_Owned; // NameStorage::Copy only
+};
+
+} // namespace Aurelia::Tools::Assembler
@@ -3,6 +3,9 @@
  *
  * Stores the mapping between label names and their memory addresses.
  *
+ * Lookups take a string_view and hash it directly (transparent hashing),
+ * so resolving a name borrowed from the source allocates nothing.
+ *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
  */
@@ -10,8 +13,10 @@
 #pragma once
 
 #include "Core/Types.hpp"
+#include <functional>
 #include <optional>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 namespace Aurelia::Tools::Assembler {
@@ -20,11 +25,11 @@ using Address = Core::Address;
 
 class SymbolTable {
 public:
-  void Define(const std::string &name, Address address) {
-    m_Symbols[name] = address;
+  void Define(std::string_view name, Address address) {
+    m_Symbols.insert_or_assign(std::string(name), address);
   }
 
-  [[nodiscard]] std::optional<Address> Resolve(const std::string &name) const {
+  [[nodiscard]] std::optional<Address> Resolve(std::string_view name) const {
     auto it = m_Symbols.find(name);
     if (it != m_Symbols.end()) {
       return it->second;
@@ -32,12 +37,20 @@ public:
     return std::nullopt;
   }
 
-  [[nodiscard]] bool Contains(const std::string &name) const {
+  [[nodiscard]] bool Contains(std::string_view name) const {
     return m_Symbols.find(name) != m_Symbols.end();
   }
 
 private:
-  std::unordered_map<std::string, Address> m_Symbols;
+  struct NameHash {
+    using is_transparent = void;
+    std::size_t operator()(std::string_view name) const {
+      return std::hash<std::string_view>{}(name);
+    }
+  };
+
+  std::unordered_map<std::string, Address, NameHash, std::equal_to<>>
+      m_Symbols;
 };
 
 } // namespace Aurelia::Tools::Assembler
@@ -11,12 +11,48 @@
  * 4. Encoder: Code generation (AST → binary)
  *
  * USAGE:
- *   asm [options] <input.s>
+ *   asm [options] <input.s>...
  *
  * OPTIONS:
  *   -o <file>     Specify output file (default: a.out)
+ *   -f <format>   Output format: flat (default) or aex
+ *   -c            Write one relocatable object per input, no linking
+ *   -j <threads>  Threads for several inputs (default: hardware)
+ *   --stream      Assemble line by line (StreamingAssembler.hpp)
  *   -h, --help    Display help information
  *
+ * STREAMING:
+ * --stream reads the input a line at a time and encodes as it goes, so
+ * neither the source nor its tokens are ever held whole; forward label
+ * references are patched once the input ends. Output is identical to the
+ * default pipeline.
+ *
+ * OBJECTS AND LINKING:
+ * ┌──────────────────────────┬─────────────────────────────────────────┐
+ * │ Command                  │ Result                                  │
+ * ├──────────────────────────┼─────────────────────────────────────────┤
+ * │ asm a.s                  │ One file, assembled as always           │
+ * │ asm -c a.s b.s           │ a.o and b.o (ObjectFile.hpp)            │
+ * │ asm -c -o x.o a.s        │ x.o                                     │
+ * │ asm a.s b.s -o prog      │ Objects in memory, linked (Linker.hpp)  │
+ * │ alink a.o b.o -o prog    │ Links objects from earlier asm -c runs  │
+ * └──────────────────────────┴─────────────────────────────────────────┘
+ * Several inputs are assembled in parallel, one Host::ThreadPool task per
+ * file. Rebuilds are incremental per file: reassemble what changed with
+ * -c, then relink with alink. Labels are private to their file unless
+ * exported with .global; a name a file uses but does not define is an
+ * import that some other file must export.
+ *
+ * OUTPUT FORMATS:
+ * ┌────────┬───────────────────────────────────────────────────────────┐
+ * │ Format │ Contents                                                  │
+ * ├────────┼───────────────────────────────────────────────────────────┤
+ * │ flat   │ [text][rodata][data] loaded at ResetVector; .entry is     │
+ * │        │ ignored and .bss relies on RAM starting zeroed            │
+ * │ aex    │ Sectioned image with entry point and symbol table; .bss   │
+ * │        │ takes no file space (System/ExecutableImage.hpp)          │
+ * └────────┴───────────────────────────────────────────────────────────┘
+ *
  * EXIT CODES:
  *   0  Success (binary generated)
  *   1  Assembly error (lexer/parser/resolver/encoder failure)
@@ -34,13 +70,22 @@
 
 #include "Tools/Assembler/Encoder.hpp"
 #include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Linker.hpp"
+#include "Tools/Assembler/ObjectAssembler.hpp"
 #include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/ProgramOutput.hpp"
 #include "Tools/Assembler/Resolver.hpp"
+#include "Tools/Assembler/StreamingAssembler.hpp"
+#include "Host/ThreadPool.hpp"
+#include "System/MemoryMap.hpp"
+#include <algorithm>
 #include <cstdlib>
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 /**
@@ -59,9 +104,13 @@ constexpr int ExitInvalidArgs = 3;
  */
 void PrintUsage(const char *programName) {
   std::cout << "Aurelia Assembler\n"
-            << "Usage: " << programName << " [options] <input.s>\n\n"
+            << "Usage: " << programName << " [options] <input.s>...\n\n"
             << "Options:\n"
             << "  -o <file>     Specify output binary file (default: a.out)\n"
+            << "  -f <format>   Output format: flat (default) or aex\n"
+            << "  -c            Write one object per input, do not link\n"
+            << "  -j <threads>  Threads for several inputs\n"
+            << "  --stream      Assemble line by line, for huge sources\n"
             << "  -h, --help    Display this help information\n\n"
             << "Exit Codes:\n"
             << "  0  Success\n"
@@ -69,7 +118,8 @@ void PrintUsage(const char *programName) {
             << "  2  I/O error\n"
             << "  3  Invalid arguments\n\n"
             << "Example:\n"
-            << "  " << programName << " -o program.bin program.s\n";
+            << "  " << programName << " -o program.bin program.s\n"
+            << "  " << programName << " -c main.s lib.s\n";
 }
 
 /**
@@ -136,6 +186,198 @@ bool WriteFile(const std::string &filename,
   return true;
 }
 
+/**
+ * @brief Builds the output file contents (see STAGE 5 in main).
+ */
+std::vector<std::uint8_t>
+BuildOutput(const Aurelia::Tools::Assembler::AssembledProgram &program,
+            bool imageFormat) {
+  using namespace Aurelia::Tools::Assembler;
+
+  std::vector<std::uint8_t> output;
+  if (imageFormat) {
+    Aurelia::System::ExecutableImage image = BuildImage(program);
+    output = image.Serialize();
+    std::cout << "  [✓] Image: " << image.Sections.size() << " sections, "
+              << image.Symbols.size() << " symbols, entry 0x" << std::hex
+              << program.Entry << std::dec << "\n";
+  } else {
+    if (program.Entry != program.Layout.TextBase) {
+      std::cerr << "Warning: .entry ignored for flat output\n";
+    }
+    output = BuildFlatBinary(program);
+    if (!program.Data.empty()) {
+      std::cout << "  [✓] Data: " << program.Data.size()
+                << " bytes appended\n";
+    }
+  }
+
+  return output;
+}
+
+/**
+ * @brief --stream: lex, parse and encode the file one line at a time.
+ *
+ * Same layout and output as main's pipeline, but the source is never read
+ * whole and no stage holds more than one line of tokens or instructions.
+ */
+int AssembleStreaming(const std::string &inputFile,
+                      const std::string &outputFile, bool imageFormat) {
+  std::ifstream in(inputFile, std::ios::in | std::ios::binary);
+  if (!in.is_open()) {
+    std::cerr << "Error: Cannot read input file: " << inputFile << "\n";
+    return ExitIoError;
+  }
+
+  std::cout << "Assembling (streaming): " << inputFile << "\n";
+
+  using namespace Aurelia::Tools::Assembler;
+  StreamingAssembler assembler(Aurelia::System::ResetVector);
+  if (!assembler.Assemble(in)) {
+    std::cerr << "Assembler Error: " << assembler.GetErrorMessage() << "\n";
+    return ExitAssemblyError;
+  }
+  if (in.bad()) {
+    std::cerr << "Error: Failed reading input file: " << inputFile << "\n";
+    return ExitIoError;
+  }
+
+  const auto &text = assembler.GetText();
+  std::cout << "  [✓] Stream: " << text.size() / 4 << " instructions, "
+            << assembler.GetSymbols().size() << " labels, at most "
+            << assembler.GetPeakFixups() << " pending fixups\n";
+
+  const SectionLayout &layout = assembler.GetLayout();
+  std::vector<std::uint8_t> output = BuildOutput(
+      {text, assembler.GetRoDataSegment(), assembler.GetDataSegment(),
+       assembler.GetBssSize(), layout, assembler.GetSymbols(),
+       FindEntry(assembler.GetSymbols(), assembler.GetEntryLabel(),
+                 layout.TextBase)},
+      imageFormat);
+
+  if (!WriteFile(outputFile, output)) {
+    std::cerr << "Error: Cannot write output file: " << outputFile << "\n";
+    return ExitIoError;
+  }
+
+  std::cout << "Success: Binary written to " << outputFile << " ("
+            << output.size() << " bytes total)\n";
+  return ExitSuccess;
+}
+
+/**
+ * One input file and the object assembled from it.
+ */
+struct ObjectJob {
+  std::string Input;
+  Aurelia::Tools::Assembler::ObjectFile Object;
+  std::string Error;
+  bool ReadFailed = false;
+  bool Assembled = false;
+};
+
+/**
+ * @brief Assemble every input into its object, one pool task per file.
+ *
+ * Files share nothing until link time, so each task touches only its own
+ * job and needs no locking. Results are reported afterwards in input
+ * order, so the output does not depend on scheduling.
+ *
+ * @return ExitSuccess, or the exit code for the first input that failed
+ */
+int AssembleObjects(std::vector<ObjectJob> &jobs, std::size_t threads) {
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+
+  {
+    Aurelia::Host::ThreadPool pool(std::min(threads, jobs.size()));
+    for (ObjectJob &job : jobs) {
+      pool.Submit([&job] {
+        std::string source;
+        if (!ReadFile(job.Input, source)) {
+          job.ReadFailed = true;
+          return;
+        }
+        job.Assembled = Aurelia::Tools::Assembler::AssembleObject(
+            source, job.Object, job.Error);
+      });
+    }
+    pool.Wait();
+  }
+
+  for (const ObjectJob &job : jobs) {
+    if (job.ReadFailed) {
+      std::cerr << "Error: Cannot read input file: " << job.Input << "\n";
+      return ExitIoError;
+    }
+    if (!job.Assembled) {
+      std::cerr << "Assembler Error: " << job.Input << ": " << job.Error
+                << "\n";
+      return ExitAssemblyError;
+    }
+    std::cout << "  [✓] " << job.Input << ": " << job.Object.Text.size() / 4
+              << " instructions, " << job.Object.Symbols.size()
+              << " symbols, " << job.Object.Relocations.size()
+              << " relocations\n";
+  }
+  return ExitSuccess;
+}
+
+/**
+ * @brief -c: write each job's object beside its source (or to `output`).
+ */
+int WriteObjects(const std::vector<ObjectJob> &jobs,
+                 const std::string &outputFile) {
+  for (const ObjectJob &job : jobs) {
+    std::string path = outputFile;
+    if (path.empty()) {
+      path = std::filesystem::path(job.Input).replace_extension(".o");
+    }
+    if (!WriteFile(path, job.Object.Serialize())) {
+      std::cerr << "Error: Cannot write output file: " << path << "\n";
+      return ExitIoError;
+    }
+    std::cout << "Success: Object written to " << path << "\n";
+  }
+  return ExitSuccess;
+}
+
+/**
+ * @brief Several inputs without -c: link the objects in memory.
+ */
+int LinkObjects(const std::vector<ObjectJob> &jobs,
+                const std::string &outputFile, bool imageFormat) {
+  using namespace Aurelia::Tools::Assembler;
+
+  Linker linker(Aurelia::System::ResetVector);
+  for (const ObjectJob &job : jobs) {
+    linker.AddObject(job.Input, job.Object);
+  }
+  if (!linker.Link()) {
+    std::cerr << "Linker Error: " << linker.GetErrorMessage() << "\n";
+    return ExitAssemblyError;
+  }
+
+  std::cout << "  [✓] Linker: " << jobs.size() << " objects, "
+            << linker.GetSymbols().size() << " symbols\n";
+
+  std::vector<std::uint8_t> output = BuildOutput(
+      {linker.GetText(), linker.GetRoDataSegment(), linker.GetDataSegment(),
+       linker.GetBssSize(), linker.GetLayout(), linker.GetSymbols(),
+       linker.GetEntry()},
+      imageFormat);
+
+  if (!WriteFile(outputFile, output)) {
+    std::cerr << "Error: Cannot write output file: " << outputFile << "\n";
+    return ExitIoError;
+  }
+
+  std::cout << "Success: Binary written to " << outputFile << " ("
+            << output.size() << " bytes total)\n";
+  return ExitSuccess;
+}
+
 /**
  * @brief Main assembler pipeline orchestration.
  *
@@ -168,12 +410,19 @@ int main(int argc, char *argv[]) {
    *
    * Simple manual parsing without external dependencies.
    * Supports:
-   * - Input file (required, positional)
-   * - -o <output> (optional, default: a.out)
+   * - Input files (at least one, positional)
+   * - -o <output> (optional, default: a.out, or <input>.o with -c)
+   * - -c (optional, write objects instead of linking)
+   * - -j <threads> (optional, for several inputs)
+   * - --stream (optional, assemble line by line)
    * - -h/--help (show usage and exit)
    */
-  std::string inputFile;
-  std::string outputFile = "a.out";
+  std::vector<std::string> inputFiles;
+  std::string outputFile;
+  bool imageFormat = false;
+  bool streamMode = false;
+  bool objectMode = false;
+  std::size_t threads = 0;
 
   // Parse command-line arguments
   for (int i = 1; i < argc; ++i) {
@@ -190,6 +439,28 @@ int main(int argc, char *argv[]) {
         return ExitInvalidArgs;
       }
       outputFile = argv[++i];
+    } else if (arg == "-f") {
+      std::string format = i + 1 < argc ? argv[++i] : "";
+      if (format != "flat" && format != "aex") {
+        std::cerr << "Error: -f expects flat or aex\n";
+        PrintUsage(argv[0]);
+        return ExitInvalidArgs;
+      }
+      imageFormat = format == "aex";
+    } else if (arg == "-c") {
+      objectMode = true;
+    } else if (arg == "-j") {
+      char *end = nullptr;
+      unsigned long value =
+          i + 1 < argc ? std::strtoul(argv[++i], &end, 10) : 0;
+      if (!end || *end != '\0' || value == 0 || value > 4096) {
+        std::cerr << "Error: -j expects a thread count\n";
+        PrintUsage(argv[0]);
+        return ExitInvalidArgs;
+      }
+      threads = value;
+    } else if (arg == "--stream") {
+      streamMode = true;
     } else if (arg[0] == '-') {
       // Unknown option
       std::cerr << "Error: Unknown option: " << arg << "\n";
@@ -197,21 +468,50 @@ int main(int argc, char *argv[]) {
       return ExitInvalidArgs;
     } else {
       // Positional argument (input file)
-      if (!inputFile.empty()) {
-        std::cerr << "Error: Multiple input files specified\n";
-        PrintUsage(argv[0]);
-        return ExitInvalidArgs;
-      }
-      inputFile = arg;
+      inputFiles.push_back(arg);
     }
   }
 
   // Validate required arguments
-  if (inputFile.empty()) {
+  if (inputFiles.empty()) {
     std::cerr << "Error: No input file specified\n";
     PrintUsage(argv[0]);
     return ExitInvalidArgs;
   }
+  if (streamMode && (objectMode || inputFiles.size() > 1)) {
+    std::cerr << "Error: --stream takes one input and no -c\n";
+    return ExitInvalidArgs;
+  }
+  if (objectMode && !outputFile.empty() && inputFiles.size() > 1) {
+    std::cerr << "Error: -o with -c takes a single input\n";
+    return ExitInvalidArgs;
+  }
+
+  if (objectMode || inputFiles.size() > 1) {
+    std::vector<ObjectJob> jobs(inputFiles.size());
+    for (std::size_t i = 0; i < jobs.size(); ++i) {
+      jobs[i].Input = inputFiles[i];
+    }
+
+    std::cout << "Assembling " << jobs.size() << " file(s)\n";
+    if (int status = AssembleObjects(jobs, threads); status != ExitSuccess) {
+      return status;
+    }
+    if (objectMode) {
+      return WriteObjects(jobs, outputFile);
+    }
+    return LinkObjects(jobs, outputFile.empty() ? "a.out" : outputFile,
+                       imageFormat);
+  }
+
+  const std::string &inputFile = inputFiles.front();
+  if (outputFile.empty()) {
+    outputFile = "a.out";
+  }
+
+  if (streamMode) {
+    return AssembleStreaming(inputFile, outputFile, imageFormat);
+  }
 
   /**
    * STAGE 0: READ INPUT FILE
@@ -267,25 +567,34 @@ int main(int argc, char *argv[]) {
   // and to ensure we're encoding the resolved output.
   auto instructions = parser.GetInstructions();
   auto labels = parser.GetLabels();
-  auto dataSegment = parser.GetDataSegment();
+  const auto &roDataSegment = parser.GetRoDataSegment();
+  const auto &dataSegment = parser.GetDataSegment();
+  std::size_t bssSize = parser.GetBssSize();
 
   std::cout << "  [✓] Parser: " << instructions.size() << " instructions, "
             << labels.size() << " labels";
 
+  if (!roDataSegment.empty()) {
+    std::cout << ", " << roDataSegment.size() << " rodata bytes";
+  }
   if (!dataSegment.empty()) {
     std::cout << ", " << dataSegment.size() << " data bytes";
   }
+  if (bssSize != 0) {
+    std::cout << ", " << bssSize << " bss bytes";
+  }
   std::cout << "\n";
 
   // Validate non-empty output
-  if (instructions.empty() && dataSegment.empty()) {
+  if (instructions.empty() && roDataSegment.empty() && dataSegment.empty()) {
     std::cerr << "Warning: Source produces no output (empty program)\n";
   }
 
   /**
    * STAGE 3: SYMBOL RESOLUTION
    *
-   * Two-pass symbol resolution:
+   * Sections are laid out back to back from ResetVector, then two-pass
+   * symbol resolution runs against that layout:
    * - Pass 1: Assign addresses to labels
    * - Pass 2: Resolve label references to addresses/offsets
    *
@@ -298,7 +607,10 @@ int main(int argc, char *argv[]) {
    *
    * ERRORS: Undefined labels, duplicate labels, branch out of range
    */
-  Resolver resolver(instructions, labels);
+  auto layout = SectionLayout::Sequential(
+      Aurelia::System::ResetVector, instructions.size() * 4,
+      roDataSegment.size(), dataSegment.size());
+  Resolver resolver(instructions, labels, layout);
   if (!resolver.Resolve()) {
     std::cerr << "Resolver Error: " << resolver.GetErrorMessage() << "\n";
     return ExitAssemblyError;
@@ -334,24 +646,21 @@ int main(int argc, char *argv[]) {
    * STAGE 5: WRITE OUTPUT FILE
    *
    * OUTPUT FORMAT:
-   * Flat binary: [text segment (instructions)][data segment (.string)]
+   * Flat:  [text][rodata][data], padded to the resolved layout, so the
+   *        file is a RAM image starting at ResetVector.
+   * AEX:   One section per non-empty segment at its resolved address,
+   *        plus entry point and symbol table.
    *
-   * NOTE (KleaSCM) Simple flat binary format suitable for direct loading.
-   * Text segment (executable code) comes first, data segment (.string
-   * directives) follows immediately after. More sophisticated formats
-   * (ELF, COFF, etc.) would include headers with section metadata.
+   * NOTE (KleaSCM) For programs using only .text and .string the flat
+   * output is unchanged from before sections existed: rodata is empty
+   * and data starts right after the last instruction.
    */
-  std::vector<std::uint8_t> output;
-  output.reserve(binary.size() + dataSegment.size());
-
-  // Append text segment (encoded instructions)
-  output.insert(output.end(), binary.begin(), binary.end());
-
-  // Append data segment (.string directives)
-  if (!dataSegment.empty()) {
-    output.insert(output.end(), dataSegment.begin(), dataSegment.end());
-    std::cout << "  [✓] Data: " << dataSegment.size() << " bytes appended\n";
-  }
+  std::vector<std::uint8_t> output = BuildOutput(
+      {binary, roDataSegment, dataSegment, bssSize, layout,
+       resolver.GetSymbols(),
+       FindEntry(resolver.GetSymbols(), parser.GetEntryLabel(),
+                 layout.TextBase)},
+      imageFormat);
 
   if (!WriteFile(outputFile, output)) {
     std::cerr << "Error: Cannot write output file: " << outputFile << "\n";
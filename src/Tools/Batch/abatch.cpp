@@ -0,0 +1,182 @@
+/**
+ * Aurelia Headless Batch Runner Tool.
+ *
+ * Runs every job in a manifest (System/BatchRunner.hpp) as its own
+ * headless VM on a work-stealing thread pool and reports per-job results
+ * plus aggregate throughput.
+ *
+ * USAGE:
+ *   abatch [-j <threads>] [-q <cycles>] [-m <vms>] [-v] <manifest>
+ *
+ * OPTIONS:
+ * ┌────────┬──────────────────────────────────────────────────────────┐
+ * │ Option │ Effect                                                   │
+ * ├────────┼──────────────────────────────────────────────────────────┤
+ * │ -j N   │ Worker threads (default: hardware concurrency)           │
+ * │ -q N   │ Guest cycles per time slice; 0 runs each job unsliced    │
+ * │        │ (default 1000000)                                        │
+ * │ -m N   │ Machines alive at once (default: four per thread)        │
+ * │ -v     │ Print the console output of jobs that did not pass       │
+ * └────────┴──────────────────────────────────────────────────────────┘
+ *
+ * Built with AURELIA_INSTRUMENT, a probe report follows the summary and
+ * SIGUSR1 prints one mid-run.
+ *
+ * EXIT CODES:
+ *   0  Every job passed
+ *   1  At least one job failed, timed out or errored
+ *   2  I/O error (manifest not found)
+ *   3  Invalid arguments or manifest syntax
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Core/Instrument.hpp"
+#include "System/BatchRunner.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace Aurelia;
+using System::BatchJob;
+using System::BatchRunner;
+using System::JobResult;
+using System::JobStatus;
+
+constexpr int ExitSuccess = 0;
+constexpr int ExitJobsFailed = 1;
+constexpr int ExitIoError = 2;
+constexpr int ExitInvalidArgs = 3;
+
+void PrintUsage(const char *programName) {
+  std::cout << "Aurelia Headless Batch Runner\n"
+            << "Usage: " << programName
+            << " [-j <threads>] [-q <cycles>] [-m <vms>] [-v] <manifest>\n\n"
+            << "Manifest lines:\n"
+            << "  <name> <image> [cycles=N] [input=file] [expect=file]\n\n"
+            << "Exit Codes:\n"
+            << "  0  Every job passed\n"
+            << "  1  At least one job did not pass\n"
+            << "  2  I/O error\n"
+            << "  3  Invalid arguments or manifest\n";
+}
+
+int main(int argc, char *argv[]) {
+  std::size_t threads = 0;
+  std::size_t maxLive = 0;
+  Core::TickCount quantum = BatchRunner::DefaultQuantum;
+  bool verbose = false;
+  std::string manifestPath;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "-j" && i + 1 < argc) {
+      char *end = nullptr;
+      unsigned long value = std::strtoul(argv[++i], &end, 10);
+      if (*end != '\0' || value == 0 || value > 4096) {
+        std::cerr << "Error: Invalid thread count '" << argv[i] << "'\n";
+        return ExitInvalidArgs;
+      }
+      threads = value;
+    } else if ((arg == "-q" || arg == "-m") && i + 1 < argc) {
+      char *end = nullptr;
+      unsigned long long value = std::strtoull(argv[++i], &end, 10);
+      if (*end != '\0' || (arg == "-m" && value == 0)) {
+        std::cerr << "Error: Invalid " << arg << " value '" << argv[i]
+                  << "'\n";
+        return ExitInvalidArgs;
+      }
+      if (arg == "-q") {
+        quantum = value;
+      } else {
+        maxLive = static_cast<std::size_t>(value);
+      }
+    } else if (arg == "-v") {
+      verbose = true;
+    } else if (arg == "-h" || arg == "--help") {
+      PrintUsage(argv[0]);
+      return ExitSuccess;
+    } else if (manifestPath.empty() && !arg.starts_with('-')) {
+      manifestPath = arg;
+    } else {
+      PrintUsage(argv[0]);
+      return ExitInvalidArgs;
+    }
+  }
+  if (manifestPath.empty()) {
+    PrintUsage(argv[0]);
+    return ExitInvalidArgs;
+  }
+
+  std::ifstream file(manifestPath, std::ios::in | std::ios::binary);
+  if (!file) {
+    std::cerr << "Error: Cannot read '" << manifestPath << "'\n";
+    return ExitIoError;
+  }
+  std::string text((std::istreambuf_iterator<char>(file)),
+                   std::istreambuf_iterator<char>());
+
+  std::size_t slash = manifestPath.rfind('/');
+  std::string baseDir =
+      slash == std::string::npos ? "" : manifestPath.substr(0, slash);
+
+  std::vector<BatchJob> jobs;
+  std::string error;
+  if (!System::ParseManifest(text, baseDir, jobs, error)) {
+    std::cerr << "Error: " << manifestPath << ": " << error << "\n";
+    return ExitInvalidArgs;
+  }
+
+  Core::Instrument::InstallSignalReporter(std::cout);
+  BatchRunner runner(threads);
+  runner.SetQuantum(quantum);
+  runner.SetMaxLiveVms(maxLive);
+  std::vector<JobResult> results = runner.Run(jobs);
+
+  std::size_t passed = 0;
+  for (std::size_t i = 0; i < jobs.size(); ++i) {
+    const JobResult &result = results[i];
+    std::cout << std::left << std::setw(8) << System::ToString(result.Status)
+              << jobs[i].Name << "  " << result.Cycles << " cycles, "
+              << std::fixed << std::setprecision(3) << result.Seconds * 1e3
+              << " ms";
+    if (!result.Error.empty()) {
+      std::cout << "  (" << result.Error << ")";
+    }
+    std::cout << "\n";
+
+    if (result.Status == JobStatus::Pass) {
+      ++passed;
+    } else if (verbose && !result.Output.empty()) {
+      std::cout << "---- output ----\n" << result.Output;
+      if (!result.Output.ends_with('\n')) {
+        std::cout << "\n";
+      }
+      std::cout << "----------------\n";
+    }
+  }
+
+  double wall = runner.GetWallSeconds();
+  double cycles = static_cast<double>(runner.GetTotalCycles());
+  std::cout << "\nJobs:     " << passed << "/" << jobs.size() << " passed on "
+            << runner.GetThreadCount() << " threads ("
+            << runner.GetStealCount() << " steals)\n"
+            << "Cycles:   " << runner.GetTotalCycles() << " in "
+            << runner.GetSliceCount() << " slices\n"
+            << std::fixed << std::setprecision(3) << "Wall:     " << wall
+            << " s\n";
+  if (wall > 0.0) {
+    std::cout << std::setprecision(1)
+              << "Rate:     " << static_cast<double>(jobs.size()) / wall
+              << " jobs/s, " << cycles / wall / 1e6
+              << " guest MHz aggregate\n";
+  }
+  Core::Instrument::Report(std::cout);
+
+  return passed == jobs.size() ? ExitSuccess : ExitJobsFailed;
+}
@@ -0,0 +1,199 @@
+/**
+ * Aurelia Page Image Tool.
+ *
+ * Creates and inspects compressed page images
+ * (Storage/Image/PageImage.hpp) for the image library: RAM images
+ * attached with AURELIA_RAM_IMAGE and NAND snapshots written by
+ * AURELIA_NAND_IMAGE.
+ *
+ * USAGE:
+ *   aimg pack [-p <page size>] <raw file> <image>
+ *   aimg unpack <image> <raw file>
+ *   aimg info <image>
+ *
+ * COMMANDS:
+ * ┌────────┬──────────────────────────────────────────────────────────┐
+ * │ Command│ Action                                                   │
+ * ├────────┼──────────────────────────────────────────────────────────┤
+ * │ pack   │ Compress a raw byte image into a Flat page image         │
+ * │        │ (default page size 4096)                                 │
+ * │ unpack │ Decode every page back to a raw file (either layout)     │
+ * │ info   │ Geometry, encoding histogram and compression ratio       │
+ * └────────┴──────────────────────────────────────────────────────────┘
+ *
+ * EXIT CODES:
+ *   0  Success
+ *   1  Corrupt or unsupported image
+ *   2  I/O error (file not found, cannot write)
+ *   3  Invalid arguments
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Host/MappedFile.hpp"
+#include "Storage/Image/PageImage.hpp"
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Aurelia;
+using Storage::Image::PageEncoding;
+using Storage::Image::PageImage;
+using Storage::Image::PageImageWriter;
+
+constexpr int ExitSuccess = 0;
+constexpr int ExitImageError = 1;
+constexpr int ExitIoError = 2;
+constexpr int ExitInvalidArgs = 3;
+
+constexpr std::size_t DefaultPageSize = 4096;
+
+void PrintUsage(const char *programName) {
+  std::cout << "Aurelia Page Image Tool\n"
+            << "Usage:\n"
+            << "  " << programName
+            << " pack [-p <page size>] <raw file> <image>\n"
+            << "  " << programName << " unpack <image> <raw file>\n"
+            << "  " << programName << " info <image>\n\n"
+            << "Exit Codes:\n"
+            << "  0  Success\n"
+            << "  1  Corrupt or unsupported image\n"
+            << "  2  I/O error\n"
+            << "  3  Invalid arguments\n";
+}
+
+bool WriteFile(const std::string &filename,
+               const std::vector<std::uint8_t> &data) {
+  std::ofstream file(filename, std::ios::out | std::ios::binary);
+  if (!file.is_open()) {
+    return false;
+  }
+  file.write(reinterpret_cast<const char *>(data.data()),
+             static_cast<std::streamsize>(data.size()));
+  return file.good();
+}
+
+int Pack(const std::string &input, const std::string &output,
+         std::size_t pageSize) {
+  Host::MappedFile raw;
+  if (!raw.Open(input)) {
+    std::cerr << "Error: Cannot read '" << input << "'\n";
+    return ExitIoError;
+  }
+
+  std::vector<std::uint8_t> image =
+      PageImageWriter::Pack(raw.Bytes(), pageSize);
+  if (!WriteFile(output, image)) {
+    std::cerr << "Error: Cannot write '" << output << "'\n";
+    return ExitIoError;
+  }
+
+  std::cout << "Packed " << raw.Bytes().size() << " bytes into "
+            << image.size() << " bytes (" << output << ")\n";
+  return ExitSuccess;
+}
+
+bool OpenImage(const std::string &filename, PageImage &image) {
+  std::string error;
+  if (!image.Open(filename, error)) {
+    std::cerr << "Error: " << error << "\n";
+    return false;
+  }
+  return true;
+}
+
+int Unpack(const std::string &input, const std::string &output) {
+  PageImage image;
+  if (!OpenImage(input, image)) {
+    return ExitImageError;
+  }
+
+  std::vector<std::uint8_t> raw(
+      static_cast<std::size_t>(image.GetLogicalSize()));
+  for (std::size_t i = 0; i < image.GetPageCount(); ++i) {
+    std::span<std::uint8_t> page(raw.data() + i * image.GetPageSize(),
+                                 image.GetPageBytes(i));
+    if (!image.ReadPage(i, page)) {
+      std::cerr << "Error: Page " << i << " is corrupt\n";
+      return ExitImageError;
+    }
+  }
+
+  if (!WriteFile(output, raw)) {
+    std::cerr << "Error: Cannot write '" << output << "'\n";
+    return ExitIoError;
+  }
+  return ExitSuccess;
+}
+
+int Info(const std::string &input) {
+  PageImage image;
+  if (!OpenImage(input, image)) {
+    return ExitImageError;
+  }
+
+  std::array<std::size_t, 3> counts{};
+  for (std::size_t i = 0; i < image.GetPageCount(); ++i) {
+    ++counts[static_cast<std::size_t>(image.GetEncoding(i))];
+  }
+
+  double ratio = image.GetLogicalSize() == 0
+                     ? 1.0
+                     : static_cast<double>(image.GetFileSize()) /
+                           static_cast<double>(image.GetLogicalSize());
+  std::cout << "Layout:     "
+            << (image.GetLayout() == Storage::Image::PageLayout::Flat
+                    ? "flat"
+                    : "nand-blocks")
+            << "\n"
+            << "Page size:  " << image.GetPageSize() << "\n"
+            << "Pages:      " << image.GetPageCount() << " (fill "
+            << counts[static_cast<std::size_t>(PageEncoding::Fill)]
+            << ", raw " << counts[static_cast<std::size_t>(PageEncoding::Raw)]
+            << ", lz " << counts[static_cast<std::size_t>(PageEncoding::Lz)]
+            << ")\n"
+            << "Size:       " << image.GetLogicalSize() << " -> "
+            << image.GetFileSize() << " bytes (" << std::fixed
+            << std::setprecision(1) << ratio * 100.0 << "%)\n";
+  return ExitSuccess;
+}
+
+int main(int argc, char *argv[]) {
+  std::vector<std::string> args(argv + 1, argv + argc);
+  if (args.empty() || args[0] == "-h" || args[0] == "--help") {
+    PrintUsage(argv[0]);
+    return args.empty() ? ExitInvalidArgs : ExitSuccess;
+  }
+
+  const std::string command = args[0];
+  args.erase(args.begin());
+
+  if (command == "pack") {
+    std::size_t pageSize = DefaultPageSize;
+    if (args.size() >= 2 && args[0] == "-p") {
+      char *end = nullptr;
+      unsigned long value = std::strtoul(args[1].c_str(), &end, 0);
+      if (*end != '\0' || value == 0 || value > (1ul << 24)) {
+        std::cerr << "Error: Invalid page size '" << args[1] << "'\n";
+        return ExitInvalidArgs;
+      }
+      pageSize = value;
+      args.erase(args.begin(), args.begin() + 2);
+    }
+    if (args.size() == 2) {
+      return Pack(args[0], args[1], pageSize);
+    }
+  } else if (command == "unpack" && args.size() == 2) {
+    return Unpack(args[0], args[1]);
+  } else if (command == "info" && args.size() == 1) {
+    return Info(args[0]);
+  }
+
+  PrintUsage(argv[0]);
+  return ExitInvalidArgs;
+}
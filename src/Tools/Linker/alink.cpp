@@ -0,0 +1,156 @@
+/**
+ * Aurelia Linker Command-Line Interface.
+ *
+ * Links relocatable objects written by `asm -c` (ObjectFile.hpp) into one
+ * program, in the same output formats as asm. Together they make rebuilds
+ * incremental: only the sources that changed are reassembled, then
+ * everything is relinked.
+ *
+ * USAGE:
+ *   alink [options] <input.o>...
+ *
+ * OPTIONS:
+ *   -o <file>     Specify output file (default: a.out)
+ *   -f <format>   Output format: flat (default) or aex
+ *   -h, --help    Display help information
+ *
+ * Objects are laid out in command-line order (Linker.hpp): text of the
+ * first object first, and so on for each section.
+ *
+ * EXIT CODES:
+ *   0  Success
+ *   1  Link error (bad object, duplicate or undefined symbol, range)
+ *   2  I/O error (file not found, cannot write)
+ *   3  Invalid arguments
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Host/MappedFile.hpp"
+#include "System/MemoryMap.hpp"
+#include "Tools/Assembler/Linker.hpp"
+#include "Tools/Assembler/ObjectFile.hpp"
+#include "Tools/Assembler/ProgramOutput.hpp"
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::Tools::Assembler;
+
+constexpr int ExitSuccess = 0;
+constexpr int ExitLinkError = 1;
+constexpr int ExitIoError = 2;
+constexpr int ExitInvalidArgs = 3;
+
+void PrintUsage(const char *programName) {
+  std::cout << "Aurelia Linker\n"
+            << "Usage: " << programName << " [options] <input.o>...\n\n"
+            << "Options:\n"
+            << "  -o <file>     Specify output binary file (default: a.out)\n"
+            << "  -f <format>   Output format: flat (default) or aex\n"
+            << "  -h, --help    Display this help information\n\n"
+            << "Exit Codes:\n"
+            << "  0  Success\n"
+            << "  1  Link error\n"
+            << "  2  I/O error\n"
+            << "  3  Invalid arguments\n\n"
+            << "Example:\n"
+            << "  " << programName << " -o program.bin main.o lib.o\n";
+}
+
+bool WriteFile(const std::string &filename,
+               const std::vector<std::uint8_t> &data) {
+  std::ofstream file(filename, std::ios::out | std::ios::binary);
+  if (!file.is_open()) {
+    return false;
+  }
+  file.write(reinterpret_cast<const char *>(data.data()),
+             static_cast<std::streamsize>(data.size()));
+  return file.good();
+}
+
+int main(int argc, char *argv[]) {
+  std::vector<std::string> inputFiles;
+  std::string outputFile = "a.out";
+  bool imageFormat = false;
+
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg == "-h" || arg == "--help") {
+      PrintUsage(argv[0]);
+      return ExitSuccess;
+    } else if (arg == "-o" && i + 1 < argc) {
+      outputFile = argv[++i];
+    } else if (arg == "-f") {
+      std::string format = i + 1 < argc ? argv[++i] : "";
+      if (format != "flat" && format != "aex") {
+        std::cerr << "Error: -f expects flat or aex\n";
+        PrintUsage(argv[0]);
+        return ExitInvalidArgs;
+      }
+      imageFormat = format == "aex";
+    } else if (arg.starts_with('-')) {
+      std::cerr << "Error: Unknown option: " << arg << "\n";
+      PrintUsage(argv[0]);
+      return ExitInvalidArgs;
+    } else {
+      inputFiles.push_back(arg);
+    }
+  }
+  if (inputFiles.empty()) {
+    std::cerr << "Error: No input file specified\n";
+    PrintUsage(argv[0]);
+    return ExitInvalidArgs;
+  }
+
+  std::vector<ObjectFile> objects(inputFiles.size());
+  Linker linker(System::ResetVector);
+  for (std::size_t i = 0; i < inputFiles.size(); ++i) {
+    Host::MappedFile file;
+    if (!file.Open(inputFiles[i])) {
+      std::cerr << "Error: Cannot read input file: " << inputFiles[i] << "\n";
+      return ExitIoError;
+    }
+    std::string error;
+    if (!objects[i].Parse(file.Bytes(), error)) {
+      std::cerr << "Linker Error: " << inputFiles[i] << ": " << error << "\n";
+      return ExitLinkError;
+    }
+    linker.AddObject(inputFiles[i], objects[i]);
+  }
+
+  if (!linker.Link()) {
+    std::cerr << "Linker Error: " << linker.GetErrorMessage() << "\n";
+    return ExitLinkError;
+  }
+
+  AssembledProgram program{linker.GetText(),
+                           linker.GetRoDataSegment(),
+                           linker.GetDataSegment(),
+                           linker.GetBssSize(),
+                           linker.GetLayout(),
+                           linker.GetSymbols(),
+                           linker.GetEntry()};
+  std::vector<std::uint8_t> output;
+  if (imageFormat) {
+    output = BuildImage(program).Serialize();
+  } else {
+    if (program.Entry != program.Layout.TextBase) {
+      std::cerr << "Warning: .entry ignored for flat output\n";
+    }
+    output = BuildFlatBinary(program);
+  }
+
+  if (!WriteFile(outputFile, output)) {
+    std::cerr << "Error: Cannot write output file: " << outputFile << "\n";
+    return ExitIoError;
+  }
+
+  std::cout << "Linked " << inputFiles.size() << " objects, "
+            << program.Symbols.size() << " symbols, into " << outputFile
+            << " (" << output.size() << " bytes)\n";
+  return ExitSuccess;
+}
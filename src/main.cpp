@@ -14,6 +14,9 @@
  * deterministic behavior for debugging pipeline hazards and bus contention, at
  * the cost of raw throughput.
  *
+ * Every device is registered with Core::System, which owns the clock and
+ * ticks each device at its clock-domain rate (see System/ClockDomains.hpp).
+ *
  * SYSTEM ARCHITECTURE:
  * ┌───────────────┐      ┌───────────────┐      ┌───────────────┐
  * │  Aurelia CPU  │◄────►│  System Bus   │◄────►│  RAM (256MB)  │
@@ -23,12 +26,18 @@
  * ┌───────────────┐      ┌───────────────┐      ┌───────────────┐
  * │  UART (TTY)   │      │      PIC      │      │     Timer     │
  * └───────────────┘      └───────────────┘      └───────────────┘
+ *         ▲                      │
+ *         │              ┌───────┴───────┐      ┌───────────────┐
+ *   Host Input Pump      │ NVMe Storage  │◄────►│  FTL + NAND   │
+ *                        └───────────────┘      └───────────────┘
  *
  * PERFORMANCE METRICS:
  * The harness captures real-time telemetry including:
  * - Effective Clock Rate (MHz)
- * - IPC (Instructions Per Cycle) via Bus Utilization
+ * - Retired instructions and CPI (cycles per instruction)
  * - Total Execution Time
+ * - Per-probe host time, when built with AURELIA_INSTRUMENT (SIGUSR1
+ *   prints it mid-run)
  *
  * USAGE:
  * $ ./aurelia_vm [binary_path]
@@ -39,13 +48,28 @@
  */
 
 #include "Bus/Bus.hpp"
+#include "Core/Instrument.hpp"
+#include "Core/System.hpp"
 #include "Cpu/Cpu.hpp"
+#include "Graphics/BlitterDevice.hpp"
+#include "Graphics/GpuDevice.hpp"
+#include "Host/AsyncIo.hpp"
+#include "Host/HostInputPump.hpp"
 #include "Memory/RamDevice.hpp"
+#include "Network/NetDevice.hpp"
+#include "Peripherals/DmaController.hpp"
 #include "Peripherals/KeyboardDevice.hpp"
 #include "Peripherals/MouseDevice.hpp"
 #include "Peripherals/PicDevice.hpp"
+#include "Peripherals/RtcDevice.hpp"
 #include "Peripherals/TimerDevice.hpp"
 #include "Peripherals/UartDevice.hpp"
+#include "Storage/Controller/StorageController.hpp"
+#include "Storage/FTL/Ftl.hpp"
+#include "Storage/Image/PageImage.hpp"
+#include "Storage/Nand/NandChip.hpp"
+#include "Storage/Virtio/VirtioBlockDevice.hpp"
+#include "System/ClockDomains.hpp"
 #include "System/Loader.hpp"
 #include "System/MemoryMap.hpp"
 #include "Tools/Assembler/Encoder.hpp"
@@ -54,8 +78,12 @@
 #include "Tools/Assembler/Resolver.hpp"
 
 #include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 using namespace Aurelia;
@@ -220,8 +248,21 @@ int main(int argc, char *argv[]) {
   std::cout << "Initializing Hardware...\n";
   Bus::Bus bus;
   Memory::RamDevice ram(System::RamSize, 0); // 256MB RAM
-  Memory::RamDevice ssd(4096, 0);            // 4KB SSD Buffer
-  ssd.SetBaseAddress(0xE0000000);            // SSD MMIO Base
+  Memory::RamDevice ssd(System::SsdBufferSize, 0);
+
+  // Compressed RAM image (AURELIA_RAM_IMAGE, made with `aimg pack`):
+  // pages decode as the guest first touches them
+  Storage::Image::PageImage ramImage;
+  bool ramImageAttached = false;
+  if (const char *path = std::getenv("AURELIA_RAM_IMAGE")) {
+    std::string error;
+    ramImageAttached = ramImage.Open(path, error) && ram.AttachImage(&ramImage);
+    if (!ramImageAttached) {
+      std::cerr << "Warning: RAM image not attached: "
+                << (error.empty() ? "does not fit in RAM" : error) << "\n";
+    }
+  }
+  ssd.SetBaseAddress(System::SsdBufferBase); // 4KB SSD Buffer Window
 
   Cpu::Cpu cpu;
   Peripherals::UartDevice uart;    // 0xE0001000
@@ -229,6 +270,79 @@ int main(int argc, char *argv[]) {
   Peripherals::TimerDevice timer;  // 0xE0003000
   Peripherals::KeyboardDevice kbc; // 0xE0004000
   Peripherals::MouseDevice mouse;  // 0xE0005000
+  Peripherals::DmaController dma;  // 0xE0006000
+  Graphics::GpuDevice gpu;         // 0xF0000000 (VRAM @ 0xF0100000)
+  Graphics::BlitterDevice blitter; // 0xF0001000
+  Network::NetDevice nic;          // 0xE0007000
+  Peripherals::RtcDevice rtc;      // 0xE0008000
+
+  // NVMe storage stack: NAND array → FTL → controller (0xE0010000)
+  constexpr std::size_t StorageBlocks = 16; // 16 × 64 pages × 4KB = 4MB
+  Storage::Nand::NandChip nand(StorageBlocks);
+
+  // NAND snapshot (AURELIA_NAND_IMAGE): restored lazily before the FTL
+  // mounts, rewritten at exit so the drive persists across runs
+  const char *nandImagePath = std::getenv("AURELIA_NAND_IMAGE");
+  Storage::Image::PageImage nandImage;
+  bool nandRestored = false;
+  if (nandImagePath) {
+    std::string error;
+    if (nandImage.Open(nandImagePath, error)) {
+      nandRestored = nand.AttachImage(&nandImage);
+      if (!nandRestored) {
+        std::cerr << "Warning: " << nandImagePath
+                  << " is not a snapshot of this drive; starting blank\n";
+      }
+    }
+  }
+  Storage::FTL::Ftl ftl(&nand, StorageBlocks);
+  Storage::Controller::StorageController storage(&ftl);
+  storage.SetBaseAddress(System::StorageControllerBase);
+
+  // Paravirtual disk (0xE0020000): host image named by AURELIA_DISK.
+  // Host I/O overlaps guest execution through io_uring (or worker threads
+  // with AURELIA_AIO=threads); the AsyncIo must outlive the device.
+  Host::AsyncIo diskIo;
+  Storage::Virtio::VirtioBlockDevice vblk;
+  bool diskAttached = false;
+  if (const char *image = std::getenv("AURELIA_DISK")) {
+    diskAttached = vblk.OpenImage(image);
+  }
+  if (diskAttached) {
+    const char *aioMode = std::getenv("AURELIA_AIO");
+    bool threads = aioMode && std::string(aioMode) == "threads";
+    diskIo.Start(threads ? Host::AsyncIoBackend::ThreadPool
+                         : Host::AsyncIoBackend::IoUring);
+    vblk.ConnectAsyncIo(&diskIo);
+    vblk.SetLatencyTicks(2000); // Roughly an NVMe read at 100 MHz
+  }
+
+  // Network link: AURELIA_NET=<local socket>:<peer socket>
+  Network::UnixDatagramBackend netLink;
+  if (const char *link = std::getenv("AURELIA_NET")) {
+    std::string spec(link);
+    std::size_t colon = spec.find(':');
+    if (colon != std::string::npos &&
+        netLink.Open(spec.substr(0, colon), spec.substr(colon + 1))) {
+      nic.ConnectBackend(&netLink);
+    }
+  }
+
+  // Guest time base: AURELIA_TIME=real (default), virtual, or a rate such
+  // as 0.25 for host time slowed to a quarter
+  if (const char *base = std::getenv("AURELIA_TIME")) {
+    std::string mode(base);
+    if (mode == "virtual") {
+      rtc.SetMode(Peripherals::RtcMode::Virtual);
+    } else if (mode != "real") {
+      double rate = std::strtod(base, nullptr);
+      if (rate > 0.0) {
+        rtc.SetScale(static_cast<std::uint64_t>(
+            rate * static_cast<double>(Peripherals::RtcDevice::ScaleOne)));
+        rtc.SetMode(Peripherals::RtcMode::Scaled);
+      }
+    }
+  }
 
   // -------------------------------------------------------------------------
   // 2. Component Wiring (Bus Topology)
@@ -240,34 +354,118 @@ int main(int argc, char *argv[]) {
   bus.ConnectDevice(&timer);
   bus.ConnectDevice(&kbc);
   bus.ConnectDevice(&mouse);
+  bus.ConnectDevice(&dma);
+  bus.ConnectDevice(&nic);
+  bus.ConnectDevice(&rtc);
+  bus.ConnectDevice(&storage);
+  bus.ConnectDevice(&vblk);
+  bus.ConnectDevice(&gpu);
+  bus.ConnectDevice(&blitter);
 
   // Interrupt Routing
   kbc.ConnectPic(&pic);
   mouse.ConnectPic(&pic);
+  gpu.ConnectPic(&pic);
+  blitter.ConnectPic(&pic);
+  blitter.ConnectGpu(&gpu);
+  dma.ConnectPic(&pic);
+  vblk.ConnectPic(&pic);
+  nic.ConnectPic(&pic);
+  rtc.ConnectPic(&pic);
 
   cpu.ConnectBus(&bus);
+  storage.ConnectBus(&bus); // DMA master
+  dma.ConnectBus(&bus);     // DMA master
+  vblk.ConnectBus(&bus);    // DMA master
+  nic.ConnectBus(&bus);     // DMA master
+
+  // Host input: stdin feeds the UART receiver from a background thread
+  Host::HostInputPump inputPump;
+  inputPump.ConnectUart(&uart);
+  inputPump.ConnectKeyboard(&kbc);
+  inputPump.ConnectMouse(&mouse);
+  inputPump.AddStdin(Host::InputTarget::Uart);
+  bool inputLive = inputPump.Start();
+
+  // Scan-out: changed frames go to numbered PPM files when requested
+  std::unique_ptr<Graphics::PpmSequenceSink> frameSink;
+  if (const char *prefix = std::getenv("AURELIA_FRAMES")) {
+    frameSink = std::make_unique<Graphics::PpmSequenceSink>(prefix);
+    gpu.SetFrameSink(frameSink.get());
+  }
+
+  // -------------------------------------------------------------------------
+  // 2b. Clock Distribution
+  // -------------------------------------------------------------------------
+  // CPU before Bus: the bus completes the request the CPU drove this cycle
+  Core::System machine;
+  machine.AddDevice(&cpu, System::CoreClockDivider);
+  machine.AddDevice(&bus, System::CoreClockDivider);
+  machine.AddDevice(&ram, System::CoreClockDivider);
+  machine.AddDevice(&ssd, System::CoreClockDivider);
+  machine.AddDevice(&uart, System::CoreClockDivider);
+  machine.AddDevice(&storage, System::CoreClockDivider);
+  machine.AddDevice(&vblk, System::CoreClockDivider);
+  machine.AddDevice(&gpu, System::CoreClockDivider);
+  machine.AddDevice(&blitter, System::CoreClockDivider);
+  machine.AddDevice(&dma, System::CoreClockDivider);
+  machine.AddDevice(&nic, System::CoreClockDivider);
+  machine.AddDevice(&timer, System::TimerClockDivider);
+  machine.AddDevice(&pic, System::ControlClockDivider);
+  machine.AddDevice(&kbc, System::ControlClockDivider);
+  machine.AddDevice(&mouse, System::ControlClockDivider);
+  machine.AddDevice(&rtc, System::ControlClockDivider);
+  rtc.ConnectClock(&machine.GetClock()); // Virtual time counts cycles
+  machine.AddDevice(&inputPump, System::ControlClockDivider);
 
   std::cout << "  [✓] Bus Interconnect Active\n"
             << "  [✓] RAM: 256MB (Mapped @ 0x00000000)\n"
             << "  [✓] SSD: 4KB Buffer (Mapped @ 0xE0000000)\n"
+            << "  [" << (ramImageAttached ? "✓" : " ")
+            << "] RAM Image: " << ram.GetPendingImagePages()
+            << " pages on demand\n"
+            << "  [✓] NVMe: 4MB NAND via FTL (Mapped @ 0xE0010000)"
+            << (nandRestored ? ", restored from snapshot" : "") << "\n"
+            << "  [" << (diskAttached ? "✓" : " ")
+            << "] Virtio Disk: " << vblk.GetCapacitySectors()
+            << " sectors (Mapped @ 0xE0020000)"
+            << (!diskAttached ? ""
+                : diskIo.GetBackend() == Host::AsyncIoBackend::IoUring
+                    ? " via io_uring"
+                    : " via worker threads")
+            << "\n"
             << "  [✓] CPU: Aurelia Core (Connected)\n"
-            << "  [✓] Peripherals: UART, PIC, Timer, KBC, Mouse\n"
+            << "  [✓] Peripherals: UART, PIC, Timer, KBC, Mouse, DMA, RTC\n"
+            << "  [✓] GPU: 640x480 RGBA (VRAM @ 0xF0100000) + Blitter\n"
+            << "  [" << (netLink.IsOpen() ? "✓" : " ")
+            << "] NIC: Unix datagram link (Mapped @ 0xE0007000)\n"
+            << "  [" << (inputLive ? "✓" : " ")
+            << "] Host Input: stdin → UART\n"
             << "\n";
 
   // -------------------------------------------------------------------------
   // 3. Program Loader
   // -------------------------------------------------------------------------
   std::vector<std::uint8_t> program;
+  Core::Address entryPoint = System::ResetVector;
   if (argc > 1) {
     if (std::string(argv[1]) == "--demo") {
       program = GenerateDemoProgram();
     } else {
       std::cout << "Loading binary: " << argv[1] << "...\n";
       System::Loader loader(bus);
-      if (!loader.LoadBinary(argv[1], System::ResetVector)) {
-        std::cerr << "Fatal: Failed to load binary.\n";
+      // AEX images carry their own layout; flat binaries go at reset
+      if (!loader.LoadExecutable(argv[1], System::ResetVector)) {
+        std::cerr << "Fatal: Failed to load binary: "
+                  << loader.GetErrorMessage() << "\n";
         return 1;
       }
+      entryPoint = loader.GetEntryPoint();
+      if (!loader.GetSymbols().empty()) {
+        std::cout << "  Image: " << loader.GetSymbols().size()
+                  << " symbols, entry 0x" << std::hex << entryPoint
+                  << std::dec << "\n";
+      }
     }
   } else {
     std::cout
@@ -289,21 +487,24 @@ int main(int argc, char *argv[]) {
   std::cout << "\nStarting Execution...\n";
   std::cout << "──────────────────────────────────────────────────\n";
 
-  cpu.Reset(System::ResetVector);
+  cpu.Reset(entryPoint);
+  Core::Instrument::InstallSignalReporter(std::cout);
+  Core::Instrument::Reset(); // Profile the run, not the setup
 
   auto start = std::chrono::high_resolution_clock::now();
-  std::uint64_t cycles = 0;
-  const std::uint64_t MaxCycles = 5000000;
+  const Core::TickCount MaxCycles = 5000000;
 
-  while (!cpu.IsHalted() && cycles < MaxCycles) {
-    cpu.OnTick();
-    bus.OnTick();
-    cycles++;
-  }
+  Core::TickCount cycles =
+      machine.RunUntil([&cpu] { return cpu.IsHalted(); }, MaxCycles);
+
+  inputPump.Stop();
 
   auto end = std::chrono::high_resolution_clock::now();
   std::chrono::duration<double> elapsed = end - start;
 
+  // Drain any unterminated guest output before the host report
+  uart.FlushTx();
+
   std::cout << "──────────────────────────────────────────────────\n";
 
   // -------------------------------------------------------------------------
@@ -318,13 +519,21 @@ int main(int argc, char *argv[]) {
             << mhz << " MHz\n"
             << "    Exec Time:       " << std::fixed << std::setprecision(4)
             << secs << "s\n"
-            << "    Total Cycles:    " << cycles << "\n";
+            << "    Total Cycles:    " << cycles << "\n"
+            << "    Instructions:    " << cpu.GetRetiredCount() << " (CPI "
+            << std::setprecision(2)
+            << (cpu.GetRetiredCount() != 0
+                    ? static_cast<double>(cycles) /
+                          static_cast<double>(cpu.GetRetiredCount())
+                    : 0.0)
+            << ")\n";
 
   std::cout << "\n  Bus Traffic:\n"
             << "    Total Transfers: "
             << (bus.GetReadCount() + bus.GetWriteCount()) << "\n"
             << "    Memory Reads:    " << bus.GetReadCount() << "\n"
             << "    Memory Writes:   " << bus.GetWriteCount() << "\n";
+  Core::Instrument::Report(std::cout);
 
   std::cout << "\n  Component Status:\n";
 
@@ -338,6 +547,21 @@ int main(int argc, char *argv[]) {
     std::cout << "    SSD Persistence: [Idle] (No data detected)\n";
   }
 
+  if (nandImagePath) {
+    // Written aside and renamed: the old snapshot may still be mapped
+    std::vector<std::uint8_t> snapshot = nand.ExportImage();
+    std::string temp = std::string(nandImagePath) + ".tmp";
+    std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+    out.write(reinterpret_cast<const char *>(snapshot.data()),
+              static_cast<std::streamsize>(snapshot.size()));
+    out.close();
+    bool saved = out && std::rename(temp.c_str(), nandImagePath) == 0;
+    std::cout << "    NAND Snapshot:   "
+              << (saved ? "[Saved] " : "[Write failed] ") << snapshot.size()
+              << " bytes, " << nand.GetPendingImagePages()
+              << " pages never decoded\n";
+  }
+
   std::cout << "    CPU State:       "
             << (cpu.IsHalted() ? "HALTED" : "RUNNING") << "\n";
   std::cout << "    Final PC:        0x" << std::hex << cpu.GetPC() << std::dec
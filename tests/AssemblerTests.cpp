@@ -2,14 +2,20 @@
  * Assembler Lexer Tests.
  *
  * Verifies that the Lexer correctly tokenizes assembly source code.
- * Ensures strict adherence to token types and line/column tracking.
+ * Ensures strict adherence to token types and line/column tracking, that
+ * token text borrows the source, and that keywords and label names are
+ * resolved to IDs at lex time through the compile-time keyword table.
  *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
  */
 
+#include "Cpu/InstructionDefs.hpp"
+#include "Tools/Assembler/Keywords.hpp"
 #include "Tools/Assembler/Lexer.hpp"
 #include <catch2/catch_test_macros.hpp>
+#include <cctype>
+#include <string>
 
 using namespace Aurelia::Tools::Assembler;
 
@@ -138,3 +144,116 @@ TEST_CASE("Lexer - High Registers") {
   CHECK(tokens[3].Type == TokenType::Register);
   CHECK(tokens[3].Text == "R31");
 }
+
+TEST_CASE("Lexer - Tokens View The Source") {
+  std::string source = "loop: LDR R0, [R1, #8]\n.string \"Hi\"\n";
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+
+  const char *begin = source.data();
+  const char *end = source.data() + source.size();
+  for (const Token &token : tokens) {
+    switch (token.Type) {
+    case TokenType::Comma:
+    case TokenType::LeftBracket:
+    case TokenType::RightBracket:
+    case TokenType::Colon:
+    case TokenType::NewLine:
+    case TokenType::EndOfFile:
+      continue; // Fixed literal text
+    default:
+      break;
+    }
+    INFO(std::string(token.Text));
+    CHECK(token.Text.data() >= begin);
+    CHECK(token.Text.data() + token.Text.size() <= end);
+  }
+  CHECK(tokens[0].Text.data() == begin); // "loop"
+  CHECK(tokens[7].Text == "#8");
+}
+
+TEST_CASE("Lexer - Keywords Resolve To IDs") {
+  Lexer lexer("halt\nMov r7, SP\nBNE LR");
+  auto tokens = lexer.Tokenize();
+
+  REQUIRE(tokens[0].Type == TokenType::Mnemonic);
+  CHECK(tokens[0].Id == static_cast<std::uint32_t>(Aurelia::Cpu::Opcode::Halt));
+  CHECK(tokens[2].Id == static_cast<std::uint32_t>(Aurelia::Cpu::Opcode::MOV));
+  CHECK(tokens[3].Type == TokenType::Register);
+  CHECK(tokens[3].Id == 7);
+  CHECK(tokens[5].Id == 30); // SP
+  CHECK(tokens[7].Id == static_cast<std::uint32_t>(Aurelia::Cpu::Opcode::BNE));
+  CHECK(tokens[8].Id == 31); // LR
+
+  // Longer than any keyword, or not quite one: label references
+  Lexer names("HALTED R32 ADDS");
+  auto refs = names.Tokenize();
+  for (std::size_t i = 0; i < 3; ++i) {
+    CHECK(refs[i].Type == TokenType::LabelRef);
+  }
+}
+
+TEST_CASE("Lexer - Label Names Are Interned") {
+  Lexer lexer("loop:\nB done\nB loop\ndone:\nB Loop\n");
+  auto tokens = lexer.Tokenize();
+  const StringInterner &symbols = lexer.GetSymbols();
+
+  // loop: \n B done \n B loop \n done: \n B Loop
+  REQUIRE(tokens[0].Type == TokenType::Label);
+  REQUIRE(tokens[6].Type == TokenType::LabelRef);
+  CHECK(tokens[0].Id == tokens[6].Id); // Definition and use share an ID
+  CHECK(tokens[3].Id == tokens[8].Id);
+  CHECK(tokens[0].Id != tokens[3].Id);
+  CHECK(tokens[11].Id != tokens[0].Id); // Names are case-sensitive
+
+  CHECK(symbols.GetCount() == 3);
+  CHECK(symbols.GetName(tokens[3].Id) == "done");
+  CHECK(symbols.Find("loop") == tokens[0].Id);
+  CHECK_FALSE(symbols.Find("exit").has_value());
+}
+
+// The table is usable at compile time
+static_assert(FindKeyword("HALT")->Id ==
+              static_cast<std::uint32_t>(Aurelia::Cpu::Opcode::Halt));
+static_assert(!FindKeyword("loop").has_value());
+
+TEST_CASE("Keywords - Every Entry Is Found In Any Case") {
+  for (const Keywords::Entry &entry : Keywords::Table) {
+    INFO(std::string(entry.Name));
+    std::string upper(entry.Name);
+    for (char &c : upper) {
+      c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+    for (std::string_view text : {entry.Name, std::string_view(upper)}) {
+      auto keyword = FindKeyword(text);
+      REQUIRE(keyword.has_value());
+      CHECK(keyword->Type == entry.Value.Type);
+      CHECK(keyword->Id == entry.Value.Id);
+    }
+  }
+}
+
+TEST_CASE("Keywords - Near Misses Are Names") {
+  for (std::string_view text :
+       {"", "ad", "addd", "r32", "r1_", "s", "hal", "halts", ".str",
+        ".strings", "text", "spx", "_add", "movr", "R01"}) {
+    INFO(std::string(text));
+    CHECK_FALSE(FindKeyword(text).has_value());
+  }
+}
+
+TEST_CASE("Lexer - Directives Resolve To IDs") {
+  Lexer lexer(".TEXT\n.RoData\n.global main\n.bogus\n");
+  auto tokens = lexer.Tokenize();
+
+  auto id = [](Directive directive) {
+    return static_cast<std::uint32_t>(directive);
+  };
+  REQUIRE(tokens[0].Type == TokenType::Directive);
+  CHECK(tokens[0].Id == id(Directive::Text));
+  CHECK(tokens[2].Id == id(Directive::RoData));
+  CHECK(tokens[4].Id == id(Directive::Global));
+  CHECK(tokens[7].Type == TokenType::Directive);
+  CHECK(tokens[7].Id == id(Directive::Unknown));
+  CHECK(tokens[7].Text == ".bogus");
+}
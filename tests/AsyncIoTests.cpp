@@ -0,0 +1,126 @@
+/**
+ * Async Host I/O Unit Tests.
+ *
+ * Runs the same read/write/fsync sequence through both backends. The
+ * io_uring case falls back to the worker pool where the kernel refuses
+ * io_uring, so it never fails for environmental reasons.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Host/AsyncIo.hpp"
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <cerrno>
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::Host;
+
+namespace {
+
+std::vector<AsyncIoCompletion> Drain(AsyncIo &aio) {
+  std::vector<AsyncIoCompletion> all;
+  std::array<AsyncIoCompletion, 4> batch{};
+  while (aio.GetInFlight() != 0) {
+    aio.Wait();
+    std::size_t n = aio.Reap(batch);
+    all.insert(all.end(), batch.begin(),
+               batch.begin() + static_cast<long>(n));
+  }
+  return all;
+}
+
+void RoundTrip(AsyncIoBackend backend) {
+  std::string path =
+      "/tmp/aurelia-aio-test-" + std::to_string(::getpid()) + ".img";
+  int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+  REQUIRE(fd >= 0);
+
+  AsyncIo aio(8);
+  REQUIRE(aio.Start(backend));
+  REQUIRE_FALSE(aio.Start(backend)); // Already started
+
+  // Eight 4 KB writes in one batch, each block filled with its index
+  std::vector<std::vector<Core::Byte>> blocks;
+  for (std::uint64_t i = 0; i < 8; ++i) {
+    blocks.emplace_back(4096, static_cast<Core::Byte>(i + 1));
+    AsyncIoRequest req;
+    req.Op = AsyncIoOp::Write;
+    req.Fd = fd;
+    req.Offset = i * 4096;
+    req.Buffer = blocks.back().data();
+    req.Length = 4096;
+    req.Tag = i;
+    REQUIRE(aio.Submit(req));
+  }
+  REQUIRE_FALSE(aio.HasCapacity());
+  REQUIRE_FALSE(aio.Submit(AsyncIoRequest{}));
+  aio.Kick();
+
+  auto writes = Drain(aio);
+  REQUIRE(writes.size() == 8);
+  std::uint64_t tags = 0;
+  for (const auto &c : writes) {
+    CHECK(c.Result == 4096);
+    tags |= std::uint64_t{1} << c.Tag;
+  }
+  CHECK(tags == 0xFF);
+
+  // Read block 5 back, fsync, and a short read past end of file
+  std::vector<Core::Byte> readBack(4096);
+  std::vector<Core::Byte> tail(4096);
+  REQUIRE(aio.Submit({AsyncIoOp::Read, fd, 5 * 4096, readBack.data(), 4096,
+                      100}));
+  REQUIRE(aio.Submit({AsyncIoOp::Fsync, fd, 0, nullptr, 0, 101}));
+  REQUIRE(aio.Submit({AsyncIoOp::Read, fd, 8 * 4096 - 100, tail.data(), 4096,
+                      102}));
+  aio.Kick();
+
+  for (const auto &c : Drain(aio)) {
+    if (c.Tag == 100) {
+      CHECK(c.Result == 4096);
+    } else if (c.Tag == 101) {
+      CHECK(c.Result == 0);
+    } else {
+      CHECK(c.Tag == 102);
+      CHECK(c.Result == 100);
+    }
+  }
+  CHECK(readBack.front() == 6);
+  CHECK(readBack.back() == 6);
+  CHECK(tail[99] == 8);
+
+  // Errors come back as -errno
+  REQUIRE(aio.Submit({AsyncIoOp::Read, -1, 0, readBack.data(), 16, 7}));
+  auto failed = Drain(aio);
+  REQUIRE(failed.size() == 1);
+  CHECK(failed[0].Result == -EBADF);
+
+  ::close(fd);
+  ::unlink(path.c_str());
+}
+
+} // namespace
+
+TEST_CASE("AsyncIo - Worker Pool Round Trip") {
+  RoundTrip(AsyncIoBackend::ThreadPool);
+}
+
+TEST_CASE("AsyncIo - io_uring Round Trip") {
+  RoundTrip(AsyncIoBackend::IoUring);
+}
+
+TEST_CASE("AsyncIo - Idle Queue") {
+  AsyncIo aio;
+  std::array<AsyncIoCompletion, 1> out{};
+  REQUIRE_FALSE(aio.Submit(AsyncIoRequest{})); // Not started
+  REQUIRE(aio.Start(AsyncIoBackend::ThreadPool));
+  CHECK(aio.GetBackend() == AsyncIoBackend::ThreadPool);
+  CHECK(aio.Reap(out) == 0);
+  aio.Wait(); // Nothing in flight: returns immediately
+}
@@ -0,0 +1,275 @@
+/**
+ * Batch Runner Tests.
+ *
+ * Verifies manifest parsing, headless VMs running assembled programs
+ * against the console (output capture, flow-controlled input, cycle
+ * budgets, time slicing, execution counters) and a whole batch
+ * returning results in manifest order however it is sliced.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "System/BatchRunner.hpp"
+#include "System/VirtualMachine.hpp"
+#include "Tools/Assembler/Encoder.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::System;
+
+namespace {
+
+std::vector<std::uint8_t> Assemble(const std::string &source) {
+  using namespace Aurelia::Tools::Assembler;
+
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+  Parser parser(tokens);
+  REQUIRE(parser.Parse());
+  auto instructions = parser.GetInstructions();
+  Resolver resolver(instructions, parser.GetLabels());
+  REQUIRE(resolver.Resolve());
+  Encoder encoder(instructions);
+  REQUIRE(encoder.Encode());
+  return encoder.GetBinary();
+}
+
+// R1 = UART base (0xE0001000)
+const std::string UartPrologue = "MOV R1, #224\n"
+                                 "MOV R3, #24\n"
+                                 "LSL R1, R1, R3\n"
+                                 "MOV R2, #16\n"
+                                 "MOV R3, #8\n"
+                                 "LSL R2, R2, R3\n"
+                                 "ADD R1, R1, R2\n";
+
+// Prints "OK\n"
+const std::string HelloSource = UartPrologue + "MOV R0, #79\n"
+                                               "STR R0, [R1, #0]\n"
+                                               "MOV R0, #75\n"
+                                               "STR R0, [R1, #0]\n"
+                                               "MOV R0, #10\n"
+                                               "STR R0, [R1, #0]\n"
+                                               "HALT\n";
+
+// Echoes console input until it reads a '.'. ALU instructions only take
+// register operands, so the constants live in R4 and R5.
+const std::string EchoSource = UartPrologue + "MOV R4, #0\n"
+                                              "MOV R5, #46\n"
+                                              "loop:\n"
+                                              "LDR R2, [R1, #20]\n"
+                                              "CMP R2, R4\n"
+                                              "BEQ loop\n"
+                                              "LDR R0, [R1, #0]\n"
+                                              "CMP R0, R5\n"
+                                              "BEQ done\n"
+                                              "STR R0, [R1, #0]\n"
+                                              "B loop\n"
+                                              "done:\n"
+                                              "HALT\n";
+
+const std::string SpinSource = "spin: B spin\n";
+
+void WriteFile(const std::filesystem::path &path, const std::string &text) {
+  std::ofstream(path, std::ios::binary)
+      .write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+void WriteFile(const std::filesystem::path &path,
+               const std::vector<std::uint8_t> &bytes) {
+  std::ofstream(path, std::ios::binary)
+      .write(reinterpret_cast<const char *>(bytes.data()),
+             static_cast<std::streamsize>(bytes.size()));
+}
+
+} // namespace
+
+TEST_CASE("Batch - Parse Manifest", "[batch]") {
+  std::vector<BatchJob> jobs;
+  std::string error;
+
+  std::string text = "# Regression suite\n"
+                     "\n"
+                     "hello  hello.bin expect=hello.out\n"
+                     "echo /abs/echo.bin cycles=5000 input=in.txt # note\n";
+  REQUIRE(ParseManifest(text, "suite", jobs, error));
+  REQUIRE(jobs.size() == 2);
+
+  REQUIRE(jobs[0].Name == "hello");
+  REQUIRE(jobs[0].Image == "suite/hello.bin");
+  REQUIRE(jobs[0].ExpectPath == "suite/hello.out");
+  REQUIRE(jobs[0].InputPath.empty());
+  REQUIRE(jobs[0].CycleBudget == BatchJob::DefaultCycleBudget);
+
+  REQUIRE(jobs[1].Image == "/abs/echo.bin");
+  REQUIRE(jobs[1].CycleBudget == 5000);
+  REQUIRE(jobs[1].InputPath == "suite/in.txt");
+  REQUIRE(jobs[1].ExpectPath.empty());
+
+  SECTION("Errors name the line") {
+    jobs.clear();
+    REQUIRE_FALSE(ParseManifest("ok a.bin\nbad\n", "", jobs, error));
+    REQUIRE(error.starts_with("Line 2"));
+    REQUIRE_FALSE(ParseManifest("x a.bin cycles=12q\n", "", jobs, error));
+    REQUIRE_FALSE(ParseManifest("x a.bin cycles=0\n", "", jobs, error));
+    REQUIRE_FALSE(ParseManifest("x a.bin colour=red\n", "", jobs, error));
+  }
+}
+
+TEST_CASE("Batch - VM Captures Console Output", "[batch]") {
+  VirtualMachine vm;
+  REQUIRE(vm.LoadProgram(Assemble(HelloSource)));
+  REQUIRE(vm.Run(100000) == VmExit::Halted);
+  REQUIRE(vm.GetOutput() == "OK\n");
+  REQUIRE(vm.GetCycles() > 0);
+  REQUIRE(vm.GetCycles() < 100000);
+}
+
+TEST_CASE("Batch - VM Counts Retired Instructions", "[batch]") {
+  VirtualMachine vm;
+  REQUIRE(vm.LoadProgram(Assemble(HelloSource)));
+  REQUIRE(vm.Run(100000) == VmExit::Halted);
+
+  // 7 prologue + 6 stores and moves + HALT
+  REQUIRE(vm.GetCpu().GetRetiredCount() == 14);
+  // Every instruction fetch and store holds the bus for part of the run
+  REQUIRE(vm.GetBus().GetBusyCycles() >= 17);
+  REQUIRE(vm.GetBus().GetBusyCycles() < vm.GetCycles());
+
+  vm.GetCpu().Reset(ResetVector);
+  REQUIRE(vm.GetCpu().GetRetiredCount() == 0);
+}
+
+TEST_CASE("Batch - VM Storage Is Opt-In", "[batch]") {
+  VirtualMachine plain;
+  REQUIRE_FALSE(plain.GetBus().IsMapped(StorageControllerBase));
+
+  VmConfig config;
+  config.NandBlocks = 4;
+  VirtualMachine withStorage(config);
+  REQUIRE(withStorage.GetBus().IsMapped(StorageControllerBase));
+}
+
+TEST_CASE("Batch - VM Feeds Input With Flow Control", "[batch]") {
+  // Far more than the 16-byte FIFO: nothing may be dropped
+  std::string input;
+  for (int i = 0; i < 200; ++i) {
+    input += static_cast<char>('a' + i % 26);
+  }
+
+  VirtualMachine vm;
+  REQUIRE(vm.LoadProgram(Assemble(EchoSource)));
+  vm.QueueInput(input + ".");
+  REQUIRE(vm.Run(50'000'000) == VmExit::Halted);
+  REQUIRE(vm.GetOutput() == input);
+}
+
+TEST_CASE("Batch - VM Stops At Cycle Budget", "[batch]") {
+  VirtualMachine vm;
+  REQUIRE(vm.LoadProgram(Assemble(SpinSource)));
+  REQUIRE(vm.Run(10000) == VmExit::BudgetExhausted);
+  REQUIRE(vm.GetCycles() == 10000);
+
+  // Budgets are per call: the machine continues where it stopped
+  REQUIRE(vm.Run(5000) == VmExit::BudgetExhausted);
+  REQUIRE(vm.GetCycles() == 15000);
+}
+
+TEST_CASE("Batch - VM Resumes Across Slices", "[batch]") {
+  std::string input = "sliced input survives every yield";
+  auto program = Assemble(EchoSource);
+
+  VirtualMachine whole;
+  REQUIRE(whole.LoadProgram(program));
+  whole.QueueInput(input + ".");
+  REQUIRE(whole.Run(50'000'000) == VmExit::Halted);
+
+  VirtualMachine sliced;
+  REQUIRE(sliced.LoadProgram(program));
+  sliced.QueueInput(input + ".");
+  int slices = 1;
+  while (sliced.RunSlice(97) == VmExit::Yielded) {
+    ++slices;
+  }
+  REQUIRE(slices > 10);
+  REQUIRE(sliced.GetCpu().IsHalted());
+  REQUIRE(sliced.GetOutput() == input);
+  REQUIRE(sliced.GetCycles() == whole.GetCycles());
+
+  SECTION("Cycle limit ends a sliced run at the same cycle") {
+    VirtualMachine spin;
+    REQUIRE(spin.LoadProgram(Assemble(SpinSource)));
+    spin.SetCycleLimit(10'000);
+    VmExit exit = VmExit::Yielded;
+    while (exit == VmExit::Yielded) {
+      exit = spin.RunSlice(3'000);
+    }
+    REQUIRE(exit == VmExit::BudgetExhausted);
+    REQUIRE(spin.GetCycles() == 10'000);
+  }
+}
+
+TEST_CASE("Batch - Run Manifest", "[batch]") {
+  auto dir = std::filesystem::temp_directory_path() / "aurelia_batch_test";
+  std::filesystem::create_directories(dir);
+  WriteFile(dir / "hello.bin", Assemble(HelloSource));
+  WriteFile(dir / "echo.bin", Assemble(EchoSource));
+  WriteFile(dir / "spin.bin", Assemble(SpinSource));
+  WriteFile(dir / "hello.out", std::string("OK\n"));
+  WriteFile(dir / "wrong.out", std::string("NO\n"));
+  WriteFile(dir / "echo.in", std::string("batch.ignored"));
+  WriteFile(dir / "echo.out", std::string("batch"));
+
+  std::string text = "hello hello.bin expect=hello.out\n"
+                     "wrong hello.bin expect=wrong.out\n"
+                     "echo echo.bin input=echo.in expect=echo.out\n"
+                     "spin spin.bin cycles=20000\n"
+                     "missing nothing.bin\n";
+  std::vector<BatchJob> jobs;
+  std::string error;
+  REQUIRE(ParseManifest(text, dir.string(), jobs, error));
+
+  // Enough copies that the pool has to interleave them
+  std::vector<BatchJob> batch;
+  for (int copy = 0; copy < 4; ++copy) {
+    batch.insert(batch.end(), jobs.begin(), jobs.end());
+  }
+
+  // Unsliced, then many short slices with few machines alive at once:
+  // the verdicts and cycle counts must not depend on the schedule
+  for (Core::TickCount quantum : {Core::TickCount{0}, Core::TickCount{500}}) {
+    INFO("quantum " << quantum);
+    BatchRunner runner(3);
+    runner.SetQuantum(quantum);
+    runner.SetMaxLiveVms(2);
+    std::vector<JobResult> results = runner.Run(batch);
+    REQUIRE(results.size() == batch.size());
+    REQUIRE(runner.GetThreadCount() == 3);
+
+    Core::TickCount total = 0;
+    for (std::size_t i = 0; i < results.size(); i += jobs.size()) {
+      REQUIRE(results[i].Status == JobStatus::Pass);
+      REQUIRE(results[i + 1].Status == JobStatus::Fail);
+      REQUIRE(results[i + 1].Error == "Output differs at byte 0");
+      REQUIRE(results[i + 2].Status == JobStatus::Pass);
+      REQUIRE(results[i + 3].Status == JobStatus::Timeout);
+      REQUIRE(results[i + 3].Cycles == 20000);
+      REQUIRE(results[i + 3].Slices == (quantum == 0 ? 1 : 40));
+      REQUIRE(results[i + 4].Status == JobStatus::Error);
+      for (std::size_t j = 0; j < jobs.size(); ++j) {
+        total += results[i + j].Cycles;
+      }
+    }
+    REQUIRE(runner.GetTotalCycles() == total);
+  }
+
+  std::filesystem::remove_all(dir);
+}
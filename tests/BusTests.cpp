@@ -9,6 +9,8 @@
 
 #include "Bus/Bus.hpp"
 #include "Core/BitManip.hpp"
+#include "Memory/RamDevice.hpp"
+#include <array>
 #include <catch2/catch_test_macros.hpp>
 
 using namespace Aurelia;
@@ -97,3 +99,30 @@ TEST_CASE_METHOD(BusTest, "Bus - BusFault") {
   auto state = bus->GetState();
   CHECK(CheckBit(state.Control, 5));
 }
+
+TEST_CASE_METHOD(BusTest, "Bus - Block Transfers") {
+  Memory::RamDevice ram(4096, 3); // Latency is bypassed by the bulk path
+  mem1->BaseAddr = 0x1000;
+  bus->ConnectDevice(&ram);
+  bus->ConnectDevice(mem1.get());
+
+  std::array<Byte, 20> out{};
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    out[i] = static_cast<Byte>(i + 1);
+  }
+  REQUIRE(bus->WriteBlock(0x100, out));
+
+  std::array<Byte, 20> in{};
+  REQUIRE(bus->ReadBlock(0x100, in));
+  CHECK(in == out);
+
+  // A block straddling RAM and the next device is a bus fault
+  CHECK_FALSE(bus->ReadBlock(0xFF8, in));
+  CHECK(bus->IsMapped(0x1000));
+  CHECK_FALSE(bus->IsMapped(0x9000));
+
+  // Devices without a bulk override see word writes; the tail of the
+  // block arrives zero-extended
+  REQUIRE(bus->WriteBlock(0x1000, out));
+  CHECK(mem1->LastWritten == 0x14131211);
+}
@@ -1,15 +1,21 @@
 /**
  * Core Types Test.
  *
- * Verifies Bit Manipulation logic.
+ * Verifies Bit Manipulation logic and the core device-modelling
+ * containers (EventQueue, RingBuffer, SpscQueue).
  *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
  */
 
 #include "Core/BitManip.hpp"
+#include "Core/EventQueue.hpp"
+#include "Core/RingBuffer.hpp"
+#include "Core/SpscQueue.hpp"
 #include "Core/Types.hpp"
 #include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <thread>
 
 using namespace Aurelia::Core;
 
@@ -37,3 +43,112 @@ TEST_CASE("BitManip - ExtractBits") {
   // Extract bits 0-3 (1010) -> 10 (0xA)
   CHECK(ExtractBits(val, 0, 4) == 0xA);
 }
+
+TEST_CASE("EventQueue - Fires In Deadline Order") {
+  EventQueue queue;
+  queue.Schedule(30, 3);
+  queue.Schedule(10, 1);
+  queue.Schedule(20, 2);
+  queue.Schedule(10, 4); // Same deadline as Id 1, scheduled later
+
+  REQUIRE(queue.NextDeadline() == 10);
+
+  EventQueue::Event ev;
+  REQUIRE_FALSE(queue.PopDue(9, ev));
+
+  REQUIRE(queue.PopDue(10, ev));
+  CHECK(ev.Id == 1);
+  REQUIRE(queue.PopDue(10, ev));
+  CHECK(ev.Id == 4);
+  REQUIRE_FALSE(queue.PopDue(10, ev));
+
+  REQUIRE(queue.PopDue(100, ev));
+  CHECK(ev.Id == 2);
+  REQUIRE(queue.PopDue(100, ev));
+  CHECK(ev.Id == 3);
+  CHECK(queue.IsEmpty());
+  CHECK(queue.NextDeadline() == EventQueue::NoDeadline);
+}
+
+TEST_CASE("EventQueue - Cancel Removes All Matching Events") {
+  EventQueue queue;
+  queue.Schedule(5, 7, 0xAA);
+  queue.Schedule(6, 8, 0xBB);
+  queue.Schedule(7, 7, 0xCC);
+
+  queue.Cancel(7);
+  REQUIRE(queue.GetPendingCount() == 1);
+
+  EventQueue::Event ev;
+  REQUIRE(queue.PopDue(100, ev));
+  CHECK(ev.Id == 8);
+  CHECK(ev.Payload == 0xBB);
+}
+
+TEST_CASE("RingBuffer - Bounded FIFO") {
+  RingBuffer<Byte, 4> ring;
+  const Byte first[] = {1, 2, 3, 4};
+  for (Byte i : first) {
+    REQUIRE(ring.Push(i));
+  }
+  CHECK(ring.IsFull());
+  CHECK_FALSE(ring.Push(5)); // Dropped
+
+  Byte out = 0;
+  REQUIRE(ring.Pop(out));
+  CHECK(out == 1);
+
+  // Wrap around the end of storage
+  REQUIRE(ring.Push(6));
+  const Byte remaining[] = {2, 3, 4, 6};
+  for (Byte expected : remaining) {
+    REQUIRE(ring.Pop(out));
+    CHECK(out == expected);
+  }
+  CHECK(ring.IsEmpty());
+  CHECK_FALSE(ring.Pop(out));
+}
+
+TEST_CASE("SpscQueue - Bounded Push And Pop") {
+  SpscQueue<int, 2> queue;
+  REQUIRE(queue.TryPush(1));
+  REQUIRE(queue.TryPush(2));
+  CHECK_FALSE(queue.TryPush(3)); // Full
+
+  int out = 0;
+  REQUIRE(queue.TryPop(out));
+  CHECK(out == 1);
+  REQUIRE(queue.TryPush(3));
+  REQUIRE(queue.TryPop(out));
+  CHECK(out == 2);
+  REQUIRE(queue.TryPop(out));
+  CHECK(out == 3);
+  CHECK_FALSE(queue.TryPop(out));
+}
+
+TEST_CASE("SpscQueue - Cross-Thread Transfer Preserves Order") {
+  constexpr std::uint32_t Count = 100000;
+  SpscQueue<std::uint32_t, 64> queue;
+
+  std::thread producer([&queue] {
+    for (std::uint32_t i = 0; i < Count;) {
+      if (queue.TryPush(i)) {
+        ++i;
+      }
+    }
+  });
+
+  std::uint32_t expected = 0;
+  bool inOrder = true;
+  while (expected < Count) {
+    std::uint32_t value = 0;
+    if (queue.TryPop(value)) {
+      inOrder = inOrder && (value == expected);
+      ++expected;
+    }
+  }
+  producer.join();
+
+  CHECK(inOrder);
+  CHECK(queue.SizeApprox() == 0);
+}
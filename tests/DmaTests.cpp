@@ -0,0 +1,198 @@
+/**
+ * DMA Controller Unit Tests.
+ *
+ * Verifies descriptor chains, bulk copy/fill, port transfers with WAIT
+ * pacing, error reporting and per-channel interrupts.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bus/Bus.hpp"
+#include "Memory/RamDevice.hpp"
+#include "Peripherals/DmaController.hpp"
+#include "System/MemoryMap.hpp"
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Aurelia;
+using namespace Aurelia::Peripherals;
+
+namespace {
+constexpr Core::Address Dma = System::DmaBase;
+constexpr Core::Address PortAddr = 0x80000000;
+
+constexpr Core::Address ChReg(std::size_t ch, Core::Address reg) {
+  return Dma + DmaController::ChannelBase + ch * DmaController::ChannelStride +
+         reg;
+}
+
+/**
+ * @brief Data port that produces an incrementing byte, answering WAIT
+ * on every other access to model a slow peripheral.
+ */
+class SlowPort final : public Bus::IBusDevice {
+public:
+  bool IsAddressInRange(Core::Address addr) const override {
+    return addr == PortAddr;
+  }
+  bool OnRead(Core::Address, Core::Data &outData) override {
+    if ((m_Polls++ & 1) == 0) {
+      return false;
+    }
+    outData = m_Next++;
+    return true;
+  }
+  bool OnWrite(Core::Address, Core::Data inData) override {
+    Written.push_back(static_cast<std::uint8_t>(inData));
+    return true;
+  }
+  void OnTick() override {}
+
+  std::vector<std::uint8_t> Written;
+
+private:
+  std::uint64_t m_Polls = 0;
+  std::uint8_t m_Next = 0x40;
+};
+
+struct DmaFixture {
+  Bus::Bus bus;
+  Memory::RamDevice ram{64 * 1024, 0};
+  DmaController dma;
+  PicDevice pic;
+  SlowPort port;
+
+  DmaFixture() {
+    bus.ConnectDevice(&ram);
+    bus.ConnectDevice(&dma);
+    bus.ConnectDevice(&port);
+    dma.ConnectBus(&bus);
+    dma.ConnectPic(&pic);
+    pic.OnWrite(System::PicBase + 0x4, 0xFFFF);
+  }
+
+  void WriteDescriptor(Core::Address at, DmaOpcode op, std::uint8_t flags,
+                       std::uint32_t length, std::uint64_t src,
+                       std::uint64_t dst, std::uint64_t next) {
+    std::array<Core::Byte, DmaController::DescriptorSize> raw{};
+    raw[0] = static_cast<Core::Byte>(op);
+    raw[1] = flags;
+    for (std::size_t i = 0; i < 4; ++i) {
+      raw[4 + i] = static_cast<Core::Byte>(length >> (8 * i));
+    }
+    for (std::size_t i = 0; i < 8; ++i) {
+      raw[8 + i] = static_cast<Core::Byte>(src >> (8 * i));
+      raw[16 + i] = static_cast<Core::Byte>(dst >> (8 * i));
+      raw[24 + i] = static_cast<Core::Byte>(next >> (8 * i));
+    }
+    REQUIRE(bus.WriteBlock(at, raw));
+  }
+
+  void Start(std::size_t ch, Core::Address head) {
+    REQUIRE(dma.OnWrite(ChReg(ch, DmaController::ChDescOffset), head));
+    REQUIRE(dma.OnWrite(ChReg(ch, DmaController::ChControlOffset),
+                        DmaController::ControlStart));
+  }
+
+  int RunUntilIdle(std::size_t ch) {
+    int ticks = 0;
+    while (dma.GetChannelState(ch) == DmaChannelState::Busy && ticks < 10000) {
+      dma.OnTick();
+      ticks++;
+    }
+    return ticks;
+  }
+};
+} // namespace
+
+TEST_CASE("DMA - Copy And Fill Chain") {
+  DmaFixture f;
+
+  std::array<Core::Byte, 1000> pattern{};
+  for (std::size_t i = 0; i < pattern.size(); ++i) {
+    pattern[i] = static_cast<Core::Byte>(i * 7);
+  }
+  REQUIRE(f.bus.WriteBlock(0x2000, pattern));
+
+  // Copy 1000 bytes, then fill 100 bytes with a repeating pattern
+  f.WriteDescriptor(0x100, DmaOpcode::Copy, 0, 1000, 0x2000, 0x4000, 0x120);
+  f.WriteDescriptor(0x120, DmaOpcode::Fill, 0, 100, 0x0807060504030201,
+                    0x5000, 0);
+  REQUIRE(f.dma.OnWrite(Dma + DmaController::IrqEnableOffset, 0x2));
+  f.Start(1, 0x100);
+
+  // 2 fetches + 4 bursts of ≤256 bytes + 1 burst of fill
+  CHECK(f.RunUntilIdle(1) == 7);
+  CHECK(f.dma.GetChannelState(1) == DmaChannelState::Done);
+
+  std::array<Core::Byte, 1000> copied{};
+  REQUIRE(f.bus.ReadBlock(0x4000, copied));
+  CHECK(copied == pattern);
+
+  std::array<Core::Byte, 100> filled{};
+  REQUIRE(f.bus.ReadBlock(0x5000, filled));
+  CHECK(filled[0] == 0x01);
+  CHECK(filled[7] == 0x08);
+  CHECK(filled[99] == 0x04);
+
+  Core::Data count = 0;
+  REQUIRE(f.dma.OnRead(ChReg(1, DmaController::ChCountOffset), count));
+  CHECK(count == 2);
+
+  Core::Data irqStatus = 0;
+  REQUIRE(f.dma.OnRead(Dma + DmaController::IrqStatusOffset, irqStatus));
+  CHECK(irqStatus == 0x2);
+  CHECK(f.pic.GetPendingIrqNumber() == PicDevice::IrqDma0 + 1);
+
+  REQUIRE(f.dma.OnWrite(Dma + DmaController::IrqStatusOffset, 0x2));
+  REQUIRE(f.dma.OnRead(Dma + DmaController::IrqStatusOffset, irqStatus));
+  CHECK(irqStatus == 0);
+}
+
+TEST_CASE("DMA - Port Transfers Follow Peripheral WAIT") {
+  DmaFixture f;
+
+  // 4 one-byte elements from the port into RAM, then back out again
+  f.WriteDescriptor(0x100, DmaOpcode::FromPort, 0, 4, PortAddr, 0x3000,
+                    0x120);
+  f.WriteDescriptor(0x120, DmaOpcode::ToPort, 0, 4, 0x3000, PortAddr, 0);
+  f.Start(0, 0x100);
+
+  // Fetch, 4 × (WAIT + transfer), fetch, 4 writes
+  CHECK(f.RunUntilIdle(0) == 1 + 8 + 1 + 4);
+
+  std::array<Core::Byte, 4> received{};
+  REQUIRE(f.bus.ReadBlock(0x3000, received));
+  CHECK(received[0] == 0x40);
+  CHECK(received[3] == 0x43);
+  REQUIRE(f.port.Written.size() == 4);
+  CHECK(f.port.Written[3] == 0x43);
+  CHECK(f.dma.GetBytesTransferred() == 8);
+}
+
+TEST_CASE("DMA - Faults Stop The Channel") {
+  DmaFixture f;
+  REQUIRE(f.dma.OnWrite(Dma + DmaController::IrqEnableOffset, 0xF));
+
+  // Unknown opcode
+  f.WriteDescriptor(0x100, static_cast<DmaOpcode>(0x7F), 0, 8, 0, 0, 0);
+  f.Start(2, 0x100);
+  f.RunUntilIdle(2);
+  CHECK(f.dma.GetChannelState(2) == DmaChannelState::Error);
+  CHECK(f.pic.GetPendingIrqNumber() == PicDevice::IrqDma0 + 2);
+
+  // Copy from an unmapped source
+  f.WriteDescriptor(0x200, DmaOpcode::Copy, 0, 8, 0x90000000, 0x1000, 0);
+  f.Start(3, 0x200);
+  f.RunUntilIdle(3);
+  CHECK(f.dma.GetChannelState(3) == DmaChannelState::Error);
+
+  Core::Data desc = 0;
+  REQUIRE(f.dma.OnRead(ChReg(3, DmaController::ChDescOffset), desc));
+  CHECK(desc == 0x200);
+
+  Core::Data busy = 1;
+  REQUIRE(f.dma.OnRead(Dma + DmaController::BusyOffset, busy));
+  CHECK(busy == 0);
+}
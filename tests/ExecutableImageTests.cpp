@@ -0,0 +1,215 @@
+/**
+ * Executable Image Tests.
+ *
+ * Verifies the AEX container round trip, rejection of malformed files,
+ * and loading a sectioned program assembled from source: section
+ * placement, BSS zero fill, symbols and the entry point.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bus/Bus.hpp"
+#include "Cpu/Cpu.hpp"
+#include "Memory/RamDevice.hpp"
+#include "System/ExecutableImage.hpp"
+#include "System/Loader.hpp"
+#include "System/MemoryMap.hpp"
+#include "Tools/Assembler/Encoder.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include <algorithm>
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::System;
+
+namespace {
+
+/**
+ * @brief Assemble source into an AEX image, as `asm -f aex` does.
+ */
+std::vector<Core::Byte> AssembleImage(const std::string &source,
+                                      Core::Address base) {
+  using namespace Aurelia::Tools::Assembler;
+
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+  Parser parser(tokens);
+  REQUIRE(parser.Parse());
+
+  auto instructions = parser.GetInstructions();
+  const auto &roData = parser.GetRoDataSegment();
+  const auto &data = parser.GetDataSegment();
+  auto layout = SectionLayout::Sequential(base, instructions.size() * 4,
+                                          roData.size(), data.size());
+  Resolver resolver(instructions, parser.GetLabels(), layout);
+  REQUIRE(resolver.Resolve());
+  Encoder encoder(instructions);
+  REQUIRE(encoder.Encode());
+
+  ExecutableImage image;
+  image.Entry = layout.TextBase;
+  image.Sections.push_back({SectionKind::Text, layout.TextBase,
+                            encoder.GetBinary().size(), encoder.GetBinary()});
+  image.Sections.push_back(
+      {SectionKind::RoData, layout.RoDataBase, roData.size(), roData});
+  image.Sections.push_back(
+      {SectionKind::Data, layout.DataBase, data.size(), data});
+  image.Sections.push_back(
+      {SectionKind::Bss, layout.BssBase, parser.GetBssSize(), {}});
+  for (const auto &sym : resolver.GetSymbols()) {
+    image.Symbols.push_back(
+        {sym.Name, sym.Address, sym.Section, sym.IsGlobal});
+    if (sym.Name == parser.GetEntryLabel()) {
+      image.Entry = sym.Address;
+    }
+  }
+  return image.Serialize();
+}
+
+const ImageSymbol *FindSymbol(const std::vector<ImageSymbol> &symbols,
+                              const std::string &name) {
+  for (const auto &sym : symbols) {
+    if (sym.Name == name) {
+      return &sym;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace
+
+TEST_CASE("Image - Serialize And Parse Round Trip", "[image]") {
+  std::array<Core::Byte, 8> text{1, 2, 3, 4, 5, 6, 7, 8};
+  std::array<Core::Byte, 3> data{0xAA, 0xBB, 0xCC};
+
+  ExecutableImage out;
+  out.Entry = 0x1004;
+  out.Sections.push_back({SectionKind::Text, 0x1000, text.size(), text});
+  out.Sections.push_back({SectionKind::Data, 0x2000, data.size(), data});
+  out.Sections.push_back({SectionKind::Bss, 0x3000, 1 << 20, {}});
+  out.Symbols.push_back({"start", 0x1004, SectionKind::Text, true});
+  out.Symbols.push_back({"table", 0x2000, SectionKind::Data, false});
+
+  std::vector<Core::Byte> file = out.Serialize();
+  REQUIRE(ExecutableImage::HasMagic(file));
+  REQUIRE(file.size() < 256); // A megabyte of BSS costs nothing
+
+  ExecutableImage in;
+  std::string error;
+  REQUIRE(in.Parse(file, error));
+  REQUIRE(in.Entry == 0x1004);
+  REQUIRE(in.Sections.size() == 3);
+  REQUIRE(in.Sections[0].Address == 0x1000);
+  REQUIRE(std::equal(text.begin(), text.end(), in.Sections[0].Bytes.begin(),
+                     in.Sections[0].Bytes.end()));
+  REQUIRE(std::equal(data.begin(), data.end(), in.Sections[1].Bytes.begin(),
+                     in.Sections[1].Bytes.end()));
+  REQUIRE(in.Sections[2].Kind == SectionKind::Bss);
+  REQUIRE(in.Sections[2].Size == 1 << 20);
+  REQUIRE(in.Sections[2].Bytes.empty());
+
+  REQUIRE(in.Symbols.size() == 2);
+  REQUIRE(in.Symbols[0].Name == "start");
+  REQUIRE(in.Symbols[0].IsGlobal);
+  REQUIRE(in.Symbols[1].Name == "table");
+  REQUIRE(in.Symbols[1].Section == SectionKind::Data);
+
+  SECTION("Truncated file is rejected") {
+    for (std::size_t cut : {std::size_t{0}, std::size_t{16}, file.size() - 1}) {
+      std::vector<Core::Byte> truncated(
+          file.begin(), file.begin() + static_cast<std::ptrdiff_t>(cut));
+      INFO("cut at " << cut);
+      REQUIRE_FALSE(in.Parse(truncated, error));
+    }
+  }
+
+  SECTION("Corrupt section kind is rejected") {
+    file[ExecutableImage::HeaderSize] = 9;
+    REQUIRE_FALSE(in.Parse(file, error));
+  }
+
+  SECTION("Flat binary is not an image") {
+    std::vector<Core::Byte> flat{0x00, 0x00, 0x00, 0x80};
+    REQUIRE_FALSE(ExecutableImage::HasMagic(flat));
+    REQUIRE_FALSE(in.Parse(flat, error));
+  }
+}
+
+TEST_CASE("Image - Load Sectioned Program", "[image]") {
+  Bus::Bus bus;
+  Memory::RamDevice ram(256 * 1024, 0);
+  Cpu::Cpu cpu;
+  bus.ConnectDevice(&ram);
+  cpu.ConnectBus(&bus);
+
+  // Garbage where BSS will land: the loader must clear it
+  std::vector<Core::Byte> junk(64 * 1024, 0xEE);
+  REQUIRE(bus.WriteBlock(0x1000, junk));
+
+  std::string source = ".rodata\n"
+                       "greeting: .string \"Hi\"\n"
+                       ".data\n"
+                       "counter: .string \"\\0\\0\\0\"\n"
+                       ".bss\n"
+                       "scratch: .space #20000\n"
+                       ".text\n"
+                       ".global main\n"
+                       ".entry main\n"
+                       "MOV R0, #1\n"
+                       "HALT\n"
+                       "main: MOV R0, #42\n"
+                       "HALT\n";
+  auto file = AssembleImage(source, 0x1000);
+
+  Loader loader(bus);
+  REQUIRE(loader.LoadImageData(file));
+  REQUIRE(loader.GetErrorMessage().empty());
+
+  const ImageSymbol *main = FindSymbol(loader.GetSymbols(), "main");
+  const ImageSymbol *greeting = FindSymbol(loader.GetSymbols(), "greeting");
+  const ImageSymbol *scratch = FindSymbol(loader.GetSymbols(), "scratch");
+  REQUIRE(main);
+  REQUIRE(greeting);
+  REQUIRE(scratch);
+  REQUIRE(main->IsGlobal);
+  REQUIRE(main->Address == 0x1008);
+  REQUIRE(loader.GetEntryPoint() == main->Address);
+  REQUIRE(greeting->Address == 0x1010); // Right after four instructions
+
+  std::array<Core::Byte, 3> text{};
+  REQUIRE(bus.ReadBlock(greeting->Address, text));
+  REQUIRE(text == std::array<Core::Byte, 3>{'H', 'i', 0});
+
+  std::vector<Core::Byte> bss(20000);
+  REQUIRE(bus.ReadBlock(scratch->Address, bss));
+  REQUIRE(std::all_of(bss.begin(), bss.end(), [](Core::Byte b) {
+    return b == 0;
+  }));
+
+  cpu.Reset(loader.GetEntryPoint());
+  for (int i = 0; i < 100 && !cpu.IsHalted(); ++i) {
+    cpu.OnTick();
+    bus.OnTick();
+  }
+  REQUIRE(cpu.IsHalted());
+  REQUIRE(cpu.GetRegister(Cpu::Register::R0) == 42);
+
+  SECTION("Image outside RAM leaves memory untouched") {
+    std::array<Core::Byte, 4> word{9, 9, 9, 9};
+    ExecutableImage bad;
+    bad.Sections.push_back({SectionKind::Data, 0x20000, word.size(), word});
+    bad.Sections.push_back({SectionKind::Text, MmioBase, word.size(), word});
+    REQUIRE_FALSE(loader.LoadImageData(bad.Serialize()));
+    REQUIRE_FALSE(loader.GetErrorMessage().empty());
+
+    std::array<Core::Byte, 4> back{};
+    REQUIRE(bus.ReadBlock(0x20000, back));
+    REQUIRE(back == std::array<Core::Byte, 4>{});
+  }
+}
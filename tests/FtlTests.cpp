@@ -112,3 +112,33 @@ TEST_CASE("FTL - GarbageCollection_ReclaimsSpace") {
   CHECK(recycled);
   CHECK(info.EraseCount == 1); // Verify it was erased
 }
+
+TEST_CASE("FTL - GarbageCollection_CopiesBackValidPages") {
+  // NOTE (KleaSCM) Random overwrites leave every victim partly valid, so
+  // GC must copy pages back into the reclaimed block and keep writing.
+  NandChip nand(8);
+  Ftl ftl(&nand, 8);
+
+  constexpr Lba Working = 128; // A quarter of the 512 physical pages
+  std::vector<Byte> data(PageDataSize, 0x5A);
+  for (Lba lba = 0; lba < Working; ++lba) {
+    REQUIRE(ftl.Write(lba, data) == NandStatus::Success);
+  }
+
+  std::vector<Byte> expected(Working, 0x5A);
+  std::uint32_t seed = 1;
+  for (int i = 0; i < 4096; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    Lba lba = (seed >> 8) % Working;
+    data[0] = static_cast<Byte>(i);
+    expected[lba] = data[0];
+    REQUIRE(ftl.Write(lba, data) == NandStatus::Success);
+  }
+
+  // Every LBA still reads back its last write
+  std::vector<Byte> buffer(PageDataSize);
+  for (Lba lba = 0; lba < Working; ++lba) {
+    REQUIRE(ftl.Read(lba, buffer) == NandStatus::Success);
+    CHECK(buffer[0] == expected[lba]);
+  }
+}
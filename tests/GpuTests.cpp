@@ -0,0 +1,224 @@
+/**
+ * GPU Device Unit Tests.
+ *
+ * Verifies register layout, dirty-tile tracking, vsync-driven scan-out
+ * and the PPM frame sink.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Graphics/GpuDevice.hpp"
+#include "System/MemoryMap.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::Graphics;
+
+namespace {
+constexpr Core::Address Regs = System::GpuBase;
+constexpr Core::Address Vram = System::GpuVramBase;
+
+/**
+ * @brief Records every presented frame's dirty rectangles.
+ */
+class RecordingSink final : public IFrameSink {
+public:
+  void Present(const FrameView &frame, std::span<const Rect> dirty) override {
+    Frames.push_back(frame.FrameNumber);
+    Dirty.assign(dirty.begin(), dirty.end());
+    FirstPixel = frame.Pixels[0];
+  }
+
+  std::vector<std::uint64_t> Frames;
+  std::vector<Rect> Dirty;
+  std::uint8_t FirstPixel = 0;
+};
+
+Core::Address PixelAddress(std::uint32_t x, std::uint32_t y) {
+  return Vram + (static_cast<Core::Address>(y) * GpuDevice::Pitch) +
+         x * GpuDevice::BytesPerPixel;
+}
+} // namespace
+
+TEST_CASE("GPU - Identification And Geometry Registers") {
+  GpuDevice gpu;
+  Core::Data data = 0;
+
+  REQUIRE(gpu.IsAddressInRange(Regs));
+  REQUIRE(gpu.IsAddressInRange(Vram + GpuDevice::VramSize - 1));
+  REQUIRE_FALSE(gpu.IsAddressInRange(Vram + GpuDevice::VramSize));
+
+  REQUIRE(gpu.OnRead(Regs + GpuDevice::IdOffset, data));
+  REQUIRE(data == GpuDevice::DeviceId);
+  REQUIRE(gpu.OnRead(Regs + GpuDevice::WidthOffset, data));
+  REQUIRE(data == 640);
+  REQUIRE(gpu.OnRead(Regs + GpuDevice::HeightOffset, data));
+  REQUIRE(data == 480);
+  REQUIRE(gpu.OnRead(Regs + GpuDevice::PitchOffset, data));
+  REQUIRE(data == 2560);
+}
+
+TEST_CASE("GPU - Only Changed Frames Reach The Sink") {
+  GpuDevice gpu;
+  RecordingSink sink;
+  gpu.SetFrameSink(&sink);
+  REQUIRE(gpu.OnWrite(Regs + GpuDevice::VsyncPeriodOffset, 10));
+
+  // Nothing drawn: vsyncs elapse but no frame is presented
+  for (int i = 0; i < 30; ++i) {
+    gpu.OnTick();
+  }
+  REQUIRE(gpu.GetVsyncCount() == 3);
+  REQUIRE(gpu.GetSkippedFrames() == 3);
+  REQUIRE(sink.Frames.empty());
+
+  // Two RGBA pixels at (100, 50)
+  REQUIRE(gpu.OnWrite(PixelAddress(100, 50), 0xFF0000FFFF0000FFull));
+  REQUIRE(gpu.IsDirty());
+
+  for (int i = 0; i < 10; ++i) {
+    gpu.OnTick();
+  }
+  REQUIRE(sink.Frames.size() == 1);
+  REQUIRE(sink.Frames[0] == 0); // Numbered by frames, not vsyncs
+  REQUIRE(gpu.GetPresentedFrames() == 1);
+  REQUIRE_FALSE(gpu.IsDirty());
+
+  // Exactly the 32×32 tile containing the store
+  REQUIRE(sink.Dirty.size() == 1);
+  REQUIRE(sink.Dirty[0].X == 96);
+  REQUIRE(sink.Dirty[0].Y == 32);
+  REQUIRE(sink.Dirty[0].Width == 32);
+  REQUIRE(sink.Dirty[0].Height == 32);
+
+  // Read back through the bus path
+  Core::Data data = 0;
+  REQUIRE(gpu.OnRead(PixelAddress(100, 50), data));
+  REQUIRE(data == 0xFF0000FFFF0000FFull);
+}
+
+TEST_CASE("GPU - Dirty Rectangles Merge Runs And Rows") {
+  GpuDevice gpu;
+  RecordingSink sink;
+  gpu.SetFrameSink(&sink);
+
+  // 64×64 block spanning 2×2 tiles, plus a separate tile further right
+  gpu.MarkDirty({0, 0, 64, 64});
+  gpu.MarkDirty({320, 0, 1, 1});
+  REQUIRE(gpu.Present());
+
+  REQUIRE(sink.Dirty.size() == 3);
+  REQUIRE(sink.Dirty[0].X == 0);
+  REQUIRE(sink.Dirty[0].Width == 64);
+  REQUIRE(sink.Dirty[0].Height == 32);
+  REQUIRE(sink.Dirty[1].X == 320);
+  REQUIRE(sink.Dirty[1].Width == 32);
+  REQUIRE(sink.Dirty[2].Y == 32);
+  REQUIRE(sink.Dirty[2].Height == 32);
+
+  // Identical tile rows collapse into one tall rectangle
+  gpu.MarkDirty({32, 0, 32, GpuDevice::Height});
+  REQUIRE(gpu.Present());
+  REQUIRE(sink.Dirty.size() == 1);
+  REQUIRE(sink.Dirty[0].X == 32);
+  REQUIRE(sink.Dirty[0].Height == GpuDevice::Height);
+
+  // Nothing new: PRESENT is a no-op
+  REQUIRE(gpu.OnWrite(Regs + GpuDevice::PresentOffset, 1));
+  REQUIRE(gpu.GetPresentedFrames() == 2);
+}
+
+TEST_CASE("GPU - Vsync Status And Interrupt") {
+  GpuDevice gpu;
+  Peripherals::PicDevice pic;
+  gpu.ConnectPic(&pic);
+  REQUIRE(pic.OnWrite(System::PicBase + 0x4, 0xFFFF));
+
+  REQUIRE(gpu.OnWrite(Regs + GpuDevice::VsyncPeriodOffset, 4));
+  REQUIRE(gpu.OnWrite(Regs + GpuDevice::ControlOffset,
+                      GpuDevice::ControlScanoutEnable |
+                          GpuDevice::ControlVsyncIrqEnable));
+
+  for (int i = 0; i < 4; ++i) {
+    gpu.OnTick();
+  }
+  REQUIRE(pic.GetPendingIrqNumber() ==
+          Peripherals::PicDevice::IrqGpuVsync);
+
+  // VSYNC is sticky until STATUS is read
+  Core::Data status = 0;
+  REQUIRE(gpu.OnRead(Regs + GpuDevice::StatusOffset, status));
+  REQUIRE((status & GpuDevice::StatusVsync) != 0);
+  REQUIRE(gpu.OnRead(Regs + GpuDevice::StatusOffset, status));
+  REQUIRE((status & GpuDevice::StatusVsync) == 0);
+
+  // Period 0 stops the vsync clock entirely
+  REQUIRE(gpu.OnWrite(Regs + GpuDevice::VsyncPeriodOffset, 0));
+  for (int i = 0; i < 100; ++i) {
+    gpu.OnTick();
+  }
+  REQUIRE(gpu.GetVsyncCount() == 1);
+}
+
+TEST_CASE("GPU - PPM Sink Writes Changed Frames") {
+  std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "aurelia_gpu_test";
+  std::filesystem::create_directories(dir);
+  std::string prefix = (dir / "frame_").string();
+
+  GpuDevice gpu;
+  PpmSequenceSink sink(prefix, true);
+  gpu.SetFrameSink(&sink);
+
+  REQUIRE(gpu.OnWrite(PixelAddress(0, 0), 0x000000FF000000FFull));
+  REQUIRE(gpu.Present());
+  REQUIRE_FALSE(gpu.Present());
+
+  REQUIRE(sink.GetFilesWritten() == 1);
+  REQUIRE(sink.GetLastPath() == prefix + "000000_x0_y0.ppm");
+
+  // Cropped to one 32×32 tile: header + 32 × 32 × 3 bytes of RGB
+  std::string header = "P6\n32 32\n255\n";
+  REQUIRE(std::filesystem::file_size(sink.GetLastPath()) ==
+          header.size() + 32 * 32 * 3);
+
+  std::FILE *file = std::fopen(sink.GetLastPath().c_str(), "rb");
+  REQUIRE(file != nullptr);
+  std::vector<char> bytes(header.size() + 3);
+  REQUIRE(std::fread(bytes.data(), 1, bytes.size(), file) == bytes.size());
+  std::fclose(file);
+  REQUIRE(std::string(bytes.data(), header.size()) == header);
+  REQUIRE(static_cast<std::uint8_t>(bytes[header.size()]) == 0xFF); // R
+
+  std::filesystem::remove_all(dir);
+}
+
+TEST_CASE("GPU - Manual Presents Get Their Own Files") {
+  std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "aurelia_gpu_manual_test";
+  std::filesystem::create_directories(dir);
+  std::string prefix = (dir / "frame_").string();
+
+  GpuDevice gpu;
+  PpmSequenceSink sink(prefix);
+  gpu.SetFrameSink(&sink);
+  REQUIRE(gpu.OnWrite(Regs + GpuDevice::VsyncPeriodOffset, 0));
+
+  // No vsync ever elapses; each PRESENT still names a new file
+  REQUIRE(gpu.OnWrite(PixelAddress(0, 0), 0x000000FF000000FFull));
+  REQUIRE(gpu.OnWrite(Regs + GpuDevice::PresentOffset, 1));
+  REQUIRE(gpu.OnWrite(PixelAddress(1, 0), 0x0000FF000000FF00ull));
+  REQUIRE(gpu.OnWrite(Regs + GpuDevice::PresentOffset, 1));
+  REQUIRE(gpu.GetVsyncCount() == 0);
+
+  REQUIRE(sink.GetFilesWritten() == 2);
+  REQUIRE(std::filesystem::exists(prefix + "000000.ppm"));
+  REQUIRE(std::filesystem::exists(prefix + "000001.ppm"));
+
+  std::filesystem::remove_all(dir);
+}
@@ -0,0 +1,157 @@
+/**
+ * Host Input Pump Unit Tests.
+ *
+ * Verifies that bytes and mouse packets written to host descriptors reach
+ * the guest devices through the I/O thread and tick-boundary delivery.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Host/HostInputPump.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace Aurelia;
+using namespace Aurelia::Host;
+
+namespace {
+
+/**
+ * Tick the pump until `done` holds or roughly two seconds pass. The I/O
+ * thread runs asynchronously, so tests poll rather than assume timing.
+ */
+bool TickUntil(HostInputPump &pump, const std::function<bool()> &done) {
+  for (int i = 0; i < 2000; ++i) {
+    pump.OnTick();
+    if (done()) {
+      return true;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+} // namespace
+
+TEST_CASE("HostInputPump - Pipe Feeds UART Receiver") {
+  int fds[2];
+  REQUIRE(::pipe(fds) == 0);
+
+  Peripherals::UartDevice uart;
+  HostInputPump pump;
+  pump.ConnectUart(&uart);
+  REQUIRE(pump.AddSource(fds[0], InputTarget::Uart));
+  REQUIRE(pump.Start());
+
+  // Nothing queued yet: ticking must not block
+  pump.OnTick();
+  REQUIRE(pump.GetDeliveredCount() == 0);
+
+  REQUIRE(::write(fds[1], "hi", 2) == 2);
+
+  Core::Data level = 0;
+  REQUIRE(TickUntil(pump, [&] {
+    uart.OnRead(0xE0001014, level); // RX_LEVEL
+    return level == 2;
+  }));
+
+  Core::Data data = 0;
+  REQUIRE(uart.OnRead(0xE0001000, data));
+  REQUIRE(data == 'h');
+  REQUIRE(uart.OnRead(0xE0001000, data));
+  REQUIRE(data == 'i');
+
+  pump.Stop();
+  REQUIRE_FALSE(pump.IsRunning());
+  ::close(fds[0]); // Not owned by the pump
+  ::close(fds[1]);
+}
+
+TEST_CASE("HostInputPump - UART Burst Waits For FIFO Space") {
+  int fds[2];
+  REQUIRE(::pipe(fds) == 0);
+
+  Peripherals::UartDevice uart;
+  HostInputPump pump;
+  pump.ConnectUart(&uart);
+  REQUIRE(pump.AddSource(fds[0], InputTarget::Uart));
+  REQUIRE(pump.Start());
+
+  // 40 bytes at once: more than twice the 16-byte RX FIFO
+  std::string sent;
+  for (char c = 'A'; sent.size() < 40; ++c) {
+    sent += c;
+  }
+  REQUIRE(::write(fds[1], sent.data(), sent.size()) ==
+          static_cast<ssize_t>(sent.size()));
+
+  // The guest drains the FIFO between ticks, as a driver would
+  std::string received;
+  REQUIRE(TickUntil(pump, [&] {
+    uart.OnTick();
+    Core::Data level = 0;
+    uart.OnRead(0xE0001014, level); // RX_LEVEL
+    for (Core::Data i = 0; i < level; ++i) {
+      Core::Data data = 0;
+      uart.OnRead(0xE0001000, data);
+      received += static_cast<char>(data);
+    }
+    return received.size() == sent.size();
+  }));
+
+  CHECK(received == sent);
+  CHECK(uart.GetRxOverrunCount() == 0);
+  CHECK(pump.GetDroppedCount() == 0);
+
+  pump.Stop();
+  ::close(fds[0]);
+  ::close(fds[1]);
+}
+
+TEST_CASE("HostInputPump - Unix Socket Mouse Packets") {
+  std::string path =
+      "/tmp/aurelia-pump-test-" + std::to_string(::getpid()) + ".sock";
+
+  Peripherals::MouseDevice mouse;
+  HostInputPump pump;
+  pump.ConnectMouse(&mouse);
+  REQUIRE(pump.ListenUnix(path, InputTarget::Mouse));
+  REQUIRE(pump.Start());
+
+  int client = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  REQUIRE(client >= 0);
+  sockaddr_un addr{};
+  addr.sun_family = AF_UNIX;
+  std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+  REQUIRE(::connect(client, reinterpret_cast<const sockaddr *>(&addr),
+                    sizeof(addr)) == 0);
+
+  // buttons=1, dx=+5, dy=-3 (little-endian), split across two writes
+  const std::uint8_t packet[] = {0x01, 0x05, 0x00, 0x00, 0x00,
+                                 0xFD, 0xFF, 0xFF, 0xFF};
+  REQUIRE(::write(client, packet, 4) == 4);
+  REQUIRE(::write(client, packet + 4, 5) == 5);
+
+  REQUIRE(TickUntil(pump, [&] { return pump.GetDeliveredCount() == 1; }));
+
+  Core::Data data = 0;
+  REQUIRE(mouse.OnRead(0xE0005004, data)); // DATA_X
+  REQUIRE(static_cast<std::int32_t>(data) == 5);
+  REQUIRE(mouse.OnRead(0xE0005008, data)); // DATA_Y
+  REQUIRE(static_cast<std::int32_t>(data) == -3);
+  REQUIRE(mouse.OnRead(0xE000500C, data)); // BUTTONS
+  REQUIRE(data == 1);
+
+  ::close(client);
+  pump.Stop();
+  REQUIRE(::access(path.c_str(), F_OK) != 0); // Socket file removed
+}
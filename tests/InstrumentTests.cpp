@@ -0,0 +1,173 @@
+/**
+ * Instrumentation Tests.
+ *
+ * Verifies probe naming, that the CPU, bus and RAM probes record a real
+ * program's execution, sampled timing, and that counts from many threads
+ * add up. With AURELIA_INSTRUMENT off every probe must stay at zero.
+ *
+ * NOTE (KleaSCM) Snapshot() sums every thread that ever recorded,
+ * including pool workers from earlier tests, and each thread samples its
+ * own first call. Tests that bound sampled totals Reset() first and record
+ * on the test thread only, so the bound does not depend on test order.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bus/Bus.hpp"
+#include "Core/Instrument.hpp"
+#include "Cpu/Cpu.hpp"
+#include "Memory/RamDevice.hpp"
+#include "Tools/Assembler/Encoder.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Aurelia;
+using Core::Instrument::Probe;
+using Core::Instrument::ProbeCount;
+
+namespace {
+
+std::vector<std::uint8_t> Assemble(const std::string &source) {
+  using namespace Aurelia::Tools::Assembler;
+
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+  Parser parser(tokens);
+  REQUIRE(parser.Parse());
+  auto instructions = parser.GetInstructions();
+  Resolver resolver(instructions, parser.GetLabels());
+  REQUIRE(resolver.Resolve());
+  Encoder encoder(instructions);
+  REQUIRE(encoder.Encode());
+  return encoder.GetBinary();
+}
+
+std::uint64_t CallsOf(Probe probe) {
+  return Core::Instrument::Snapshot()[static_cast<std::size_t>(probe)].Calls;
+}
+
+} // namespace
+
+TEST_CASE("Instrument - Every Probe Has A Unique Name") {
+  std::set<std::string> names;
+  for (std::size_t i = 0; i < ProbeCount; ++i) {
+    std::string name = Core::Instrument::ToString(static_cast<Probe>(i));
+    REQUIRE(name != "?");
+    REQUIRE(names.insert(name).second);
+  }
+  REQUIRE(std::string(Core::Instrument::ToString(Probe::Count)) == "?");
+}
+
+TEST_CASE("Instrument - Records CPU, Bus And RAM Probes") {
+  // Only this thread's counts from here on: see the NOTE above
+  Core::Instrument::Reset();
+
+  Bus::Bus bus;
+  Memory::RamDevice ram(0x10000, 0);
+  Cpu::Cpu cpu;
+  bus.ConnectDevice(&ram);
+  cpu.ConnectBus(&bus);
+
+  // Ten loads, ten stores, then halt
+  std::string source = "MOV R1, #512\n";
+  for (int i = 0; i < 10; ++i) {
+    source += "LDR R2, [R1, #0]\nSTR R2, [R1, #8]\n";
+  }
+  source += "HALT\n";
+  std::vector<std::uint8_t> program = Assemble(source);
+  REQUIRE(ram.OnWriteBlock(0, program));
+
+  auto before = Core::Instrument::Snapshot();
+  cpu.Reset(0);
+  for (int tick = 0; tick < 100000 && !cpu.IsHalted(); ++tick) {
+    cpu.OnTick();
+    bus.OnTick();
+    ram.OnTick();
+  }
+  REQUIRE(cpu.IsHalted());
+  auto after = Core::Instrument::Snapshot();
+
+  auto delta = [&](Probe probe) {
+    auto i = static_cast<std::size_t>(probe);
+    return after[i].Calls - before[i].Calls;
+  };
+
+  if constexpr (Core::Instrument::Enabled) {
+    // 22 instructions: each fetched and decoded once
+    REQUIRE(delta(Probe::CpuDecode) == 22);
+    REQUIRE(delta(Probe::CpuMemory) >= 20);
+    REQUIRE(delta(Probe::RamRead) == 22 + 10);
+    REQUIRE(delta(Probe::RamWrite) == 10);
+    REQUIRE(delta(Probe::BusDecode) >= delta(Probe::RamRead));
+
+    // Sampled probes time one call per period; Cpu/Fetch's first call is
+    // in phase, so it has been timed at least once. Since Reset() only
+    // this thread has recorded, so at most one extra sample
+    for (std::size_t i = 0; i < ProbeCount; ++i) {
+      REQUIRE(after[i].Timed <= after[i].Calls);
+    }
+    auto fetch = static_cast<std::size_t>(Probe::CpuFetch);
+    REQUIRE(Core::Instrument::SamplePhase(Probe::CpuFetch) == 0);
+    REQUIRE(after[fetch].Timed >= 1);
+    REQUIRE(after[fetch].Timed <=
+            after[fetch].Calls /
+                    (Core::Instrument::SampleMask(Probe::CpuFetch) + 1) +
+                1);
+  } else {
+    for (std::size_t i = 0; i < ProbeCount; ++i) {
+      REQUIRE(after[i].Calls == 0);
+    }
+  }
+}
+
+TEST_CASE("Instrument - Counts From Many Threads Add Up") {
+  std::uint64_t before = CallsOf(Probe::FtlGcCopy);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([] {
+      for (int i = 0; i < 1000; ++i) {
+        AURELIA_INSTRUMENT_COUNT(FtlGcCopy, 1);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  // Exited threads hand their slots back without losing counts
+  std::uint64_t expected = Core::Instrument::Enabled ? 4000 : 0;
+  REQUIRE(CallsOf(Probe::FtlGcCopy) - before == expected);
+}
+
+TEST_CASE("Instrument - Report Lists Only Probes That Fired") {
+  Core::Instrument::Reset();
+  REQUIRE(CallsOf(Probe::NvmeCommand) == 0);
+  {
+    AURELIA_INSTRUMENT_SCOPE(NvmeCommand);
+  }
+
+  std::ostringstream out;
+  out << std::hex;
+  std::ios_base::fmtflags flags = out.flags();
+  Core::Instrument::Report(out);
+  // Never touches the stream's format state, even while formatting
+  REQUIRE(out.flags() == flags);
+  REQUIRE(out.precision() == 6);
+  if constexpr (Core::Instrument::Enabled) {
+    REQUIRE(CallsOf(Probe::NvmeCommand) == 1);
+    REQUIRE(out.str().find("Nvme/Command") != std::string::npos);
+    REQUIRE(out.str().find("Ftl/Write") == std::string::npos);
+    REQUIRE(Core::Instrument::TicksPerSecond() > 0.0);
+  } else {
+    REQUIRE(out.str().empty());
+  }
+}
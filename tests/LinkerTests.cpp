@@ -0,0 +1,186 @@
+/**
+ * Linker Tests.
+ *
+ * Verifies that objects linked together match the same code assembled as
+ * one file, that labels stay private unless exported with .global, and
+ * that symbol, entry and range problems are reported against the object
+ * and line that caused them.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Tools/Assembler/Encoder.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Linker.hpp"
+#include "Tools/Assembler/ObjectAssembler.hpp"
+#include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::Tools::Assembler;
+
+namespace {
+
+constexpr Address Base = 0x100;
+
+const std::string MainSource = ".global main\n"
+                               ".global back\n"
+                               ".entry main\n"
+                               "main: MOV R1, msg\n"
+                               "loop: BNE helper\n"
+                               "back: CMP R1, R2\n"
+                               "BEQ loop\n"
+                               "HALT\n"
+                               ".data\n"
+                               "msg: .string \"abc\"\n";
+
+const std::string HelperSource = ".global helper\n"
+                                 "helper: MOV R2, value\n"
+                                 "B back\n"
+                                 ".data\n"
+                                 "value: .string \"xyz\"\n"
+                                 ".bss\n"
+                                 "scratch: .space #12\n";
+
+ObjectFile AssembleOrFail(const std::string &source) {
+  ObjectFile object;
+  std::string error;
+  bool assembled = AssembleObject(source, object, error);
+  INFO(error);
+  REQUIRE(assembled);
+  return object;
+}
+
+} // namespace
+
+TEST_CASE("Linker - Matches A Single-File Build", "[linker]") {
+  // Both data strings are 4 bytes, so no padding separates the pieces
+  std::string whole = MainSource + ".text\n" + HelperSource;
+  Lexer lexer(whole);
+  auto tokens = lexer.Tokenize();
+  Parser parser(tokens);
+  REQUIRE(parser.Parse());
+  auto instructions = parser.GetInstructions();
+  auto layout = SectionLayout::Sequential(
+      Base, instructions.size() * 4, parser.GetRoDataSegment().size(),
+      parser.GetDataSegment().size());
+  Resolver resolver(instructions, parser.GetLabels(), layout);
+  REQUIRE(resolver.Resolve());
+  Encoder encoder(instructions);
+  REQUIRE(encoder.Encode());
+
+  ObjectFile main = AssembleOrFail(MainSource);
+  ObjectFile helper = AssembleOrFail(HelperSource);
+  Linker linker(Base);
+  linker.AddObject("main.o", main);
+  linker.AddObject("helper.o", helper);
+  REQUIRE(linker.Link());
+
+  CHECK(linker.GetText() == encoder.GetBinary());
+  CHECK(linker.GetDataSegment() == parser.GetDataSegment());
+  CHECK(linker.GetBssSize() == parser.GetBssSize());
+  CHECK(linker.GetLayout().DataBase == layout.DataBase);
+  CHECK(linker.GetLayout().BssBase == layout.BssBase);
+
+  const auto &expected = resolver.GetSymbols();
+  REQUIRE(linker.GetSymbols().size() == expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    CHECK(linker.GetSymbols()[i].Name == expected[i].Name);
+    CHECK(linker.GetSymbols()[i].Address == expected[i].Address);
+    CHECK(linker.GetSymbols()[i].IsGlobal == expected[i].IsGlobal);
+  }
+  CHECK(linker.GetEntry() == Base);
+}
+
+TEST_CASE("Linker - Pieces Are Aligned Per Object", "[linker]") {
+  ObjectFile a = AssembleOrFail(".data\nfirst: .string \"a\"\n");
+  ObjectFile b = AssembleOrFail(".data\nsecond: .string \"b\"\n");
+  Linker linker;
+  linker.AddObject("a.o", a);
+  linker.AddObject("b.o", b);
+  REQUIRE(linker.Link());
+
+  // "a\0" is two bytes; b's data starts at the next 4-byte boundary
+  REQUIRE(linker.GetSymbols().size() == 2);
+  CHECK(linker.GetSymbols()[1].Address - linker.GetSymbols()[0].Address ==
+        SectionLayout::Alignment);
+  CHECK(linker.GetDataSegment() ==
+        std::vector<Core::Byte>{'a', 0, 0, 0, 'b', 0});
+}
+
+TEST_CASE("Linker - Labels Are Private Unless Global", "[linker]") {
+  SECTION("Same local name in two objects") {
+    ObjectFile a = AssembleOrFail("loop: NOP\nBNE loop\n");
+    ObjectFile b = AssembleOrFail("loop: NOP\nBNE loop\n");
+    Linker linker;
+    linker.AddObject("a.o", a);
+    linker.AddObject("b.o", b);
+    REQUIRE(linker.Link());
+    CHECK(linker.GetSymbols().size() == 2);
+    // Identical code: each branch reaches its own loop
+    CHECK(std::equal(linker.GetText().begin(), linker.GetText().begin() + 8,
+                     linker.GetText().begin() + 8));
+  }
+
+  SECTION("A local does not satisfy an import") {
+    ObjectFile a = AssembleOrFail("hidden: HALT\n");
+    ObjectFile b = AssembleOrFail("NOP\nB hidden\n");
+    Linker linker;
+    linker.AddObject("a.o", a);
+    linker.AddObject("b.o", b);
+    CHECK_FALSE(linker.Link());
+    CHECK(linker.GetErrorMessage() == "b.o: [Line 2] Undefined Symbol: hidden");
+  }
+}
+
+TEST_CASE("Linker - Reports Symbol And Range Errors", "[linker]") {
+  Linker linker;
+
+  SECTION("Duplicate global") {
+    ObjectFile a = AssembleOrFail(".global f\nf: HALT\n");
+    ObjectFile b = AssembleOrFail(".global f\nf: HALT\n");
+    linker.AddObject("a.o", a);
+    linker.AddObject("b.o", b);
+    CHECK_FALSE(linker.Link());
+    CHECK(linker.GetErrorMessage() == "b.o: Duplicate global symbol: f");
+  }
+
+  SECTION("Two entry points") {
+    ObjectFile a = AssembleOrFail(".entry f\nf: HALT\n");
+    ObjectFile b = AssembleOrFail(".entry g\ng: HALT\n");
+    linker.AddObject("a.o", a);
+    linker.AddObject("b.o", b);
+    CHECK_FALSE(linker.Link());
+    CHECK(linker.GetErrorMessage().find("entry") != std::string::npos);
+  }
+
+  SECTION("Branch across objects out of range") {
+    std::string big = ".global far\n";
+    for (int i = 0; i < 300; ++i) {
+      big += "NOP\n";
+    }
+    big += "far: HALT\n";
+    ObjectFile a = AssembleOrFail("B far\n");
+    ObjectFile b = AssembleOrFail(big);
+    linker.AddObject("a.o", a);
+    linker.AddObject("b.o", b);
+    CHECK_FALSE(linker.Link());
+    CHECK(linker.GetErrorMessage() ==
+          "a.o: [Line 1] Branch target out of range (1204)");
+  }
+}
+
+TEST_CASE("Linker - Entry In A Later Object", "[linker]") {
+  ObjectFile a = AssembleOrFail("NOP\nNOP\n");
+  ObjectFile b = AssembleOrFail(".entry start\nNOP\nstart: HALT\n");
+  Linker linker(Base);
+  linker.AddObject("a.o", a);
+  linker.AddObject("b.o", b);
+  REQUIRE(linker.Link());
+  CHECK(linker.GetEntry() == Base + 12);
+}
@@ -1,14 +1,16 @@
 /**
  * Memory Subsystem Tests.
  *
- * Verifies RAM storage and latency simulation.
+ * Verifies RAM storage, latency simulation and sparse zero fill.
  *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
  */
 
 #include "Memory/RamDevice.hpp"
+#include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <vector>
 
 using namespace Aurelia;
 using namespace Aurelia::Memory;
@@ -52,3 +54,34 @@ TEST_CASE("Memory - LatencySimulation") {
   // Tick 2: Should be ready now!
   CHECK(ram.OnWrite(0x1000, writeVal));
 }
+
+TEST_CASE("Memory - ZeroBlock") {
+  constexpr std::size_t Size = 64 * 1024;
+  RamDevice ram(Size, 0);
+  ram.SetBaseAddress(0x10000);
+
+  std::vector<Byte> pattern(Size, 0x5A);
+  REQUIRE(ram.OnWriteBlock(0x10000, pattern));
+
+  // Unaligned at both ends and spanning several host pages
+  constexpr std::size_t First = 1000;
+  constexpr std::size_t Length = 3 * 4096 + 777;
+  REQUIRE(ram.OnZeroBlock(0x10000 + First, Length));
+
+  std::vector<Byte> after(Size);
+  REQUIRE(ram.OnReadBlock(0x10000, after));
+  for (std::size_t i = 0; i < Size; ++i) {
+    bool zeroed = i >= First && i < First + Length;
+    INFO("offset " << i);
+    REQUIRE(after[i] == (zeroed ? 0 : 0x5A));
+  }
+
+  // Released pages are writable again
+  std::array<Byte, 4> bytes{1, 2, 3, 4};
+  REQUIRE(ram.OnWriteBlock(0x10000 + 8192, bytes));
+  std::array<Byte, 4> back{};
+  REQUIRE(ram.OnReadBlock(0x10000 + 8192, back));
+  REQUIRE(back == bytes);
+
+  REQUIRE_FALSE(ram.OnZeroBlock(0x10000 + Size - 4, 8)); // Past the end
+}
@@ -0,0 +1,318 @@
+/**
+ * Network Device Unit Tests.
+ *
+ * Verifies frame transfer between two NICs over an in-process switch,
+ * switch learning and flooding, interrupt moderation, receive backlog
+ * overflow, and the Unix datagram backend.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bus/Bus.hpp"
+#include "Memory/RamDevice.hpp"
+#include "Network/NetDevice.hpp"
+#include "System/MemoryMap.hpp"
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::Network;
+
+namespace {
+constexpr Core::Address Regs = System::NetBase;
+constexpr std::uint32_t RingSize = 8;
+
+constexpr Core::Address TxRing = 0x1000;
+constexpr Core::Address RxRing = 0x2000;
+constexpr Core::Address TxBuffers = 0x10000;
+constexpr Core::Address RxBuffers = 0x20000;
+constexpr std::uint16_t BufferSize = 2048;
+
+Frame MakeFrame(const MacAddress &dst, const MacAddress &src,
+                std::size_t length, Core::Byte seed) {
+  Frame frame(length);
+  std::copy(dst.begin(), dst.end(), frame.begin());
+  std::copy(src.begin(), src.end(), frame.begin() + 6);
+  frame[12] = 0x88; // Local experimental EtherType
+  frame[13] = 0xB5;
+  for (std::size_t i = EthernetHeaderSize; i < length; ++i) {
+    frame[i] = static_cast<Core::Byte>(seed + i);
+  }
+  return frame;
+}
+
+/**
+ * One machine's worth of NIC: its own bus and RAM, rings set up and both
+ * directions enabled.
+ */
+struct Station {
+  Bus::Bus bus;
+  Memory::RamDevice ram{256 * 1024, 0};
+  NetDevice nic;
+  std::uint32_t txTail = 0;
+  std::uint32_t rxTail = 0;
+
+  Station(INetBackend *backend, Core::Byte id) {
+    bus.ConnectDevice(&ram);
+    bus.ConnectDevice(&nic);
+    nic.ConnectBus(&bus);
+    nic.ConnectBackend(backend);
+    nic.SetMacAddress({0x02, 0x00, 0x00, 0x00, 0x00, id});
+
+    REQUIRE(nic.OnWrite(Regs + NetDevice::TxBaseLoOffset, TxRing));
+    REQUIRE(nic.OnWrite(Regs + NetDevice::TxSizeOffset, RingSize));
+    REQUIRE(nic.OnWrite(Regs + NetDevice::RxBaseLoOffset, RxRing));
+    REQUIRE(nic.OnWrite(Regs + NetDevice::RxSizeOffset, RingSize));
+    REQUIRE(nic.OnWrite(Regs + NetDevice::ControlOffset,
+                        NetDevice::ControlRxEnable |
+                            NetDevice::ControlTxEnable));
+  }
+
+  void WriteDescriptor(Core::Address ring, std::uint32_t index,
+                       Core::Address addr, std::uint16_t len) {
+    std::array<Core::Byte, NetDevice::DescriptorSize> raw{};
+    for (std::size_t i = 0; i < 8; ++i) {
+      raw[i] = static_cast<Core::Byte>(addr >> (8 * i));
+    }
+    raw[8] = static_cast<Core::Byte>(len);
+    raw[9] = static_cast<Core::Byte>(len >> 8);
+    REQUIRE(bus.WriteBlock(ring + NetDevice::DescriptorSize * index, raw));
+  }
+
+  std::uint16_t ReadField(Core::Address ring, std::uint32_t index,
+                          Core::Address offset) {
+    std::array<Core::Byte, 2> raw{};
+    REQUIRE(bus.ReadBlock(ring + NetDevice::DescriptorSize * index + offset,
+                          raw));
+    return static_cast<std::uint16_t>(raw[0] | (raw[1] << 8));
+  }
+
+  /**
+   * @brief Post `count` empty receive buffers.
+   */
+  void PostRxBuffers(std::uint32_t count) {
+    for (std::uint32_t i = 0; i < count; ++i) {
+      WriteDescriptor(RxRing, rxTail, RxBuffers + BufferSize * rxTail,
+                      BufferSize);
+      rxTail = (rxTail + 1) % RingSize;
+    }
+    REQUIRE(nic.OnWrite(Regs + NetDevice::RxTailOffset, rxTail));
+  }
+
+  void Send(const Frame &frame) {
+    Core::Address buffer = TxBuffers + BufferSize * txTail;
+    REQUIRE(bus.WriteBlock(buffer, frame));
+    WriteDescriptor(TxRing, txTail, buffer,
+                    static_cast<std::uint16_t>(frame.size()));
+    txTail = (txTail + 1) % RingSize;
+    REQUIRE(nic.OnWrite(Regs + NetDevice::TxTailOffset, txTail));
+  }
+
+  Core::Data Read(Core::Address offset) {
+    Core::Data value = 0;
+    REQUIRE(nic.OnRead(Regs + offset, value));
+    return value;
+  }
+};
+
+/**
+ * @brief Tick both NICs long enough for a receive poll to happen.
+ */
+void Run(Station &a, Station &b, std::size_t ticks = 64) {
+  for (std::size_t i = 0; i < ticks; ++i) {
+    a.nic.OnTick();
+    b.nic.OnTick();
+  }
+}
+} // namespace
+
+TEST_CASE("Network - Frame Crosses Switch Between NICs", "[network]") {
+  NetSwitch fabric;
+  Station a(fabric.AddPort(), 1);
+  Station b(fabric.AddPort(), 2);
+  b.PostRxBuffers(4);
+
+  REQUIRE(a.Read(NetDevice::IdOffset) == NetDevice::DeviceId);
+  REQUIRE(a.Read(NetDevice::StatusOffset) == 1);
+  REQUIRE(b.Read(NetDevice::MacHiOffset) == 0x0200);
+
+  Frame sent = MakeFrame(b.nic.GetMacAddress(), a.nic.GetMacAddress(), 300,
+                         0x40);
+  a.Send(sent);
+  Run(a, b);
+
+  // Sender: descriptor completed, head caught up with tail
+  REQUIRE(a.ReadField(TxRing, 0, 10) == NetDevice::DescDone);
+  REQUIRE(a.Read(NetDevice::TxHeadOffset) == 1);
+  REQUIRE(a.Read(NetDevice::TxFramesOffset) == 1);
+  REQUIRE((a.Read(NetDevice::IrqStatusOffset) & NetDevice::IrqTx) != 0);
+
+  // Receiver: frame in RAM, length written back
+  REQUIRE(b.ReadField(RxRing, 0, 10) == NetDevice::DescDone);
+  REQUIRE(b.ReadField(RxRing, 0, 8) == 300);
+  REQUIRE(b.Read(NetDevice::RxHeadOffset) == 1);
+  REQUIRE(b.Read(NetDevice::RxFramesOffset) == 1);
+
+  Frame got(300);
+  REQUIRE(b.bus.ReadBlock(RxBuffers, got));
+  REQUIRE(got == sent);
+
+  SECTION("Frames for another MAC are filtered") {
+    MacAddress stranger{0x02, 0x00, 0x00, 0x00, 0x00, 0x09};
+    a.Send(MakeFrame(stranger, a.nic.GetMacAddress(), 64, 0));
+    Run(a, b);
+    REQUIRE(b.nic.GetRxFrames() == 1);
+  }
+
+  SECTION("Oversized TX descriptor is marked ERROR") {
+    a.WriteDescriptor(TxRing, 1, TxBuffers, MaxFrameSize + 1);
+    REQUIRE(a.nic.OnWrite(Regs + NetDevice::TxTailOffset, 2));
+    Run(a, b);
+    REQUIRE(a.ReadField(TxRing, 1, 10) ==
+            (NetDevice::DescDone | NetDevice::DescError));
+    REQUIRE(a.nic.GetTxFrames() == 1);
+  }
+}
+
+TEST_CASE("Network - Switch Floods Broadcast And Learns", "[network]") {
+  NetSwitch fabric;
+  Station a(fabric.AddPort(), 1);
+  Station b(fabric.AddPort(), 2);
+  Station c(fabric.AddPort(), 3);
+  REQUIRE(fabric.GetPortCount() == 3);
+  b.PostRxBuffers(4);
+  c.PostRxBuffers(4);
+
+  MacAddress broadcast{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+  a.Send(MakeFrame(broadcast, a.nic.GetMacAddress(), 60, 1));
+  for (std::size_t i = 0; i < 64; ++i) {
+    a.nic.OnTick();
+    b.nic.OnTick();
+    c.nic.OnTick();
+  }
+  REQUIRE(b.nic.GetRxFrames() == 1);
+  REQUIRE(c.nic.GetRxFrames() == 1);
+  REQUIRE(a.nic.GetRxFrames() == 0); // Never echoed to the sender
+
+  // The switch now knows where A lives: a reply goes to A's port only
+  a.PostRxBuffers(2);
+  c.Send(MakeFrame(a.nic.GetMacAddress(), c.nic.GetMacAddress(), 60, 2));
+  for (std::size_t i = 0; i < 64; ++i) {
+    a.nic.OnTick();
+    b.nic.OnTick();
+    c.nic.OnTick();
+  }
+  REQUIRE(a.nic.GetRxFrames() == 1);
+  REQUIRE(b.nic.GetRxFrames() == 1);
+}
+
+TEST_CASE("Network - Interrupt Moderation", "[network]") {
+  NetSwitch fabric;
+  Station a(fabric.AddPort(), 1);
+  Station b(fabric.AddPort(), 2);
+  Peripherals::PicDevice pic;
+  b.nic.ConnectPic(&pic);
+  REQUIRE(b.nic.OnWrite(Regs + NetDevice::IrqEnableOffset, NetDevice::IrqRx));
+
+  auto burst = [&](std::size_t frames) {
+    for (std::size_t i = 0; i < frames; ++i) {
+      b.PostRxBuffers(1);
+      a.Send(MakeFrame(b.nic.GetMacAddress(), a.nic.GetMacAddress(), 64,
+                       static_cast<Core::Byte>(i)));
+      Run(a, b, NetDevice::RxPollTicks);
+    }
+  };
+
+  SECTION("Without ITR every frame interrupts") {
+    burst(6);
+    REQUIRE(b.nic.GetRxFrames() == 6);
+    REQUIRE(b.nic.GetInterruptCount() == 6);
+  }
+
+  SECTION("ITR coalesces a burst") {
+    REQUIRE(b.nic.OnWrite(Regs + NetDevice::ItrOffset, 1000));
+    burst(6);
+    REQUIRE(b.nic.GetRxFrames() == 6);
+    REQUIRE(b.nic.GetInterruptCount() == 1);
+
+    // Once the window expires the pending cause is delivered
+    Run(a, b, 1000);
+    REQUIRE(b.nic.GetInterruptCount() == 2);
+  }
+
+  SECTION("RX threshold bypasses ITR") {
+    REQUIRE(b.nic.OnWrite(Regs + NetDevice::ItrOffset, 1000));
+    REQUIRE(b.nic.OnWrite(Regs + NetDevice::RxThresholdOffset, 2));
+    burst(6);
+    REQUIRE(b.nic.GetInterruptCount() == 3); // First, then every 2nd frame
+  }
+
+  SECTION("Acknowledged causes are not delivered late") {
+    REQUIRE(b.nic.OnWrite(Regs + NetDevice::ItrOffset, 1000));
+    burst(2);
+    REQUIRE(b.nic.OnWrite(Regs + NetDevice::IrqStatusOffset, 0xFFFFFFFF));
+    Run(a, b, 1000);
+    REQUIRE(b.nic.GetInterruptCount() == 1);
+  }
+}
+
+TEST_CASE("Network - Receive Without Buffers", "[network]") {
+  NetSwitch fabric;
+  Station a(fabric.AddPort(), 1);
+  Station b(fabric.AddPort(), 2);
+  REQUIRE(b.nic.OnWrite(Regs + NetDevice::IrqEnableOffset,
+                        NetDevice::IrqRxNoBuffer));
+
+  // Backlog holds frames until the guest posts buffers
+  a.Send(MakeFrame(b.nic.GetMacAddress(), a.nic.GetMacAddress(), 64, 0));
+  Run(a, b);
+  REQUIRE(b.nic.GetRxFrames() == 0);
+  b.PostRxBuffers(1);
+  Run(a, b, 1);
+  REQUIRE(b.nic.GetRxFrames() == 1);
+
+  // Past the backlog depth frames are dropped and counted
+  std::size_t flood = NetDevice::RxBacklogDepth + 5;
+  for (std::size_t i = 0; i < flood; ++i) {
+    a.Send(MakeFrame(b.nic.GetMacAddress(), a.nic.GetMacAddress(), 64,
+                     static_cast<Core::Byte>(i)));
+    Run(a, b, 2);
+  }
+  Run(a, b, NetDevice::RxBacklogDepth * NetDevice::RxPollTicks);
+  REQUIRE(b.nic.GetRxDropped() == 5);
+  REQUIRE(b.Read(NetDevice::RxDroppedOffset) == 5);
+  REQUIRE((b.Read(NetDevice::IrqStatusOffset) & NetDevice::IrqRxNoBuffer) !=
+          0);
+}
+
+TEST_CASE("Network - Unix Datagram Link", "[network]") {
+  auto dir = std::filesystem::temp_directory_path();
+  std::string tag = std::to_string(::getpid());
+  std::string pathA = (dir / ("aurelia_net_a_" + tag + ".sock")).string();
+  std::string pathB = (dir / ("aurelia_net_b_" + tag + ".sock")).string();
+
+  UnixDatagramBackend linkA;
+  UnixDatagramBackend linkB;
+  REQUIRE(linkA.Open(pathA, pathB));
+  REQUIRE(linkB.Open(pathB, pathA));
+  REQUIRE_FALSE(linkA.Open(pathA, pathB)); // Already open
+
+  Station a(&linkA, 1);
+  Station b(&linkB, 2);
+  b.PostRxBuffers(2);
+
+  Frame sent = MakeFrame(b.nic.GetMacAddress(), a.nic.GetMacAddress(), 1500,
+                         0x11);
+  a.Send(sent);
+  Run(a, b);
+
+  REQUIRE(b.nic.GetRxFrames() == 1);
+  Frame got(1500);
+  REQUIRE(b.bus.ReadBlock(RxBuffers, got));
+  REQUIRE(got == sent);
+}
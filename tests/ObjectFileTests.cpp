@@ -0,0 +1,172 @@
+/**
+ * Object File Tests.
+ *
+ * Verifies the AOB container round trip and rejection of malformed
+ * files, and what AssembleObject() leaves for the Linker: local text
+ * branches encoded in place, everything else as a relocation against a
+ * defined or undefined symbol.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Tools/Assembler/ObjectAssembler.hpp"
+#include "Tools/Assembler/ObjectFile.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::Tools::Assembler;
+using System::SectionKind;
+
+namespace {
+
+ObjectFile AssembleOrFail(const std::string &source) {
+  ObjectFile object;
+  std::string error;
+  bool assembled = AssembleObject(source, object, error);
+  INFO(error);
+  REQUIRE(assembled);
+  return object;
+}
+
+} // namespace
+
+TEST_CASE("Object - Serialize And Parse Round Trip", "[object]") {
+  ObjectFile out;
+  out.Text = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+  out.RoData = {'h', 'i', 0};
+  out.Data = {0xAA};
+  out.BssSize = 64;
+  out.Symbols = {{"start", SectionKind::Text, 4, true},
+                 {"msg", SectionKind::RoData, 0, false},
+                 {"buffer", SectionKind::Bss, 16, false},
+                 {"extern_fn", std::nullopt, 0, false}};
+  out.Relocations = {{0, RelocationKind::Branch, 3, 7},
+                     {4, RelocationKind::Absolute, 1, 9}};
+  out.Entry = 0;
+
+  std::vector<Core::Byte> file = out.Serialize();
+  REQUIRE(ObjectFile::HasMagic(file));
+
+  ObjectFile in;
+  std::string error;
+  REQUIRE(in.Parse(file, error));
+  CHECK(in.Text == out.Text);
+  CHECK(in.RoData == out.RoData);
+  CHECK(in.Data == out.Data);
+  CHECK(in.BssSize == 64);
+  CHECK(in.Entry == 0u);
+
+  REQUIRE(in.Symbols.size() == out.Symbols.size());
+  for (std::size_t i = 0; i < out.Symbols.size(); ++i) {
+    CHECK(in.Symbols[i].Name == out.Symbols[i].Name);
+    CHECK(in.Symbols[i].Section == out.Symbols[i].Section);
+    CHECK(in.Symbols[i].Offset == out.Symbols[i].Offset);
+    CHECK(in.Symbols[i].IsGlobal == out.Symbols[i].IsGlobal);
+  }
+
+  REQUIRE(in.Relocations.size() == 2);
+  CHECK(in.Relocations[0].Offset == 0);
+  CHECK(in.Relocations[0].Kind == RelocationKind::Branch);
+  CHECK(in.Relocations[0].Symbol == 3);
+  CHECK(in.Relocations[0].Line == 7);
+  CHECK(in.Relocations[1].Kind == RelocationKind::Absolute);
+}
+
+TEST_CASE("Object - Rejects Malformed Files", "[object]") {
+  ObjectFile good;
+  good.Text = {0, 0, 0, 0};
+  good.Symbols = {{"x", std::nullopt}};
+  good.Relocations = {{0, RelocationKind::Absolute, 0, 1}};
+  std::vector<Core::Byte> file = good.Serialize();
+
+  ObjectFile object;
+  std::string error;
+
+  SECTION("Truncated") {
+    file.resize(file.size() - 1);
+    CHECK_FALSE(object.Parse(file, error));
+  }
+
+  SECTION("Wrong magic") {
+    file[0] = 'X';
+    CHECK_FALSE(ObjectFile::HasMagic(file));
+    CHECK_FALSE(object.Parse(file, error));
+  }
+
+  SECTION("Relocation past the end of text") {
+    good.Relocations[0].Offset = 4;
+    CHECK_FALSE(object.Parse(good.Serialize(), error));
+  }
+
+  SECTION("Relocation against a missing symbol") {
+    good.Relocations[0].Symbol = 1;
+    CHECK_FALSE(object.Parse(good.Serialize(), error));
+  }
+
+  SECTION("Entry naming an undefined symbol") {
+    good.Entry = 0;
+    CHECK_FALSE(object.Parse(good.Serialize(), error));
+  }
+
+  SECTION("Symbol outside its section") {
+    good.Symbols.push_back({"y", SectionKind::Text, 8, false});
+    CHECK_FALSE(object.Parse(good.Serialize(), error));
+  }
+}
+
+TEST_CASE("Object - Only Position-Dependent Operands Relocate",
+          "[object]") {
+  ObjectFile object = AssembleOrFail(".global start\n"
+                                     "start: ADD R1, R1, #1\n"
+                                     "BNE start        ; local\n"
+                                     "BEQ elsewhere    ; import\n"
+                                     "MOV R2, buffer   ; absolute\n"
+                                     "HALT\n"
+                                     ".bss\n"
+                                     "buffer: .space #8\n");
+
+  REQUIRE(object.Text.size() == 5 * 4);
+  CHECK(object.BssSize == 8);
+
+  REQUIRE(object.Symbols.size() == 3);
+  CHECK(object.Symbols[0].Name == "start");
+  CHECK(object.Symbols[0].Section == SectionKind::Text);
+  CHECK(object.Symbols[0].IsGlobal);
+  CHECK(object.Symbols[1].Name == "buffer");
+  CHECK(object.Symbols[1].Section == SectionKind::Bss);
+  CHECK_FALSE(object.Symbols[1].IsGlobal);
+  CHECK(object.Symbols[2].Name == "elsewhere");
+  CHECK_FALSE(object.Symbols[2].Section.has_value());
+
+  REQUIRE(object.Relocations.size() == 2);
+  CHECK(object.Relocations[0].Offset == 8);
+  CHECK(object.Relocations[0].Kind == RelocationKind::Branch);
+  CHECK(object.Relocations[0].Symbol == 2);
+  CHECK(object.Relocations[0].Line == 4);
+  CHECK(object.Relocations[1].Offset == 12);
+  CHECK(object.Relocations[1].Kind == RelocationKind::Absolute);
+  CHECK(object.Relocations[1].Symbol == 1);
+
+  // BNE start: offset -4 already in the immediate field
+  std::uint32_t bne = static_cast<std::uint32_t>(object.Text[4]) |
+                      static_cast<std::uint32_t>(object.Text[5]) << 8;
+  CHECK((bne & 0x7FF) == 0x7FC);
+}
+
+TEST_CASE("Object - Errors Keep Their Line", "[object]") {
+  ObjectFile object;
+  std::string error;
+  CHECK_FALSE(AssembleObject("NOP\nADD R1,\n", object, error));
+  CHECK(error.find("Line 2") != std::string::npos);
+
+  std::string source = "far: NOP\n";
+  for (int i = 0; i < 300; ++i) {
+    source += "NOP\n";
+  }
+  source += "B far\n";
+  CHECK_FALSE(AssembleObject(source, object, error));
+  CHECK(error.find("[Line 302]") != std::string::npos);
+}
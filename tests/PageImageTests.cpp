@@ -0,0 +1,278 @@
+/**
+ * Compressed Page Image Tests.
+ *
+ * Verifies the LZ codec, the page image container and its validation,
+ * demand decoding in RAM, and NAND snapshots restored under a freshly
+ * mounted FTL.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Memory/RamDevice.hpp"
+#include "Storage/FTL/Ftl.hpp"
+#include "Storage/Image/Lz.hpp"
+#include "Storage/Image/PageImage.hpp"
+#include "Storage/Nand/NandChip.hpp"
+#include <algorithm>
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::Storage::Image;
+
+namespace {
+
+/**
+ * Deterministic, incompressible filler (xorshift).
+ */
+std::vector<Core::Byte> Noise(std::size_t size, std::uint32_t seed) {
+  std::vector<Core::Byte> out(size);
+  for (auto &b : out) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    b = static_cast<Core::Byte>(seed);
+  }
+  return out;
+}
+
+/**
+ * Text-like data with plenty of repeats at varying distances.
+ */
+std::vector<Core::Byte> Repetitive(std::size_t size) {
+  std::string words[] = {"load ", "store ", "branch ", "halt\n", "r0, r1 "};
+  std::vector<Core::Byte> out;
+  for (std::size_t i = 0; out.size() < size; i = i * 7 + 3) {
+    const std::string &w = words[i % 5];
+    out.insert(out.end(), w.begin(), w.end());
+  }
+  out.resize(size);
+  return out;
+}
+
+bool RoundTrips(const std::vector<Core::Byte> &input) {
+  std::vector<Core::Byte> packed;
+  LzCompress(input, packed);
+  std::vector<Core::Byte> output(input.size());
+  return LzDecompress(packed, output) && output == input;
+}
+
+} // namespace
+
+TEST_CASE("Lz - Round Trip", "[image]") {
+  for (std::size_t size : {0, 1, 12, 13, 17, 4096, 70000}) {
+    INFO("size " << size);
+    REQUIRE(RoundTrips(Noise(size, 7)));
+    REQUIRE(RoundTrips(Repetitive(size)));
+    REQUIRE(RoundTrips(std::vector<Core::Byte>(size, 0xAB)));
+  }
+
+  // Long runs use length extension bytes and overlapping matches
+  std::vector<Core::Byte> packed;
+  std::size_t stored = LzCompress(std::vector<Core::Byte>(4096, 0), packed);
+  REQUIRE(stored < 64);
+
+  packed.clear();
+  auto noise = Noise(4096, 99);
+  REQUIRE(LzCompress(noise, packed) <= LzCompressBound(noise.size()));
+}
+
+TEST_CASE("Lz - Rejects Corrupt Input", "[image]") {
+  auto input = Repetitive(4096);
+  std::vector<Core::Byte> packed;
+  LzCompress(input, packed);
+  std::vector<Core::Byte> output(input.size());
+
+  SECTION("Truncated") {
+    for (std::size_t cut : {std::size_t{1}, packed.size() / 2,
+                            packed.size() - 1}) {
+      std::span<const Core::Byte> part(packed.data(), cut);
+      REQUIRE_FALSE(LzDecompress(part, output));
+    }
+  }
+
+  SECTION("Wrong output size") {
+    std::vector<Core::Byte> small(input.size() - 1);
+    std::vector<Core::Byte> large(input.size() + 1);
+    REQUIRE_FALSE(LzDecompress(packed, small));
+    REQUIRE_FALSE(LzDecompress(packed, large));
+  }
+
+  SECTION("Offset before start of output") {
+    // Token: 1 literal, match 4; offset 2 reaches before byte 0
+    std::vector<Core::Byte> bad{0x10, 'x', 0x02, 0x00, 0x00};
+    std::vector<Core::Byte> out(5);
+    REQUIRE_FALSE(LzDecompress(bad, out));
+  }
+}
+
+TEST_CASE("Page Image - Pack And Read", "[image]") {
+  constexpr std::size_t PageSize = 4096;
+  std::vector<Core::Byte> raw;
+  auto text = Repetitive(PageSize);
+  auto noise = Noise(PageSize, 3);
+  raw.insert(raw.end(), PageSize, 0x00);           // Fill
+  raw.insert(raw.end(), text.begin(), text.end()); // Lz
+  raw.insert(raw.end(), noise.begin(), noise.end()); // Raw
+  raw.insert(raw.end(), 100, 0xFF);                // Short last page
+
+  auto file = PageImageWriter::Pack(raw, PageSize);
+  REQUIRE(PageImage::HasMagic(file));
+  REQUIRE(file.size() < raw.size() - PageSize);
+
+  PageImage image;
+  std::string error;
+  REQUIRE(image.Attach(file, error));
+  REQUIRE(image.GetLayout() == PageLayout::Flat);
+  REQUIRE(image.GetPageCount() == 4);
+  REQUIRE(image.GetLogicalSize() == raw.size());
+  REQUIRE(image.GetEncoding(0) == PageEncoding::Fill);
+  REQUIRE(image.GetEncoding(1) == PageEncoding::Lz);
+  REQUIRE(image.GetEncoding(2) == PageEncoding::Raw);
+  REQUIRE(image.GetPageBytes(3) == 100);
+
+  std::vector<Core::Byte> decoded(raw.size());
+  for (std::size_t i = 0; i < image.GetPageCount(); ++i) {
+    REQUIRE(image.ReadPage(i, std::span(decoded).subspan(i * PageSize)));
+  }
+  REQUIRE(decoded == raw);
+
+  std::vector<Core::Byte> page(PageSize);
+  REQUIRE_FALSE(image.ReadPage(4, page));
+
+  SECTION("Truncated index") {
+    std::span<const Core::Byte> part(file.data(), PageImage::HeaderSize + 20);
+    REQUIRE_FALSE(image.Attach(part, error));
+  }
+
+  SECTION("Payload past end of file") {
+    std::span<const Core::Byte> part(file.data(), file.size() - 1);
+    REQUIRE_FALSE(image.Attach(part, error));
+  }
+
+  SECTION("Bad encoding") {
+    file[PageImage::HeaderSize + PageImage::IndexEntrySize + 12] = 7;
+    REQUIRE_FALSE(image.Attach(file, error));
+  }
+}
+
+TEST_CASE("Page Image - RAM Decodes On Demand", "[image]") {
+  constexpr std::size_t PageSize = 4096;
+  constexpr std::size_t Pages = 16;
+  auto raw = Repetitive(PageSize * Pages);
+  auto file = PageImageWriter::Pack(raw, PageSize);
+
+  PageImage image;
+  std::string error;
+  REQUIRE(image.Attach(file, error));
+
+  Memory::RamDevice ram(PageSize * Pages * 2, 0);
+  std::vector<Core::Byte> dirty(PageSize * Pages * 2, 0xEE);
+  REQUIRE(ram.OnWriteBlock(0, dirty));
+  REQUIRE(ram.AttachImage(&image));
+  REQUIRE(ram.GetPendingImagePages() == Pages);
+
+  // A word read faults in exactly one page
+  Core::Data word = 0;
+  REQUIRE(ram.OnRead(5 * PageSize + 8, word));
+  Core::Data expected = 0;
+  std::memcpy(&expected, raw.data() + 5 * PageSize + 8, sizeof(expected));
+  REQUIRE(word == expected);
+  REQUIRE(ram.GetPendingImagePages() == Pages - 1);
+
+  // A block write covering whole pages replaces them undecoded; the
+  // partially covered edge pages are decoded first
+  std::vector<Core::Byte> patch(2 * PageSize + 200, 0x11);
+  REQUIRE(ram.OnWriteBlock(PageSize - 100, patch));
+  REQUIRE(ram.GetPendingImagePages() == Pages - 5);
+
+  std::vector<Core::Byte> edge(100);
+  REQUIRE(ram.OnReadBlock(PageSize - 200, edge));
+  REQUIRE(std::equal(edge.begin(), edge.end(),
+                     raw.begin() + PageSize - 200));
+
+  // Past the image, RAM keeps its own contents
+  REQUIRE(ram.OnRead(Pages * PageSize, word));
+  REQUIRE(word == 0xEEEEEEEEEEEEEEEE);
+
+  // Touching everything drops back to the plain path
+  std::vector<Core::Byte> all(PageSize * Pages);
+  REQUIRE(ram.OnReadBlock(0, all));
+  REQUIRE(ram.GetPendingImagePages() == 0);
+  REQUIRE(ram.GetImageErrorCount() == 0);
+  std::copy(patch.begin(), patch.end(), raw.begin() + PageSize - 100);
+  REQUIRE(all == raw);
+
+  SECTION("Image larger than RAM is refused") {
+    Memory::RamDevice small(PageSize, 0);
+    REQUIRE_FALSE(small.AttachImage(&image));
+  }
+}
+
+TEST_CASE("Page Image - NAND Snapshot Restore", "[image]") {
+  using namespace Aurelia::Storage;
+  constexpr std::size_t Blocks = 8;
+
+  std::vector<Core::Byte> snapshot;
+  {
+    Nand::NandChip nand(Blocks);
+    FTL::Ftl ftl(&nand, Blocks);
+    for (FTL::Lba lba = 0; lba < 20; ++lba) {
+      std::vector<Core::Byte> data(Nand::PageDataSize,
+                                   static_cast<Core::Byte>(0x40 + lba));
+      REQUIRE(ftl.Write(lba, data) == Nand::NandStatus::Success);
+    }
+    snapshot = nand.ExportImage();
+  }
+
+  // 8 blocks × 65 pages of 4 KB, mostly erased: stored as fills
+  REQUIRE(snapshot.size() < 64 * 1024);
+
+  PageImage image;
+  std::string error;
+  REQUIRE(image.Attach(snapshot, error));
+  REQUIRE(image.GetLayout() == PageLayout::NandBlocks);
+
+  Nand::NandChip restored(Blocks);
+  REQUIRE(restored.AttachImage(&image));
+  REQUIRE(restored.GetPendingImagePages() == Blocks * Nand::PagesPerBlock);
+
+  // Mounting reads OOB only: no data page is decoded
+  FTL::Ftl ftl(&restored, Blocks);
+  REQUIRE(restored.GetPendingImagePages() == Blocks * Nand::PagesPerBlock);
+
+  std::vector<Core::Byte> readBack(Nand::PageDataSize);
+  REQUIRE(ftl.Read(7, readBack) == Nand::NandStatus::Success);
+  REQUIRE(readBack[0] == 0x47);
+  REQUIRE(readBack[Nand::PageDataSize - 1] == 0x47);
+  REQUIRE(restored.GetPendingImagePages() ==
+          Blocks * Nand::PagesPerBlock - 1);
+
+  // New writes land on erased pages, which must read as erased first
+  std::vector<Core::Byte> data(Nand::PageDataSize, 0x99);
+  REQUIRE(ftl.Write(30, data) == Nand::NandStatus::Success);
+  REQUIRE(ftl.Read(30, readBack) == Nand::NandStatus::Success);
+  REQUIRE(readBack[0] == 0x99);
+  REQUIRE(ftl.Read(19, readBack) == Nand::NandStatus::Success);
+  REQUIRE(readBack[0] == 0x53);
+
+  // Re-exporting without touching the rest reproduces the same contents
+  PageImage again;
+  auto second = restored.ExportImage();
+  REQUIRE(again.Attach(second, error));
+  Nand::NandChip third(Blocks);
+  REQUIRE(third.AttachImage(&again));
+  FTL::Ftl ftl3(&third, Blocks);
+  REQUIRE(ftl3.Read(30, readBack) == Nand::NandStatus::Success);
+  REQUIRE(readBack[0] == 0x99);
+  REQUIRE(ftl3.Read(12, readBack) == Nand::NandStatus::Success);
+  REQUIRE(readBack[0] == 0x4C);
+
+  SECTION("Snapshot of another geometry is refused") {
+    Nand::NandChip other(Blocks + 1);
+    REQUIRE_FALSE(other.AttachImage(&image));
+  }
+}
@@ -1,7 +1,8 @@
 /**
  * Assembler Parser Verification Tests.
  *
- * Verifies the Parser correctly constructs the professional AST.
+ * Verifies the Parser correctly constructs the professional AST, and that
+ * the AST borrows the source instead of owning heap memory.
  *
  * Author: KleaSCM
  * Email: KleaSCM@gmail.com
@@ -10,6 +11,8 @@
 #include "Tools/Assembler/Lexer.hpp"
 #include "Tools/Assembler/Parser.hpp"
 #include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <type_traits>
 #include <variant>
 
 using namespace Aurelia::Tools::Assembler;
@@ -116,3 +119,101 @@ TEST_CASE("Parser - Error Reporting") {
   CHECK(parser.HasError());
   CHECK(parser.GetErrorMessage().find("Expected ']'") != std::string::npos);
 }
+
+TEST_CASE("Parser - Sections") {
+  std::string source = ".rodata\n"
+                       "msg: .string \"Hi\"\n"
+                       ".data\n"
+                       ".space #3\n"
+                       "count: .space #8\n"
+                       ".bss\n"
+                       ".space #16\n"
+                       "buffer: .space #4096\n"
+                       ".text\n"
+                       ".global main\n"
+                       ".entry main\n"
+                       "NOP\n"
+                       "main: HALT\n";
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+
+  Parser parser(tokens);
+  REQUIRE(parser.Parse());
+
+  CHECK(parser.GetRoDataSegment().size() == 3);
+  CHECK(parser.GetDataSegment().size() == 11);
+  CHECK(parser.GetBssSize() == 16 + 4096);
+  CHECK(parser.GetEntryLabel() == "main");
+
+  const auto &labels = parser.GetLabels();
+  REQUIRE(labels.size() == 4);
+  CHECK(labels[0].Section == Aurelia::System::SectionKind::RoData);
+  CHECK(labels[0].Offset == 0);
+  CHECK(labels[1].Section == Aurelia::System::SectionKind::Data);
+  CHECK(labels[1].Offset == 3);
+  CHECK(labels[2].Section == Aurelia::System::SectionKind::Bss);
+  CHECK(labels[2].Offset == 16);
+  CHECK(labels[3].Section == Aurelia::System::SectionKind::Text);
+  CHECK(labels[3].InstructionIndex == 1);
+  CHECK(labels[3].IsGlobal);
+  CHECK_FALSE(labels[0].IsGlobal);
+
+  SECTION("Invalid section use") {
+    for (const char *bad : {".bss\n.string \"x\"\n", ".space #4\n",
+                            ".global nowhere\n", "NOP\n.entry nowhere\n"}) {
+      std::string text(bad);
+      Lexer badLexer(text);
+      auto badTokens = badLexer.Tokenize();
+      Parser badParser(badTokens);
+      INFO(text);
+      CHECK_FALSE(badParser.Parse());
+    }
+  }
+}
+
+// Nothing per instruction to allocate, free or deep-copy
+static_assert(std::is_trivially_copyable_v<ParsedInstruction>);
+static_assert(std::is_trivially_copyable_v<Parser::LabelDef>);
+
+TEST_CASE("Parser - Inline Operand List") {
+  std::string source = "ADD R1, R2, R3, R4\n";
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+  Parser parser(tokens);
+  CHECK_FALSE(parser.Parse());
+  CHECK(parser.GetErrorMessage().find("Too many operands") !=
+        std::string::npos);
+
+  OperandList list = {Operand{OperandType::Register, RegisterOperand{1}}};
+  REQUIRE(list.size() == 1);
+  CHECK(list.push_back({OperandType::Immediate, ImmediateOperand{2}}));
+  CHECK(list.push_back({OperandType::Immediate, ImmediateOperand{3}}));
+  CHECK_FALSE(list.push_back({OperandType::Immediate, ImmediateOperand{4}}));
+  REQUIRE(list.size() == OperandList::Capacity);
+  CHECK(std::get<ImmediateOperand>(list[2].Value).Value == 3);
+}
+
+TEST_CASE("Parser - AST Borrows The Source") {
+  std::string source = "start:\nMOV R1, #1\nB start\n";
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+  Parser parser(tokens);
+  REQUIRE(parser.Parse());
+
+  const auto &instrs = parser.GetInstructions();
+  const auto &labels = parser.GetLabels();
+  REQUIRE(instrs.size() == 2);
+  REQUIRE(labels.size() == 1);
+
+  const char *begin = source.data();
+  const char *end = begin + source.size();
+  CHECK(labels[0].Name.data() == begin);
+  CHECK(instrs[0].Mnemonic == "MOV");
+  CHECK(instrs[0].Mnemonic.data() > begin);
+  CHECK(instrs[0].Mnemonic.data() < end);
+
+  const auto &ref = std::get<LabelOperand>(instrs[1].Operands[0].Value);
+  CHECK(ref.Name.data() > begin);
+  CHECK(ref.Name.data() < end);
+  CHECK(ref.Id == labels[0].Id);
+}
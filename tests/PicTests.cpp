@@ -0,0 +1,127 @@
+/**
+ * PIC Device Unit Tests.
+ *
+ * Verifies enable masking, priority resolution, claim/complete and
+ * vector table addressing.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Peripherals/PicDevice.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Aurelia;
+using namespace Aurelia::Peripherals;
+
+namespace {
+constexpr Core::Address PicBase = 0xE0002000;
+constexpr Core::Address IrqEnable = PicBase + 0x4;
+constexpr Core::Address Threshold = PicBase + 0x10;
+constexpr Core::Address Claim = PicBase + 0x14;
+constexpr Core::Address VectorBase = PicBase + 0x18;
+constexpr Core::Address Vector = PicBase + 0x1C;
+constexpr Core::Address InService = PicBase + 0x20;
+
+constexpr Core::Address Priority(std::uint8_t irq) {
+  return PicBase + 0x100 + irq * 4u;
+}
+} // namespace
+
+TEST_CASE("PIC - Reset Priorities Keep Fixed Ordering") {
+  PicDevice pic;
+  REQUIRE(pic.OnWrite(IrqEnable, 0xFFFF));
+
+  pic.RaiseIrq(PicDevice::IrqMouse);
+  pic.RaiseIrq(PicDevice::IrqTimer);
+
+  REQUIRE(pic.HasPendingIrq());
+  REQUIRE(pic.GetPendingIrqNumber() == PicDevice::IrqTimer);
+
+  Core::Data data = 0;
+  REQUIRE(pic.OnRead(Priority(5), data));
+  REQUIRE(data == PicDevice::DefaultPriority);
+}
+
+TEST_CASE("PIC - Programmable Priority And Threshold") {
+  PicDevice pic;
+  REQUIRE(pic.OnWrite(IrqEnable, 0xFFFF));
+  REQUIRE(pic.OnWrite(Priority(PicDevice::IrqMouse), 5));
+  REQUIRE(pic.OnWrite(Priority(PicDevice::IrqKeyboard), 5));
+  REQUIRE(pic.OnWrite(Priority(PicDevice::IrqTimer), 2));
+
+  pic.RaiseIrq(PicDevice::IrqTimer);
+  pic.RaiseIrq(PicDevice::IrqMouse);
+  pic.RaiseIrq(PicDevice::IrqKeyboard);
+
+  // Highest priority wins, lower line number breaks the tie
+  REQUIRE(pic.GetPendingIrqNumber() == PicDevice::IrqKeyboard);
+
+  // Threshold 5 masks everything at or below priority 5
+  REQUIRE(pic.OnWrite(Threshold, 5));
+  REQUIRE_FALSE(pic.HasPendingIrq());
+  REQUIRE(pic.GetPendingIrqNumber() == PicDevice::NoIrq);
+
+  // Threshold 2 lets the priority-5 lines through but not the timer
+  REQUIRE(pic.OnWrite(Threshold, 2));
+  REQUIRE(pic.GetPendingIrqNumber() == PicDevice::IrqKeyboard);
+
+  // Priority writes saturate at 7; priority 0 never interrupts
+  Core::Data data = 0;
+  REQUIRE(pic.OnWrite(Priority(0), 99));
+  REQUIRE(pic.OnRead(Priority(0), data));
+  REQUIRE(data == PicDevice::MaxPriority);
+  REQUIRE(pic.OnWrite(Priority(PicDevice::IrqKeyboard), 0));
+  REQUIRE(pic.GetPendingIrqNumber() == PicDevice::IrqMouse);
+}
+
+TEST_CASE("PIC - Claim And Complete") {
+  PicDevice pic;
+  Core::Data data = 0;
+  REQUIRE(pic.OnWrite(IrqEnable, 0xFFFF));
+
+  pic.RaiseIrq(PicDevice::IrqUartRx);
+  pic.RaiseIrq(PicDevice::IrqTimer);
+
+  REQUIRE(pic.OnRead(Claim, data));
+  REQUIRE(data == PicDevice::IrqUartRx);
+  REQUIRE(pic.OnRead(InService, data));
+  REQUIRE(data == 0x1);
+
+  // Level source still asserted: re-raised, but fenced while in service
+  pic.RaiseIrq(PicDevice::IrqUartRx);
+  REQUIRE(pic.OnRead(Claim, data));
+  REQUIRE(data == PicDevice::IrqTimer);
+
+  REQUIRE(pic.OnRead(Claim, data));
+  REQUIRE(data == PicDevice::NoIrq);
+
+  // Completing UART RX makes its re-raised request claimable again
+  REQUIRE(pic.OnWrite(Claim, PicDevice::IrqUartRx));
+  REQUIRE(pic.OnRead(Claim, data));
+  REQUIRE(data == PicDevice::IrqUartRx);
+
+  REQUIRE(pic.OnWrite(Claim, PicDevice::IrqUartRx));
+  REQUIRE(pic.OnWrite(Claim, PicDevice::IrqTimer));
+  REQUIRE(pic.OnRead(InService, data));
+  REQUIRE(data == 0);
+}
+
+TEST_CASE("PIC - Vector Table Addressing") {
+  PicDevice pic;
+  Core::Data data = 0;
+  REQUIRE(pic.OnWrite(IrqEnable, 0xFFFF));
+  REQUIRE(pic.OnWrite(VectorBase, 0x1003)); // Forced word alignment
+
+  // Nothing pending: spurious slot after the 16 line slots
+  REQUIRE(pic.OnRead(Vector, data));
+  REQUIRE(data == 0x1000 + 16 * 4);
+
+  pic.RaiseIrq(PicDevice::IrqKeyboard);
+  REQUIRE(pic.OnRead(Vector, data));
+  REQUIRE(data == 0x1000 + PicDevice::IrqKeyboard * 4);
+  REQUIRE(pic.GetVectorAddress() == data);
+
+  // Reading VECTOR did not claim
+  REQUIRE(pic.HasPendingIrq());
+}
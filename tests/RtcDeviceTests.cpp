@@ -0,0 +1,177 @@
+/**
+ * Real-Time Clock Device Unit Tests.
+ *
+ * Verifies the real, scaled and virtual time bases against a controlled
+ * host clock, continuity across mode changes, setting the wall clock,
+ * and the alarm interrupt.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Core/System.hpp"
+#include "Peripherals/RtcDevice.hpp"
+#include "System/MemoryMap.hpp"
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Aurelia;
+using namespace Aurelia::Peripherals;
+
+namespace {
+constexpr Core::Address Regs = System::RtcBase;
+constexpr std::int64_t BootWallNs = 1'700'000'000'000'000'000;
+
+/**
+ * Host clock that only moves when told to.
+ */
+struct FakeHostClock final : Host::IHostClock {
+  std::uint64_t Mono = 5'000'000'000; // Host booted a while ago
+  std::int64_t Wall = BootWallNs;
+
+  [[nodiscard]] std::uint64_t MonotonicNs() const override { return Mono; }
+  [[nodiscard]] std::int64_t WallNs() const override { return Wall; }
+
+  void Advance(std::uint64_t ns) {
+    Mono += ns;
+    Wall += static_cast<std::int64_t>(ns);
+  }
+};
+
+struct RtcFixture {
+  FakeHostClock host;
+  Core::System machine;
+  RtcDevice rtc;
+
+  RtcFixture() {
+    rtc.ConnectHostClock(&host);
+    rtc.ConnectClock(&machine.GetClock());
+  }
+
+  Core::Data Read(Core::Address offset) {
+    Core::Data value = 0;
+    REQUIRE(rtc.OnRead(Regs + offset, value));
+    return value;
+  }
+
+  void Write(Core::Address offset, Core::Data value) {
+    REQUIRE(rtc.OnWrite(Regs + offset, value));
+  }
+};
+} // namespace
+
+TEST_CASE("RTC - Real Time Follows Host", "[rtc]") {
+  RtcFixture f;
+  REQUIRE(f.Read(RtcDevice::IdOffset) == RtcDevice::DeviceId);
+  REQUIRE(f.Read(RtcDevice::ModeOffset) == 0);
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 0);
+  REQUIRE(f.Read(RtcDevice::WallOffset) ==
+          static_cast<Core::Data>(BootWallNs));
+
+  f.host.Advance(1'500'000);
+  f.machine.Run(10); // Cycles are irrelevant in real mode
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 1'500'000);
+  REQUIRE(f.rtc.GetWallNs() == BootWallNs + 1'500'000);
+}
+
+TEST_CASE("RTC - Scaled Time", "[rtc]") {
+  RtcFixture f;
+  f.host.Advance(1000);
+
+  f.Write(RtcDevice::ScaleOffset, RtcDevice::ScaleOne / 4);
+  f.Write(RtcDevice::ModeOffset, static_cast<Core::Data>(RtcMode::Scaled));
+  REQUIRE(f.rtc.GetMode() == RtcMode::Scaled);
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 1000);
+
+  f.host.Advance(4'000'000);
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 1000 + 1'000'000);
+
+  // Speeding up continues from the current reading
+  f.Write(RtcDevice::ScaleOffset, 3 * RtcDevice::ScaleOne);
+  f.host.Advance(1'000'000);
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 1000 + 1'000'000 + 3'000'000);
+
+  // A long span at a high rate does not overflow
+  f.host.Advance(30ull * 24 * 3600 * 1'000'000'000); // 30 days
+  REQUIRE(f.rtc.GetMonotonicNs() ==
+          4'001'000 + 90ull * 24 * 3600 * 1'000'000'000);
+
+  SECTION("Out-of-range scale is ignored") {
+    f.Write(RtcDevice::ScaleOffset, 1ull << 40);
+    REQUIRE(f.Read(RtcDevice::ScaleOffset) == 3 * RtcDevice::ScaleOne);
+  }
+}
+
+TEST_CASE("RTC - Virtual Time Counts Cycles", "[rtc]") {
+  RtcFixture f;
+  f.Write(RtcDevice::TickHzOffset, 1'000'000); // 1 µs per cycle
+  f.Write(RtcDevice::ModeOffset, static_cast<Core::Data>(RtcMode::Virtual));
+
+  f.host.Advance(1'000'000'000); // Host time no longer matters
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 0);
+
+  f.machine.Run(2500);
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 2'500'000);
+
+  // Back to real time: picks up exactly where virtual time left off
+  f.Write(RtcDevice::ModeOffset, static_cast<Core::Data>(RtcMode::Real));
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 2'500'000);
+  f.host.Advance(7);
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 2'500'007);
+
+  SECTION("Fractional rates") {
+    RtcFixture g;
+    g.rtc.SetTickHz(3);
+    g.rtc.SetMode(RtcMode::Virtual);
+    g.machine.Run(4);
+    REQUIRE(g.rtc.GetMonotonicNs() == 1'333'333'333);
+  }
+
+  SECTION("Zero TICK_HZ is ignored") {
+    f.Write(RtcDevice::TickHzOffset, 0);
+    REQUIRE(f.Read(RtcDevice::TickHzOffset) == 1'000'000);
+  }
+}
+
+TEST_CASE("RTC - Setting Wall Time", "[rtc]") {
+  RtcFixture f;
+  f.host.Advance(100);
+
+  constexpr Core::Data Set = 946'684'800'000'000'000; // 2000-01-01
+  f.Write(RtcDevice::WallOffset, Set);
+  REQUIRE(f.Read(RtcDevice::WallOffset) == Set);
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 100);
+
+  f.host.Advance(50);
+  REQUIRE(f.Read(RtcDevice::WallOffset) == Set + 50);
+
+  f.rtc.Reset();
+  REQUIRE(f.Read(RtcDevice::MonotonicOffset) == 0);
+  REQUIRE(f.rtc.GetWallNs() == BootWallNs + 150);
+}
+
+TEST_CASE("RTC - Alarm Interrupt", "[rtc]") {
+  RtcFixture f;
+  PicDevice pic;
+  pic.OnWrite(System::PicBase + 0x4, 0xFFFF);
+  f.rtc.ConnectPic(&pic);
+  f.rtc.SetTickHz(1'000'000);
+  f.rtc.SetMode(RtcMode::Virtual);
+
+  f.Write(RtcDevice::AlarmOffset, 100'000); // 100 cycles
+  f.Write(RtcDevice::ControlOffset, RtcDevice::ControlAlarmIrq);
+
+  f.machine.Run(99);
+  f.rtc.OnTick();
+  REQUIRE(f.Read(RtcDevice::StatusOffset) == 0);
+  REQUIRE_FALSE(pic.HasPendingIrq());
+
+  f.machine.Run(1);
+  f.rtc.OnTick();
+  REQUIRE(f.Read(RtcDevice::StatusOffset) == RtcDevice::StatusAlarm);
+  REQUIRE(f.Read(RtcDevice::AlarmOffset) == 0); // One-shot
+  REQUIRE(pic.HasPendingIrq());
+  REQUIRE(pic.GetPendingIrqNumber() == PicDevice::IrqRtc);
+
+  f.Write(RtcDevice::StatusOffset, RtcDevice::StatusAlarm);
+  REQUIRE(f.Read(RtcDevice::StatusOffset) == 0);
+}
@@ -0,0 +1,162 @@
+/**
+ * Streaming Assembler Tests.
+ *
+ * Verifies that line-by-line assembly produces exactly what the batch
+ * pipeline does (text, sections, symbols), that only forward and
+ * non-text references become fixups, and that errors keep their line.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Tools/Assembler/Encoder.hpp"
+#include "Tools/Assembler/Lexer.hpp"
+#include "Tools/Assembler/Parser.hpp"
+#include "Tools/Assembler/Resolver.hpp"
+#include "Tools/Assembler/StreamingAssembler.hpp"
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Aurelia::Tools::Assembler;
+
+namespace {
+
+constexpr Address Base = 0x100;
+
+const std::string SectionedSource = ".rodata\n"
+                                    "msg: .string \"Hi\"\n"
+                                    ".data\n"
+                                    "count: .space #8\n"
+                                    ".bss\n"
+                                    "buffer: .space #16\n"
+                                    ".text\n"
+                                    ".global main\n"
+                                    ".entry main\n"
+                                    "main: MOV R1, msg\n"
+                                    "MOV R2, count\n"
+                                    "loop: ADD R3, R3, #1\n"
+                                    "CMP R3, R2\n"
+                                    "BEQ done ; forward\n"
+                                    "B loop   ; backward\n"
+                                    "done:\n"
+                                    "MOV R4, buffer\n"
+                                    "HALT\n";
+
+struct BatchResult {
+  std::vector<std::uint8_t> Text;
+  std::vector<ResolvedSymbol> Symbols;
+  SectionLayout Layout;
+};
+
+BatchResult AssembleBatch(const std::string &source) {
+  Lexer lexer(source);
+  auto tokens = lexer.Tokenize();
+  Parser parser(tokens);
+  REQUIRE(parser.Parse());
+  auto instructions = parser.GetInstructions();
+  auto layout = SectionLayout::Sequential(
+      Base, instructions.size() * 4, parser.GetRoDataSegment().size(),
+      parser.GetDataSegment().size());
+  Resolver resolver(instructions, parser.GetLabels(), layout);
+  REQUIRE(resolver.Resolve());
+  Encoder encoder(instructions);
+  REQUIRE(encoder.Encode());
+  return {encoder.GetBinary(), resolver.GetSymbols(), layout};
+}
+
+} // namespace
+
+TEST_CASE("Streaming - Matches The Batch Pipeline") {
+  BatchResult batch = AssembleBatch(SectionedSource);
+
+  StreamingAssembler assembler(Base);
+  std::istringstream in(SectionedSource);
+  REQUIRE(assembler.Assemble(in));
+
+  CHECK(assembler.GetText() == batch.Text);
+  CHECK(assembler.GetLayout().RoDataBase == batch.Layout.RoDataBase);
+  CHECK(assembler.GetLayout().DataBase == batch.Layout.DataBase);
+  CHECK(assembler.GetLayout().BssBase == batch.Layout.BssBase);
+  CHECK(assembler.GetRoDataSegment().size() == 3);
+  CHECK(assembler.GetDataSegment().size() == 8);
+  CHECK(assembler.GetBssSize() == 16);
+  CHECK(assembler.GetEntryLabel() == "main");
+
+  REQUIRE(assembler.GetSymbols().size() == batch.Symbols.size());
+  for (std::size_t i = 0; i < batch.Symbols.size(); ++i) {
+    const ResolvedSymbol &symbol = assembler.GetSymbols()[i];
+    CHECK(symbol.Name == batch.Symbols[i].Name);
+    CHECK(symbol.Address == batch.Symbols[i].Address);
+    CHECK(symbol.IsGlobal == batch.Symbols[i].IsGlobal);
+  }
+}
+
+TEST_CASE("Streaming - Only Unknown Addresses Become Fixups") {
+  SECTION("Backward branches are encoded on the spot") {
+    StreamingAssembler assembler;
+    for (const char *line : {"top:", "ADD R1, R1, #1", "CMP R1, R2",
+                             "BNE top", "B top", "HALT"}) {
+      REQUIRE(assembler.AssembleLine(line));
+    }
+    REQUIRE(assembler.Finish());
+    CHECK(assembler.GetPeakFixups() == 0);
+  }
+
+  SECTION("Forward and data references wait for Finish()") {
+    StreamingAssembler assembler(Base);
+    std::istringstream in("B end\nMOV R1, value\nend: HALT\n"
+                          ".data\nvalue: .space #4\n");
+    REQUIRE(assembler.Assemble(in));
+    CHECK(assembler.GetPeakFixups() == 2);
+    CHECK(assembler.GetText() == AssembleBatch(in.str()).Text);
+  }
+}
+
+TEST_CASE("Streaming - Labels Survive The Line Buffer") {
+  // Every line goes through the same reused buffer, as from a file
+  StreamingAssembler assembler(Base);
+  std::string line;
+  for (const char *text :
+       {"B far_away_label", "NOP", "far_away_label: HALT"}) {
+    line = text;
+    REQUIRE(assembler.AssembleLine(line));
+    line.assign(line.size(), '#');
+  }
+  REQUIRE(assembler.Finish());
+  REQUIRE(assembler.GetSymbols().size() == 1);
+  CHECK(assembler.GetSymbols()[0].Name == "far_away_label");
+  CHECK(assembler.GetText() ==
+        AssembleBatch("B far_away_label\nNOP\nfar_away_label: HALT\n").Text);
+}
+
+TEST_CASE("Streaming - Errors Keep Their Line") {
+  SECTION("Syntax error stops at once") {
+    StreamingAssembler assembler;
+    std::istringstream in("NOP\nNOP\nADD R1,\nHALT\n");
+    CHECK_FALSE(assembler.Assemble(in));
+    CHECK(assembler.GetErrorMessage().find("[Line 3]") != std::string::npos);
+    CHECK_FALSE(assembler.AssembleLine("NOP"));
+  }
+
+  SECTION("Undefined label is found at Finish()") {
+    StreamingAssembler assembler;
+    std::istringstream in("NOP\nB nowhere\nHALT\n");
+    CHECK_FALSE(assembler.Assemble(in));
+    CHECK(assembler.GetErrorMessage() == "[Line 2] Undefined Symbol: nowhere");
+  }
+
+  SECTION("Forward branch out of range") {
+    std::string source = "B end\n";
+    for (int i = 0; i < 300; ++i) {
+      source += "NOP\n";
+    }
+    source += "end: HALT\n";
+    StreamingAssembler assembler;
+    std::istringstream in(source);
+    CHECK_FALSE(assembler.Assemble(in));
+    CHECK(assembler.GetErrorMessage().find("out of range") !=
+          std::string::npos);
+  }
+}
@@ -17,7 +17,10 @@
 #include "Tools/Assembler/Lexer.hpp"
 #include "Tools/Assembler/Parser.hpp"
 #include "Tools/Assembler/Resolver.hpp"
+#include <array>
 #include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
 #include <sstream>
 
@@ -176,9 +179,9 @@ TEST_CASE("System - Integration: SSD Read/Write (Persistence)") {
    */
   Bus::Bus bus;
   Memory::RamDevice ram(RamSize, 0);
-  // Mock SSD at StorageControllerBase (0xE0000000)
+  // Mock SSD at SsdBufferBase (0xE0000000)
   Memory::RamDevice ssd(0x1000, 0);
-  ssd.SetBaseAddress(StorageControllerBase);
+  ssd.SetBaseAddress(SsdBufferBase);
 
   bus.ConnectDevice(&ram);
   bus.ConnectDevice(&ssd);
@@ -218,7 +221,7 @@ TEST_CASE("System - Integration: SSD Read/Write (Persistence)") {
 
   // Verify "Persistence" in Device
   Core::Data val = 0;
-  ssd.OnRead(StorageControllerBase, val);
+  ssd.OnRead(SsdBufferBase, val);
   REQUIRE(val == 123);
 }
 
@@ -307,6 +310,61 @@ TEST_CASE("Loader - Address Out of Range") {
   REQUIRE(!loader.GetErrorMessage().empty());
 }
 
+TEST_CASE("Loader - Binary File Bulk Load") {
+  Bus::Bus bus;
+  Memory::RamDevice ram(1024 * 1024, 0);
+  bus.ConnectDevice(&ram);
+  Loader loader(bus);
+
+  // Odd size, so the tail is not a whole 64-bit word
+  std::vector<std::uint8_t> image(256 * 1024 + 3);
+  for (std::size_t i = 0; i < image.size(); ++i) {
+    image[i] = static_cast<std::uint8_t>(i * 7 + (i >> 8));
+  }
+  auto path = std::filesystem::temp_directory_path() / "aurelia_loader.bin";
+  std::ofstream(path, std::ios::binary)
+      .write(reinterpret_cast<const char *>(image.data()),
+             static_cast<std::streamsize>(image.size()));
+
+  REQUIRE(loader.LoadBinary(path.string(), 0x1000));
+  REQUIRE(loader.GetErrorMessage().empty());
+
+  std::vector<std::uint8_t> loaded(image.size() + 1);
+  REQUIRE(bus.ReadBlock(0x1000, loaded));
+  REQUIRE(std::equal(image.begin(), image.end(), loaded.begin()));
+  REQUIRE(loaded.back() == 0); // Nothing written past the image
+
+  SECTION("Empty file is rejected") {
+    std::ofstream(path, std::ios::binary | std::ios::trunc).flush();
+    REQUIRE_FALSE(loader.LoadBinary(path.string(), 0x1000));
+  }
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Loader - Range Validation") {
+  Bus::Bus bus;
+  constexpr std::size_t Size = 64 * 1024;
+  Memory::RamDevice ram(Size, 0);
+  bus.ConnectDevice(&ram);
+  Loader loader(bus);
+  std::array<std::uint8_t, 16> data{};
+  data.fill(0xAB);
+
+  // Crosses the end of the RAM region into MMIO space
+  REQUIRE_FALSE(loader.LoadData(data, RamEnd - 7));
+  REQUIRE(!loader.GetErrorMessage().empty());
+
+  // Inside the RAM region but past the connected RAM device: all or nothing
+  REQUIRE_FALSE(loader.LoadData(data, Size - 8));
+  std::array<std::uint8_t, 8> tail{};
+  REQUIRE(bus.ReadBlock(Size - 8, tail));
+  REQUIRE(tail == std::array<std::uint8_t, 8>{});
+
+  // Exactly filling the device succeeds
+  REQUIRE(loader.LoadData(data, Size - data.size()));
+}
+
 TEST_CASE("MemoryMap - Address Validation") {
   // RAM addresses
   REQUIRE(IsRamAddress(RamBase));
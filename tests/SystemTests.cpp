@@ -42,3 +42,61 @@ TEST_CASE("System - SystemRun") {
   CHECK(dev1.TickCount == 10);
   CHECK(dev2.TickCount == 10);
 }
+
+TEST_CASE("System - TickDividers") {
+  System sys;
+  MockDevice fast;
+  MockDevice timer;
+  MockDevice slow;
+
+  sys.AddDevice(&fast);
+  sys.AddDevice(&timer, 4);
+  sys.AddDevice(&slow, 1024);
+
+  sys.Run(4096 + 3);
+
+  CHECK(fast.TickCount == 4099);
+  CHECK(timer.TickCount == 1024);
+  CHECK(slow.TickCount == 4);
+}
+
+TEST_CASE("System - RunUntil") {
+  System sys;
+  MockDevice dev;
+  sys.AddDevice(&dev);
+
+  TickCount executed = sys.RunUntil([&dev] { return dev.TickCount == 7; }, 100);
+  CHECK(executed == 7);
+  CHECK(sys.GetClock().GetTotalTicks() == 7);
+
+  // Safety limit stops a predicate that never holds
+  executed = sys.RunUntil([] { return false; }, 5);
+  CHECK(executed == 5);
+  CHECK(dev.TickCount == 12);
+}
+
+TEST_CASE("System - RunSlice") {
+  System sys;
+  MockDevice dev;
+  MockDevice timer;
+  sys.AddDevice(&dev);
+  sys.AddDevice(&timer, 4);
+
+  auto done = [&dev] { return dev.TickCount == 25; };
+
+  // Slices that do not divide the run still resume exactly
+  CHECK(sys.RunSlice(done, 10) == RunExit::Yielded);
+  CHECK(sys.RunSlice(done, 10) == RunExit::Yielded);
+  CHECK(timer.TickCount == 5);
+  CHECK(sys.RunSlice(done, 10) == RunExit::Done);
+  CHECK(sys.GetClock().GetTotalTicks() == 25);
+  CHECK(timer.TickCount == 6);
+
+  // The limit is on total cycles, not per slice
+  sys.SetCycleLimit(32);
+  CHECK(sys.RunSlice([] { return false; }, 5) == RunExit::Yielded);
+  CHECK(sys.RunSlice([] { return false; }, 5) == RunExit::LimitReached);
+  CHECK(sys.GetClock().GetTotalTicks() == 32);
+  CHECK(sys.RunSlice([] { return false; }, 5) == RunExit::LimitReached);
+  CHECK(sys.GetClock().GetTotalTicks() == 32);
+}
@@ -0,0 +1,120 @@
+/**
+ * Thread Pool Tests.
+ *
+ * Verifies that every submitted task runs exactly once, that tasks may
+ * submit further tasks, that idle workers steal from a busy one, and
+ * that deferred continuations take turns round-robin.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Host/ThreadPool.hpp"
+#include <atomic>
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace Aurelia::Host;
+
+TEST_CASE("ThreadPool - Runs Every Task Once", "[threadpool]") {
+  ThreadPool pool(4);
+  REQUIRE(pool.GetThreadCount() == 4);
+
+  std::vector<std::atomic<int>> hits(1000);
+  for (std::size_t i = 0; i < hits.size(); ++i) {
+    pool.Submit([&hits, i] { hits[i].fetch_add(1); });
+  }
+  pool.Wait();
+
+  for (const auto &hit : hits) {
+    REQUIRE(hit.load() == 1);
+  }
+
+  SECTION("Pool is reusable after Wait") {
+    std::atomic<int> count{0};
+    for (int i = 0; i < 10; ++i) {
+      pool.Submit([&count] { count.fetch_add(1); });
+    }
+    pool.Wait();
+    REQUIRE(count.load() == 10);
+  }
+}
+
+TEST_CASE("ThreadPool - Nested Submit", "[threadpool]") {
+  ThreadPool pool(3);
+  std::atomic<int> leaves{0};
+
+  // A task fanning out into more tasks, two levels deep
+  pool.Submit([&pool, &leaves] {
+    for (int i = 0; i < 8; ++i) {
+      pool.Submit([&pool, &leaves] {
+        for (int j = 0; j < 8; ++j) {
+          pool.Submit([&leaves] { leaves.fetch_add(1); });
+        }
+      });
+    }
+  });
+  pool.Wait();
+
+  REQUIRE(leaves.load() == 64);
+}
+
+TEST_CASE("ThreadPool - Idle Workers Steal", "[threadpool]") {
+  ThreadPool pool(4);
+  std::atomic<int> done{0};
+
+  // Everything lands on one worker's deque; the others can only steal
+  pool.Submit([&pool, &done] {
+    for (int i = 0; i < 64; ++i) {
+      pool.Submit([&done] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        done.fetch_add(1);
+      });
+    }
+  });
+  pool.Wait();
+
+  REQUIRE(done.load() == 64);
+  REQUIRE(pool.GetStealCount() > 0);
+}
+
+TEST_CASE("ThreadPool - Defer Round Robin", "[threadpool]") {
+  ThreadPool pool(1);
+  std::mutex mutex;
+  std::string order;
+
+  // Three sliced tasks of three slices each, all on one worker
+  std::function<void(char, int)> slice = [&](char name, int left) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      order += name;
+    }
+    if (left > 1) {
+      pool.Defer([&slice, name, left] { slice(name, left - 1); });
+    }
+  };
+  pool.Submit([&] {
+    for (char name : {'a', 'b', 'c'}) {
+      pool.Submit([&slice, name] { slice(name, 3); });
+    }
+  });
+  pool.Wait();
+
+  // Newest first on the first pass, then strict turns
+  REQUIRE(order == "cbacbacba");
+}
+
+TEST_CASE("ThreadPool - Destructor Drains Queue", "[threadpool]") {
+  std::atomic<int> count{0};
+  {
+    ThreadPool pool(2);
+    for (int i = 0; i < 100; ++i) {
+      pool.Submit([&count] { count.fetch_add(1); });
+    }
+  }
+  REQUIRE(count.load() == 100);
+}
@@ -55,6 +55,9 @@ TEST_CASE("UART - Transmit Data") {
   // Write 'H' to DATA register
   REQUIRE(uart.OnWrite(0xE0001000, 0x48));
 
+  // Output is batched host-side; drain before inspecting
+  uart.FlushTx();
+
   // Restore cout
   std::cout.rdbuf(oldCoutBuf);
 
@@ -196,3 +199,229 @@ TEST_CASE("UART - Reserved Register Access") {
   // Write to undefined offset (should succeed silently)
   REQUIRE(uart.OnWrite(0xE0001200, 0xFF));
 }
+
+TEST_CASE("UART - TX Batching Flushes On Newline") {
+  UartDevice uart;
+  RingSink sink;
+  uart.SetSink(&sink);
+
+  // Partial line stays buffered
+  REQUIRE(uart.OnWrite(0xE0001000, 'O'));
+  REQUIRE(uart.OnWrite(0xE0001000, 'K'));
+  REQUIRE(sink.Contents().empty());
+
+  // Newline drains the whole line in a single batch
+  REQUIRE(uart.OnWrite(0xE0001000, '\n'));
+  REQUIRE(sink.Contents() == "OK\n");
+  REQUIRE(sink.GetWriteCount() == 1);
+  REQUIRE(uart.GetTxFlushCount() == 1);
+}
+
+TEST_CASE("UART - TX Batching Threshold And Deadline") {
+  UartDevice uart;
+  RingSink sink;
+  uart.SetSink(&sink);
+
+  UartDevice::TxBatchConfig config;
+  config.Threshold = 4;
+  config.FlushOnNewline = false;
+  config.DeadlineTicks = 10;
+  uart.ConfigureTxBatching(config);
+
+  // Threshold: 4th byte triggers the flush
+  for (char c : std::string("ABCD")) {
+    REQUIRE(uart.OnWrite(0xE0001000, static_cast<Core::Data>(c)));
+  }
+  REQUIRE(sink.Contents() == "ABCD");
+
+  // Deadline: a lone byte is flushed after DeadlineTicks ticks
+  REQUIRE(uart.OnWrite(0xE0001000, 'E'));
+  for (int i = 0; i < 9; ++i) {
+    uart.OnTick();
+  }
+  REQUIRE(sink.Contents() == "ABCD");
+  uart.OnTick();
+  REQUIRE(sink.Contents() == "ABCDE");
+  REQUIRE(sink.GetWriteCount() == 2);
+}
+
+TEST_CASE("UART - RingSink Keeps Most Recent Bytes") {
+  RingSink sink(4);
+  const std::uint8_t bytes[] = {'1', '2', '3', '4', '5', '6'};
+  sink.Write(bytes);
+  REQUIRE(sink.Contents() == "3456");
+
+  sink.Clear();
+  REQUIRE(sink.Contents().empty());
+}
+
+TEST_CASE("UART - TX FIFO Paced By Baud Divisor") {
+  RingSink sink; // Must outlive the UART, which flushes on destruction
+  UartDevice uart;
+  uart.SetSink(&sink);
+
+  UartDevice::TxBatchConfig config;
+  config.Threshold = 1; // Observe every byte as it leaves the wire
+  uart.ConfigureTxBatching(config);
+
+  Core::Data data;
+  REQUIRE(uart.OnWrite(0xE0001010, 2)); // BAUD_DIV: 20 ticks per frame
+
+  for (char c : std::string("ABC")) {
+    REQUIRE(uart.OnWrite(0xE0001000, static_cast<Core::Data>(c)));
+  }
+
+  // 'A' is in the shift register, 'B' and 'C' wait in the FIFO
+  REQUIRE(uart.OnRead(0xE0001018, data)); // TX_LEVEL
+  REQUIRE(data == 2);
+  REQUIRE(uart.OnRead(0xE0001004, data));
+  REQUIRE((data & 0x8) == 0); // TX_EMPTY clear
+
+  for (int i = 0; i < 19; ++i) {
+    uart.OnTick();
+  }
+  REQUIRE(sink.Contents().empty());
+  uart.OnTick();
+  REQUIRE(sink.Contents() == "A");
+
+  for (int i = 0; i < 40; ++i) {
+    uart.OnTick();
+  }
+  REQUIRE(sink.Contents() == "ABC");
+  REQUIRE(uart.OnRead(0xE0001004, data));
+  REQUIRE((data & 0x8) == 0x8); // TX_EMPTY set
+}
+
+TEST_CASE("UART - TX FIFO Full Clears TX_READY") {
+  RingSink sink; // Must outlive the UART, which flushes on destruction
+  UartDevice uart;
+  uart.SetSink(&sink);
+  Core::Data data;
+
+  REQUIRE(uart.OnWrite(0xE0001010, 100)); // Slow line
+
+  // One byte in the shifter plus a full 16-byte FIFO
+  for (std::size_t i = 0; i < UartDevice::FifoDepth + 1; ++i) {
+    REQUIRE(uart.OnWrite(0xE0001000, 'x'));
+  }
+  REQUIRE(uart.OnRead(0xE0001004, data));
+  REQUIRE((data & 0x1) == 0); // TX_READY clear
+
+  // Writing while full loses the byte
+  REQUIRE(uart.OnWrite(0xE0001000, 'y'));
+  REQUIRE(uart.OnRead(0xE0001018, data));
+  REQUIRE(data == UartDevice::FifoDepth);
+
+  // TX IRQ (THRE) only once the FIFO has drained
+  REQUIRE(uart.OnWrite(0xE0001008, 0x04));
+  REQUIRE_FALSE(uart.HasIrq());
+  for (std::size_t i = 0; i < UartDevice::FifoDepth * 1000; ++i) {
+    uart.OnTick();
+  }
+  REQUIRE(uart.HasIrq());
+}
+
+TEST_CASE("UART - RX Trigger Level Batches Interrupts") {
+  Core::Data data;
+
+  auto receiveBurst = [&data](UartDevice &uart, int count) {
+    for (int i = 0; i < count; ++i) {
+      uart.SimulateReceive(static_cast<std::uint8_t>('0' + i));
+      // Interrupt handler drains the FIFO whenever the IRQ is raised
+      if (uart.HasIrq()) {
+        while (uart.OnRead(0xE0001004, data) && (data & 0x2)) {
+          uart.OnRead(0xE0001000, data);
+        }
+      }
+    }
+  };
+
+  // Reset configuration: one interrupt per byte
+  UartDevice perByte;
+  REQUIRE(perByte.OnWrite(0xE0001008, 0x08));
+  receiveBurst(perByte, 16);
+  REQUIRE(perByte.GetIrqAssertCount() == 16);
+
+  // Trigger level 8 (FIFO_CTRL bits [7:6] = 10)
+  UartDevice batched;
+  REQUIRE(batched.OnWrite(0xE000100C, 0x81));
+  REQUIRE(batched.OnWrite(0xE0001008, 0x08));
+
+  for (int i = 0; i < 7; ++i) {
+    batched.SimulateReceive('a');
+  }
+  REQUIRE_FALSE(batched.HasIrq());
+  batched.SimulateReceive('a');
+  REQUIRE(batched.HasIrq());
+  REQUIRE(batched.OnRead(0xE0001004, data));
+  REQUIRE((data & 0x10) == 0x10); // RX_TRIG
+
+  REQUIRE(batched.OnWrite(0xE000100C, 0x83)); // RX_RESET
+  REQUIRE(batched.OnRead(0xE0001014, data));
+  REQUIRE(data == 0);
+  REQUIRE(batched.OnRead(0xE000100C, data));
+  REQUIRE(data == 0x81); // Reset bit self-clears
+
+  receiveBurst(batched, 16);
+  REQUIRE(batched.GetIrqAssertCount() == 3);
+}
+
+TEST_CASE("UART - RX Overrun Latches Until STATUS Read") {
+  UartDevice uart;
+  Core::Data data;
+
+  for (std::size_t i = 0; i < UartDevice::FifoDepth + 2; ++i) {
+    uart.SimulateReceive(static_cast<std::uint8_t>(i));
+  }
+  REQUIRE(uart.GetRxOverrunCount() == 2);
+
+  REQUIRE(uart.OnRead(0xE0001004, data));
+  REQUIRE((data & 0x4) == 0x4); // OVERRUN
+  REQUIRE(uart.OnRead(0xE0001004, data));
+  REQUIRE((data & 0x4) == 0); // Cleared by previous read
+
+  // FIFO contents survive; the late bytes are the ones lost
+  REQUIRE(uart.OnRead(0xE0001000, data));
+  REQUIRE(data == 0);
+  REQUIRE(uart.OnRead(0xE0001014, data));
+  REQUIRE(data == UartDevice::FifoDepth - 1);
+}
+
+TEST_CASE("UART - RX Character Timeout") {
+  UartDevice uart;
+  Core::Data data;
+
+  REQUIRE(uart.OnWrite(0xE0001010, 1));    // 10 ticks per frame
+  REQUIRE(uart.OnWrite(0xE000100C, 0x41)); // Trigger level 4
+  REQUIRE(uart.OnWrite(0xE0001008, 0x08));
+
+  uart.SimulateReceive('h');
+  uart.SimulateReceive('i');
+
+  // Bytes cross the wire one frame apart
+  for (int i = 0; i < 10; ++i) {
+    uart.OnTick();
+  }
+  REQUIRE(uart.OnRead(0xE0001014, data));
+  REQUIRE(data == 1);
+  for (int i = 0; i < 10; ++i) {
+    uart.OnTick();
+  }
+  REQUIRE(uart.OnRead(0xE0001014, data));
+  REQUIRE(data == 2);
+
+  // Below trigger: quiet until 4 character times pass with no activity
+  for (int i = 0; i < 39; ++i) {
+    uart.OnTick();
+  }
+  REQUIRE_FALSE(uart.HasIrq());
+  uart.OnTick();
+  REQUIRE(uart.HasIrq());
+  REQUIRE(uart.OnRead(0xE0001004, data));
+  REQUIRE((data & 0x20) == 0x20); // RX_TIMEOUT
+
+  // Reading DATA clears the timeout
+  REQUIRE(uart.OnRead(0xE0001000, data));
+  REQUIRE(data == 'h');
+  REQUIRE_FALSE(uart.HasIrq());
+}
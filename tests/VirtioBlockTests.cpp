@@ -0,0 +1,293 @@
+/**
+ * Virtio Block Device Unit Tests.
+ *
+ * Verifies the virtio-mmio registers, read/write/flush requests against
+ * a host image, the used ring and completion interrupts, error
+ * statuses for out-of-range and read-only accesses, and completion
+ * timing with asynchronous host I/O.
+ *
+ * Author: KleaSCM
+ * Email: KleaSCM@gmail.com
+ */
+
+#include "Bus/Bus.hpp"
+#include "Memory/RamDevice.hpp"
+#include "Storage/Virtio/VirtioBlockDevice.hpp"
+#include "System/MemoryMap.hpp"
+#include <array>
+#include <catch2/catch_test_macros.hpp>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace Aurelia;
+using namespace Aurelia::Storage::Virtio;
+
+namespace {
+constexpr Core::Address Regs = System::VirtioBlockBase;
+constexpr std::uint32_t QueueSize = 8;
+constexpr std::uint64_t ImageSectors = 64;
+
+constexpr Core::Address DescTable = 0x1000;
+constexpr Core::Address AvailRing = 0x2000;
+constexpr Core::Address UsedRing = 0x3000;
+constexpr Core::Address HeaderAddr = 0x4000;
+constexpr Core::Address StatusAddr = 0x5000;
+constexpr Core::Address DataAddr = 0x10000;
+
+Core::Byte ImageByte(std::size_t i) { return static_cast<Core::Byte>(i * 3); }
+
+struct VirtioFixture {
+  Bus::Bus bus;
+  Memory::RamDevice ram{1024 * 1024, 0};
+  Host::AsyncIo aio{16}; // Declared first so it outlives the device
+  VirtioBlockDevice vblk;
+  Peripherals::PicDevice pic;
+  std::filesystem::path image;
+  std::uint16_t availIdx = 0;
+
+  explicit VirtioFixture(bool readOnly = false) {
+    image = std::filesystem::temp_directory_path() / "aurelia_vblk_test.img";
+    std::vector<char> contents(ImageSectors * VirtioBlockDevice::SectorSize);
+    for (std::size_t i = 0; i < contents.size(); ++i) {
+      contents[i] = static_cast<char>(ImageByte(i));
+    }
+    std::ofstream(image, std::ios::binary)
+        .write(contents.data(), static_cast<std::streamsize>(contents.size()));
+
+    bus.ConnectDevice(&ram);
+    bus.ConnectDevice(&vblk);
+    vblk.ConnectBus(&bus);
+    vblk.ConnectPic(&pic);
+    pic.OnWrite(System::PicBase + 0x4, 0xFFFF);
+    REQUIRE(vblk.OpenImage(image.string(), readOnly));
+
+    REQUIRE(vblk.OnWrite(Regs + VirtioBlockDevice::QueueNumOffset, QueueSize));
+    REQUIRE(vblk.OnWrite(Regs + VirtioBlockDevice::QueueDescLowOffset,
+                         DescTable));
+    REQUIRE(vblk.OnWrite(Regs + VirtioBlockDevice::QueueDriverLowOffset,
+                         AvailRing));
+    REQUIRE(vblk.OnWrite(Regs + VirtioBlockDevice::QueueDeviceLowOffset,
+                         UsedRing));
+    REQUIRE(vblk.OnWrite(Regs + VirtioBlockDevice::QueueReadyOffset, 1));
+  }
+
+  ~VirtioFixture() { std::filesystem::remove(image); }
+
+  void WriteDescriptor(std::uint16_t index, Core::Address addr,
+                       std::uint32_t len, std::uint16_t flags,
+                       std::uint16_t next) {
+    std::array<Core::Byte, 16> raw{};
+    for (std::size_t i = 0; i < 8; ++i) {
+      raw[i] = static_cast<Core::Byte>(addr >> (8 * i));
+    }
+    for (std::size_t i = 0; i < 4; ++i) {
+      raw[8 + i] = static_cast<Core::Byte>(len >> (8 * i));
+    }
+    raw[12] = static_cast<Core::Byte>(flags);
+    raw[14] = static_cast<Core::Byte>(next);
+    REQUIRE(bus.WriteBlock(DescTable + 16u * index, raw));
+  }
+
+  /**
+   * @brief Build header/data/status chain at descriptors 0-2, publish it
+   * and ring the doorbell.
+   */
+  void Post(BlockRequestType type, std::uint64_t sector,
+            std::uint32_t dataLen, bool deviceWrites) {
+    std::array<Core::Byte, 16> header{};
+    header[0] = static_cast<Core::Byte>(type);
+    for (std::size_t i = 0; i < 8; ++i) {
+      header[8 + i] = static_cast<Core::Byte>(sector >> (8 * i));
+    }
+    REQUIRE(bus.WriteBlock(HeaderAddr, header));
+
+    auto dataFlags = static_cast<std::uint16_t>(
+        VirtioBlockDevice::DescNext |
+        (deviceWrites ? VirtioBlockDevice::DescWrite : 0));
+    if (dataLen != 0) {
+      WriteDescriptor(0, HeaderAddr, 16, VirtioBlockDevice::DescNext, 1);
+      WriteDescriptor(1, DataAddr, dataLen, dataFlags, 2);
+    } else {
+      WriteDescriptor(0, HeaderAddr, 16, VirtioBlockDevice::DescNext, 2);
+    }
+    WriteDescriptor(2, StatusAddr, 1, VirtioBlockDevice::DescWrite, 0);
+
+    std::array<Core::Byte, 2> head{0, 0};
+    REQUIRE(bus.WriteBlock(AvailRing + 4 + 2u * (availIdx % QueueSize), head));
+    availIdx++;
+    std::array<Core::Byte, 2> idx{static_cast<Core::Byte>(availIdx),
+                                  static_cast<Core::Byte>(availIdx >> 8)};
+    REQUIRE(bus.WriteBlock(AvailRing + 2, idx));
+
+    std::array<Core::Byte, 1> status{0xFF};
+    REQUIRE(bus.WriteBlock(StatusAddr, status));
+    REQUIRE(vblk.OnWrite(Regs + VirtioBlockDevice::QueueNotifyOffset, 0));
+  }
+
+  Core::Byte ReadStatus() {
+    std::array<Core::Byte, 1> status{};
+    REQUIRE(bus.ReadBlock(StatusAddr, status));
+    return status[0];
+  }
+
+  /**
+   * @brief Post a request and run one tick. Returns the status byte.
+   */
+  Core::Byte Submit(BlockRequestType type, std::uint64_t sector,
+                    std::uint32_t dataLen, bool deviceWrites) {
+    Post(type, sector, dataLen, deviceWrites);
+    vblk.OnTick();
+    return ReadStatus();
+  }
+};
+} // namespace
+
+TEST_CASE("Virtio Block - Identification Registers") {
+  VirtioFixture f;
+
+  Core::Data value = 0;
+  REQUIRE(f.vblk.OnRead(Regs + VirtioBlockDevice::MagicOffset, value));
+  CHECK(value == VirtioBlockDevice::MagicValue);
+  REQUIRE(f.vblk.OnRead(Regs + VirtioBlockDevice::DeviceIdOffset, value));
+  CHECK(value == VirtioBlockDevice::BlockDeviceId);
+  REQUIRE(f.vblk.OnRead(Regs + VirtioBlockDevice::CapacityOffset, value));
+  CHECK(value == ImageSectors);
+  REQUIRE(f.vblk.OnRead(Regs + VirtioBlockDevice::DeviceFeaturesOffset,
+                        value));
+  CHECK((value & VirtioBlockDevice::FeatureFlush) != 0);
+  CHECK((value & VirtioBlockDevice::FeatureReadOnly) == 0);
+
+  // Non-power-of-two queue sizes are ignored
+  REQUIRE(f.vblk.OnWrite(Regs + VirtioBlockDevice::QueueNumOffset, 6));
+  REQUIRE(f.vblk.OnRead(Regs + VirtioBlockDevice::QueueNumOffset, value));
+  CHECK(value == QueueSize);
+}
+
+TEST_CASE("Virtio Block - Read, Write And Flush Requests") {
+  VirtioFixture f;
+
+  // Read sectors 2-3 straight from the image
+  REQUIRE(f.Submit(BlockRequestType::In, 2, 1024, true) == 0);
+  std::array<Core::Byte, 1024> data{};
+  REQUIRE(f.bus.ReadBlock(DataAddr, data));
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    REQUIRE(data[i] == ImageByte(1024 + i));
+  }
+
+  // Used ring: one element for head 0, length = data + status byte
+  std::array<Core::Byte, 12> used{};
+  REQUIRE(f.bus.ReadBlock(UsedRing, used));
+  CHECK(used[2] == 1);
+  CHECK(used[4] == 0);
+  CHECK((used[8] | (used[9] << 8)) == 1025);
+
+  Core::Data irq = 0;
+  REQUIRE(f.vblk.OnRead(Regs + VirtioBlockDevice::InterruptStatusOffset, irq));
+  CHECK(irq == 1);
+  CHECK(f.pic.GetPendingIrqNumber() ==
+        Peripherals::PicDevice::IrqVirtioBlock);
+  REQUIRE(f.vblk.OnWrite(Regs + VirtioBlockDevice::InterruptAckOffset, 1));
+  REQUIRE(f.vblk.OnRead(Regs + VirtioBlockDevice::InterruptStatusOffset, irq));
+  CHECK(irq == 0);
+
+  // Write sector 10, flush, and check the host file
+  data.fill(0xA5);
+  REQUIRE(f.bus.WriteBlock(DataAddr, std::span(data.data(), 512)));
+  REQUIRE(f.Submit(BlockRequestType::Out, 10, 512, false) == 0);
+  REQUIRE(f.Submit(BlockRequestType::Flush, 0, 0, false) == 0);
+  CHECK(f.vblk.GetCompletedRequests() == 3);
+
+  std::ifstream in(f.image, std::ios::binary);
+  in.seekg(10 * 512 - 1);
+  std::array<char, 514> check{};
+  in.read(check.data(), check.size());
+  CHECK(static_cast<Core::Byte>(check[0]) == ImageByte(10 * 512 - 1));
+  CHECK(static_cast<Core::Byte>(check[1]) == 0xA5);
+  CHECK(static_cast<Core::Byte>(check[512]) == 0xA5);
+  CHECK(static_cast<Core::Byte>(check[513]) == ImageByte(11 * 512));
+}
+
+TEST_CASE("Virtio Block - Error Statuses") {
+  SECTION("Out of range") {
+    VirtioFixture f;
+    CHECK(f.Submit(BlockRequestType::In, ImageSectors - 1, 1024, true) == 1);
+    CHECK(f.Submit(BlockRequestType::In, ImageSectors, 512, true) == 1);
+  }
+
+  SECTION("Sector whose byte offset wraps") {
+    // 2^55 + 1 sectors is byte offset 512 modulo 2^64
+    VirtioFixture f;
+    CHECK(f.Submit(BlockRequestType::In, (1ull << 55) + 1, 512, true) == 1);
+    CHECK(f.Submit(BlockRequestType::Out, (1ull << 55) + 1, 512, false) == 1);
+  }
+
+  SECTION("Read-only image rejects writes") {
+    VirtioFixture f(true);
+    Core::Data features = 0;
+    REQUIRE(f.vblk.OnRead(Regs + VirtioBlockDevice::DeviceFeaturesOffset,
+                          features));
+    CHECK((features & VirtioBlockDevice::FeatureReadOnly) != 0);
+    CHECK(f.Submit(BlockRequestType::Out, 0, 512, false) == 1);
+    CHECK(f.Submit(BlockRequestType::In, 0, 512, true) == 0);
+  }
+
+  SECTION("Unknown request type") {
+    VirtioFixture f;
+    CHECK(f.Submit(static_cast<BlockRequestType>(99), 0, 512, true) == 2);
+  }
+}
+
+TEST_CASE("Virtio Block - Async Host I/O Completes At Deadline") {
+  for (auto backend :
+       {Host::AsyncIoBackend::ThreadPool, Host::AsyncIoBackend::IoUring}) {
+    VirtioFixture f;
+    REQUIRE(f.aio.Start(backend));
+    f.vblk.ConnectAsyncIo(&f.aio);
+    f.vblk.SetLatencyTicks(10);
+
+    f.Post(BlockRequestType::In, 4, 2048, true);
+    f.vblk.OnTick(); // Doorbell: host read starts
+    CHECK(f.vblk.GetOutstandingRequests() == 1);
+
+    for (int i = 0; i < 9; ++i) {
+      f.vblk.OnTick();
+      REQUIRE(f.ReadStatus() == 0xFF); // Not before the deadline
+    }
+    f.vblk.OnTick();
+    REQUIRE(f.ReadStatus() == 0);
+    CHECK(f.vblk.GetOutstandingRequests() == 0);
+    CHECK(f.pic.GetPendingIrqNumber() ==
+          Peripherals::PicDevice::IrqVirtioBlock);
+
+    std::array<Core::Byte, 2048> data{};
+    REQUIRE(f.bus.ReadBlock(DataAddr, data));
+    CHECK(data[0] == ImageByte(4 * 512));
+    CHECK(data[2047] == ImageByte(4 * 512 + 2047));
+  }
+}
+
+TEST_CASE("Virtio Block - Free-Running Completion Waits For Host") {
+  VirtioFixture f;
+  REQUIRE(f.aio.Start(Host::AsyncIoBackend::ThreadPool));
+  f.vblk.ConnectAsyncIo(&f.aio);
+  f.vblk.SetDeterministic(false);
+
+  std::array<Core::Byte, 512> data{};
+  data.fill(0x5A);
+  REQUIRE(f.bus.WriteBlock(DataAddr, data));
+  f.Post(BlockRequestType::Out, 1, 512, false);
+
+  // Latency 0: completes on whichever tick first sees the host result
+  int ticks = 0;
+  while (f.ReadStatus() == 0xFF && ticks < 100000) {
+    f.vblk.OnTick();
+    ticks++;
+  }
+  REQUIRE(f.ReadStatus() == 0);
+  CHECK(f.vblk.GetCompletedRequests() == 1);
+
+  std::ifstream in(f.image, std::ios::binary);
+  in.seekg(512);
+  CHECK(in.get() == 0x5A);
+}